@@ -61,6 +61,13 @@
  */
 #define CRC16CCITT_POLYNOM  (0x1021)
 
+#ifdef CRC16CCITT_SLICING
+
+/** Number of bytes, which are processed at once by the slicing algorithm. */
+#define CRC16CCITT_SLICING_NUM  (8u)
+
+#endif  /* CRC16CCITT_SLICING */
+
 /*******************************************************************************
     MACROS
 *******************************************************************************/
@@ -73,21 +80,311 @@
     PROTOTYPES
 *******************************************************************************/
 
-#ifdef CRC16CCITT_FAST
+#if defined(CRC16CCITT_SLICING)
+
+static Crc16CCITT   crc16ccitt_updateSlicing(Crc16CCITT crc, const uint8_t *data, size_t size);
+
+#elif defined(CRC16CCITT_FAST)
 
 static Crc16CCITT   crc16ccitt_updateFast(Crc16CCITT crc, const uint8_t *data, size_t size);
 
-#else   /* Not defined CRC16CCITT_FAST */
+#elif defined(CRC16CCITT_NIBBLE)
+
+static Crc16CCITT   crc16ccitt_updateNibble(Crc16CCITT crc, const uint8_t *data, size_t size);
+
+#else   /* Bit by bit algorithm */
 
 static Crc16CCITT   crc16ccitt_updateAlgo(Crc16CCITT crc, const uint8_t *data, size_t size);
 
-#endif  /* Not defined CRC16CCITT_FAST */
+#endif  /* Bit by bit algorithm */
 
 /*******************************************************************************
     LOCALE VARIABLES
 *******************************************************************************/
 
-#ifdef CRC16CCITT_FAST
+#if defined(CRC16CCITT_SLICING)
+
+/**
+ * Static tables used for the slicing-by-8 implementation.
+ * The table at index k contains the CRC of a byte, which is followed by k
+ * zero bytes. Table 0 is equal to the byte-wise table.
+ */
+static const Crc16CCITT crc_tableSlicing[CRC16CCITT_SLICING_NUM][256] = {
+    {
+        0x0000u, 0x1021u, 0x2042u, 0x3063u, 0x4084u, 0x50a5u, 0x60c6u, 0x70e7u,
+        0x8108u, 0x9129u, 0xa14au, 0xb16bu, 0xc18cu, 0xd1adu, 0xe1ceu, 0xf1efu,
+        0x1231u, 0x0210u, 0x3273u, 0x2252u, 0x52b5u, 0x4294u, 0x72f7u, 0x62d6u,
+        0x9339u, 0x8318u, 0xb37bu, 0xa35au, 0xd3bdu, 0xc39cu, 0xf3ffu, 0xe3deu,
+        0x2462u, 0x3443u, 0x0420u, 0x1401u, 0x64e6u, 0x74c7u, 0x44a4u, 0x5485u,
+        0xa56au, 0xb54bu, 0x8528u, 0x9509u, 0xe5eeu, 0xf5cfu, 0xc5acu, 0xd58du,
+        0x3653u, 0x2672u, 0x1611u, 0x0630u, 0x76d7u, 0x66f6u, 0x5695u, 0x46b4u,
+        0xb75bu, 0xa77au, 0x9719u, 0x8738u, 0xf7dfu, 0xe7feu, 0xd79du, 0xc7bcu,
+        0x48c4u, 0x58e5u, 0x6886u, 0x78a7u, 0x0840u, 0x1861u, 0x2802u, 0x3823u,
+        0xc9ccu, 0xd9edu, 0xe98eu, 0xf9afu, 0x8948u, 0x9969u, 0xa90au, 0xb92bu,
+        0x5af5u, 0x4ad4u, 0x7ab7u, 0x6a96u, 0x1a71u, 0x0a50u, 0x3a33u, 0x2a12u,
+        0xdbfdu, 0xcbdcu, 0xfbbfu, 0xeb9eu, 0x9b79u, 0x8b58u, 0xbb3bu, 0xab1au,
+        0x6ca6u, 0x7c87u, 0x4ce4u, 0x5cc5u, 0x2c22u, 0x3c03u, 0x0c60u, 0x1c41u,
+        0xedaeu, 0xfd8fu, 0xcdecu, 0xddcdu, 0xad2au, 0xbd0bu, 0x8d68u, 0x9d49u,
+        0x7e97u, 0x6eb6u, 0x5ed5u, 0x4ef4u, 0x3e13u, 0x2e32u, 0x1e51u, 0x0e70u,
+        0xff9fu, 0xefbeu, 0xdfddu, 0xcffcu, 0xbf1bu, 0xaf3au, 0x9f59u, 0x8f78u,
+        0x9188u, 0x81a9u, 0xb1cau, 0xa1ebu, 0xd10cu, 0xc12du, 0xf14eu, 0xe16fu,
+        0x1080u, 0x00a1u, 0x30c2u, 0x20e3u, 0x5004u, 0x4025u, 0x7046u, 0x6067u,
+        0x83b9u, 0x9398u, 0xa3fbu, 0xb3dau, 0xc33du, 0xd31cu, 0xe37fu, 0xf35eu,
+        0x02b1u, 0x1290u, 0x22f3u, 0x32d2u, 0x4235u, 0x5214u, 0x6277u, 0x7256u,
+        0xb5eau, 0xa5cbu, 0x95a8u, 0x8589u, 0xf56eu, 0xe54fu, 0xd52cu, 0xc50du,
+        0x34e2u, 0x24c3u, 0x14a0u, 0x0481u, 0x7466u, 0x6447u, 0x5424u, 0x4405u,
+        0xa7dbu, 0xb7fau, 0x8799u, 0x97b8u, 0xe75fu, 0xf77eu, 0xc71du, 0xd73cu,
+        0x26d3u, 0x36f2u, 0x0691u, 0x16b0u, 0x6657u, 0x7676u, 0x4615u, 0x5634u,
+        0xd94cu, 0xc96du, 0xf90eu, 0xe92fu, 0x99c8u, 0x89e9u, 0xb98au, 0xa9abu,
+        0x5844u, 0x4865u, 0x7806u, 0x6827u, 0x18c0u, 0x08e1u, 0x3882u, 0x28a3u,
+        0xcb7du, 0xdb5cu, 0xeb3fu, 0xfb1eu, 0x8bf9u, 0x9bd8u, 0xabbbu, 0xbb9au,
+        0x4a75u, 0x5a54u, 0x6a37u, 0x7a16u, 0x0af1u, 0x1ad0u, 0x2ab3u, 0x3a92u,
+        0xfd2eu, 0xed0fu, 0xdd6cu, 0xcd4du, 0xbdaau, 0xad8bu, 0x9de8u, 0x8dc9u,
+        0x7c26u, 0x6c07u, 0x5c64u, 0x4c45u, 0x3ca2u, 0x2c83u, 0x1ce0u, 0x0cc1u,
+        0xef1fu, 0xff3eu, 0xcf5du, 0xdf7cu, 0xaf9bu, 0xbfbau, 0x8fd9u, 0x9ff8u,
+        0x6e17u, 0x7e36u, 0x4e55u, 0x5e74u, 0x2e93u, 0x3eb2u, 0x0ed1u, 0x1ef0u
+    },
+    {
+        0x0000u, 0x3331u, 0x6662u, 0x5553u, 0xccc4u, 0xfff5u, 0xaaa6u, 0x9997u,
+        0x89a9u, 0xba98u, 0xefcbu, 0xdcfau, 0x456du, 0x765cu, 0x230fu, 0x103eu,
+        0x0373u, 0x3042u, 0x6511u, 0x5620u, 0xcfb7u, 0xfc86u, 0xa9d5u, 0x9ae4u,
+        0x8adau, 0xb9ebu, 0xecb8u, 0xdf89u, 0x461eu, 0x752fu, 0x207cu, 0x134du,
+        0x06e6u, 0x35d7u, 0x6084u, 0x53b5u, 0xca22u, 0xf913u, 0xac40u, 0x9f71u,
+        0x8f4fu, 0xbc7eu, 0xe92du, 0xda1cu, 0x438bu, 0x70bau, 0x25e9u, 0x16d8u,
+        0x0595u, 0x36a4u, 0x63f7u, 0x50c6u, 0xc951u, 0xfa60u, 0xaf33u, 0x9c02u,
+        0x8c3cu, 0xbf0du, 0xea5eu, 0xd96fu, 0x40f8u, 0x73c9u, 0x269au, 0x15abu,
+        0x0dccu, 0x3efdu, 0x6baeu, 0x589fu, 0xc108u, 0xf239u, 0xa76au, 0x945bu,
+        0x8465u, 0xb754u, 0xe207u, 0xd136u, 0x48a1u, 0x7b90u, 0x2ec3u, 0x1df2u,
+        0x0ebfu, 0x3d8eu, 0x68ddu, 0x5becu, 0xc27bu, 0xf14au, 0xa419u, 0x9728u,
+        0x8716u, 0xb427u, 0xe174u, 0xd245u, 0x4bd2u, 0x78e3u, 0x2db0u, 0x1e81u,
+        0x0b2au, 0x381bu, 0x6d48u, 0x5e79u, 0xc7eeu, 0xf4dfu, 0xa18cu, 0x92bdu,
+        0x8283u, 0xb1b2u, 0xe4e1u, 0xd7d0u, 0x4e47u, 0x7d76u, 0x2825u, 0x1b14u,
+        0x0859u, 0x3b68u, 0x6e3bu, 0x5d0au, 0xc49du, 0xf7acu, 0xa2ffu, 0x91ceu,
+        0x81f0u, 0xb2c1u, 0xe792u, 0xd4a3u, 0x4d34u, 0x7e05u, 0x2b56u, 0x1867u,
+        0x1b98u, 0x28a9u, 0x7dfau, 0x4ecbu, 0xd75cu, 0xe46du, 0xb13eu, 0x820fu,
+        0x9231u, 0xa100u, 0xf453u, 0xc762u, 0x5ef5u, 0x6dc4u, 0x3897u, 0x0ba6u,
+        0x18ebu, 0x2bdau, 0x7e89u, 0x4db8u, 0xd42fu, 0xe71eu, 0xb24du, 0x817cu,
+        0x9142u, 0xa273u, 0xf720u, 0xc411u, 0x5d86u, 0x6eb7u, 0x3be4u, 0x08d5u,
+        0x1d7eu, 0x2e4fu, 0x7b1cu, 0x482du, 0xd1bau, 0xe28bu, 0xb7d8u, 0x84e9u,
+        0x94d7u, 0xa7e6u, 0xf2b5u, 0xc184u, 0x5813u, 0x6b22u, 0x3e71u, 0x0d40u,
+        0x1e0du, 0x2d3cu, 0x786fu, 0x4b5eu, 0xd2c9u, 0xe1f8u, 0xb4abu, 0x879au,
+        0x97a4u, 0xa495u, 0xf1c6u, 0xc2f7u, 0x5b60u, 0x6851u, 0x3d02u, 0x0e33u,
+        0x1654u, 0x2565u, 0x7036u, 0x4307u, 0xda90u, 0xe9a1u, 0xbcf2u, 0x8fc3u,
+        0x9ffdu, 0xacccu, 0xf99fu, 0xcaaeu, 0x5339u, 0x6008u, 0x355bu, 0x066au,
+        0x1527u, 0x2616u, 0x7345u, 0x4074u, 0xd9e3u, 0xead2u, 0xbf81u, 0x8cb0u,
+        0x9c8eu, 0xafbfu, 0xfaecu, 0xc9ddu, 0x504au, 0x637bu, 0x3628u, 0x0519u,
+        0x10b2u, 0x2383u, 0x76d0u, 0x45e1u, 0xdc76u, 0xef47u, 0xba14u, 0x8925u,
+        0x991bu, 0xaa2au, 0xff79u, 0xcc48u, 0x55dfu, 0x66eeu, 0x33bdu, 0x008cu,
+        0x13c1u, 0x20f0u, 0x75a3u, 0x4692u, 0xdf05u, 0xec34u, 0xb967u, 0x8a56u,
+        0x9a68u, 0xa959u, 0xfc0au, 0xcf3bu, 0x56acu, 0x659du, 0x30ceu, 0x03ffu
+    },
+    {
+        0x0000u, 0x3730u, 0x6e60u, 0x5950u, 0xdcc0u, 0xebf0u, 0xb2a0u, 0x8590u,
+        0xa9a1u, 0x9e91u, 0xc7c1u, 0xf0f1u, 0x7561u, 0x4251u, 0x1b01u, 0x2c31u,
+        0x4363u, 0x7453u, 0x2d03u, 0x1a33u, 0x9fa3u, 0xa893u, 0xf1c3u, 0xc6f3u,
+        0xeac2u, 0xddf2u, 0x84a2u, 0xb392u, 0x3602u, 0x0132u, 0x5862u, 0x6f52u,
+        0x86c6u, 0xb1f6u, 0xe8a6u, 0xdf96u, 0x5a06u, 0x6d36u, 0x3466u, 0x0356u,
+        0x2f67u, 0x1857u, 0x4107u, 0x7637u, 0xf3a7u, 0xc497u, 0x9dc7u, 0xaaf7u,
+        0xc5a5u, 0xf295u, 0xabc5u, 0x9cf5u, 0x1965u, 0x2e55u, 0x7705u, 0x4035u,
+        0x6c04u, 0x5b34u, 0x0264u, 0x3554u, 0xb0c4u, 0x87f4u, 0xdea4u, 0xe994u,
+        0x1dadu, 0x2a9du, 0x73cdu, 0x44fdu, 0xc16du, 0xf65du, 0xaf0du, 0x983du,
+        0xb40cu, 0x833cu, 0xda6cu, 0xed5cu, 0x68ccu, 0x5ffcu, 0x06acu, 0x319cu,
+        0x5eceu, 0x69feu, 0x30aeu, 0x079eu, 0x820eu, 0xb53eu, 0xec6eu, 0xdb5eu,
+        0xf76fu, 0xc05fu, 0x990fu, 0xae3fu, 0x2bafu, 0x1c9fu, 0x45cfu, 0x72ffu,
+        0x9b6bu, 0xac5bu, 0xf50bu, 0xc23bu, 0x47abu, 0x709bu, 0x29cbu, 0x1efbu,
+        0x32cau, 0x05fau, 0x5caau, 0x6b9au, 0xee0au, 0xd93au, 0x806au, 0xb75au,
+        0xd808u, 0xef38u, 0xb668u, 0x8158u, 0x04c8u, 0x33f8u, 0x6aa8u, 0x5d98u,
+        0x71a9u, 0x4699u, 0x1fc9u, 0x28f9u, 0xad69u, 0x9a59u, 0xc309u, 0xf439u,
+        0x3b5au, 0x0c6au, 0x553au, 0x620au, 0xe79au, 0xd0aau, 0x89fau, 0xbecau,
+        0x92fbu, 0xa5cbu, 0xfc9bu, 0xcbabu, 0x4e3bu, 0x790bu, 0x205bu, 0x176bu,
+        0x7839u, 0x4f09u, 0x1659u, 0x2169u, 0xa4f9u, 0x93c9u, 0xca99u, 0xfda9u,
+        0xd198u, 0xe6a8u, 0xbff8u, 0x88c8u, 0x0d58u, 0x3a68u, 0x6338u, 0x5408u,
+        0xbd9cu, 0x8aacu, 0xd3fcu, 0xe4ccu, 0x615cu, 0x566cu, 0x0f3cu, 0x380cu,
+        0x143du, 0x230du, 0x7a5du, 0x4d6du, 0xc8fdu, 0xffcdu, 0xa69du, 0x91adu,
+        0xfeffu, 0xc9cfu, 0x909fu, 0xa7afu, 0x223fu, 0x150fu, 0x4c5fu, 0x7b6fu,
+        0x575eu, 0x606eu, 0x393eu, 0x0e0eu, 0x8b9eu, 0xbcaeu, 0xe5feu, 0xd2ceu,
+        0x26f7u, 0x11c7u, 0x4897u, 0x7fa7u, 0xfa37u, 0xcd07u, 0x9457u, 0xa367u,
+        0x8f56u, 0xb866u, 0xe136u, 0xd606u, 0x5396u, 0x64a6u, 0x3df6u, 0x0ac6u,
+        0x6594u, 0x52a4u, 0x0bf4u, 0x3cc4u, 0xb954u, 0x8e64u, 0xd734u, 0xe004u,
+        0xcc35u, 0xfb05u, 0xa255u, 0x9565u, 0x10f5u, 0x27c5u, 0x7e95u, 0x49a5u,
+        0xa031u, 0x9701u, 0xce51u, 0xf961u, 0x7cf1u, 0x4bc1u, 0x1291u, 0x25a1u,
+        0x0990u, 0x3ea0u, 0x67f0u, 0x50c0u, 0xd550u, 0xe260u, 0xbb30u, 0x8c00u,
+        0xe352u, 0xd462u, 0x8d32u, 0xba02u, 0x3f92u, 0x08a2u, 0x51f2u, 0x66c2u,
+        0x4af3u, 0x7dc3u, 0x2493u, 0x13a3u, 0x9633u, 0xa103u, 0xf853u, 0xcf63u
+    },
+    {
+        0x0000u, 0x76b4u, 0xed68u, 0x9bdcu, 0xcaf1u, 0xbc45u, 0x2799u, 0x512du,
+        0x85c3u, 0xf377u, 0x68abu, 0x1e1fu, 0x4f32u, 0x3986u, 0xa25au, 0xd4eeu,
+        0x1ba7u, 0x6d13u, 0xf6cfu, 0x807bu, 0xd156u, 0xa7e2u, 0x3c3eu, 0x4a8au,
+        0x9e64u, 0xe8d0u, 0x730cu, 0x05b8u, 0x5495u, 0x2221u, 0xb9fdu, 0xcf49u,
+        0x374eu, 0x41fau, 0xda26u, 0xac92u, 0xfdbfu, 0x8b0bu, 0x10d7u, 0x6663u,
+        0xb28du, 0xc439u, 0x5fe5u, 0x2951u, 0x787cu, 0x0ec8u, 0x9514u, 0xe3a0u,
+        0x2ce9u, 0x5a5du, 0xc181u, 0xb735u, 0xe618u, 0x90acu, 0x0b70u, 0x7dc4u,
+        0xa92au, 0xdf9eu, 0x4442u, 0x32f6u, 0x63dbu, 0x156fu, 0x8eb3u, 0xf807u,
+        0x6e9cu, 0x1828u, 0x83f4u, 0xf540u, 0xa46du, 0xd2d9u, 0x4905u, 0x3fb1u,
+        0xeb5fu, 0x9debu, 0x0637u, 0x7083u, 0x21aeu, 0x571au, 0xccc6u, 0xba72u,
+        0x753bu, 0x038fu, 0x9853u, 0xeee7u, 0xbfcau, 0xc97eu, 0x52a2u, 0x2416u,
+        0xf0f8u, 0x864cu, 0x1d90u, 0x6b24u, 0x3a09u, 0x4cbdu, 0xd761u, 0xa1d5u,
+        0x59d2u, 0x2f66u, 0xb4bau, 0xc20eu, 0x9323u, 0xe597u, 0x7e4bu, 0x08ffu,
+        0xdc11u, 0xaaa5u, 0x3179u, 0x47cdu, 0x16e0u, 0x6054u, 0xfb88u, 0x8d3cu,
+        0x4275u, 0x34c1u, 0xaf1du, 0xd9a9u, 0x8884u, 0xfe30u, 0x65ecu, 0x1358u,
+        0xc7b6u, 0xb102u, 0x2adeu, 0x5c6au, 0x0d47u, 0x7bf3u, 0xe02fu, 0x969bu,
+        0xdd38u, 0xab8cu, 0x3050u, 0x46e4u, 0x17c9u, 0x617du, 0xfaa1u, 0x8c15u,
+        0x58fbu, 0x2e4fu, 0xb593u, 0xc327u, 0x920au, 0xe4beu, 0x7f62u, 0x09d6u,
+        0xc69fu, 0xb02bu, 0x2bf7u, 0x5d43u, 0x0c6eu, 0x7adau, 0xe106u, 0x97b2u,
+        0x435cu, 0x35e8u, 0xae34u, 0xd880u, 0x89adu, 0xff19u, 0x64c5u, 0x1271u,
+        0xea76u, 0x9cc2u, 0x071eu, 0x71aau, 0x2087u, 0x5633u, 0xcdefu, 0xbb5bu,
+        0x6fb5u, 0x1901u, 0x82ddu, 0xf469u, 0xa544u, 0xd3f0u, 0x482cu, 0x3e98u,
+        0xf1d1u, 0x8765u, 0x1cb9u, 0x6a0du, 0x3b20u, 0x4d94u, 0xd648u, 0xa0fcu,
+        0x7412u, 0x02a6u, 0x997au, 0xefceu, 0xbee3u, 0xc857u, 0x538bu, 0x253fu,
+        0xb3a4u, 0xc510u, 0x5eccu, 0x2878u, 0x7955u, 0x0fe1u, 0x943du, 0xe289u,
+        0x3667u, 0x40d3u, 0xdb0fu, 0xadbbu, 0xfc96u, 0x8a22u, 0x11feu, 0x674au,
+        0xa803u, 0xdeb7u, 0x456bu, 0x33dfu, 0x62f2u, 0x1446u, 0x8f9au, 0xf92eu,
+        0x2dc0u, 0x5b74u, 0xc0a8u, 0xb61cu, 0xe731u, 0x9185u, 0x0a59u, 0x7cedu,
+        0x84eau, 0xf25eu, 0x6982u, 0x1f36u, 0x4e1bu, 0x38afu, 0xa373u, 0xd5c7u,
+        0x0129u, 0x779du, 0xec41u, 0x9af5u, 0xcbd8u, 0xbd6cu, 0x26b0u, 0x5004u,
+        0x9f4du, 0xe9f9u, 0x7225u, 0x0491u, 0x55bcu, 0x2308u, 0xb8d4u, 0xce60u,
+        0x1a8eu, 0x6c3au, 0xf7e6u, 0x8152u, 0xd07fu, 0xa6cbu, 0x3d17u, 0x4ba3u
+    },
+    {
+        0x0000u, 0xaa51u, 0x4483u, 0xeed2u, 0x8906u, 0x2357u, 0xcd85u, 0x67d4u,
+        0x022du, 0xa87cu, 0x46aeu, 0xecffu, 0x8b2bu, 0x217au, 0xcfa8u, 0x65f9u,
+        0x045au, 0xae0bu, 0x40d9u, 0xea88u, 0x8d5cu, 0x270du, 0xc9dfu, 0x638eu,
+        0x0677u, 0xac26u, 0x42f4u, 0xe8a5u, 0x8f71u, 0x2520u, 0xcbf2u, 0x61a3u,
+        0x08b4u, 0xa2e5u, 0x4c37u, 0xe666u, 0x81b2u, 0x2be3u, 0xc531u, 0x6f60u,
+        0x0a99u, 0xa0c8u, 0x4e1au, 0xe44bu, 0x839fu, 0x29ceu, 0xc71cu, 0x6d4du,
+        0x0ceeu, 0xa6bfu, 0x486du, 0xe23cu, 0x85e8u, 0x2fb9u, 0xc16bu, 0x6b3au,
+        0x0ec3u, 0xa492u, 0x4a40u, 0xe011u, 0x87c5u, 0x2d94u, 0xc346u, 0x6917u,
+        0x1168u, 0xbb39u, 0x55ebu, 0xffbau, 0x986eu, 0x323fu, 0xdcedu, 0x76bcu,
+        0x1345u, 0xb914u, 0x57c6u, 0xfd97u, 0x9a43u, 0x3012u, 0xdec0u, 0x7491u,
+        0x1532u, 0xbf63u, 0x51b1u, 0xfbe0u, 0x9c34u, 0x3665u, 0xd8b7u, 0x72e6u,
+        0x171fu, 0xbd4eu, 0x539cu, 0xf9cdu, 0x9e19u, 0x3448u, 0xda9au, 0x70cbu,
+        0x19dcu, 0xb38du, 0x5d5fu, 0xf70eu, 0x90dau, 0x3a8bu, 0xd459u, 0x7e08u,
+        0x1bf1u, 0xb1a0u, 0x5f72u, 0xf523u, 0x92f7u, 0x38a6u, 0xd674u, 0x7c25u,
+        0x1d86u, 0xb7d7u, 0x5905u, 0xf354u, 0x9480u, 0x3ed1u, 0xd003u, 0x7a52u,
+        0x1fabu, 0xb5fau, 0x5b28u, 0xf179u, 0x96adu, 0x3cfcu, 0xd22eu, 0x787fu,
+        0x22d0u, 0x8881u, 0x6653u, 0xcc02u, 0xabd6u, 0x0187u, 0xef55u, 0x4504u,
+        0x20fdu, 0x8aacu, 0x647eu, 0xce2fu, 0xa9fbu, 0x03aau, 0xed78u, 0x4729u,
+        0x268au, 0x8cdbu, 0x6209u, 0xc858u, 0xaf8cu, 0x05ddu, 0xeb0fu, 0x415eu,
+        0x24a7u, 0x8ef6u, 0x6024u, 0xca75u, 0xada1u, 0x07f0u, 0xe922u, 0x4373u,
+        0x2a64u, 0x8035u, 0x6ee7u, 0xc4b6u, 0xa362u, 0x0933u, 0xe7e1u, 0x4db0u,
+        0x2849u, 0x8218u, 0x6ccau, 0xc69bu, 0xa14fu, 0x0b1eu, 0xe5ccu, 0x4f9du,
+        0x2e3eu, 0x846fu, 0x6abdu, 0xc0ecu, 0xa738u, 0x0d69u, 0xe3bbu, 0x49eau,
+        0x2c13u, 0x8642u, 0x6890u, 0xc2c1u, 0xa515u, 0x0f44u, 0xe196u, 0x4bc7u,
+        0x33b8u, 0x99e9u, 0x773bu, 0xdd6au, 0xbabeu, 0x10efu, 0xfe3du, 0x546cu,
+        0x3195u, 0x9bc4u, 0x7516u, 0xdf47u, 0xb893u, 0x12c2u, 0xfc10u, 0x5641u,
+        0x37e2u, 0x9db3u, 0x7361u, 0xd930u, 0xbee4u, 0x14b5u, 0xfa67u, 0x5036u,
+        0x35cfu, 0x9f9eu, 0x714cu, 0xdb1du, 0xbcc9u, 0x1698u, 0xf84au, 0x521bu,
+        0x3b0cu, 0x915du, 0x7f8fu, 0xd5deu, 0xb20au, 0x185bu, 0xf689u, 0x5cd8u,
+        0x3921u, 0x9370u, 0x7da2u, 0xd7f3u, 0xb027u, 0x1a76u, 0xf4a4u, 0x5ef5u,
+        0x3f56u, 0x9507u, 0x7bd5u, 0xd184u, 0xb650u, 0x1c01u, 0xf2d3u, 0x5882u,
+        0x3d7bu, 0x972au, 0x79f8u, 0xd3a9u, 0xb47du, 0x1e2cu, 0xf0feu, 0x5aafu
+    },
+    {
+        0x0000u, 0x45a0u, 0x8b40u, 0xcee0u, 0x06a1u, 0x4301u, 0x8de1u, 0xc841u,
+        0x0d42u, 0x48e2u, 0x8602u, 0xc3a2u, 0x0be3u, 0x4e43u, 0x80a3u, 0xc503u,
+        0x1a84u, 0x5f24u, 0x91c4u, 0xd464u, 0x1c25u, 0x5985u, 0x9765u, 0xd2c5u,
+        0x17c6u, 0x5266u, 0x9c86u, 0xd926u, 0x1167u, 0x54c7u, 0x9a27u, 0xdf87u,
+        0x3508u, 0x70a8u, 0xbe48u, 0xfbe8u, 0x33a9u, 0x7609u, 0xb8e9u, 0xfd49u,
+        0x384au, 0x7deau, 0xb30au, 0xf6aau, 0x3eebu, 0x7b4bu, 0xb5abu, 0xf00bu,
+        0x2f8cu, 0x6a2cu, 0xa4ccu, 0xe16cu, 0x292du, 0x6c8du, 0xa26du, 0xe7cdu,
+        0x22ceu, 0x676eu, 0xa98eu, 0xec2eu, 0x246fu, 0x61cfu, 0xaf2fu, 0xea8fu,
+        0x6a10u, 0x2fb0u, 0xe150u, 0xa4f0u, 0x6cb1u, 0x2911u, 0xe7f1u, 0xa251u,
+        0x6752u, 0x22f2u, 0xec12u, 0xa9b2u, 0x61f3u, 0x2453u, 0xeab3u, 0xaf13u,
+        0x7094u, 0x3534u, 0xfbd4u, 0xbe74u, 0x7635u, 0x3395u, 0xfd75u, 0xb8d5u,
+        0x7dd6u, 0x3876u, 0xf696u, 0xb336u, 0x7b77u, 0x3ed7u, 0xf037u, 0xb597u,
+        0x5f18u, 0x1ab8u, 0xd458u, 0x91f8u, 0x59b9u, 0x1c19u, 0xd2f9u, 0x9759u,
+        0x525au, 0x17fau, 0xd91au, 0x9cbau, 0x54fbu, 0x115bu, 0xdfbbu, 0x9a1bu,
+        0x459cu, 0x003cu, 0xcedcu, 0x8b7cu, 0x433du, 0x069du, 0xc87du, 0x8dddu,
+        0x48deu, 0x0d7eu, 0xc39eu, 0x863eu, 0x4e7fu, 0x0bdfu, 0xc53fu, 0x809fu,
+        0xd420u, 0x9180u, 0x5f60u, 0x1ac0u, 0xd281u, 0x9721u, 0x59c1u, 0x1c61u,
+        0xd962u, 0x9cc2u, 0x5222u, 0x1782u, 0xdfc3u, 0x9a63u, 0x5483u, 0x1123u,
+        0xcea4u, 0x8b04u, 0x45e4u, 0x0044u, 0xc805u, 0x8da5u, 0x4345u, 0x06e5u,
+        0xc3e6u, 0x8646u, 0x48a6u, 0x0d06u, 0xc547u, 0x80e7u, 0x4e07u, 0x0ba7u,
+        0xe128u, 0xa488u, 0x6a68u, 0x2fc8u, 0xe789u, 0xa229u, 0x6cc9u, 0x2969u,
+        0xec6au, 0xa9cau, 0x672au, 0x228au, 0xeacbu, 0xaf6bu, 0x618bu, 0x242bu,
+        0xfbacu, 0xbe0cu, 0x70ecu, 0x354cu, 0xfd0du, 0xb8adu, 0x764du, 0x33edu,
+        0xf6eeu, 0xb34eu, 0x7daeu, 0x380eu, 0xf04fu, 0xb5efu, 0x7b0fu, 0x3eafu,
+        0xbe30u, 0xfb90u, 0x3570u, 0x70d0u, 0xb891u, 0xfd31u, 0x33d1u, 0x7671u,
+        0xb372u, 0xf6d2u, 0x3832u, 0x7d92u, 0xb5d3u, 0xf073u, 0x3e93u, 0x7b33u,
+        0xa4b4u, 0xe114u, 0x2ff4u, 0x6a54u, 0xa215u, 0xe7b5u, 0x2955u, 0x6cf5u,
+        0xa9f6u, 0xec56u, 0x22b6u, 0x6716u, 0xaf57u, 0xeaf7u, 0x2417u, 0x61b7u,
+        0x8b38u, 0xce98u, 0x0078u, 0x45d8u, 0x8d99u, 0xc839u, 0x06d9u, 0x4379u,
+        0x867au, 0xc3dau, 0x0d3au, 0x489au, 0x80dbu, 0xc57bu, 0x0b9bu, 0x4e3bu,
+        0x91bcu, 0xd41cu, 0x1afcu, 0x5f5cu, 0x971du, 0xd2bdu, 0x1c5du, 0x59fdu,
+        0x9cfeu, 0xd95eu, 0x17beu, 0x521eu, 0x9a5fu, 0xdfffu, 0x111fu, 0x54bfu
+    },
+    {
+        0x0000u, 0xb861u, 0x60e3u, 0xd882u, 0xc1c6u, 0x79a7u, 0xa125u, 0x1944u,
+        0x93adu, 0x2bccu, 0xf34eu, 0x4b2fu, 0x526bu, 0xea0au, 0x3288u, 0x8ae9u,
+        0x377bu, 0x8f1au, 0x5798u, 0xeff9u, 0xf6bdu, 0x4edcu, 0x965eu, 0x2e3fu,
+        0xa4d6u, 0x1cb7u, 0xc435u, 0x7c54u, 0x6510u, 0xdd71u, 0x05f3u, 0xbd92u,
+        0x6ef6u, 0xd697u, 0x0e15u, 0xb674u, 0xaf30u, 0x1751u, 0xcfd3u, 0x77b2u,
+        0xfd5bu, 0x453au, 0x9db8u, 0x25d9u, 0x3c9du, 0x84fcu, 0x5c7eu, 0xe41fu,
+        0x598du, 0xe1ecu, 0x396eu, 0x810fu, 0x984bu, 0x202au, 0xf8a8u, 0x40c9u,
+        0xca20u, 0x7241u, 0xaac3u, 0x12a2u, 0x0be6u, 0xb387u, 0x6b05u, 0xd364u,
+        0xddecu, 0x658du, 0xbd0fu, 0x056eu, 0x1c2au, 0xa44bu, 0x7cc9u, 0xc4a8u,
+        0x4e41u, 0xf620u, 0x2ea2u, 0x96c3u, 0x8f87u, 0x37e6u, 0xef64u, 0x5705u,
+        0xea97u, 0x52f6u, 0x8a74u, 0x3215u, 0x2b51u, 0x9330u, 0x4bb2u, 0xf3d3u,
+        0x793au, 0xc15bu, 0x19d9u, 0xa1b8u, 0xb8fcu, 0x009du, 0xd81fu, 0x607eu,
+        0xb31au, 0x0b7bu, 0xd3f9u, 0x6b98u, 0x72dcu, 0xcabdu, 0x123fu, 0xaa5eu,
+        0x20b7u, 0x98d6u, 0x4054u, 0xf835u, 0xe171u, 0x5910u, 0x8192u, 0x39f3u,
+        0x8461u, 0x3c00u, 0xe482u, 0x5ce3u, 0x45a7u, 0xfdc6u, 0x2544u, 0x9d25u,
+        0x17ccu, 0xafadu, 0x772fu, 0xcf4eu, 0xd60au, 0x6e6bu, 0xb6e9u, 0x0e88u,
+        0xabf9u, 0x1398u, 0xcb1au, 0x737bu, 0x6a3fu, 0xd25eu, 0x0adcu, 0xb2bdu,
+        0x3854u, 0x8035u, 0x58b7u, 0xe0d6u, 0xf992u, 0x41f3u, 0x9971u, 0x2110u,
+        0x9c82u, 0x24e3u, 0xfc61u, 0x4400u, 0x5d44u, 0xe525u, 0x3da7u, 0x85c6u,
+        0x0f2fu, 0xb74eu, 0x6fccu, 0xd7adu, 0xcee9u, 0x7688u, 0xae0au, 0x166bu,
+        0xc50fu, 0x7d6eu, 0xa5ecu, 0x1d8du, 0x04c9u, 0xbca8u, 0x642au, 0xdc4bu,
+        0x56a2u, 0xeec3u, 0x3641u, 0x8e20u, 0x9764u, 0x2f05u, 0xf787u, 0x4fe6u,
+        0xf274u, 0x4a15u, 0x9297u, 0x2af6u, 0x33b2u, 0x8bd3u, 0x5351u, 0xeb30u,
+        0x61d9u, 0xd9b8u, 0x013au, 0xb95bu, 0xa01fu, 0x187eu, 0xc0fcu, 0x789du,
+        0x7615u, 0xce74u, 0x16f6u, 0xae97u, 0xb7d3u, 0x0fb2u, 0xd730u, 0x6f51u,
+        0xe5b8u, 0x5dd9u, 0x855bu, 0x3d3au, 0x247eu, 0x9c1fu, 0x449du, 0xfcfcu,
+        0x416eu, 0xf90fu, 0x218du, 0x99ecu, 0x80a8u, 0x38c9u, 0xe04bu, 0x582au,
+        0xd2c3u, 0x6aa2u, 0xb220u, 0x0a41u, 0x1305u, 0xab64u, 0x73e6u, 0xcb87u,
+        0x18e3u, 0xa082u, 0x7800u, 0xc061u, 0xd925u, 0x6144u, 0xb9c6u, 0x01a7u,
+        0x8b4eu, 0x332fu, 0xebadu, 0x53ccu, 0x4a88u, 0xf2e9u, 0x2a6bu, 0x920au,
+        0x2f98u, 0x97f9u, 0x4f7bu, 0xf71au, 0xee5eu, 0x563fu, 0x8ebdu, 0x36dcu,
+        0xbc35u, 0x0454u, 0xdcd6u, 0x64b7u, 0x7df3u, 0xc592u, 0x1d10u, 0xa571u
+    },
+    {
+        0x0000u, 0x47d3u, 0x8fa6u, 0xc875u, 0x0f6du, 0x48beu, 0x80cbu, 0xc718u,
+        0x1edau, 0x5909u, 0x917cu, 0xd6afu, 0x11b7u, 0x5664u, 0x9e11u, 0xd9c2u,
+        0x3db4u, 0x7a67u, 0xb212u, 0xf5c1u, 0x32d9u, 0x750au, 0xbd7fu, 0xfaacu,
+        0x236eu, 0x64bdu, 0xacc8u, 0xeb1bu, 0x2c03u, 0x6bd0u, 0xa3a5u, 0xe476u,
+        0x7b68u, 0x3cbbu, 0xf4ceu, 0xb31du, 0x7405u, 0x33d6u, 0xfba3u, 0xbc70u,
+        0x65b2u, 0x2261u, 0xea14u, 0xadc7u, 0x6adfu, 0x2d0cu, 0xe579u, 0xa2aau,
+        0x46dcu, 0x010fu, 0xc97au, 0x8ea9u, 0x49b1u, 0x0e62u, 0xc617u, 0x81c4u,
+        0x5806u, 0x1fd5u, 0xd7a0u, 0x9073u, 0x576bu, 0x10b8u, 0xd8cdu, 0x9f1eu,
+        0xf6d0u, 0xb103u, 0x7976u, 0x3ea5u, 0xf9bdu, 0xbe6eu, 0x761bu, 0x31c8u,
+        0xe80au, 0xafd9u, 0x67acu, 0x207fu, 0xe767u, 0xa0b4u, 0x68c1u, 0x2f12u,
+        0xcb64u, 0x8cb7u, 0x44c2u, 0x0311u, 0xc409u, 0x83dau, 0x4bafu, 0x0c7cu,
+        0xd5beu, 0x926du, 0x5a18u, 0x1dcbu, 0xdad3u, 0x9d00u, 0x5575u, 0x12a6u,
+        0x8db8u, 0xca6bu, 0x021eu, 0x45cdu, 0x82d5u, 0xc506u, 0x0d73u, 0x4aa0u,
+        0x9362u, 0xd4b1u, 0x1cc4u, 0x5b17u, 0x9c0fu, 0xdbdcu, 0x13a9u, 0x547au,
+        0xb00cu, 0xf7dfu, 0x3faau, 0x7879u, 0xbf61u, 0xf8b2u, 0x30c7u, 0x7714u,
+        0xaed6u, 0xe905u, 0x2170u, 0x66a3u, 0xa1bbu, 0xe668u, 0x2e1du, 0x69ceu,
+        0xfd81u, 0xba52u, 0x7227u, 0x35f4u, 0xf2ecu, 0xb53fu, 0x7d4au, 0x3a99u,
+        0xe35bu, 0xa488u, 0x6cfdu, 0x2b2eu, 0xec36u, 0xabe5u, 0x6390u, 0x2443u,
+        0xc035u, 0x87e6u, 0x4f93u, 0x0840u, 0xcf58u, 0x888bu, 0x40feu, 0x072du,
+        0xdeefu, 0x993cu, 0x5149u, 0x169au, 0xd182u, 0x9651u, 0x5e24u, 0x19f7u,
+        0x86e9u, 0xc13au, 0x094fu, 0x4e9cu, 0x8984u, 0xce57u, 0x0622u, 0x41f1u,
+        0x9833u, 0xdfe0u, 0x1795u, 0x5046u, 0x975eu, 0xd08du, 0x18f8u, 0x5f2bu,
+        0xbb5du, 0xfc8eu, 0x34fbu, 0x7328u, 0xb430u, 0xf3e3u, 0x3b96u, 0x7c45u,
+        0xa587u, 0xe254u, 0x2a21u, 0x6df2u, 0xaaeau, 0xed39u, 0x254cu, 0x629fu,
+        0x0b51u, 0x4c82u, 0x84f7u, 0xc324u, 0x043cu, 0x43efu, 0x8b9au, 0xcc49u,
+        0x158bu, 0x5258u, 0x9a2du, 0xddfeu, 0x1ae6u, 0x5d35u, 0x9540u, 0xd293u,
+        0x36e5u, 0x7136u, 0xb943u, 0xfe90u, 0x3988u, 0x7e5bu, 0xb62eu, 0xf1fdu,
+        0x283fu, 0x6fecu, 0xa799u, 0xe04au, 0x2752u, 0x6081u, 0xa8f4u, 0xef27u,
+        0x7039u, 0x37eau, 0xff9fu, 0xb84cu, 0x7f54u, 0x3887u, 0xf0f2u, 0xb721u,
+        0x6ee3u, 0x2930u, 0xe145u, 0xa696u, 0x618eu, 0x265du, 0xee28u, 0xa9fbu,
+        0x4d8du, 0x0a5eu, 0xc22bu, 0x85f8u, 0x42e0u, 0x0533u, 0xcd46u, 0x8a95u,
+        0x5357u, 0x1484u, 0xdcf1u, 0x9b22u, 0x5c3au, 0x1be9u, 0xd39cu, 0x944fu
+    }
+};
+
+#elif defined(CRC16CCITT_FAST)
 
 /** Static table used for the table_driven implementation. */
 static const Crc16CCITT crc_table[256] = {
@@ -125,7 +422,15 @@ static const Crc16CCITT crc_table[256] = {
     0x6e17u, 0x7e36u, 0x4e55u, 0x5e74u, 0x2e93u, 0x3eb2u, 0x0ed1u, 0x1ef0u
 };
 
-#endif  /* CRC16CCITT_FAST */
+#elif defined(CRC16CCITT_NIBBLE)
+
+/** Static table used for the nibble-wise implementation. */
+static const Crc16CCITT crc_tableNibble[16] = {
+    0x0000u, 0x1021u, 0x2042u, 0x3063u, 0x4084u, 0x50a5u, 0x60c6u, 0x70e7u,
+    0x8108u, 0x9129u, 0xa14au, 0xb16bu, 0xc18cu, 0xd1adu, 0xe1ceu, 0xf1efu
+};
+
+#endif  /* defined(CRC16CCITT_NIBBLE) */
 
 /*******************************************************************************
     GLOBAL VARIABLES
@@ -155,15 +460,76 @@ extern Crc16CCITT   crc16ccitt_init(void)
  */
 extern Crc16CCITT   crc16ccitt_update(Crc16CCITT crc, const uint8_t *data, size_t size)
 {
-#ifdef CRC16CCITT_FAST
+    if ((NULL == data) ||
+        (0 == size))
+    {
+        return crc;
+    }
+
+#if defined(CRC16CCITT_SLICING)
+
+    return crc16ccitt_updateSlicing(crc, data, size);
+
+#elif defined(CRC16CCITT_FAST)
 
     return crc16ccitt_updateFast(crc, data, size);
 
-#else   /* Not defined CRC16CCITT_FAST */
+#elif defined(CRC16CCITT_NIBBLE)
+
+    return crc16ccitt_updateNibble(crc, data, size);
+
+#else   /* Bit by bit algorithm */
 
     return crc16ccitt_updateAlgo(crc, data, size);
 
-#endif  /* Not defined CRC16CCITT_FAST */
+#endif  /* Bit by bit algorithm */
+}
+
+/**
+ * Update the crc value with a single byte.
+ * Use it to calculate the crc on the fly, e.g. while the data is received
+ * frame by frame, without the need to buffer it first.
+ *
+ * @param crc   The current crc value.
+ * @param data  Data byte
+ * @return      The updated crc value.
+ */
+extern Crc16CCITT   crc16ccitt_updateByte(Crc16CCITT crc, uint8_t data)
+{
+#if defined(CRC16CCITT_SLICING)
+
+    crc = crc_tableSlicing[0][((crc >> 8u) ^ data) & 0xffu] ^ (crc << 8u);
+
+#elif defined(CRC16CCITT_FAST)
+
+    crc = crc_table[((crc >> 8u) ^ data) & 0xffu] ^ (crc << 8u);
+
+#elif defined(CRC16CCITT_NIBBLE)
+
+    crc = crc_tableNibble[((crc >> 12u) ^ (data >> 4u)) & 0x0fu] ^ (crc << 4u);
+    crc = crc_tableNibble[((crc >> 12u) ^ data) & 0x0fu] ^ (crc << 4u);
+
+#else   /* Bit by bit algorithm */
+
+    uint8_t bitIndex    = 0;
+
+    crc ^= ((uint16_t)data) << 8;
+
+    for (bitIndex = 0; bitIndex < 8; ++bitIndex)
+    {
+        if (crc & (1 << 15))
+        {
+            crc = (crc << 1) ^ CRC16CCITT_POLYNOM;
+        }
+        else
+        {
+            crc = crc << 1;
+        }
+    }
+
+#endif  /* Bit by bit algorithm */
+
+    return crc & 0xffffu;
 }
 
 /**
@@ -197,7 +563,47 @@ extern Crc16CCITT   crc16ccitt_calculate(uint8_t *data, size_t size)
     LOCAL FUNCTIONS
 *******************************************************************************/
 
-#ifdef CRC16CCITT_FAST
+#if defined(CRC16CCITT_SLICING)
+
+/**
+ * Update the crc value with new data.
+ * The data is processed in slices of 8 bytes, each slice needs 8 independent
+ * table look-ups, instead of 8 dependent ones. The remaining bytes are
+ * processed byte-wise.
+ *
+ * @param crc   The current crc value.
+ * @param data  Pointer to a buffer of @a size bytes.
+ * @param size  Number of bytes in the @a data buffer.
+ * @return      The updated crc value.
+ */
+static Crc16CCITT   crc16ccitt_updateSlicing(Crc16CCITT crc, const uint8_t *data, size_t size)
+{
+    while (CRC16CCITT_SLICING_NUM <= size)
+    {
+        crc = crc_tableSlicing[7][((crc >> 8u) ^ data[0]) & 0xffu] ^
+              crc_tableSlicing[6][(crc ^ data[1]) & 0xffu] ^
+              crc_tableSlicing[5][data[2]] ^
+              crc_tableSlicing[4][data[3]] ^
+              crc_tableSlicing[3][data[4]] ^
+              crc_tableSlicing[2][data[5]] ^
+              crc_tableSlicing[1][data[6]] ^
+              crc_tableSlicing[0][data[7]];
+
+        data += CRC16CCITT_SLICING_NUM;
+        size -= CRC16CCITT_SLICING_NUM;
+    }
+
+    while (size--)
+    {
+        crc = (crc_tableSlicing[0][((crc >> 8u) ^ *data) & 0xffu] ^ (crc << 8u)) & 0xffffu;
+
+        data++;
+    }
+
+    return crc & 0xffffu;
+}
+
+#elif defined(CRC16CCITT_FAST)
 
 /**
  * Update the crc value with new data.
@@ -225,7 +631,32 @@ static Crc16CCITT   crc16ccitt_updateFast(Crc16CCITT crc, const uint8_t *data, s
     return crc & 0xffffu;
 }
 
-#else   /* Not defined CRC16CCITT_FAST */
+#elif defined(CRC16CCITT_NIBBLE)
+
+/**
+ * Update the crc value with new data.
+ * Every byte is processed in two steps, one per nibble. The look-up table
+ * needs only 32 bytes, which makes it suitable for small targets.
+ *
+ * @param crc   The current crc value.
+ * @param data  Pointer to a buffer of @a size bytes.
+ * @param size  Number of bytes in the @a data buffer.
+ * @return      The updated crc value.
+ */
+static Crc16CCITT   crc16ccitt_updateNibble(Crc16CCITT crc, const uint8_t *data, size_t size)
+{
+    while (size--)
+    {
+        crc = crc_tableNibble[((crc >> 12u) ^ (*data >> 4u)) & 0x0fu] ^ (crc << 4u);
+        crc = crc_tableNibble[((crc >> 12u) ^ *data) & 0x0fu] ^ (crc << 4u);
+
+        data++;
+    }
+
+    return crc & 0xffffu;
+}
+
+#else   /* Bit by bit algorithm */
 
 /**
  * Update the crc value with new data.
@@ -253,10 +684,10 @@ static Crc16CCITT   crc16ccitt_updateFast(Crc16CCITT crc, const uint8_t *data, s
  */
 static Crc16CCITT   crc16ccitt_updateAlgo(Crc16CCITT crc, const uint8_t *data, size_t size)
 {
-    uint8_t dataIndex   = 0;
+    size_t  dataIndex   = 0;
     uint8_t bitIndex    = 0;
 
-    do
+    for (dataIndex = 0; dataIndex < size; ++dataIndex)
     {
         crc ^= ((uint16_t)data[dataIndex]) << 8;
 
@@ -271,12 +702,9 @@ static Crc16CCITT   crc16ccitt_updateAlgo(Crc16CCITT crc, const uint8_t *data, s
                 crc = crc << 1;
             }
         }
-
-        ++dataIndex;
     }
-    while(size > dataIndex);
 
     return crc;
 }
 
-#endif  /* Not defined CRC16CCITT_FAST */
+#endif  /* Bit by bit algorithm */
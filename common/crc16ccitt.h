@@ -59,9 +59,21 @@ extern "C"
     COMPILER SWITCHES
 *******************************************************************************/
 
-/** The fast calculation uses a look-up table. */
+/*
+ * Select the algorithm by defining one of the following switches, e.g. in the
+ * makefile. If none is defined, the bit by bit algorithm is used, which needs
+ * no look-up table at all.
+ */
+
+/** The slicing-by-8 calculation uses 8 look-up tables (4 KiB), which is recommended for the host side. */
+/* #define CRC16CCITT_SLICING */
+
+/** The fast calculation uses a look-up table (512 bytes). */
 /* #define CRC16CCITT_FAST */
 
+/** The nibble calculation uses a small look-up table (32 bytes), which is recommended for small targets. */
+/* #define CRC16CCITT_NIBBLE */
+
 /*******************************************************************************
     CONSTANTS
 *******************************************************************************/
@@ -102,6 +114,17 @@ extern Crc16CCITT   crc16ccitt_init(void);
  */
 extern Crc16CCITT   crc16ccitt_update(Crc16CCITT crc, const uint8_t *data, size_t size);
 
+/**
+ * Update the crc value with a single byte.
+ * Use it to calculate the crc on the fly, e.g. while the data is received
+ * frame by frame, without the need to buffer it first.
+ *
+ * @param crc   The current crc value.
+ * @param data  Data byte
+ * @return      The updated crc value.
+ */
+extern Crc16CCITT   crc16ccitt_updateByte(Crc16CCITT crc, uint8_t data);
+
 /**
  * Calculate the final crc value.
  *
@@ -0,0 +1,310 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2019, Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  25xx SPI EEPROM driver
+@file   eeprom25xx.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see eeprom25xx.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "eeprom25xx.h"
+#include <stdlib.h>
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Max. command size in bytes (instruction and 16-bit address) */
+#define EEPROM25XX_CMD_SIZE_MAX (3u)
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+static EEPROM25XX_RET eeprom25xx_check(eeprom25xx_Device const * const dev, uint16_t addr, uint16_t size);
+static EEPROM25XX_RET eeprom25xx_sendCmd(eeprom25xx_Device const * const dev, uint8_t cmd, uint16_t addr, uint8_t keepSelected);
+static EEPROM25XX_RET eeprom25xx_waitForWriteCycle(eeprom25xx_Device const * const dev);
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Read a block of data with a single READ command.
+ *
+ * @param[in]   dev     EEPROM
+ * @param[in]   addr    Start address
+ * @param[out]  data    Data buffer
+ * @param[in]   size    Number of bytes to read
+ * @return Status
+ */
+extern EEPROM25XX_RET eeprom25xx_read(eeprom25xx_Device const * const dev, uint16_t addr, uint8_t * const data, uint16_t size)
+{
+    EEPROM25XX_RET  status  = eeprom25xx_check(dev, addr, size);
+
+    if (NULL == data)
+    {
+        status = EEPROM25XX_RET_ENULL;
+    }
+    else if ((EEPROM25XX_RET_OK == status) &&
+             (0 < size))
+    {
+        /* The EEPROM increments the address internally, the whole block is
+         * clocked out after one command.
+         */
+        status = eeprom25xx_sendCmd(dev, EEPROM25XX_CMD_READ, addr, 1);
+
+        if (EEPROM25XX_RET_OK == status)
+        {
+            status = dev->transfer(NULL, data, size, 0);
+        }
+    }
+
+    return status;
+}
+
+/**
+ * Write a block of data page by page. Every page is written with one write
+ * cycle and the function waits until it is finished.
+ *
+ * @param[in]   dev     EEPROM
+ * @param[in]   addr    Start address
+ * @param[in]   data    Data buffer
+ * @param[in]   size    Number of bytes to write
+ * @return Status
+ */
+extern EEPROM25XX_RET eeprom25xx_write(eeprom25xx_Device const * const dev, uint16_t addr, uint8_t const * const data, uint16_t size)
+{
+    EEPROM25XX_RET  status  = eeprom25xx_check(dev, addr, size);
+    uint16_t        offset  = 0;
+
+    if (NULL == data)
+    {
+        status = EEPROM25XX_RET_ENULL;
+    }
+    else if ((EEPROM25XX_RET_OK == status) &&
+             ((0 == dev->pageSize) ||
+              (0 != (dev->pageSize & (dev->pageSize - 1)))))
+    {
+        status = EEPROM25XX_RET_EPAR;
+    }
+
+    while((EEPROM25XX_RET_OK == status) && (size > offset))
+    {
+        uint16_t    pageAddr    = addr + offset;
+        uint16_t    chunkSize   = dev->pageSize - (pageAddr & (dev->pageSize - 1));
+
+        /* A write beyond the page boundary would wrap around to the page
+         * begin, therefore the block is split at every page boundary.
+         */
+        if ((size - offset) < chunkSize)
+        {
+            chunkSize = size - offset;
+        }
+
+        /* The write enable latch is reset after every write cycle. It is
+         * set by a separate command, the chip select must be released once.
+         */
+        status = eeprom25xx_sendCmd(dev, EEPROM25XX_CMD_WREN, 0, 0);
+
+        if (EEPROM25XX_RET_OK == status)
+        {
+            status = eeprom25xx_sendCmd(dev, EEPROM25XX_CMD_WRITE, pageAddr, 1);
+        }
+
+        if (EEPROM25XX_RET_OK == status)
+        {
+            /* Releasing the chip select starts the write cycle. */
+            status = dev->transfer(&data[offset], NULL, chunkSize, 0);
+        }
+
+        if (EEPROM25XX_RET_OK == status)
+        {
+            status = eeprom25xx_waitForWriteCycle(dev);
+        }
+
+        offset += chunkSize;
+    }
+
+    return status;
+}
+
+/**
+ * Read the status register.
+ *
+ * @param[in]   dev     EEPROM
+ * @param[out]  status  Status register
+ * @return Status
+ */
+extern EEPROM25XX_RET eeprom25xx_readStatus(eeprom25xx_Device const * const dev, uint8_t * const status)
+{
+    EEPROM25XX_RET  ret         = EEPROM25XX_RET_ENULL;
+    uint8_t         txData[2]   = { EEPROM25XX_CMD_RDSR, 0x00 };
+    uint8_t         rxData[2]   = { 0x00, 0x00 };
+
+    if ((NULL != dev) &&
+        (NULL != dev->transfer) &&
+        (NULL != status))
+    {
+        ret = dev->transfer(txData, rxData, sizeof(txData), 0);
+
+        if (EEPROM25XX_RET_OK == ret)
+        {
+            *status = rxData[1];
+        }
+    }
+
+    return ret;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Check the device and the address range.
+ *
+ * @param[in]   dev     EEPROM
+ * @param[in]   addr    Start address
+ * @param[in]   size    Number of bytes
+ * @return Status
+ */
+static EEPROM25XX_RET eeprom25xx_check(eeprom25xx_Device const * const dev, uint16_t addr, uint16_t size)
+{
+    EEPROM25XX_RET  status  = EEPROM25XX_RET_OK;
+
+    if ((NULL == dev) ||
+        (NULL == dev->transfer))
+    {
+        status = EEPROM25XX_RET_ENULL;
+    }
+    else if ((1 > dev->addrSize) ||
+             (2 < dev->addrSize) ||
+             (dev->size < size) ||
+             ((dev->size - size) < addr))
+    {
+        status = EEPROM25XX_RET_EPAR;
+    }
+
+    return status;
+}
+
+/**
+ * Send a command with optional address.
+ *
+ * @param[in]   dev             EEPROM
+ * @param[in]   cmd             Command
+ * @param[in]   addr            Address, only used by READ and WRITE
+ * @param[in]   keepSelected    Keep the chip select asserted after the command (1) or not (0)
+ * @return Status
+ */
+static EEPROM25XX_RET eeprom25xx_sendCmd(eeprom25xx_Device const * const dev, uint8_t cmd, uint16_t addr, uint8_t keepSelected)
+{
+    uint8_t     txData[EEPROM25XX_CMD_SIZE_MAX];
+    uint16_t    size    = 0;
+
+    txData[size] = cmd;
+    ++size;
+
+    if ((EEPROM25XX_CMD_READ == cmd) ||
+        (EEPROM25XX_CMD_WRITE == cmd))
+    {
+        /* Address MSB first */
+        if (2 == dev->addrSize)
+        {
+            txData[size] = (uint8_t)((addr >> 8) & 0xff);
+            ++size;
+        }
+
+        txData[size] = (uint8_t)((addr >> 0) & 0xff);
+        ++size;
+    }
+
+    return dev->transfer(txData, NULL, size, keepSelected);
+}
+
+/**
+ * Wait until the write cycle is finished, by polling the write-in-progress
+ * flag.
+ *
+ * @param[in]   dev EEPROM
+ * @return Status
+ */
+static EEPROM25XX_RET eeprom25xx_waitForWriteCycle(eeprom25xx_Device const * const dev)
+{
+    EEPROM25XX_RET  ret     = EEPROM25XX_RET_TIMEOUT;
+    uint16_t        polls   = 0;
+    uint8_t         status  = EEPROM25XX_STATUS_WIP;
+
+    while((dev->pollMax > polls) &&
+          (EEPROM25XX_RET_TIMEOUT == ret))
+    {
+        if (EEPROM25XX_RET_OK != eeprom25xx_readStatus(dev, &status))
+        {
+            ret = EEPROM25XX_RET_ERROR;
+        }
+        else if (0 == (status & EEPROM25XX_STATUS_WIP))
+        {
+            ret = EEPROM25XX_RET_OK;
+        }
+        else
+        {
+            ++polls;
+        }
+    }
+
+    return ret;
+}
@@ -0,0 +1,183 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2019, Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  25xx SPI EEPROM driver
+@file   eeprom25xx.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module contains the protocol of the 25xx SPI EEPROM family, e.g. the
+Microchip 25AA02E48. It is independent of the SPI peripheral, which is
+accessed by a transfer function of the application.
+
+Reading uses a single READ command for the whole block, the EEPROM clocks out
+the data sequentially. Writing uses one WREN and one WRITE command per page,
+followed by polling the write-in-progress flag, instead of one write cycle
+per byte.
+
+*******************************************************************************/
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+*/
+#ifndef __EEPROM25XX_H__
+#define __EEPROM25XX_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Read data from memory array */
+#define EEPROM25XX_CMD_READ     (0x03)
+
+/** Write data to memory array */
+#define EEPROM25XX_CMD_WRITE    (0x02)
+
+/** Reset the write enable latch */
+#define EEPROM25XX_CMD_WRDI     (0x04)
+
+/** Set the write enable latch */
+#define EEPROM25XX_CMD_WREN     (0x06)
+
+/** Read status register */
+#define EEPROM25XX_CMD_RDSR     (0x05)
+
+/** Write status register */
+#define EEPROM25XX_CMD_WRSR     (0x01)
+
+/** Status register: Write in progress */
+#define EEPROM25XX_STATUS_WIP   (0x01)
+
+/** Status register: Write enable latch */
+#define EEPROM25XX_STATUS_WEL   (0x02)
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/** This type defines the supported function return values. */
+typedef enum
+{
+    EEPROM25XX_RET_OK = 0,      /**< Successful */
+    EEPROM25XX_RET_ERROR,       /**< Failed */
+    EEPROM25XX_RET_ENULL,       /**< Unexpected NULL pointer */
+    EEPROM25XX_RET_EPAR,        /**< Parameter error */
+    EEPROM25XX_RET_TIMEOUT      /**< Write cycle didn't finish */
+
+} EEPROM25XX_RET;
+
+/**
+ * SPI transfer function, provided by the application. It sends and receives
+ * size bytes at the same time. The chip select is asserted at the begin, if
+ * it is not already, and released at the end, except keepSelected is set.
+ *
+ * @param[in]   txData          Data to send, if NULL 0x00 is sent
+ * @param[out]  rxData          Received data, if NULL it is discarded
+ * @param[in]   size            Number of bytes
+ * @param[in]   keepSelected    Keep the chip select asserted after the transfer (1) or not (0)
+ * @return Status
+ */
+typedef EEPROM25XX_RET (*eeprom25xx_Transfer)(uint8_t const * txData, uint8_t * rxData, uint16_t size, uint8_t keepSelected);
+
+/** This type defines a 25xx SPI EEPROM. */
+typedef struct
+{
+    eeprom25xx_Transfer transfer;   /**< SPI transfer function */
+    uint16_t            size;       /**< Memory size in bytes */
+    uint8_t             pageSize;   /**< Page size in bytes, power of two */
+    uint8_t             addrSize;   /**< Number of address bytes (1 or 2) */
+    uint16_t            pollMax;    /**< Max. number of status polls per write cycle */
+
+} eeprom25xx_Device;
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Read a block of data with a single READ command.
+ *
+ * @param[in]   dev     EEPROM
+ * @param[in]   addr    Start address
+ * @param[out]  data    Data buffer
+ * @param[in]   size    Number of bytes to read
+ * @return Status
+ */
+extern EEPROM25XX_RET eeprom25xx_read(eeprom25xx_Device const * const dev, uint16_t addr, uint8_t * const data, uint16_t size);
+
+/**
+ * Write a block of data page by page. Every page is written with one write
+ * cycle and the function waits until it is finished.
+ *
+ * @param[in]   dev     EEPROM
+ * @param[in]   addr    Start address
+ * @param[in]   data    Data buffer
+ * @param[in]   size    Number of bytes to write
+ * @return Status
+ */
+extern EEPROM25XX_RET eeprom25xx_write(eeprom25xx_Device const * const dev, uint16_t addr, uint8_t const * const data, uint16_t size);
+
+/**
+ * Read the status register.
+ *
+ * @param[in]   dev     EEPROM
+ * @param[out]  status  Status register
+ * @return Status
+ */
+extern EEPROM25XX_RET eeprom25xx_readStatus(eeprom25xx_Device const * const dev, uint8_t * const status);
+
+#ifdef __cplusplus
+}
+#endif  /* __cplusplus */
+
+#endif  /* __EEPROM25XX_H__ */
@@ -0,0 +1,737 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2019, Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  Capture file
+@file   capture.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see capture.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "capture.h"
+#include <string.h>
+#include <time.h>
+#include <sys/types.h>
+#include "vscp_class.h"
+#include "vscp_type.h"
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Magic at the begin of every capture file */
+#define CAPTURE_MAGIC               "VSCPCAP"
+
+/** Size of the magic in bytes, incl. string termination */
+#define CAPTURE_MAGIC_SIZE          (8u)
+
+/** Max. number of data bytes, which are shown for level 2 events. */
+#define CAPTURE_SHOW_L2_DATA_MAX    (8u)
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+#ifdef _WIN32
+
+/** Set file position with 64-bit offset */
+#define CAPTURE_FSEEK(__fd, __offset, __origin) _fseeki64((__fd), (__offset), (__origin))
+
+/** Get file position with 64-bit offset */
+#define CAPTURE_FTELL(__fd)                     _ftelli64(__fd)
+
+#else   /* _WIN32 */
+
+/** Set file position with 64-bit offset */
+#define CAPTURE_FSEEK(__fd, __offset, __origin) fseeko((__fd), (off_t)(__offset), (__origin))
+
+/** Get file position with 64-bit offset */
+#define CAPTURE_FTELL(__fd)                     ftello(__fd)
+
+#endif  /* _WIN32 */
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+static CAPTURE_RET capture_flush(capture_Writer * const writer);
+static void capture_putUInt16(uint8_t * const buffer, uint16_t value);
+static void capture_putUInt32(uint8_t * const buffer, uint32_t value);
+static void capture_putUInt64(uint8_t * const buffer, uint64_t value);
+static uint16_t capture_getUInt16(uint8_t const * const buffer);
+static uint32_t capture_getUInt32(uint8_t const * const buffer);
+static uint64_t capture_getUInt64(uint8_t const * const buffer);
+static void capture_serialize(uint8_t * const buffer, capture_Record const * const record);
+static void capture_deserialize(capture_Record * const record, uint8_t const * const buffer);
+static void capture_showData(uint8_t const * const data, uint32_t num, uint32_t max);
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function creates a new capture file and writes the file header.
+ * An already existing file will be overwritten.
+ *
+ * @param[out]  writer      Writer context
+ * @param[in]   fileName    Name of the capture file
+ * @param[in]   syncPeriod  Period in ms, after which the written data is synchronized with the storage device
+ *
+ * @return Status
+ */
+extern CAPTURE_RET capture_openWriter(capture_Writer * const writer, char const * const fileName, uint32_t syncPeriod)
+{
+    uint8_t header[CAPTURE_HEADER_SIZE];
+
+    if ((NULL == writer) ||
+        (NULL == fileName))
+    {
+        return CAPTURE_RET_ENULL;
+    }
+
+    writer->fd = fopen(fileName, "wb");
+
+    if (NULL == writer->fd)
+    {
+        return CAPTURE_RET_ERROR;
+    }
+
+    writer->startTime           = (uint64_t)time(NULL);
+    writer->startTimeMonotonic  = platform_getMonotonicTime();
+    writer->lastSync            = writer->startTimeMonotonic;
+    writer->syncPeriod          = syncPeriod;
+    writer->recordCnt           = 0;
+    writer->bufferIndex         = 0;
+
+    memset(header, 0, sizeof(header));
+    memcpy(&header[0], CAPTURE_MAGIC, CAPTURE_MAGIC_SIZE);
+    capture_putUInt16(&header[8], CAPTURE_VERSION);
+    capture_putUInt16(&header[10], CAPTURE_RECORD_SIZE);
+    capture_putUInt64(&header[16], writer->startTime);
+
+    if (1 != fwrite(header, sizeof(header), 1, writer->fd))
+    {
+        fclose(writer->fd);
+        writer->fd = NULL;
+
+        return CAPTURE_RET_ERROR;
+    }
+
+    return CAPTURE_RET_OK;
+}
+
+/**
+ * This function appends a record to the capture file. The timestamp of the
+ * record is set by the writer.
+ * The record is buffered and written to the file, if the buffer is full or
+ * by capture_processWriter().
+ *
+ * @param[in]       writer  Writer context
+ * @param[in,out]   record  Record
+ *
+ * @return Status
+ */
+extern CAPTURE_RET capture_write(capture_Writer * const writer, capture_Record * const record)
+{
+    CAPTURE_RET status  = CAPTURE_RET_OK;
+
+    if ((NULL == writer) ||
+        (NULL == writer->fd) ||
+        (NULL == record))
+    {
+        return CAPTURE_RET_ENULL;
+    }
+
+    if (sizeof(writer->buffer) < (writer->bufferIndex + CAPTURE_RECORD_SIZE))
+    {
+        status = capture_flush(writer);
+    }
+
+    if (CAPTURE_RET_OK == status)
+    {
+        record->timestamp = platform_getMonotonicTime() - writer->startTimeMonotonic;
+
+        capture_serialize(&writer->buffer[writer->bufferIndex], record);
+        writer->bufferIndex += CAPTURE_RECORD_SIZE;
+
+        ++writer->recordCnt;
+    }
+
+    return status;
+}
+
+/**
+ * This function shall be called periodically. It writes the buffered records
+ * to the file and synchronizes it with the storage device, after the
+ * configured synchronization period elapsed.
+ *
+ * @param[in]   writer  Writer context
+ *
+ * @return Status
+ */
+extern CAPTURE_RET capture_processWriter(capture_Writer * const writer)
+{
+    CAPTURE_RET status  = CAPTURE_RET_OK;
+    uint64_t    now     = 0;
+
+    if ((NULL == writer) ||
+        (NULL == writer->fd))
+    {
+        return CAPTURE_RET_ENULL;
+    }
+
+    now = platform_getMonotonicTime();
+
+    if ((((uint64_t)writer->syncPeriod) * 1000u) <= (now - writer->lastSync))
+    {
+        writer->lastSync = now;
+
+        status = capture_flush(writer);
+
+        if (CAPTURE_RET_OK == status)
+        {
+            if (0 != platform_syncFile(writer->fd))
+            {
+                status = CAPTURE_RET_ERROR;
+            }
+        }
+    }
+
+    return status;
+}
+
+/**
+ * This function writes all buffered records, synchronizes the file with the
+ * storage device and closes it.
+ *
+ * @param[in]   writer  Writer context
+ *
+ * @return Status
+ */
+extern CAPTURE_RET capture_closeWriter(capture_Writer * const writer)
+{
+    CAPTURE_RET status  = CAPTURE_RET_OK;
+
+    if ((NULL == writer) ||
+        (NULL == writer->fd))
+    {
+        return CAPTURE_RET_ENULL;
+    }
+
+    status = capture_flush(writer);
+
+    if (0 != platform_syncFile(writer->fd))
+    {
+        status = CAPTURE_RET_ERROR;
+    }
+
+    if (0 != fclose(writer->fd))
+    {
+        status = CAPTURE_RET_ERROR;
+    }
+
+    writer->fd = NULL;
+
+    return status;
+}
+
+/**
+ * This function opens a capture file for reading and verifies the file header.
+ *
+ * @param[out]  reader      Reader context
+ * @param[in]   fileName    Name of the capture file
+ *
+ * @return Status
+ */
+extern CAPTURE_RET capture_openReader(capture_Reader * const reader, char const * const fileName)
+{
+    CAPTURE_RET status  = CAPTURE_RET_OK;
+    uint8_t     header[CAPTURE_HEADER_SIZE];
+
+    if ((NULL == reader) ||
+        (NULL == fileName))
+    {
+        return CAPTURE_RET_ENULL;
+    }
+
+    reader->fd          = fopen(fileName, "rb");
+    reader->startTime   = 0;
+
+    if (NULL == reader->fd)
+    {
+        status = CAPTURE_RET_ERROR;
+    }
+    else if (1 != fread(header, sizeof(header), 1, reader->fd))
+    {
+        status = CAPTURE_RET_INVALID;
+    }
+    else if (0 != memcmp(&header[0], CAPTURE_MAGIC, CAPTURE_MAGIC_SIZE))
+    {
+        status = CAPTURE_RET_INVALID;
+    }
+    else if ((CAPTURE_VERSION != capture_getUInt16(&header[8])) ||
+             (CAPTURE_RECORD_SIZE != capture_getUInt16(&header[10])))
+    {
+        status = CAPTURE_RET_INVALID;
+    }
+    else
+    {
+        reader->startTime = capture_getUInt64(&header[16]);
+    }
+
+    if ((CAPTURE_RET_OK != status) &&
+        (NULL != reader->fd))
+    {
+        fclose(reader->fd);
+        reader->fd = NULL;
+    }
+
+    return status;
+}
+
+/**
+ * This function reads the next record from the capture file.
+ * A partial written record at the end of the file is handled like the end of
+ * the file.
+ *
+ * @param[in]   reader  Reader context
+ * @param[out]  record  Record
+ *
+ * @return Status
+ * @retval CAPTURE_RET_OK   Record read
+ * @retval CAPTURE_RET_EOF  No further record available
+ */
+extern CAPTURE_RET capture_read(capture_Reader * const reader, capture_Record * const record)
+{
+    uint8_t buffer[CAPTURE_RECORD_SIZE];
+
+    if ((NULL == reader) ||
+        (NULL == reader->fd) ||
+        (NULL == record))
+    {
+        return CAPTURE_RET_ENULL;
+    }
+
+    if (1 != fread(buffer, sizeof(buffer), 1, reader->fd))
+    {
+        return CAPTURE_RET_EOF;
+    }
+
+    capture_deserialize(record, buffer);
+
+    return CAPTURE_RET_OK;
+}
+
+/**
+ * This function sets the read position to the given record.
+ *
+ * @param[in]   reader      Reader context
+ * @param[in]   recordIndex Index of the record, which shall be read next
+ *
+ * @return Status
+ */
+extern CAPTURE_RET capture_seek(capture_Reader * const reader, uint64_t recordIndex)
+{
+    if ((NULL == reader) ||
+        (NULL == reader->fd))
+    {
+        return CAPTURE_RET_ENULL;
+    }
+
+    if (0 != CAPTURE_FSEEK(reader->fd, CAPTURE_HEADER_SIZE + recordIndex * CAPTURE_RECORD_SIZE, SEEK_SET))
+    {
+        return CAPTURE_RET_ERROR;
+    }
+
+    return CAPTURE_RET_OK;
+}
+
+/**
+ * This function determines the number of complete records in the capture file.
+ * The read position is not changed.
+ *
+ * @param[in]   reader      Reader context
+ * @param[out]  recordCnt   Number of records
+ *
+ * @return Status
+ */
+extern CAPTURE_RET capture_getRecordCnt(capture_Reader * const reader, uint64_t * const recordCnt)
+{
+    CAPTURE_RET status      = CAPTURE_RET_OK;
+    int64_t     position    = 0;
+    int64_t     size        = 0;
+
+    if ((NULL == reader) ||
+        (NULL == reader->fd) ||
+        (NULL == recordCnt))
+    {
+        return CAPTURE_RET_ENULL;
+    }
+
+    position = CAPTURE_FTELL(reader->fd);
+
+    if ((0 > position) ||
+        (0 != CAPTURE_FSEEK(reader->fd, 0, SEEK_END)))
+    {
+        status = CAPTURE_RET_ERROR;
+    }
+    else
+    {
+        size = CAPTURE_FTELL(reader->fd);
+
+        if (CAPTURE_HEADER_SIZE > size)
+        {
+            *recordCnt = 0;
+        }
+        else
+        {
+            *recordCnt = ((uint64_t)size - CAPTURE_HEADER_SIZE) / CAPTURE_RECORD_SIZE;
+        }
+
+        if (0 != CAPTURE_FSEEK(reader->fd, position, SEEK_SET))
+        {
+            status = CAPTURE_RET_ERROR;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * This function closes a capture file.
+ *
+ * @param[in]   reader  Reader context
+ */
+extern void capture_closeReader(capture_Reader * const reader)
+{
+    if ((NULL != reader) &&
+        (NULL != reader->fd))
+    {
+        fclose(reader->fd);
+        reader->fd = NULL;
+    }
+
+    return;
+}
+
+/**
+ * This function shows a record in the logger text format on the console.
+ *
+ * @param[in]   record      Record
+ * @param[in]   startTime   Wall clock time of the capture start in s since epoch (UTC)
+ */
+extern void capture_show(capture_Record const * const record, uint64_t startTime)
+{
+    time_t      rawtime;
+    struct tm * timeInfo;
+    uint32_t    dataNum     = 0;
+
+    if (NULL == record)
+    {
+        return;
+    }
+
+    rawtime     = (time_t)(startTime + (record->timestamp / 1000000u));
+    timeInfo    = localtime(&rawtime);
+
+    printf("%04u-%02u-%02u %02u:%02u:%02u ",
+        timeInfo->tm_year + 1900,
+        timeInfo->tm_mon + 1,
+        timeInfo->tm_mday,
+        timeInfo->tm_hour,
+        timeInfo->tm_min,
+        timeInfo->tm_sec);
+
+    dataNum = record->dataSize;
+
+    if (((VSCP_CLASS1_LOG == record->vscpClass) || ((VSCP_CLASS1_LOG + 512) == record->vscpClass)) &&
+        (VSCP_TYPE_LOG_MESSAGE == record->vscpType) &&
+        (8 == record->dataSize))
+    {
+        printf("Rx: %s class=0x%04X type=0x%02X prio=%2d oAddr=0x%02X %c num=%u id=0x%02X level=0x%02X idx=0x%02X data=",
+            (VSCP_CLASS1_LOG == record->vscpClass) ? "L1   " : "L1_L2",
+            record->vscpClass,
+            record->vscpType,
+            (record->head >> 5) & 0x07,
+            record->guid[15],
+            (0 == ((record->head >> 4) & 0x01)) ? '-' : 'h',
+            record->dataSize,
+            record->data[0],
+            record->data[1],
+            record->data[2]);
+
+        capture_showData(&record->data[3], dataNum - 3, dataNum - 3);
+    }
+    else if (512 > record->vscpClass)
+    {
+        printf("Rx: L1    class=0x%04X type=0x%02X prio=%2d oAddr=0x%02X %c num=%u data=",
+            record->vscpClass,
+            record->vscpType,
+            (record->head >> 5) & 0x07,
+            record->guid[15], /* Node GUID LSB */
+            (0 == ((record->head >> 4) & 0x01)) ? '-' : 'h',
+            record->dataSize);
+
+        capture_showData(record->data, dataNum, CAPTURE_DATA_SIZE);
+    }
+    else if (1024 > record->vscpClass)
+    {
+        printf("Rx: L2_L1 class=0x%04X type=0x%02X prio=%2d oAddr=0x%02X %c num=%u data=",
+            record->vscpClass,
+            record->vscpType,
+            (record->head >> 5) & 0x07,
+            record->guid[15], /* Node GUID LSB */
+            (0 == ((record->head >> 4) & 0x01)) ? '-' : 'h',
+            record->dataSize);
+
+        capture_showData(record->data, dataNum, CAPTURE_DATA_SIZE);
+    }
+    else
+    {
+        printf("Rx: L2    class=0x%02X type=0x%02X prio=%2d oAddr=0x%02X %c num=%u data=",
+            record->vscpClass,
+            record->vscpType,
+            (record->head >> 5) & 0x07,
+            record->guid[15], /* Node GUID LSB */
+            (0 == ((record->head >> 4) & 0x01)) ? '-' : 'h',
+            record->dataSize);
+
+        capture_showData(record->data, dataNum, CAPTURE_SHOW_L2_DATA_MAX);
+    }
+
+    printf("\n");
+
+    return;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function writes all buffered records to the file.
+ *
+ * @param[in]   writer  Writer context
+ *
+ * @return Status
+ */
+static CAPTURE_RET capture_flush(capture_Writer * const writer)
+{
+    CAPTURE_RET status  = CAPTURE_RET_OK;
+
+    if (0 < writer->bufferIndex)
+    {
+        if (1 != fwrite(writer->buffer, writer->bufferIndex, 1, writer->fd))
+        {
+            status = CAPTURE_RET_ERROR;
+        }
+
+        writer->bufferIndex = 0;
+    }
+
+    return status;
+}
+
+/**
+ * This function writes a 16-bit value in little endian byte order to a buffer.
+ *
+ * @param[out]  buffer  Buffer
+ * @param[in]   value   Value
+ */
+static void capture_putUInt16(uint8_t * const buffer, uint16_t value)
+{
+    buffer[0] = (uint8_t)(value >> 0);
+    buffer[1] = (uint8_t)(value >> 8);
+
+    return;
+}
+
+/**
+ * This function writes a 32-bit value in little endian byte order to a buffer.
+ *
+ * @param[out]  buffer  Buffer
+ * @param[in]   value   Value
+ */
+static void capture_putUInt32(uint8_t * const buffer, uint32_t value)
+{
+    capture_putUInt16(&buffer[0], (uint16_t)(value >> 0));
+    capture_putUInt16(&buffer[2], (uint16_t)(value >> 16));
+
+    return;
+}
+
+/**
+ * This function writes a 64-bit value in little endian byte order to a buffer.
+ *
+ * @param[out]  buffer  Buffer
+ * @param[in]   value   Value
+ */
+static void capture_putUInt64(uint8_t * const buffer, uint64_t value)
+{
+    capture_putUInt32(&buffer[0], (uint32_t)(value >> 0));
+    capture_putUInt32(&buffer[4], (uint32_t)(value >> 32));
+
+    return;
+}
+
+/**
+ * This function reads a 16-bit value in little endian byte order from a buffer.
+ *
+ * @param[in]   buffer  Buffer
+ * @return Value
+ */
+static uint16_t capture_getUInt16(uint8_t const * const buffer)
+{
+    return (uint16_t)(((uint16_t)buffer[0]) << 0) |
+           (uint16_t)(((uint16_t)buffer[1]) << 8);
+}
+
+/**
+ * This function reads a 32-bit value in little endian byte order from a buffer.
+ *
+ * @param[in]   buffer  Buffer
+ * @return Value
+ */
+static uint32_t capture_getUInt32(uint8_t const * const buffer)
+{
+    return (((uint32_t)capture_getUInt16(&buffer[0])) << 0) |
+           (((uint32_t)capture_getUInt16(&buffer[2])) << 16);
+}
+
+/**
+ * This function reads a 64-bit value in little endian byte order from a buffer.
+ *
+ * @param[in]   buffer  Buffer
+ * @return Value
+ */
+static uint64_t capture_getUInt64(uint8_t const * const buffer)
+{
+    return (((uint64_t)capture_getUInt32(&buffer[0])) << 0) |
+           (((uint64_t)capture_getUInt32(&buffer[4])) << 32);
+}
+
+/**
+ * This function serializes a record to its file representation.
+ *
+ * @param[out]  buffer  Buffer with CAPTURE_RECORD_SIZE bytes
+ * @param[in]   record  Record
+ */
+static void capture_serialize(uint8_t * const buffer, capture_Record const * const record)
+{
+    capture_putUInt64(&buffer[0], record->timestamp);
+    capture_putUInt32(&buffer[8], record->obid);
+    capture_putUInt32(&buffer[12], record->eventTimestamp);
+    capture_putUInt16(&buffer[16], record->head);
+    capture_putUInt16(&buffer[18], record->vscpClass);
+    capture_putUInt16(&buffer[20], record->vscpType);
+    capture_putUInt16(&buffer[22], record->dataSize);
+    memcpy(&buffer[24], record->guid, CAPTURE_GUID_SIZE);
+    memcpy(&buffer[24 + CAPTURE_GUID_SIZE], record->data, CAPTURE_DATA_SIZE);
+
+    return;
+}
+
+/**
+ * This function deserializes a record from its file representation.
+ *
+ * @param[out]  record  Record
+ * @param[in]   buffer  Buffer with CAPTURE_RECORD_SIZE bytes
+ */
+static void capture_deserialize(capture_Record * const record, uint8_t const * const buffer)
+{
+    record->timestamp       = capture_getUInt64(&buffer[0]);
+    record->obid            = capture_getUInt32(&buffer[8]);
+    record->eventTimestamp  = capture_getUInt32(&buffer[12]);
+    record->head            = capture_getUInt16(&buffer[16]);
+    record->vscpClass       = capture_getUInt16(&buffer[18]);
+    record->vscpType        = capture_getUInt16(&buffer[20]);
+    record->dataSize        = capture_getUInt16(&buffer[22]);
+    memcpy(record->guid, &buffer[24], CAPTURE_GUID_SIZE);
+    memcpy(record->data, &buffer[24 + CAPTURE_GUID_SIZE], CAPTURE_DATA_SIZE);
+
+    return;
+}
+
+/**
+ * This function shows event data bytes in hex format. If not all data bytes
+ * are shown, it will be signalled with "...".
+ *
+ * @param[in]   data    Event data
+ * @param[in]   num     Number of event data bytes
+ * @param[in]   max     Max. number of data bytes, which shall be shown
+ */
+static void capture_showData(uint8_t const * const data, uint32_t num, uint32_t max)
+{
+    uint32_t    index   = 0;
+    uint32_t    showNum = num;
+
+    if (max < showNum)
+    {
+        showNum = max;
+    }
+
+    for(index = 0; index < showNum; ++index)
+    {
+        printf("%02X", data[index]);
+
+        if ((index + 1) < showNum)
+        {
+            printf(" ");
+        }
+    }
+
+    if (showNum < num)
+    {
+        printf("...");
+    }
+
+    return;
+}
@@ -0,0 +1,280 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2019, Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  Capture file
+@file   capture.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module provides the access to binary capture files, which contain
+received VSCP events. A capture file is append-only and consists of a
+file header, followed by fixed-size event records. All values are stored in
+little endian byte order.
+
+The record timestamp is the time in us since the capture was started, measured
+with a monotonic clock. The file header contains the wall clock time of the
+capture start.
+
+*******************************************************************************/
+/** @defgroup capture Capture file
+ * Record VSCP events to a binary capture file and read them back.
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __CAPTURE_H__
+#define __CAPTURE_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include <stdio.h>
+#include "platform.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Capture file format version */
+#define CAPTURE_VERSION             (1u)
+
+/** Size of the capture file header in bytes */
+#define CAPTURE_HEADER_SIZE         (32u)
+
+/** Size of a single record in the capture file in bytes */
+#define CAPTURE_RECORD_SIZE         (64u)
+
+/** Size of the GUID in bytes */
+#define CAPTURE_GUID_SIZE           (16u)
+
+/**
+ * Max. number of event data bytes, stored in a record.
+ * It is sufficient for level 1 events and level 1 events over level 2, which
+ * contain the interface GUID in front of the data. Level 2 events are cut.
+ */
+#define CAPTURE_DATA_SIZE           (24u)
+
+/** Number of records, which are buffered before they are written to the file. */
+#define CAPTURE_WRITE_BUFFER_NUM    (1024u)
+
+/** Default period in ms, after which the written data is synchronized with the storage device. */
+#define CAPTURE_SYNC_PERIOD_DEFAULT (1000u)
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/** This type defines the supported function return values. */
+typedef enum
+{
+    CAPTURE_RET_OK = 0,     /**< Successful */
+    CAPTURE_RET_EOF,        /**< End of file reached */
+    CAPTURE_RET_INVALID,    /**< Invalid or unsupported file format */
+    CAPTURE_RET_ERROR,      /**< Failed */
+    CAPTURE_RET_ENULL       /**< Unexpected NULL pointer */
+
+} CAPTURE_RET;
+
+/** This type defines a single event record. */
+typedef struct
+{
+    uint64_t    timestamp;                  /**< Time since capture start in us */
+    uint32_t    obid;                       /**< Object id, used by the daemon for channel information */
+    uint32_t    eventTimestamp;             /**< Event timestamp in us, set by the event source */
+    uint16_t    head;                       /**< Event header (priority, hard coded, etc.) */
+    uint16_t    vscpClass;                  /**< VSCP class */
+    uint16_t    vscpType;                   /**< VSCP type */
+    uint16_t    dataSize;                   /**< Number of data bytes of the original event */
+    uint8_t     guid[CAPTURE_GUID_SIZE];    /**< GUID, the LSB is the node nickname id */
+    uint8_t     data[CAPTURE_DATA_SIZE];    /**< Event data (see dataSize, but max. CAPTURE_DATA_SIZE bytes) */
+
+} capture_Record;
+
+/** This type contains the context of a capture file writer. */
+typedef struct
+{
+    FILE*       fd;                 /**< File descriptor */
+    uint64_t    startTime;          /**< Wall clock time of the capture start in s since epoch (UTC) */
+    uint64_t    startTimeMonotonic; /**< Monotonic time of the capture start in us */
+    uint64_t    lastSync;           /**< Monotonic time of the last synchronization in us */
+    uint32_t    syncPeriod;         /**< Synchronization period in ms */
+    uint64_t    recordCnt;          /**< Number of written records */
+    uint32_t    bufferIndex;        /**< Number of used bytes in the write buffer */
+    uint8_t     buffer[CAPTURE_WRITE_BUFFER_NUM * CAPTURE_RECORD_SIZE]; /**< Write buffer */
+
+} capture_Writer;
+
+/** This type contains the context of a capture file reader. */
+typedef struct
+{
+    FILE*       fd;         /**< File descriptor */
+    uint64_t    startTime;  /**< Wall clock time of the capture start in s since epoch (UTC) */
+
+} capture_Reader;
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function creates a new capture file and writes the file header.
+ * An already existing file will be overwritten.
+ *
+ * @param[out]  writer      Writer context
+ * @param[in]   fileName    Name of the capture file
+ * @param[in]   syncPeriod  Period in ms, after which the written data is synchronized with the storage device
+ *
+ * @return Status
+ */
+extern CAPTURE_RET capture_openWriter(capture_Writer * const writer, char const * const fileName, uint32_t syncPeriod);
+
+/**
+ * This function appends a record to the capture file. The timestamp of the
+ * record is set by the writer.
+ * The record is buffered and written to the file, if the buffer is full or
+ * by capture_processWriter().
+ *
+ * @param[in]       writer  Writer context
+ * @param[in,out]   record  Record
+ *
+ * @return Status
+ */
+extern CAPTURE_RET capture_write(capture_Writer * const writer, capture_Record * const record);
+
+/**
+ * This function shall be called periodically. It writes the buffered records
+ * to the file and synchronizes it with the storage device, after the
+ * configured synchronization period elapsed.
+ *
+ * @param[in]   writer  Writer context
+ *
+ * @return Status
+ */
+extern CAPTURE_RET capture_processWriter(capture_Writer * const writer);
+
+/**
+ * This function writes all buffered records, synchronizes the file with the
+ * storage device and closes it.
+ *
+ * @param[in]   writer  Writer context
+ *
+ * @return Status
+ */
+extern CAPTURE_RET capture_closeWriter(capture_Writer * const writer);
+
+/**
+ * This function opens a capture file for reading and verifies the file header.
+ *
+ * @param[out]  reader      Reader context
+ * @param[in]   fileName    Name of the capture file
+ *
+ * @return Status
+ */
+extern CAPTURE_RET capture_openReader(capture_Reader * const reader, char const * const fileName);
+
+/**
+ * This function reads the next record from the capture file.
+ * A partial written record at the end of the file is handled like the end of
+ * the file.
+ *
+ * @param[in]   reader  Reader context
+ * @param[out]  record  Record
+ *
+ * @return Status
+ * @retval CAPTURE_RET_OK   Record read
+ * @retval CAPTURE_RET_EOF  No further record available
+ */
+extern CAPTURE_RET capture_read(capture_Reader * const reader, capture_Record * const record);
+
+/**
+ * This function sets the read position to the given record.
+ *
+ * @param[in]   reader      Reader context
+ * @param[in]   recordIndex Index of the record, which shall be read next
+ *
+ * @return Status
+ */
+extern CAPTURE_RET capture_seek(capture_Reader * const reader, uint64_t recordIndex);
+
+/**
+ * This function determines the number of complete records in the capture file.
+ * The read position is not changed.
+ *
+ * @param[in]   reader      Reader context
+ * @param[out]  recordCnt   Number of records
+ *
+ * @return Status
+ */
+extern CAPTURE_RET capture_getRecordCnt(capture_Reader * const reader, uint64_t * const recordCnt);
+
+/**
+ * This function closes a capture file.
+ *
+ * @param[in]   reader  Reader context
+ */
+extern void capture_closeReader(capture_Reader * const reader);
+
+/**
+ * This function shows a record in the logger text format on the console.
+ *
+ * @param[in]   record      Record
+ * @param[in]   startTime   Wall clock time of the capture start in s since epoch (UTC)
+ */
+extern void capture_show(capture_Record const * const record, uint64_t startTime);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __CAPTURE_H__ */
+
+/** @} */
@@ -0,0 +1,923 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2019, Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  Capture file index
+@file   captureIndex.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see captureIndex.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "captureIndex.h"
+#include <stdlib.h>
+#include <string.h>
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Index file magic */
+#define CAPTUREINDEX_MAGIC          "VSCPIDX"
+
+/** Size of the index file magic in bytes (incl. string termination) */
+#define CAPTUREINDEX_MAGIC_SIZE     (8u)
+
+/** Initial number of allocated items of a list */
+#define CAPTUREINDEX_LIST_SIZE_INIT (16u)
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+static FILE* captureIndex_openFile(char const * const captureFileName, char const * const mode);
+static CAPTURE_RET captureIndex_appendBlock(captureIndex_List * const list, uint32_t block);
+static uint32_t captureIndex_findClass(captureIndex_Index const * const index, uint16_t vscpClass);
+static captureIndex_ClassEntry* captureIndex_getClassEntry(captureIndex_Index * const index, uint16_t vscpClass);
+static CAPTURE_RET captureIndex_intersect(captureIndex_List * const result, captureIndex_List const * const list);
+static BOOL captureIndex_writeUInt(FILE* fd, uint64_t value, uint8_t size);
+static BOOL captureIndex_readUInt(FILE* fd, uint64_t * const value, uint8_t size);
+static BOOL captureIndex_writeList(FILE* fd, captureIndex_List const * const list);
+static BOOL captureIndex_readList(FILE* fd, captureIndex_List * const list);
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function initializes an empty index.
+ *
+ * @param[out]  index   Index
+ */
+extern void captureIndex_init(captureIndex_Index * const index)
+{
+    if (NULL != index)
+    {
+        memset(index, 0, sizeof(captureIndex_Index));
+    }
+
+    return;
+}
+
+/**
+ * This function releases all resources of an index.
+ *
+ * @param[in]   index   Index
+ */
+extern void captureIndex_release(captureIndex_Index * const index)
+{
+    uint32_t    idx = 0;
+
+    if (NULL == index)
+    {
+        return;
+    }
+
+    free(index->buckets);
+
+    for(idx = 0; idx < index->classNum; ++idx)
+    {
+        captureIndex_releaseList(&index->classes[idx].blocks);
+    }
+
+    free(index->classes);
+
+    for(idx = 0; idx < CAPTURE_INDEX_NICKNAME_NUM; ++idx)
+    {
+        captureIndex_releaseList(&index->nicknames[idx]);
+    }
+
+    captureIndex_init(index);
+
+    return;
+}
+
+/**
+ * This function adds the next record of the capture file to the index.
+ * The records must be added in the same order as they are stored in the
+ * capture file.
+ *
+ * @param[in]   index   Index
+ * @param[in]   record  Record
+ *
+ * @return Status
+ */
+extern CAPTURE_RET captureIndex_add(captureIndex_Index * const index, capture_Record const * const record)
+{
+    uint64_t                    bucket      = 0;
+    uint32_t                    block       = 0;
+    captureIndex_ClassEntry*    classEntry  = NULL;
+
+    if ((NULL == index) ||
+        (NULL == record))
+    {
+        return CAPTURE_RET_ENULL;
+    }
+
+    /* The timestamps are monotonic, therefore all buckets up to the bucket of
+     * this record, which are not used yet, start with this record.
+     */
+    bucket = record->timestamp / (CAPTURE_INDEX_BUCKET_PERIOD * 1000u);
+
+    if (UINT32_MAX <= bucket)
+    {
+        return CAPTURE_RET_ERROR;
+    }
+
+    while(index->bucketNum <= bucket)
+    {
+        if (index->bucketNum >= index->bucketSize)
+        {
+            uint32_t    size    = (0 == index->bucketSize) ? CAPTUREINDEX_LIST_SIZE_INIT : (index->bucketSize * 2u);
+            uint64_t*   buckets = realloc(index->buckets, size * sizeof(uint64_t));
+
+            if (NULL == buckets)
+            {
+                return CAPTURE_RET_ERROR;
+            }
+
+            index->buckets      = buckets;
+            index->bucketSize   = size;
+        }
+
+        index->buckets[index->bucketNum] = index->recordCnt;
+        ++index->bucketNum;
+    }
+
+    block       = (uint32_t)(index->recordCnt / CAPTURE_INDEX_BLOCK_SIZE);
+    classEntry  = captureIndex_getClassEntry(index, record->vscpClass);
+
+    if (NULL == classEntry)
+    {
+        return CAPTURE_RET_ERROR;
+    }
+
+    if ((CAPTURE_RET_OK != captureIndex_appendBlock(&classEntry->blocks, block)) ||
+        (CAPTURE_RET_OK != captureIndex_appendBlock(&index->nicknames[record->guid[CAPTURE_GUID_SIZE - 1]], block)))
+    {
+        return CAPTURE_RET_ERROR;
+    }
+
+    ++index->recordCnt;
+
+    return CAPTURE_RET_OK;
+}
+
+/**
+ * This function builds the index by reading the whole capture file.
+ *
+ * @param[out]  index           Index
+ * @param[in]   captureFileName Name of the capture file
+ *
+ * @return Status
+ */
+extern CAPTURE_RET captureIndex_build(captureIndex_Index * const index, char const * const captureFileName)
+{
+    CAPTURE_RET     status  = CAPTURE_RET_OK;
+    capture_Reader  reader;
+    capture_Record  record;
+
+    if ((NULL == index) ||
+        (NULL == captureFileName))
+    {
+        return CAPTURE_RET_ENULL;
+    }
+
+    captureIndex_init(index);
+
+    status = capture_openReader(&reader, captureFileName);
+
+    if (CAPTURE_RET_OK != status)
+    {
+        return status;
+    }
+
+    while(CAPTURE_RET_OK == status)
+    {
+        status = capture_read(&reader, &record);
+
+        if (CAPTURE_RET_OK == status)
+        {
+            status = captureIndex_add(index, &record);
+        }
+    }
+
+    capture_closeReader(&reader);
+
+    if (CAPTURE_RET_EOF == status)
+    {
+        status = CAPTURE_RET_OK;
+    }
+    else
+    {
+        captureIndex_release(index);
+    }
+
+    return status;
+}
+
+/**
+ * This function writes the index to the index file of the given capture
+ * file. An already existing index file will be overwritten.
+ *
+ * @param[in]   index           Index
+ * @param[in]   captureFileName Name of the capture file
+ *
+ * @return Status
+ */
+extern CAPTURE_RET captureIndex_save(captureIndex_Index const * const index, char const * const captureFileName)
+{
+    FILE*       fd      = NULL;
+    BOOL        isOk    = TRUE;
+    uint32_t    idx     = 0;
+
+    if ((NULL == index) ||
+        (NULL == captureFileName))
+    {
+        return CAPTURE_RET_ENULL;
+    }
+
+    fd = captureIndex_openFile(captureFileName, "wb");
+
+    if (NULL == fd)
+    {
+        return CAPTURE_RET_ERROR;
+    }
+
+    isOk = (1 == fwrite(CAPTUREINDEX_MAGIC, CAPTUREINDEX_MAGIC_SIZE, 1, fd)) &&
+           captureIndex_writeUInt(fd, CAPTURE_INDEX_VERSION, 2) &&
+           captureIndex_writeUInt(fd, CAPTURE_INDEX_BLOCK_SIZE, 2) &&
+           captureIndex_writeUInt(fd, CAPTURE_INDEX_BUCKET_PERIOD, 4) &&
+           captureIndex_writeUInt(fd, index->recordCnt, 8) &&
+           captureIndex_writeUInt(fd, index->bucketNum, 4) &&
+           captureIndex_writeUInt(fd, index->classNum, 4);
+
+    for(idx = 0; (TRUE == isOk) && (idx < index->bucketNum); ++idx)
+    {
+        isOk = captureIndex_writeUInt(fd, index->buckets[idx], 8);
+    }
+
+    for(idx = 0; (TRUE == isOk) && (idx < index->classNum); ++idx)
+    {
+        isOk = captureIndex_writeUInt(fd, index->classes[idx].vscpClass, 2) &&
+               captureIndex_writeList(fd, &index->classes[idx].blocks);
+    }
+
+    for(idx = 0; (TRUE == isOk) && (idx < CAPTURE_INDEX_NICKNAME_NUM); ++idx)
+    {
+        isOk = captureIndex_writeList(fd, &index->nicknames[idx]);
+    }
+
+    if (0 != fclose(fd))
+    {
+        isOk = FALSE;
+    }
+
+    return (TRUE == isOk) ? CAPTURE_RET_OK : CAPTURE_RET_ERROR;
+}
+
+/**
+ * This function reads the index from the index file of the given capture
+ * file.
+ *
+ * @param[out]  index           Index
+ * @param[in]   captureFileName Name of the capture file
+ *
+ * @return Status
+ */
+extern CAPTURE_RET captureIndex_load(captureIndex_Index * const index, char const * const captureFileName)
+{
+    CAPTURE_RET status      = CAPTURE_RET_OK;
+    FILE*       fd          = NULL;
+    uint32_t    idx         = 0;
+    uint64_t    version     = 0;
+    uint64_t    blockSize   = 0;
+    uint64_t    period      = 0;
+    uint64_t    bucketNum   = 0;
+    uint64_t    classNum    = 0;
+    uint64_t    value       = 0;
+    uint8_t     magic[CAPTUREINDEX_MAGIC_SIZE];
+
+    if ((NULL == index) ||
+        (NULL == captureFileName))
+    {
+        return CAPTURE_RET_ENULL;
+    }
+
+    captureIndex_init(index);
+
+    fd = captureIndex_openFile(captureFileName, "rb");
+
+    if (NULL == fd)
+    {
+        return CAPTURE_RET_ERROR;
+    }
+
+    if ((1 != fread(magic, sizeof(magic), 1, fd)) ||
+        (0 != memcmp(magic, CAPTUREINDEX_MAGIC, CAPTUREINDEX_MAGIC_SIZE)) ||
+        (FALSE == captureIndex_readUInt(fd, &version, 2)) ||
+        (FALSE == captureIndex_readUInt(fd, &blockSize, 2)) ||
+        (FALSE == captureIndex_readUInt(fd, &period, 4)) ||
+        (FALSE == captureIndex_readUInt(fd, &index->recordCnt, 8)) ||
+        (FALSE == captureIndex_readUInt(fd, &bucketNum, 4)) ||
+        (FALSE == captureIndex_readUInt(fd, &classNum, 4)))
+    {
+        status = CAPTURE_RET_INVALID;
+    }
+    else if ((CAPTURE_INDEX_VERSION != version) ||
+             (CAPTURE_INDEX_BLOCK_SIZE != blockSize) ||
+             (CAPTURE_INDEX_BUCKET_PERIOD != period))
+    {
+        status = CAPTURE_RET_INVALID;
+    }
+    else
+    {
+        index->buckets      = (0 == bucketNum) ? NULL : malloc((size_t)bucketNum * sizeof(uint64_t));
+        index->classes      = (0 == classNum) ? NULL : calloc((size_t)classNum, sizeof(captureIndex_ClassEntry));
+        index->bucketSize   = (uint32_t)bucketNum;
+        index->classSize    = (uint32_t)classNum;
+
+        if (((0 < bucketNum) && (NULL == index->buckets)) ||
+            ((0 < classNum) && (NULL == index->classes)))
+        {
+            status = CAPTURE_RET_ERROR;
+        }
+    }
+
+    for(idx = 0; (CAPTURE_RET_OK == status) && (idx < bucketNum); ++idx)
+    {
+        if (FALSE == captureIndex_readUInt(fd, &index->buckets[idx], 8))
+        {
+            status = CAPTURE_RET_INVALID;
+        }
+        else
+        {
+            ++index->bucketNum;
+        }
+    }
+
+    for(idx = 0; (CAPTURE_RET_OK == status) && (idx < classNum); ++idx)
+    {
+        if ((FALSE == captureIndex_readUInt(fd, &value, 2)) ||
+            (FALSE == captureIndex_readList(fd, &index->classes[idx].blocks)))
+        {
+            status = CAPTURE_RET_INVALID;
+        }
+        else
+        {
+            index->classes[idx].vscpClass = (uint16_t)value;
+        }
+
+        /* Count the entry anyway, so a partial read list is released. */
+        ++index->classNum;
+    }
+
+    for(idx = 0; (CAPTURE_RET_OK == status) && (idx < CAPTURE_INDEX_NICKNAME_NUM); ++idx)
+    {
+        if (FALSE == captureIndex_readList(fd, &index->nicknames[idx]))
+        {
+            status = CAPTURE_RET_INVALID;
+        }
+    }
+
+    fclose(fd);
+
+    if (CAPTURE_RET_OK != status)
+    {
+        captureIndex_release(index);
+    }
+
+    return status;
+}
+
+/**
+ * This function initializes a query, which matches all records.
+ *
+ * @param[out]  query   Query
+ */
+extern void captureIndex_initQuery(captureIndex_Query * const query)
+{
+    if (NULL != query)
+    {
+        query->useClass     = FALSE;
+        query->vscpClass    = 0;
+        query->useNickname  = FALSE;
+        query->nickname     = 0;
+        query->from         = 0;
+        query->to           = UINT64_MAX;
+    }
+
+    return;
+}
+
+/**
+ * This function determines the blocks, which may contain records matching
+ * the query. Every record in the resulting blocks must still be checked with
+ * captureIndex_isMatch().
+ *
+ * @param[in]   index   Index
+ * @param[in]   query   Query
+ * @param[out]  blocks  Candidate blocks (shall be empty, released by the caller)
+ *
+ * @return Status
+ */
+extern CAPTURE_RET captureIndex_find(captureIndex_Index const * const index, captureIndex_Query const * const query, captureIndex_List * const blocks)
+{
+    CAPTURE_RET status      = CAPTURE_RET_OK;
+    uint64_t    bucket      = 0;
+    uint64_t    firstRecord = 0;
+    uint64_t    endRecord   = 0;
+    uint64_t    block       = 0;
+    uint64_t    firstBlock  = 0;
+    uint64_t    endBlock    = 0;
+
+    if ((NULL == index) ||
+        (NULL == query) ||
+        (NULL == blocks))
+    {
+        return CAPTURE_RET_ENULL;
+    }
+
+    if ((0 == index->bucketNum) ||
+        (query->from > query->to))
+    {
+        return CAPTURE_RET_OK;
+    }
+
+    /* Limit the record range by the time buckets. */
+    bucket = query->from / (CAPTURE_INDEX_BUCKET_PERIOD * 1000u);
+
+    if (index->bucketNum <= bucket)
+    {
+        firstRecord = index->recordCnt;
+    }
+    else
+    {
+        firstRecord = index->buckets[bucket];
+    }
+
+    bucket = query->to / (CAPTURE_INDEX_BUCKET_PERIOD * 1000u);
+
+    if ((index->bucketNum - 1u) <= bucket)
+    {
+        endRecord = index->recordCnt;
+    }
+    else
+    {
+        endRecord = index->buckets[bucket + 1u];
+    }
+
+    if (firstRecord >= endRecord)
+    {
+        return CAPTURE_RET_OK;
+    }
+
+    firstBlock  = firstRecord / CAPTURE_INDEX_BLOCK_SIZE;
+    endBlock    = (endRecord + CAPTURE_INDEX_BLOCK_SIZE - 1u) / CAPTURE_INDEX_BLOCK_SIZE;
+
+    /* The class posting list is usually the shorter one, therefore the
+     * intersection starts with it.
+     */
+    if (TRUE == query->useClass)
+    {
+        uint32_t                    classIdx    = captureIndex_findClass(index, query->vscpClass);
+        captureIndex_List const *   list        = NULL;
+
+        if (index->classNum <= classIdx)
+        {
+            return CAPTURE_RET_OK;
+        }
+
+        list = &index->classes[classIdx].blocks;
+
+        for(block = 0; (CAPTURE_RET_OK == status) && (block < list->num); ++block)
+        {
+            if ((firstBlock <= list->items[block]) &&
+                (endBlock > list->items[block]))
+            {
+                status = captureIndex_appendBlock(blocks, list->items[block]);
+            }
+        }
+
+        if ((CAPTURE_RET_OK == status) &&
+            (TRUE == query->useNickname))
+        {
+            status = captureIndex_intersect(blocks, &index->nicknames[query->nickname]);
+        }
+    }
+    else if (TRUE == query->useNickname)
+    {
+        captureIndex_List const *   list    = &index->nicknames[query->nickname];
+
+        for(block = 0; (CAPTURE_RET_OK == status) && (block < list->num); ++block)
+        {
+            if ((firstBlock <= list->items[block]) &&
+                (endBlock > list->items[block]))
+            {
+                status = captureIndex_appendBlock(blocks, list->items[block]);
+            }
+        }
+    }
+    else
+    {
+        for(block = firstBlock; (CAPTURE_RET_OK == status) && (block < endBlock); ++block)
+        {
+            status = captureIndex_appendBlock(blocks, (uint32_t)block);
+        }
+    }
+
+    return status;
+}
+
+/**
+ * This function checks whether a record matches the query.
+ *
+ * @param[in]   query   Query
+ * @param[in]   record  Record
+ *
+ * @return If the record matches, it will return TRUE otherwise FALSE.
+ */
+extern BOOL captureIndex_isMatch(captureIndex_Query const * const query, capture_Record const * const record)
+{
+    if ((NULL == query) ||
+        (NULL == record))
+    {
+        return FALSE;
+    }
+
+    if ((query->from > record->timestamp) ||
+        (query->to < record->timestamp))
+    {
+        return FALSE;
+    }
+
+    if ((TRUE == query->useClass) &&
+        (query->vscpClass != record->vscpClass))
+    {
+        return FALSE;
+    }
+
+    if ((TRUE == query->useNickname) &&
+        (query->nickname != record->guid[CAPTURE_GUID_SIZE - 1]))
+    {
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * This function releases the items of a block list.
+ *
+ * @param[in]   list    Block list
+ */
+extern void captureIndex_releaseList(captureIndex_List * const list)
+{
+    if (NULL != list)
+    {
+        free(list->items);
+        list->items = NULL;
+        list->num   = 0;
+        list->size  = 0;
+    }
+
+    return;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function opens the index file of the given capture file.
+ *
+ * @param[in]   captureFileName Name of the capture file
+ * @param[in]   mode            File access mode
+ *
+ * @return File descriptor or NULL, if failed.
+ */
+static FILE* captureIndex_openFile(char const * const captureFileName, char const * const mode)
+{
+    FILE*   fd          = NULL;
+    size_t  length      = strlen(captureFileName);
+    char*   fileName    = malloc(length + sizeof(CAPTURE_INDEX_FILE_EXT));
+
+    if (NULL != fileName)
+    {
+        memcpy(fileName, captureFileName, length);
+        memcpy(&fileName[length], CAPTURE_INDEX_FILE_EXT, sizeof(CAPTURE_INDEX_FILE_EXT));
+
+        fd = fopen(fileName, mode);
+
+        free(fileName);
+    }
+
+    return fd;
+}
+
+/**
+ * This function appends a block number to a list. If it is equal to the last
+ * one in the list, it will be skipped.
+ *
+ * @param[in]   list    Block list
+ * @param[in]   block   Block number
+ *
+ * @return Status
+ */
+static CAPTURE_RET captureIndex_appendBlock(captureIndex_List * const list, uint32_t block)
+{
+    if ((0 < list->num) &&
+        (block == list->items[list->num - 1u]))
+    {
+        return CAPTURE_RET_OK;
+    }
+
+    if (list->num >= list->size)
+    {
+        uint32_t    size    = (0 == list->size) ? CAPTUREINDEX_LIST_SIZE_INIT : (list->size * 2u);
+        uint32_t*   items   = realloc(list->items, size * sizeof(uint32_t));
+
+        if (NULL == items)
+        {
+            return CAPTURE_RET_ERROR;
+        }
+
+        list->items = items;
+        list->size  = size;
+    }
+
+    list->items[list->num] = block;
+    ++list->num;
+
+    return CAPTURE_RET_OK;
+}
+
+/**
+ * This function searches the class entry of the given VSCP class.
+ *
+ * @param[in]   index       Index
+ * @param[in]   vscpClass   VSCP class
+ *
+ * @return Index of the class entry or the number of class entries, if not found.
+ */
+static uint32_t captureIndex_findClass(captureIndex_Index const * const index, uint16_t vscpClass)
+{
+    uint32_t    idx = 0;
+
+    for(idx = 0; idx < index->classNum; ++idx)
+    {
+        if (vscpClass == index->classes[idx].vscpClass)
+        {
+            break;
+        }
+    }
+
+    return idx;
+}
+
+/**
+ * This function gets the class entry of the given VSCP class. If there is
+ * none yet, it will be created. Because consecutive records often have the
+ * same class, the last used entry is checked first.
+ *
+ * @param[in]   index       Index
+ * @param[in]   vscpClass   VSCP class
+ *
+ * @return Class entry or NULL, if out of memory.
+ */
+static captureIndex_ClassEntry* captureIndex_getClassEntry(captureIndex_Index * const index, uint16_t vscpClass)
+{
+    uint32_t    idx = 0;
+
+    if ((index->classLast < index->classNum) &&
+        (vscpClass == index->classes[index->classLast].vscpClass))
+    {
+        return &index->classes[index->classLast];
+    }
+
+    idx = captureIndex_findClass(index, vscpClass);
+
+    if (index->classNum > idx)
+    {
+        index->classLast = idx;
+        return &index->classes[idx];
+    }
+
+    if (index->classNum >= index->classSize)
+    {
+        uint32_t                    size    = (0 == index->classSize) ? CAPTUREINDEX_LIST_SIZE_INIT : (index->classSize * 2u);
+        captureIndex_ClassEntry*    classes = realloc(index->classes, size * sizeof(captureIndex_ClassEntry));
+
+        if (NULL == classes)
+        {
+            return NULL;
+        }
+
+        index->classes      = classes;
+        index->classSize    = size;
+    }
+
+    idx = index->classNum;
+    index->classes[idx].vscpClass = vscpClass;
+    memset(&index->classes[idx].blocks, 0, sizeof(captureIndex_List));
+    ++index->classNum;
+    index->classLast = idx;
+
+    return &index->classes[idx];
+}
+
+/**
+ * This function removes all block numbers from the result, which are not
+ * contained in the given list. Both lists are sorted in ascending order.
+ *
+ * @param[in,out]   result  Block list
+ * @param[in]       list    Block list
+ *
+ * @return Status
+ */
+static CAPTURE_RET captureIndex_intersect(captureIndex_List * const result, captureIndex_List const * const list)
+{
+    uint32_t    readIdx     = 0;
+    uint32_t    writeIdx    = 0;
+    uint32_t    listIdx     = 0;
+
+    for(readIdx = 0; readIdx < result->num; ++readIdx)
+    {
+        while((listIdx < list->num) &&
+              (list->items[listIdx] < result->items[readIdx]))
+        {
+            ++listIdx;
+        }
+
+        if (listIdx >= list->num)
+        {
+            break;
+        }
+
+        if (list->items[listIdx] == result->items[readIdx])
+        {
+            result->items[writeIdx] = result->items[readIdx];
+            ++writeIdx;
+        }
+    }
+
+    result->num = writeIdx;
+
+    return CAPTURE_RET_OK;
+}
+
+/**
+ * This function writes an unsigned value in little endian byte order to a file.
+ *
+ * @param[in]   fd      File descriptor
+ * @param[in]   value   Value
+ * @param[in]   size    Size of the value in bytes
+ *
+ * @return If successful, it will return TRUE otherwise FALSE.
+ */
+static BOOL captureIndex_writeUInt(FILE* fd, uint64_t value, uint8_t size)
+{
+    uint8_t buffer[8];
+    uint8_t idx = 0;
+
+    for(idx = 0; idx < size; ++idx)
+    {
+        buffer[idx] = (uint8_t)(value >> (8u * idx));
+    }
+
+    return (1 == fwrite(buffer, size, 1, fd)) ? TRUE : FALSE;
+}
+
+/**
+ * This function reads an unsigned value in little endian byte order from a file.
+ *
+ * @param[in]   fd      File descriptor
+ * @param[out]  value   Value
+ * @param[in]   size    Size of the value in bytes
+ *
+ * @return If successful, it will return TRUE otherwise FALSE.
+ */
+static BOOL captureIndex_readUInt(FILE* fd, uint64_t * const value, uint8_t size)
+{
+    uint8_t buffer[8];
+    uint8_t idx = 0;
+
+    if (1 != fread(buffer, size, 1, fd))
+    {
+        return FALSE;
+    }
+
+    *value = 0;
+
+    for(idx = 0; idx < size; ++idx)
+    {
+        *value |= ((uint64_t)buffer[idx]) << (8u * idx);
+    }
+
+    return TRUE;
+}
+
+/**
+ * This function writes a block list to a file.
+ *
+ * @param[in]   fd      File descriptor
+ * @param[in]   list    Block list
+ *
+ * @return If successful, it will return TRUE otherwise FALSE.
+ */
+static BOOL captureIndex_writeList(FILE* fd, captureIndex_List const * const list)
+{
+    BOOL        isOk    = TRUE;
+    uint32_t    idx     = 0;
+
+    isOk = captureIndex_writeUInt(fd, list->num, 4);
+
+    for(idx = 0; (TRUE == isOk) && (idx < list->num); ++idx)
+    {
+        isOk = captureIndex_writeUInt(fd, list->items[idx], 4);
+    }
+
+    return isOk;
+}
+
+/**
+ * This function reads a block list from a file.
+ *
+ * @param[in]   fd      File descriptor
+ * @param[out]  list    Block list
+ *
+ * @return If successful, it will return TRUE otherwise FALSE.
+ */
+static BOOL captureIndex_readList(FILE* fd, captureIndex_List * const list)
+{
+    uint64_t    num     = 0;
+    uint64_t    value   = 0;
+    uint32_t    idx     = 0;
+
+    if (FALSE == captureIndex_readUInt(fd, &num, 4))
+    {
+        return FALSE;
+    }
+
+    for(idx = 0; idx < num; ++idx)
+    {
+        if ((FALSE == captureIndex_readUInt(fd, &value, 4)) ||
+            (CAPTURE_RET_OK != captureIndex_appendBlock(list, (uint32_t)value)))
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
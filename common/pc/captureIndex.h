@@ -0,0 +1,264 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2019, Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  Capture file index
+@file   captureIndex.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module provides a sidecar index for capture files. It allows to find the
+records of a time range, a VSCP class or a node nickname without scanning the
+whole capture file.
+
+The capture file is divided into blocks of CAPTURE_INDEX_BLOCK_SIZE records.
+The index contains:
+- A time bucket table, which contains for every bucket of
+  CAPTURE_INDEX_BUCKET_PERIOD ms the index of the first record in it.
+- A posting list per VSCP class, which contains the numbers of the blocks
+  with at least one event of this class.
+- A posting list per nickname, which contains the numbers of the blocks with
+  at least one event of this node.
+
+A query results in a list of candidate blocks, which have to be read and
+filtered record by record.
+
+The index file is written by the logger after the capture is finished. If it
+is missing or outdated, it can be rebuilt from the capture file.
+
+*******************************************************************************/
+/** @defgroup captureIndex Capture file index
+ * Find records in a capture file without scanning the whole file.
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __CAPTUREINDEX_H__
+#define __CAPTUREINDEX_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include "capture.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Index file format version */
+#define CAPTURE_INDEX_VERSION       (1u)
+
+/** Number of records per block */
+#define CAPTURE_INDEX_BLOCK_SIZE    (256u)
+
+/** Period of a time bucket in ms */
+#define CAPTURE_INDEX_BUCKET_PERIOD (1000u)
+
+/** Number of nicknames */
+#define CAPTURE_INDEX_NICKNAME_NUM  (256u)
+
+/** File name extension of the index file, which is appended to the capture file name. */
+#define CAPTURE_INDEX_FILE_EXT      ".idx"
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/** This type defines a sorted list of block numbers. */
+typedef struct
+{
+    uint32_t*   items;  /**< Block numbers in ascending order */
+    uint32_t    num;    /**< Number of used items */
+    uint32_t    size;   /**< Number of allocated items */
+
+} captureIndex_List;
+
+/** This type defines the posting list of a single VSCP class. */
+typedef struct
+{
+    uint16_t            vscpClass;  /**< VSCP class */
+    captureIndex_List   blocks;     /**< Blocks which contain the class */
+
+} captureIndex_ClassEntry;
+
+/** This type contains the index of a capture file. */
+typedef struct
+{
+    uint64_t                    recordCnt;      /**< Number of indexed records */
+    uint64_t*                   buckets;        /**< Index of the first record per time bucket */
+    uint32_t                    bucketNum;      /**< Number of used time buckets */
+    uint32_t                    bucketSize;     /**< Number of allocated time buckets */
+    captureIndex_ClassEntry*    classes;        /**< Posting lists per VSCP class */
+    uint32_t                    classNum;       /**< Number of used class entries */
+    uint32_t                    classSize;      /**< Number of allocated class entries */
+    uint32_t                    classLast;      /**< Class entry of the last added record */
+    captureIndex_List           nicknames[CAPTURE_INDEX_NICKNAME_NUM];  /**< Posting lists per nickname */
+
+} captureIndex_Index;
+
+/** This type defines a query. */
+typedef struct
+{
+    BOOL        useClass;       /**< Filter by VSCP class */
+    uint16_t    vscpClass;      /**< VSCP class */
+    BOOL        useNickname;    /**< Filter by nickname */
+    uint8_t     nickname;       /**< Node nickname */
+    uint64_t    from;           /**< Begin of the time range in us since capture start */
+    uint64_t    to;             /**< End of the time range in us since capture start (inclusive) */
+
+} captureIndex_Query;
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function initializes an empty index.
+ *
+ * @param[out]  index   Index
+ */
+extern void captureIndex_init(captureIndex_Index * const index);
+
+/**
+ * This function releases all resources of an index.
+ *
+ * @param[in]   index   Index
+ */
+extern void captureIndex_release(captureIndex_Index * const index);
+
+/**
+ * This function adds the next record of the capture file to the index.
+ * The records must be added in the same order as they are stored in the
+ * capture file.
+ *
+ * @param[in]   index   Index
+ * @param[in]   record  Record
+ *
+ * @return Status
+ */
+extern CAPTURE_RET captureIndex_add(captureIndex_Index * const index, capture_Record const * const record);
+
+/**
+ * This function builds the index by reading the whole capture file.
+ *
+ * @param[out]  index           Index
+ * @param[in]   captureFileName Name of the capture file
+ *
+ * @return Status
+ */
+extern CAPTURE_RET captureIndex_build(captureIndex_Index * const index, char const * const captureFileName);
+
+/**
+ * This function writes the index to the index file of the given capture
+ * file. An already existing index file will be overwritten.
+ *
+ * @param[in]   index           Index
+ * @param[in]   captureFileName Name of the capture file
+ *
+ * @return Status
+ */
+extern CAPTURE_RET captureIndex_save(captureIndex_Index const * const index, char const * const captureFileName);
+
+/**
+ * This function reads the index from the index file of the given capture
+ * file.
+ *
+ * @param[out]  index           Index
+ * @param[in]   captureFileName Name of the capture file
+ *
+ * @return Status
+ */
+extern CAPTURE_RET captureIndex_load(captureIndex_Index * const index, char const * const captureFileName);
+
+/**
+ * This function initializes a query, which matches all records.
+ *
+ * @param[out]  query   Query
+ */
+extern void captureIndex_initQuery(captureIndex_Query * const query);
+
+/**
+ * This function determines the blocks, which may contain records matching
+ * the query. Every record in the resulting blocks must still be checked with
+ * captureIndex_isMatch().
+ *
+ * @param[in]   index   Index
+ * @param[in]   query   Query
+ * @param[out]  blocks  Candidate blocks (shall be empty, released by the caller)
+ *
+ * @return Status
+ */
+extern CAPTURE_RET captureIndex_find(captureIndex_Index const * const index, captureIndex_Query const * const query, captureIndex_List * const blocks);
+
+/**
+ * This function checks whether a record matches the query.
+ *
+ * @param[in]   query   Query
+ * @param[in]   record  Record
+ *
+ * @return If the record matches, it will return TRUE otherwise FALSE.
+ */
+extern BOOL captureIndex_isMatch(captureIndex_Query const * const query, capture_Record const * const record);
+
+/**
+ * This function releases the items of a block list.
+ *
+ * @param[in]   list    Block list
+ */
+extern void captureIndex_releaseList(captureIndex_List * const list);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __CAPTUREINDEX_H__ */
+
+/** @} */
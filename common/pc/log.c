@@ -35,6 +35,13 @@
 @section desc Description
 @see log.h
 
+After log_init() all messages are formatted on the caller's thread into fixed
+size records of a bounded lock-free ring (multiple producers, single consumer).
+A writer thread takes them out in batches, prefixes the timestamp and writes
+them to stdout. The caller never waits for the console and never takes a lock,
+only if the ring is full it yields until the writer thread made room.
+Without log_init() the messages are written synchronous.
+
 *******************************************************************************/
 
 /*******************************************************************************
@@ -46,6 +53,8 @@
 #include <time.h>
 #include <string.h>
 #include <pthread.h>
+#include <sched.h>
+#include "platform.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -55,6 +64,15 @@
     CONSTANTS
 *******************************************************************************/
 
+/** Number of records in the ring. Must be a power of two. */
+#define LOG_RING_SIZE           1024
+
+/** Max. text size of a single record, including the string termination. */
+#define LOG_RECORD_TEXT_SIZE    256
+
+/** Time in ms the writer thread sleeps, if the ring is empty. */
+#define LOG_WRITER_IDLE_TIME    1
+
 /*******************************************************************************
     MACROS
 *******************************************************************************/
@@ -63,12 +81,28 @@
     TYPES AND STRUCTURES
 *******************************************************************************/
 
+/** This type defines a single log record in the ring. */
+typedef struct
+{
+    uint32_t    sequence;                   /**< Sequence number, which synchronizes producers and consumer */
+    time_t      timestamp;                  /**< Time when the message was logged */
+    uint16_t    len;                        /**< Text length without string termination */
+    char        text[LOG_RECORD_TEXT_SIZE]; /**< Formatted text */
+
+} log_Record;
+
 /*******************************************************************************
     PROTOTYPES
 *******************************************************************************/
 
 static char const * const   log_getLogLevelStr(LOG_LEVEL level);
 static const char * log_getFileNameOnly(char const * const fileName);
+static void log_vprintf(char const * const format, va_list args);
+static log_Record* log_ringReserve(void);
+static void log_ringCommit(log_Record* record);
+static uint32_t log_ringWrite(FILE* stream);
+static char const * log_getTimestampStr(time_t timestamp);
+static void* log_writerThread(void* par);
 
 /*******************************************************************************
     LOCAL VARIABLES
@@ -77,9 +111,33 @@ static const char * log_getFileNameOnly(char const * const fileName);
 /** The current log level in the system. */
 static unsigned int     log_logLevel    = 0;
 
-/** Mutex used to protect the log_printf() */
+/** Mutex used to protect the log_printf() in synchronous mode */
 static pthread_mutex_t  log_mutex       = PTHREAD_MUTEX_INITIALIZER;
 
+/** Log record ring */
+static log_Record       log_ring[LOG_RING_SIZE];
+
+/** Next ring position, a producer will reserve. */
+static uint32_t         log_ringEnqueuePos  = 0;
+
+/** Next ring position, the writer thread will take out. Used only by the writer thread. */
+static uint32_t         log_ringDequeuePos  = 0;
+
+/** Is the writer thread running and the asynchronous mode active? */
+static BOOL             log_isAsync         = FALSE;
+
+/** Flag to signal the writer thread to quit */
+static BOOL             log_quitFlag        = FALSE;
+
+/** Writer thread id */
+static pthread_t        log_writerThreadId;
+
+/** Timestamp of the cached timestamp string */
+static time_t           log_timestampCached = 0;
+
+/** Cached timestamp string, which is updated only once per second. */
+static char             log_timestampStr[32] = "";
+
 /*******************************************************************************
     GLOBAL VARIABLES
 *******************************************************************************/
@@ -89,11 +147,49 @@ static pthread_mutex_t  log_mutex       = PTHREAD_MUTEX_INITIALIZER;
 *******************************************************************************/
 
 /**
- * This function intializes the module.
+ * This function intializes the module and starts the writer thread. From now on
+ * all messages are written asynchronous.
  */
 extern void log_init(void)
 {
-    /* Nothing to do */
+    uint32_t    index   = 0;
+
+    if (FALSE == log_isAsync)
+    {
+        for(index = 0; index < LOG_RING_SIZE; ++index)
+        {
+            log_ring[index].sequence = index;
+        }
+
+        log_ringEnqueuePos  = 0;
+        log_ringDequeuePos  = 0;
+        log_quitFlag        = FALSE;
+
+        if (0 == pthread_create(&log_writerThreadId, NULL, log_writerThread, NULL))
+        {
+            __atomic_store_n(&log_isAsync, TRUE, __ATOMIC_RELEASE);
+        }
+    }
+
+    return;
+}
+
+/**
+ * This function de-initializes the module. It writes all pending messages and
+ * stops the writer thread. Call it only after all other threads, which log, are
+ * stopped.
+ */
+extern void log_deInit(void)
+{
+    if (FALSE != log_isAsync)
+    {
+        __atomic_store_n(&log_quitFlag, TRUE, __ATOMIC_RELEASE);
+
+        /* Wait for the writer thread, until all pending messages are written. */
+        (void)pthread_join(log_writerThreadId, NULL);
+
+        __atomic_store_n(&log_isAsync, FALSE, __ATOMIC_RELEASE);
+    }
 
     return;
 }
@@ -198,29 +294,12 @@ extern void log_writeParStr(char const * const fileName, int line, uint8_t logLe
  */
 extern void log_printf(char const * const format, ...)
 {
-    va_list     args;
-    time_t      rawtime;
-    struct tm * timeInfo;
-
-    time(&rawtime);
-    timeInfo = localtime(&rawtime);
-
-    (void)pthread_mutex_lock(&log_mutex);
-
-    printf("%04u-%02u-%02u %02u:%02u:%02u ",
-        timeInfo->tm_year + 1900,
-        timeInfo->tm_mon + 1,
-        timeInfo->tm_mday,
-        timeInfo->tm_hour,
-        timeInfo->tm_min,
-        timeInfo->tm_sec);
+    va_list args;
 
     va_start(args, format);
-    vprintf(format, args);
+    log_vprintf(format, args);
     va_end(args);
 
-    (void)pthread_mutex_unlock(&log_mutex);
-
     return;
 }
 
@@ -228,6 +307,219 @@ extern void log_printf(char const * const format, ...)
     LOCAL FUNCTIONS
 *******************************************************************************/
 
+/**
+ * This function writes a message with the current date and time in front. In
+ * asynchronous mode the message is only formatted into a record of the ring and
+ * the writer thread does the rest.
+ *
+ * @param[in]   format  Format
+ * @param[in]   args    Variable argument list
+ */
+static void log_vprintf(char const * const format, va_list args)
+{
+    time_t  rawtime;
+
+    time(&rawtime);
+
+    if (FALSE != __atomic_load_n(&log_isAsync, __ATOMIC_ACQUIRE))
+    {
+        log_Record* record  = log_ringReserve();
+        int         len     = 0;
+
+        /* Ring full? Give the writer thread the chance to make room. */
+        while(NULL == record)
+        {
+            (void)sched_yield();
+            record = log_ringReserve();
+        }
+
+        len = vsnprintf(record->text, LOG_RECORD_TEXT_SIZE, format, args);
+
+        if (0 > len)
+        {
+            len = 0;
+        }
+        /* Message truncated? */
+        else if (LOG_RECORD_TEXT_SIZE <= len)
+        {
+            len = LOG_RECORD_TEXT_SIZE - 1;
+            memcpy(&record->text[len - 4], "...\n", 4);
+        }
+
+        record->timestamp   = rawtime;
+        record->len         = (uint16_t)len;
+
+        log_ringCommit(record);
+    }
+    else
+    {
+        (void)pthread_mutex_lock(&log_mutex);
+
+        printf("%s", log_getTimestampStr(rawtime));
+        vprintf(format, args);
+
+        (void)pthread_mutex_unlock(&log_mutex);
+    }
+
+    return;
+}
+
+/**
+ * This function reserves the next free record in the ring. It is safe to be
+ * called by several threads concurrently.
+ *
+ * @return Record or NULL, if the ring is full
+ */
+static log_Record* log_ringReserve(void)
+{
+    log_Record* record  = NULL;
+    uint32_t    pos     = __atomic_load_n(&log_ringEnqueuePos, __ATOMIC_RELAXED);
+
+    for(;;)
+    {
+        uint32_t    sequence    = 0;
+        int32_t     diff        = 0;
+
+        record      = &log_ring[pos & (LOG_RING_SIZE - 1)];
+        sequence    = __atomic_load_n(&record->sequence, __ATOMIC_ACQUIRE);
+        diff        = (int32_t)(sequence - pos);
+
+        /* Record is free? */
+        if (0 == diff)
+        {
+            /* If another producer was faster, pos is updated and the next try starts. */
+            if (FALSE != __atomic_compare_exchange_n(&log_ringEnqueuePos, &pos, pos + 1, TRUE, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            {
+                break;
+            }
+        }
+        /* Record is still not written by the writer thread, the ring is full. */
+        else if (0 > diff)
+        {
+            record = NULL;
+            break;
+        }
+        else
+        {
+            pos = __atomic_load_n(&log_ringEnqueuePos, __ATOMIC_RELAXED);
+        }
+    }
+
+    return record;
+}
+
+/**
+ * This function hands over a reserved and filled record to the writer thread.
+ *
+ * @param[in]   record  Record
+ */
+static void log_ringCommit(log_Record* record)
+{
+    /* The sequence of a reserved record is the reserved position. */
+    __atomic_store_n(&record->sequence, record->sequence + 1, __ATOMIC_RELEASE);
+
+    return;
+}
+
+/**
+ * This function writes all committed records to the given stream and releases
+ * them for the producers. Called only by the writer thread.
+ *
+ * @param[in]   stream  Output stream
+ * @return Number of written records
+ */
+static uint32_t log_ringWrite(FILE* stream)
+{
+    uint32_t    num     = 0;
+
+    for(;;)
+    {
+        log_Record* record      = &log_ring[log_ringDequeuePos & (LOG_RING_SIZE - 1)];
+        uint32_t    sequence    = __atomic_load_n(&record->sequence, __ATOMIC_ACQUIRE);
+
+        /* Record not committed yet? */
+        if ((log_ringDequeuePos + 1) != sequence)
+        {
+            break;
+        }
+
+        fputs(log_getTimestampStr(record->timestamp), stream);
+        fwrite(record->text, 1, record->len, stream);
+
+        /* Release the record for the next round */
+        __atomic_store_n(&record->sequence, log_ringDequeuePos + LOG_RING_SIZE, __ATOMIC_RELEASE);
+        ++log_ringDequeuePos;
+        ++num;
+    }
+
+    if (0 < num)
+    {
+        fflush(stream);
+    }
+
+    return num;
+}
+
+/**
+ * This function returns the date and time as string, with a trailing space.
+ * The string is only generated again, if the second changed. Don't call it
+ * concurrently.
+ *
+ * @param[in]   timestamp   Timestamp
+ * @return Timestamp string
+ */
+static char const * log_getTimestampStr(time_t timestamp)
+{
+    if (('\0' == log_timestampStr[0]) ||
+        (log_timestampCached != timestamp))
+    {
+        struct tm * timeInfo    = localtime(&timestamp);
+
+        snprintf(log_timestampStr, sizeof(log_timestampStr), "%04u-%02u-%02u %02u:%02u:%02u ",
+            timeInfo->tm_year + 1900,
+            timeInfo->tm_mon + 1,
+            timeInfo->tm_mday,
+            timeInfo->tm_hour,
+            timeInfo->tm_min,
+            timeInfo->tm_sec);
+
+        log_timestampCached = timestamp;
+    }
+
+    return log_timestampStr;
+}
+
+/**
+ * This thread writes the logged messages in batches to stdout, until it shall
+ * quit and all pending messages are written.
+ *
+ * @param[in]   par Thread parameters (not used)
+ * @return Not used
+ */
+static void* log_writerThread(void* par)
+{
+    (void)par;
+
+    for(;;)
+    {
+        BOOL    quitFlag    = __atomic_load_n(&log_quitFlag, __ATOMIC_ACQUIRE);
+
+        if (0 == log_ringWrite(stdout))
+        {
+            if (FALSE != quitFlag)
+            {
+                break;
+            }
+
+            platform_delay(LOG_WRITER_IDLE_TIME);
+        }
+    }
+
+    pthread_exit(NULL);
+
+    return NULL;
+}
+
 /**
  * Get a user friendly string for a given log level.
  *
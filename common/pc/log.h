@@ -155,10 +155,18 @@ typedef enum
 *******************************************************************************/
 
 /**
- * This function intializes the module.
+ * This function intializes the module and starts the writer thread. From now on
+ * all messages are written asynchronous.
  */
 extern void log_init(void);
 
+/**
+ * This function de-initializes the module. It writes all pending messages and
+ * stops the writer thread. Call it only after all other threads, which log, are
+ * stopped.
+ */
+extern void log_deInit(void);
+
 /**
  * This function sets the log level. The log level can be a sum of several single
  * log level. Use OR to combine them.
@@ -46,6 +46,9 @@
 #ifdef _WIN32
 
 #include <conio.h>
+#include <io.h>
+#include <sys/types.h>
+#include <sys/stat.h>
 
 #endif  /* _WIN32 */
 
@@ -53,7 +56,11 @@
 
 #include <termios.h>
 #include <sys/select.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
 #include <unistd.h>
+#include <time.h>
 
 #endif  /* __linux__ */
 
@@ -84,6 +91,7 @@ static void platform_win_echoOn(void);
 static int platform_win_kbhit(void);
 static int platform_win_getch(void);
 static void platform_win_sleepMS(long valueMS);
+static uint64_t platform_win_getMonotonicTime(void);
 static void platform_win_setTextColor(PLATFORM_COLOR color);
 static void platform_win_setTextBgColor(PLATFORM_COLOR color);
 static uint8_t  platform_win_getTextColor(void);
@@ -97,6 +105,7 @@ static void platform_linux_echoOn(void);
 static int platform_linux_kbhit(void);
 static int platform_linux_getch(void);
 static void platform_linux_sleepMS(long valueMS);
+static uint64_t platform_linux_getMonotonicTime(void);
 static void platform_linux_setTextColor(PLATFORM_COLOR color);
 static void platform_linux_setTextBgColor(PLATFORM_COLOR color);
 
@@ -362,6 +371,305 @@ extern void platform_delay(long valueMS)
     return;
 }
 
+/**
+ * This function returns the time of a monotonic clock in us. The clock is not
+ * affected by changes of the system time and its start point is unspecified.
+ * Use it only to measure time differences.
+ *
+ * @return Monotonic time in us
+ */
+extern uint64_t platform_getMonotonicTime(void)
+{
+#ifdef _WIN32
+
+    return platform_win_getMonotonicTime();
+
+#endif  /* _WIN32 */
+
+#ifdef __linux__
+
+    return platform_linux_getMonotonicTime();
+
+#endif  /* __linux__ */
+
+    return 0;
+}
+
+/**
+ * This function writes all buffered data of a file to the storage device.
+ *
+ * @param[in] fd    File
+ * @return Status
+ * @retval 0    Successful
+ * @retval < 0  Failed
+ */
+extern int platform_syncFile(FILE* fd)
+{
+    if (NULL == fd)
+    {
+        return -1;
+    }
+
+    if (0 != fflush(fd))
+    {
+        return -1;
+    }
+
+#ifdef _WIN32
+
+    if (0 != _commit(_fileno(fd)))
+    {
+        return -1;
+    }
+
+#endif  /* _WIN32 */
+
+#ifdef __linux__
+
+    if (0 != fsync(fileno(fd)))
+    {
+        return -1;
+    }
+
+#endif  /* __linux__ */
+
+    return 0;
+}
+
+/**
+ * This function gets the time of the last modification of a file.
+ *
+ * @param[in]   fileName    Name of the file
+ * @param[out]  modTime     Time of the last modification
+ * @return Status
+ * @retval 0    Successful
+ * @retval < 0  Failed, e.g. the file doesn't exist
+ */
+extern int platform_getFileTime(char const * const fileName, time_t * const modTime)
+{
+    struct stat fileStat;
+
+    if ((NULL == fileName) ||
+        (NULL == modTime))
+    {
+        return -1;
+    }
+
+    if (0 != stat(fileName, &fileStat))
+    {
+        return -1;
+    }
+
+    *modTime = fileStat.st_mtime;
+
+    return 0;
+}
+
+/**
+ * This function maps a file shared into memory, for read and write access.
+ * If the file doesn't exist, it will be created. If the file size differs
+ * from the requested size, the file is resized. Additional space is zeroed.
+ * Changes of the mapped content are written to the file by the operating
+ * system, even if the program crashes.
+ *
+ * @param[out]  mappedFile  Mapped file
+ * @param[in]   fileName    Name of the file
+ * @param[in]   size        Size of the mapped file content in bytes
+ * @return Status
+ * @retval 0    Successful
+ * @retval < 0  Failed
+ */
+extern int platform_mapFile(platform_MappedFile * const mappedFile, char const * const fileName, size_t size)
+{
+    if ((NULL == mappedFile) ||
+        (NULL == fileName) ||
+        (0 == size))
+    {
+        return -1;
+    }
+
+    mappedFile->addr = NULL;
+    mappedFile->size = size;
+
+#ifdef _WIN32
+    {
+        LARGE_INTEGER   fileSize;
+        void*           addr        = NULL;
+
+        fileSize.QuadPart = (LONGLONG)size;
+
+        mappedFile->mapping = NULL;
+        mappedFile->file    = CreateFileA(fileName, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, NULL, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+
+        if (INVALID_HANDLE_VALUE == mappedFile->file)
+        {
+            return -1;
+        }
+
+        if ((FALSE == SetFilePointerEx(mappedFile->file, fileSize, NULL, FILE_BEGIN)) ||
+            (FALSE == SetEndOfFile(mappedFile->file)))
+        {
+            CloseHandle(mappedFile->file);
+            return -1;
+        }
+
+        mappedFile->mapping = CreateFileMappingA(mappedFile->file, NULL, PAGE_READWRITE, 0, 0, NULL);
+
+        if (NULL != mappedFile->mapping)
+        {
+            addr = MapViewOfFile(mappedFile->mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+        }
+
+        if (NULL == addr)
+        {
+            if (NULL != mappedFile->mapping)
+            {
+                CloseHandle(mappedFile->mapping);
+            }
+
+            CloseHandle(mappedFile->file);
+            return -1;
+        }
+
+        mappedFile->addr = (uint8_t*)addr;
+    }
+#endif  /* _WIN32 */
+
+#ifdef __linux__
+    {
+        struct stat fileStat;
+        void*       addr        = MAP_FAILED;
+
+        mappedFile->fd = open(fileName, O_RDWR | O_CREAT, 0644);
+
+        if (0 > mappedFile->fd)
+        {
+            return -1;
+        }
+
+        if ((0 != fstat(mappedFile->fd, &fileStat)) ||
+            ((size != (size_t)fileStat.st_size) && (0 != ftruncate(mappedFile->fd, (off_t)size))))
+        {
+            close(mappedFile->fd);
+            return -1;
+        }
+
+        addr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, mappedFile->fd, 0);
+
+        if (MAP_FAILED == addr)
+        {
+            close(mappedFile->fd);
+            return -1;
+        }
+
+        mappedFile->addr = (uint8_t*)addr;
+    }
+#endif  /* __linux__ */
+
+    return 0;
+}
+
+/**
+ * This function writes the changed content of a mapped file to the storage
+ * device and waits until it is finished.
+ *
+ * @param[in] mappedFile    Mapped file
+ * @return Status
+ * @retval 0    Successful
+ * @retval < 0  Failed
+ */
+extern int platform_syncMappedFile(platform_MappedFile * const mappedFile)
+{
+    if (NULL == mappedFile)
+    {
+        return -1;
+    }
+
+    return platform_syncMappedFileRange(mappedFile, 0, mappedFile->size);
+}
+
+/**
+ * This function writes the changed content of a part of a mapped file to the
+ * storage device and waits until it is finished. The part is extended to the
+ * memory pages, which contain it.
+ *
+ * @param[in] mappedFile    Mapped file
+ * @param[in] offset        Offset of the part in bytes
+ * @param[in] size          Size of the part in bytes
+ * @return Status
+ * @retval 0    Successful
+ * @retval < 0  Failed
+ */
+extern int platform_syncMappedFileRange(platform_MappedFile * const mappedFile, size_t offset, size_t size)
+{
+    if ((NULL == mappedFile) ||
+        (NULL == mappedFile->addr) ||
+        (mappedFile->size < offset) ||
+        ((mappedFile->size - offset) < size))
+    {
+        return -1;
+    }
+
+#ifdef _WIN32
+
+    /* The start address is rounded down to the page boundary by the system. */
+    if ((FALSE == FlushViewOfFile(&mappedFile->addr[offset], size)) ||
+        (FALSE == FlushFileBuffers(mappedFile->file)))
+    {
+        return -1;
+    }
+
+#endif  /* _WIN32 */
+
+#ifdef __linux__
+    {
+        size_t const    pageSize    = (size_t)sysconf(_SC_PAGESIZE);
+        size_t const    pageOffset  = offset - (offset % pageSize);
+
+        /* The start address has to be page aligned. */
+        if (0 != msync(&mappedFile->addr[pageOffset], size + (offset - pageOffset), MS_SYNC))
+        {
+            return -1;
+        }
+    }
+#endif  /* __linux__ */
+
+    return 0;
+}
+
+/**
+ * This function removes the mapping of a file and closes it.
+ *
+ * @param[in] mappedFile    Mapped file
+ */
+extern void platform_unmapFile(platform_MappedFile * const mappedFile)
+{
+    if ((NULL == mappedFile) ||
+        (NULL == mappedFile->addr))
+    {
+        return;
+    }
+
+#ifdef _WIN32
+
+    (void)UnmapViewOfFile(mappedFile->addr);
+    (void)CloseHandle(mappedFile->mapping);
+    (void)CloseHandle(mappedFile->file);
+
+#endif  /* _WIN32 */
+
+#ifdef __linux__
+
+    (void)munmap(mappedFile->addr, mappedFile->size);
+    (void)close(mappedFile->fd);
+
+#endif  /* __linux__ */
+
+    mappedFile->addr = NULL;
+
+    return;
+}
+
 /**
  * Set text foreground color.
  *
@@ -517,6 +825,23 @@ static void platform_win_sleepMS(long valueMS)
     return;
 }
 
+/**
+ * This function returns the time of a monotonic clock in us.
+ *
+ * @return Monotonic time in us
+ */
+static uint64_t platform_win_getMonotonicTime(void)
+{
+    LARGE_INTEGER   counter;
+    LARGE_INTEGER   frequency;
+
+    (void)QueryPerformanceCounter(&counter);
+    (void)QueryPerformanceFrequency(&frequency);
+
+    return ((uint64_t)(counter.QuadPart / frequency.QuadPart)) * 1000000u +
+           ((uint64_t)(counter.QuadPart % frequency.QuadPart)) * 1000000u / (uint64_t)frequency.QuadPart;
+}
+
 /**
  * Set text foreground color.
  *
@@ -688,6 +1013,20 @@ static void platform_linux_sleepMS(long valueMS)
     return;
 }
 
+/**
+ * This function returns the time of a monotonic clock in us.
+ *
+ * @return Monotonic time in us
+ */
+static uint64_t platform_linux_getMonotonicTime(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec) * 1000000u + ((uint64_t)now.tv_nsec) / 1000u;
+}
+
 /**
  * Set text foreground color.
  *
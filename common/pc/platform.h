@@ -55,6 +55,8 @@ encapsulates the platform dependent code.
     INCLUDES
 *******************************************************************************/
 #include <stdint.h>
+#include <stdio.h>
+#include <time.h>
 
 #ifdef _WIN32
 
@@ -120,6 +122,27 @@ typedef enum
 
 } PLATFORM_COLOR;
 
+/** This type contains a file, which is mapped into memory. */
+typedef struct
+{
+    uint8_t*    addr;       /**< Address of the mapped file content */
+    size_t      size;       /**< Size of the mapped file content in bytes */
+
+#ifdef _WIN32
+
+    HANDLE      file;       /**< File handle */
+    HANDLE      mapping;    /**< File mapping handle */
+
+#endif  /* _WIN32 */
+
+#ifdef __linux__
+
+    int         fd;         /**< File descriptor */
+
+#endif  /* __linux__ */
+
+} platform_MappedFile;
+
 /*******************************************************************************
     VARIABLES
 *******************************************************************************/
@@ -181,6 +204,84 @@ extern int platform_getch(void);
  */
 extern void platform_delay(long valueMS);
 
+/**
+ * This function returns the time of a monotonic clock in us. The clock is not
+ * affected by changes of the system time and its start point is unspecified.
+ * Use it only to measure time differences.
+ *
+ * @return Monotonic time in us
+ */
+extern uint64_t platform_getMonotonicTime(void);
+
+/**
+ * This function writes all buffered data of a file to the storage device.
+ *
+ * @param[in] fd    File
+ * @return Status
+ * @retval 0    Successful
+ * @retval < 0  Failed
+ */
+extern int platform_syncFile(FILE* fd);
+
+/**
+ * This function gets the time of the last modification of a file.
+ *
+ * @param[in]   fileName    Name of the file
+ * @param[out]  modTime     Time of the last modification
+ * @return Status
+ * @retval 0    Successful
+ * @retval < 0  Failed, e.g. the file doesn't exist
+ */
+extern int platform_getFileTime(char const * const fileName, time_t * const modTime);
+
+/**
+ * This function maps a file shared into memory, for read and write access.
+ * If the file doesn't exist, it will be created. If the file size differs
+ * from the requested size, the file is resized. Additional space is zeroed.
+ * Changes of the mapped content are written to the file by the operating
+ * system, even if the program crashes.
+ *
+ * @param[out]  mappedFile  Mapped file
+ * @param[in]   fileName    Name of the file
+ * @param[in]   size        Size of the mapped file content in bytes
+ * @return Status
+ * @retval 0    Successful
+ * @retval < 0  Failed
+ */
+extern int platform_mapFile(platform_MappedFile * const mappedFile, char const * const fileName, size_t size);
+
+/**
+ * This function writes the changed content of a mapped file to the storage
+ * device and waits until it is finished.
+ *
+ * @param[in] mappedFile    Mapped file
+ * @return Status
+ * @retval 0    Successful
+ * @retval < 0  Failed
+ */
+extern int platform_syncMappedFile(platform_MappedFile * const mappedFile);
+
+/**
+ * This function writes the changed content of a part of a mapped file to the
+ * storage device and waits until it is finished. The part is extended to the
+ * memory pages, which contain it.
+ *
+ * @param[in] mappedFile    Mapped file
+ * @param[in] offset        Offset of the part in bytes
+ * @param[in] size          Size of the part in bytes
+ * @return Status
+ * @retval 0    Successful
+ * @retval < 0  Failed
+ */
+extern int platform_syncMappedFileRange(platform_MappedFile * const mappedFile, size_t offset, size_t size);
+
+/**
+ * This function removes the mapping of a file and closes it.
+ *
+ * @param[in] mappedFile    Mapped file
+ */
+extern void platform_unmapFile(platform_MappedFile * const mappedFile);
+
 /**
  * Set text foreground color.
  *
@@ -0,0 +1,558 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2019, Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  Trace file
+@file   trace.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see trace.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "trace.h"
+#include <string.h>
+#include <time.h>
+#include <sys/types.h>
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Magic at the begin of every trace file */
+#define TRACE_MAGIC                 "VSCPTRC"
+
+/** Size of the magic in bytes, incl. string termination */
+#define TRACE_MAGIC_SIZE            (8u)
+
+/** Offset of the number of written records in the file header */
+#define TRACE_HEADER_RECORD_CNT     (24u)
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+#ifdef _WIN32
+
+/** Set file position with 64-bit offset */
+#define TRACE_FSEEK(__fd, __offset, __origin)   _fseeki64((__fd), (__offset), (__origin))
+
+#else   /* _WIN32 */
+
+/** Set file position with 64-bit offset */
+#define TRACE_FSEEK(__fd, __offset, __origin)   fseeko((__fd), (off_t)(__offset), (__origin))
+
+#endif  /* _WIN32 */
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+static void trace_putUInt16(uint8_t * const buffer, uint16_t value);
+static void trace_putUInt32(uint8_t * const buffer, uint32_t value);
+static void trace_putUInt64(uint8_t * const buffer, uint64_t value);
+static uint16_t trace_getUInt16(uint8_t const * const buffer);
+static uint32_t trace_getUInt32(uint8_t const * const buffer);
+static uint64_t trace_getUInt64(uint8_t const * const buffer);
+static void trace_serialize(uint8_t * const buffer, trace_Record const * const record, uint32_t sequence);
+static uint32_t trace_deserialize(trace_Record * const record, uint8_t const * const buffer);
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function creates a new trace file with a ring of the given size and
+ * maps it into memory. An already existing file will be overwritten.
+ *
+ * @param[out]  writer      Writer context
+ * @param[in]   fileName    Name of the trace file
+ * @param[in]   recordNum   Number of records in the ring
+ *
+ * @return Status
+ */
+extern TRACE_RET trace_openWriter(trace_Writer * const writer, char const * const fileName, uint32_t recordNum)
+{
+    uint8_t*    header  = NULL;
+
+    if ((NULL == writer) ||
+        (NULL == fileName))
+    {
+        return TRACE_RET_ENULL;
+    }
+
+    if (0 == recordNum)
+    {
+        return TRACE_RET_ERROR;
+    }
+
+    if (0 != platform_mapFile(&writer->file, fileName, TRACE_HEADER_SIZE + ((size_t)recordNum) * TRACE_RECORD_SIZE))
+    {
+        return TRACE_RET_ERROR;
+    }
+
+    writer->startTimeMonotonic  = platform_getMonotonicTime();
+    writer->recordNum           = recordNum;
+    writer->recordCnt           = 0;
+
+    /* Remove the records of a previous trace */
+    memset(writer->file.addr, 0, writer->file.size);
+
+    header = writer->file.addr;
+    memcpy(&header[0], TRACE_MAGIC, TRACE_MAGIC_SIZE);
+    trace_putUInt16(&header[8], TRACE_VERSION);
+    trace_putUInt16(&header[10], TRACE_RECORD_SIZE);
+    trace_putUInt32(&header[12], recordNum);
+    trace_putUInt64(&header[16], (uint64_t)time(NULL));
+    trace_putUInt64(&header[TRACE_HEADER_RECORD_CNT], 0);
+
+    return TRACE_RET_OK;
+}
+
+/**
+ * This function writes a record to the trace file. The timestamp of the
+ * record is set by the writer. If the ring is full, the oldest record is
+ * overwritten.
+ *
+ * @param[in]       writer  Writer context
+ * @param[in,out]   record  Record
+ *
+ * @return Status
+ */
+extern TRACE_RET trace_write(trace_Writer * const writer, trace_Record * const record)
+{
+    uint8_t*    buffer  = NULL;
+
+    if ((NULL == writer) ||
+        (NULL == writer->file.addr) ||
+        (NULL == record))
+    {
+        return TRACE_RET_ENULL;
+    }
+
+    record->timestamp = platform_getMonotonicTime() - writer->startTimeMonotonic;
+
+    buffer = &writer->file.addr[TRACE_HEADER_SIZE + (writer->recordCnt % writer->recordNum) * TRACE_RECORD_SIZE];
+    trace_serialize(buffer, record, (uint32_t)writer->recordCnt);
+
+    /* The record is valid for a reader, after the number of written records is updated. */
+    ++writer->recordCnt;
+    trace_putUInt64(&writer->file.addr[TRACE_HEADER_RECORD_CNT], writer->recordCnt);
+
+    return TRACE_RET_OK;
+}
+
+/**
+ * This function synchronizes the trace file with the storage device and
+ * closes it.
+ *
+ * @param[in]   writer  Writer context
+ *
+ * @return Status
+ */
+extern TRACE_RET trace_closeWriter(trace_Writer * const writer)
+{
+    TRACE_RET   status  = TRACE_RET_OK;
+
+    if ((NULL == writer) ||
+        (NULL == writer->file.addr))
+    {
+        return TRACE_RET_ENULL;
+    }
+
+    if (0 != platform_syncMappedFile(&writer->file))
+    {
+        status = TRACE_RET_ERROR;
+    }
+
+    platform_unmapFile(&writer->file);
+
+    return status;
+}
+
+/**
+ * This function opens a trace file for reading and verifies the file header.
+ * The first read record is the oldest one in the ring.
+ *
+ * @param[out]  reader      Reader context
+ * @param[in]   fileName    Name of the trace file
+ *
+ * @return Status
+ */
+extern TRACE_RET trace_openReader(trace_Reader * const reader, char const * const fileName)
+{
+    TRACE_RET   status  = TRACE_RET_OK;
+    uint8_t     header[TRACE_HEADER_SIZE];
+
+    if ((NULL == reader) ||
+        (NULL == fileName))
+    {
+        return TRACE_RET_ENULL;
+    }
+
+    reader->fd          = fopen(fileName, "rb");
+    reader->startTime   = 0;
+    reader->recordNum   = 0;
+    reader->recordCnt   = 0;
+    reader->readIndex   = 0;
+
+    if (NULL == reader->fd)
+    {
+        status = TRACE_RET_ERROR;
+    }
+    else if (1 != fread(header, sizeof(header), 1, reader->fd))
+    {
+        status = TRACE_RET_INVALID;
+    }
+    else if (0 != memcmp(&header[0], TRACE_MAGIC, TRACE_MAGIC_SIZE))
+    {
+        status = TRACE_RET_INVALID;
+    }
+    else if ((TRACE_VERSION != trace_getUInt16(&header[8])) ||
+             (TRACE_RECORD_SIZE != trace_getUInt16(&header[10])) ||
+             (0 == trace_getUInt32(&header[12])))
+    {
+        status = TRACE_RET_INVALID;
+    }
+    else
+    {
+        reader->recordNum   = trace_getUInt32(&header[12]);
+        reader->startTime   = trace_getUInt64(&header[16]);
+        reader->recordCnt   = trace_getUInt64(&header[TRACE_HEADER_RECORD_CNT]);
+
+        /* Ring overflowed? Start with the oldest record. */
+        if (reader->recordNum < reader->recordCnt)
+        {
+            reader->readIndex = reader->recordCnt - reader->recordNum;
+        }
+    }
+
+    if ((TRACE_RET_OK != status) &&
+        (NULL != reader->fd))
+    {
+        fclose(reader->fd);
+        reader->fd = NULL;
+    }
+
+    return status;
+}
+
+/**
+ * This function reads the next record from the trace file, in the order they
+ * were written.
+ *
+ * @param[in]   reader  Reader context
+ * @param[out]  record  Record
+ *
+ * @return Status
+ * @retval TRACE_RET_OK     Record read
+ * @retval TRACE_RET_EOF    No further record available
+ */
+extern TRACE_RET trace_read(trace_Reader * const reader, trace_Record * const record)
+{
+    uint8_t buffer[TRACE_RECORD_SIZE];
+
+    if ((NULL == reader) ||
+        (NULL == reader->fd) ||
+        (NULL == record))
+    {
+        return TRACE_RET_ENULL;
+    }
+
+    while(reader->recordCnt > reader->readIndex)
+    {
+        uint64_t    index   = reader->readIndex;
+
+        ++reader->readIndex;
+
+        if (0 != TRACE_FSEEK(reader->fd, TRACE_HEADER_SIZE + (index % reader->recordNum) * TRACE_RECORD_SIZE, SEEK_SET))
+        {
+            return TRACE_RET_ERROR;
+        }
+
+        if (1 != fread(buffer, sizeof(buffer), 1, reader->fd))
+        {
+            return TRACE_RET_EOF;
+        }
+
+        /* Skip records, which were overwritten in the meantime by a running writer. */
+        if ((uint32_t)index == trace_deserialize(record, buffer))
+        {
+            return TRACE_RET_OK;
+        }
+    }
+
+    return TRACE_RET_EOF;
+}
+
+/**
+ * This function closes a trace file.
+ *
+ * @param[in]   reader  Reader context
+ */
+extern void trace_closeReader(trace_Reader * const reader)
+{
+    if ((NULL != reader) &&
+        (NULL != reader->fd))
+    {
+        fclose(reader->fd);
+        reader->fd = NULL;
+    }
+
+    return;
+}
+
+/**
+ * This function shows a record in text format on the console.
+ *
+ * @param[in]   record      Record
+ * @param[in]   startTime   Wall clock time of the trace start in s since epoch (UTC)
+ */
+extern void trace_show(trace_Record const * const record, uint64_t startTime)
+{
+    time_t      rawtime;
+    struct tm * timeInfo;
+    uint8_t     index       = 0;
+    uint8_t     dataNum     = 0;
+
+    if (NULL == record)
+    {
+        return;
+    }
+
+    rawtime     = (time_t)(startTime + (record->timestamp / 1000000u));
+    timeInfo    = localtime(&rawtime);
+
+    printf("%04u-%02u-%02u %02u:%02u:%02u.%06u ",
+        timeInfo->tm_year + 1900,
+        timeInfo->tm_mon + 1,
+        timeInfo->tm_mday,
+        timeInfo->tm_hour,
+        timeInfo->tm_min,
+        timeInfo->tm_sec,
+        (uint32_t)(record->timestamp % 1000000u));
+
+    if (TRACE_KIND_ACTION == record->kind)
+    {
+        printf("Action: id=0x%02X par=0x%02X class=0x%04X type=0x%02X oAddr=0x%02X",
+            record->action,
+            record->actionPar,
+            record->vscpClass,
+            record->vscpType,
+            record->oAddr);
+    }
+    else
+    {
+        printf("%cx: class=0x%04X type=0x%02X prio=%2d oAddr=0x%02X %c num=%u data=",
+            (TRACE_KIND_RX == record->kind) ? 'R' : 'T',
+            record->vscpClass,
+            record->vscpType,
+            record->priority,
+            record->oAddr,
+            (0 == (record->flags & TRACE_FLAG_HARD_CODED)) ? '-' : 'h',
+            record->dataNum);
+
+        dataNum = record->dataNum;
+
+        if (TRACE_DATA_SIZE < dataNum)
+        {
+            dataNum = TRACE_DATA_SIZE;
+        }
+
+        for(index = 0; index < dataNum; ++index)
+        {
+            printf("%02X", record->data[index]);
+
+            if ((index + 1) < dataNum)
+            {
+                printf(" ");
+            }
+        }
+    }
+
+    printf(" (node 0x%02X %s)\n",
+        record->nickname,
+        (0 == (record->flags & TRACE_FLAG_ACTIVE)) ? "inactive" : "active");
+
+    return;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function writes a 16-bit value in little endian byte order to a buffer.
+ *
+ * @param[out]  buffer  Buffer
+ * @param[in]   value   Value
+ */
+static void trace_putUInt16(uint8_t * const buffer, uint16_t value)
+{
+    buffer[0] = (uint8_t)(value >> 0);
+    buffer[1] = (uint8_t)(value >> 8);
+
+    return;
+}
+
+/**
+ * This function writes a 32-bit value in little endian byte order to a buffer.
+ *
+ * @param[out]  buffer  Buffer
+ * @param[in]   value   Value
+ */
+static void trace_putUInt32(uint8_t * const buffer, uint32_t value)
+{
+    trace_putUInt16(&buffer[0], (uint16_t)(value >> 0));
+    trace_putUInt16(&buffer[2], (uint16_t)(value >> 16));
+
+    return;
+}
+
+/**
+ * This function writes a 64-bit value in little endian byte order to a buffer.
+ *
+ * @param[out]  buffer  Buffer
+ * @param[in]   value   Value
+ */
+static void trace_putUInt64(uint8_t * const buffer, uint64_t value)
+{
+    trace_putUInt32(&buffer[0], (uint32_t)(value >> 0));
+    trace_putUInt32(&buffer[4], (uint32_t)(value >> 32));
+
+    return;
+}
+
+/**
+ * This function reads a 16-bit value in little endian byte order from a buffer.
+ *
+ * @param[in]   buffer  Buffer
+ * @return Value
+ */
+static uint16_t trace_getUInt16(uint8_t const * const buffer)
+{
+    return (uint16_t)(((uint16_t)buffer[0]) << 0) |
+           (uint16_t)(((uint16_t)buffer[1]) << 8);
+}
+
+/**
+ * This function reads a 32-bit value in little endian byte order from a buffer.
+ *
+ * @param[in]   buffer  Buffer
+ * @return Value
+ */
+static uint32_t trace_getUInt32(uint8_t const * const buffer)
+{
+    return (((uint32_t)trace_getUInt16(&buffer[0])) << 0) |
+           (((uint32_t)trace_getUInt16(&buffer[2])) << 16);
+}
+
+/**
+ * This function reads a 64-bit value in little endian byte order from a buffer.
+ *
+ * @param[in]   buffer  Buffer
+ * @return Value
+ */
+static uint64_t trace_getUInt64(uint8_t const * const buffer)
+{
+    return (((uint64_t)trace_getUInt32(&buffer[0])) << 0) |
+           (((uint64_t)trace_getUInt32(&buffer[4])) << 32);
+}
+
+/**
+ * This function serializes a record to its file representation.
+ *
+ * @param[out]  buffer      Buffer with TRACE_RECORD_SIZE bytes
+ * @param[in]   record      Record
+ * @param[in]   sequence    Sequence number (lower 32 bit of the record index)
+ */
+static void trace_serialize(uint8_t * const buffer, trace_Record const * const record, uint32_t sequence)
+{
+    trace_putUInt64(&buffer[0], record->timestamp);
+    trace_putUInt32(&buffer[8], sequence);
+    buffer[12] = record->kind;
+    buffer[13] = record->flags;
+    buffer[14] = record->nickname;
+    buffer[15] = record->oAddr;
+    trace_putUInt16(&buffer[16], record->vscpClass);
+    buffer[18] = record->vscpType;
+    buffer[19] = record->priority;
+    buffer[20] = record->dataNum;
+    buffer[21] = record->action;
+    buffer[22] = record->actionPar;
+    buffer[23] = 0;
+    memcpy(&buffer[24], record->data, TRACE_DATA_SIZE);
+
+    return;
+}
+
+/**
+ * This function deserializes a record from its file representation.
+ *
+ * @param[out]  record  Record
+ * @param[in]   buffer  Buffer with TRACE_RECORD_SIZE bytes
+ * @return Sequence number (lower 32 bit of the record index)
+ */
+static uint32_t trace_deserialize(trace_Record * const record, uint8_t const * const buffer)
+{
+    record->timestamp   = trace_getUInt64(&buffer[0]);
+    record->kind        = buffer[12];
+    record->flags       = buffer[13];
+    record->nickname    = buffer[14];
+    record->oAddr       = buffer[15];
+    record->vscpClass   = trace_getUInt16(&buffer[16]);
+    record->vscpType    = buffer[18];
+    record->priority    = buffer[19];
+    record->dataNum     = buffer[20];
+    record->action      = buffer[21];
+    record->actionPar   = buffer[22];
+    memcpy(record->data, &buffer[24], TRACE_DATA_SIZE);
+
+    return trace_getUInt32(&buffer[8]);
+}
@@ -0,0 +1,256 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2019, Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  Trace file
+@file   trace.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module provides the access to binary trace files, which record what a
+node did: received and transmitted messages and executed actions. A trace file
+is a ring of fixed-size records, which is mapped into memory. If the ring is
+full, the oldest records are overwritten. Writing a record is only a memory copy,
+the operating system writes the mapped file content to the storage device, even
+if the node crashes. All values are stored in little endian byte order.
+
+The record timestamp is the time in us since the trace was started, measured
+with a monotonic clock. The file header contains the wall clock time of the
+trace start and the number of written records.
+
+*******************************************************************************/
+/** @defgroup trace Trace file
+ * Record the node activity to a binary trace file and read it back.
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __TRACE_H__
+#define __TRACE_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include <stdio.h>
+#include "platform.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Trace file format version */
+#define TRACE_VERSION               (1u)
+
+/** Size of the trace file header in bytes */
+#define TRACE_HEADER_SIZE           (64u)
+
+/** Size of a single record in the trace file in bytes */
+#define TRACE_RECORD_SIZE           (32u)
+
+/** Max. number of message data bytes, stored in a record. */
+#define TRACE_DATA_SIZE             (8u)
+
+/** Default number of records in the ring */
+#define TRACE_RECORD_NUM_DEFAULT    (65536u)
+
+/** Record flag: The node was active */
+#define TRACE_FLAG_ACTIVE           (0x01u)
+
+/** Record flag: The message is hard coded */
+#define TRACE_FLAG_HARD_CODED       (0x02u)
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/** This type defines the supported function return values. */
+typedef enum
+{
+    TRACE_RET_OK = 0,   /**< Successful */
+    TRACE_RET_EOF,      /**< End of file reached */
+    TRACE_RET_INVALID,  /**< Invalid or unsupported file format */
+    TRACE_RET_ERROR,    /**< Failed */
+    TRACE_RET_ENULL     /**< Unexpected NULL pointer */
+
+} TRACE_RET;
+
+/** This type defines the kind of a record. */
+typedef enum
+{
+    TRACE_KIND_RX = 1,  /**< Received message */
+    TRACE_KIND_TX,      /**< Transmitted message */
+    TRACE_KIND_ACTION   /**< Executed action, with the message which triggered it */
+
+} TRACE_KIND;
+
+/** This type defines a single record. */
+typedef struct
+{
+    uint64_t    timestamp;              /**< Time since trace start in us */
+    uint8_t     kind;                   /**< Record kind (see TRACE_KIND) */
+    uint8_t     flags;                  /**< Flags (see TRACE_FLAG_XXX) */
+    uint8_t     nickname;               /**< Node nickname id at this time */
+    uint8_t     oAddr;                  /**< Originating address of the message */
+    uint16_t    vscpClass;              /**< VSCP class of the message */
+    uint8_t     vscpType;               /**< VSCP type of the message */
+    uint8_t     priority;               /**< Priority of the message */
+    uint8_t     dataNum;                /**< Number of message data bytes */
+    uint8_t     action;                 /**< Action id (only for TRACE_KIND_ACTION) */
+    uint8_t     actionPar;              /**< Action parameter (only for TRACE_KIND_ACTION) */
+    uint8_t     data[TRACE_DATA_SIZE];  /**< Message data */
+
+} trace_Record;
+
+/** This type contains the context of a trace file writer. */
+typedef struct
+{
+    platform_MappedFile file;               /**< Mapped trace file */
+    uint64_t            startTimeMonotonic; /**< Monotonic time of the trace start in us */
+    uint32_t            recordNum;          /**< Number of records in the ring */
+    uint64_t            recordCnt;          /**< Number of written records */
+
+} trace_Writer;
+
+/** This type contains the context of a trace file reader. */
+typedef struct
+{
+    FILE*       fd;         /**< File descriptor */
+    uint64_t    startTime;  /**< Wall clock time of the trace start in s since epoch (UTC) */
+    uint32_t    recordNum;  /**< Number of records in the ring */
+    uint64_t    recordCnt;  /**< Number of written records */
+    uint64_t    readIndex;  /**< Index of the next record to read */
+
+} trace_Reader;
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function creates a new trace file with a ring of the given size and
+ * maps it into memory. An already existing file will be overwritten.
+ *
+ * @param[out]  writer      Writer context
+ * @param[in]   fileName    Name of the trace file
+ * @param[in]   recordNum   Number of records in the ring
+ *
+ * @return Status
+ */
+extern TRACE_RET trace_openWriter(trace_Writer * const writer, char const * const fileName, uint32_t recordNum);
+
+/**
+ * This function writes a record to the trace file. The timestamp of the
+ * record is set by the writer. If the ring is full, the oldest record is
+ * overwritten.
+ *
+ * @param[in]       writer  Writer context
+ * @param[in,out]   record  Record
+ *
+ * @return Status
+ */
+extern TRACE_RET trace_write(trace_Writer * const writer, trace_Record * const record);
+
+/**
+ * This function synchronizes the trace file with the storage device and
+ * closes it.
+ *
+ * @param[in]   writer  Writer context
+ *
+ * @return Status
+ */
+extern TRACE_RET trace_closeWriter(trace_Writer * const writer);
+
+/**
+ * This function opens a trace file for reading and verifies the file header.
+ * The first read record is the oldest one in the ring.
+ *
+ * @param[out]  reader      Reader context
+ * @param[in]   fileName    Name of the trace file
+ *
+ * @return Status
+ */
+extern TRACE_RET trace_openReader(trace_Reader * const reader, char const * const fileName);
+
+/**
+ * This function reads the next record from the trace file, in the order they
+ * were written.
+ *
+ * @param[in]   reader  Reader context
+ * @param[out]  record  Record
+ *
+ * @return Status
+ * @retval TRACE_RET_OK     Record read
+ * @retval TRACE_RET_EOF    No further record available
+ */
+extern TRACE_RET trace_read(trace_Reader * const reader, trace_Record * const record);
+
+/**
+ * This function closes a trace file.
+ *
+ * @param[in]   reader  Reader context
+ */
+extern void trace_closeReader(trace_Reader * const reader);
+
+/**
+ * This function shows a record in text format on the console.
+ *
+ * @param[in]   record      Record
+ * @param[in]   startTime   Wall clock time of the trace start in s since epoch (UTC)
+ */
+extern void trace_show(trace_Record const * const record, uint64_t startTime);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __TRACE_H__ */
+
+/** @} */
@@ -88,6 +88,7 @@ This module contains the main entry point.
 #include "vscp_core.h"
 #include "vscp_timer.h"
 #include "vscp_portable.h"
+#include "vscp_ps_access.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -202,6 +203,9 @@ int main(void)
         /* Process VSCP framework */
         vscp_core_process();
 
+        /* Write the persistent memory changes of the VSCP framework processing to the EEPROM. */
+        vscp_ps_access_flush();
+
         /* Initialize the VSCP segment, because user pressed the segment
          * initialization button?
          *
@@ -67,6 +67,14 @@ extern "C"
 
 /* ---------- Define here your preferred configuration setup. ---------- */
 
+#define VSCP_CONFIG_ENABLE_CAN_ADAPTER          VSCP_CONFIG_BASE_ENABLED
+
+#define VSCP_CONFIG_ENABLE_TP_ADAPTER_WRITE_MESSAGES    VSCP_CONFIG_BASE_ENABLED
+
+#define VSCP_CONFIG_ENABLE_EVENT_INTEREST_RESPONSE  VSCP_CONFIG_BASE_ENABLED
+
+#define VSCP_CONFIG_ENABLE_CAN_FILTER           VSCP_CONFIG_BASE_ENABLED
+
 /*
 #define VSCP_CONFIG_ENABLE_LOGGER               VSCP_CONFIG_BASE_DISABLED
 
@@ -116,7 +124,7 @@ extern "C"
 
 #define VSCP_CONFIG_MULTI_MSG_TIMEOUT           ((uint16_t)1000)
 
-#define VSCP_CONFIG_HEARTBEAT_NODE_PERIOD       ((uint16_t)30000)
+#define VSCP_CONFIG_HEARTBEAT_NODE_PERIOD       30000
 
 #define VSCP_CONFIG_DM_PAGE                     1
 
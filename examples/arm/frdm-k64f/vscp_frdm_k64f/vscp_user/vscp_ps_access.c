@@ -35,6 +35,15 @@
 @section desc Description
 @see vscp_ps_access.h
 
+The 25AA02E48 SPI EEPROM protocol is implemented by the common 25xx driver,
+this module provides only the DSPI transfer function.
+
+The persistent memory is accessed byte by byte, but the EEPROM reads fast
+sequentially and writes a whole page in one write cycle. Therefore one page
+is cached: a read miss reads the whole page with one READ command and writes
+are combined in the cached page. The page is written with a single write cycle
+as soon as another page is accessed or vscp_ps_access_flush() is called.
+
 *******************************************************************************/
 
 /*******************************************************************************
@@ -42,6 +51,7 @@
 *******************************************************************************/
 #include "vscp_ps_access.h"
 #include "fsl_dspi.h"
+#include "eeprom25xx.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -66,8 +76,17 @@
 /** SPI chip select */
 #define VSCP_PS_ACCESS_DSPI_CS				kDSPI_Pcs0
 
-/** EEPROM read transfer size in byte */
-#define VSCP_PS_ACCESS_EEPROM_READ_TFR_SIZE	(3)
+/** EEPROM size in byte */
+#define VSCP_PS_ACCESS_EEPROM_SIZE			(256U)
+
+/** EEPROM page size in byte */
+#define VSCP_PS_ACCESS_EEPROM_PAGE_SIZE		(16U)
+
+/** Max. number of status polls per write cycle (write cycle time 5 ms, one poll 16 us) */
+#define VSCP_PS_ACCESS_EEPROM_POLL_MAX		(1000U)
+
+/** Invalid cached page address */
+#define VSCP_PS_ACCESS_PAGE_INVALID			(0xFFFFU)
 
 /*******************************************************************************
     MACROS
@@ -77,26 +96,36 @@
     TYPES AND STRUCTURES
 *******************************************************************************/
 
-/* Microchip 25AA02E48 SPI EEPROM commands */
-typedef enum
-{
-	VSCP_PS_ACCESS_EEPROM_CMD_WRSR 	= 0x01,
-	VSCP_PS_ACCESS_EEPROM_CMD_WRITE	= 0x02,
-	VSCP_PS_ACCESS_EEPROM_CMD_READ	= 0x03,
-	VSCP_PS_ACCESS_EEPROM_CMD_WRDI	= 0x04,
-	VSCP_PS_ACCESS_EEPROM_CMD_RDSR	= 0x05,
-	VSCP_PS_ACCESS_EEPROM_CMD_WREN	= 0x06
-
-} VSCP_PS_ACCESS_EEPROM_CMD;
-
 /*******************************************************************************
     PROTOTYPES
 *******************************************************************************/
 
+static EEPROM25XX_RET vscp_ps_access_transfer(uint8_t const * txData, uint8_t * rxData, uint16_t size, uint8_t keepSelected);
+static uint8_t vscp_ps_access_loadPage(uint16_t addr);
+
 /*******************************************************************************
     LOCAL VARIABLES
 *******************************************************************************/
 
+/** Microchip 25AA02E48 SPI EEPROM on the FRDM-VSCP-CAN shield */
+static const eeprom25xx_Device	vscp_ps_access_eeprom	=
+{
+	vscp_ps_access_transfer,			/* SPI transfer function */
+	VSCP_PS_ACCESS_EEPROM_SIZE,			/* Memory size */
+	VSCP_PS_ACCESS_EEPROM_PAGE_SIZE,	/* Page size */
+	1,									/* Number of address bytes */
+	VSCP_PS_ACCESS_EEPROM_POLL_MAX		/* Max. number of status polls */
+};
+
+/** Cached page */
+static uint8_t	vscp_ps_access_page[VSCP_PS_ACCESS_EEPROM_PAGE_SIZE];
+
+/** Address of the cached page */
+static uint16_t	vscp_ps_access_pageAddr	= VSCP_PS_ACCESS_PAGE_INVALID;
+
+/** Cached page is modified and not written yet */
+static uint8_t	vscp_ps_access_pageDirty	= 0;
+
 /*******************************************************************************
     GLOBAL VARIABLES
 *******************************************************************************/
@@ -133,6 +162,9 @@ extern void vscp_ps_access_init(void)
 
 	DSPI_MasterInit(VSCP_PS_ACCESS_DSPI_MASTER_BASEADDR, &masterConfig, VSCP_PS_ACCESS_DSPI_CLK_FREQ);
 
+	vscp_ps_access_pageAddr		= VSCP_PS_ACCESS_PAGE_INVALID;
+	vscp_ps_access_pageDirty	= 0;
+
     return;
 }
 
@@ -144,26 +176,12 @@ extern void vscp_ps_access_init(void)
  */
 extern uint8_t  vscp_ps_access_read8(uint16_t addr)
 {
-	dspi_transfer_t	masterXfer										= { 0 };
-	uint8_t			txBuffer[VSCP_PS_ACCESS_EEPROM_READ_TFR_SIZE]	= { 0 }; /* [  op-code ] [  address ] [     dummy   ] */
-	uint8_t			rxBuffer[VSCP_PS_ACCESS_EEPROM_READ_TFR_SIZE]	= { 0 }; /* [  dummy   ] [  dummy   ] [returned data] */
-	uint8_t			data											= 0;
+	uint8_t	data	= 0;
 
-	if (0xff >= addr)
+	if ((VSCP_PS_ACCESS_EEPROM_SIZE > addr) &&
+		(0 != vscp_ps_access_loadPage(addr)))
 	{
-		txBuffer[0] = VSCP_PS_ACCESS_EEPROM_CMD_READ;	/* Opcode */
-		txBuffer[1] = (uint8_t)addr;					/* Address */
-		txBuffer[2] = 0x00;								/* Dummy */
-
-		masterXfer.txData = txBuffer;
-		masterXfer.rxData = rxBuffer;
-		masterXfer.dataSize = VSCP_PS_ACCESS_EEPROM_READ_TFR_SIZE;
-		masterXfer.configFlags = kDSPI_MasterCtar0 | VSCP_PS_ACCESS_DSPI_CS | kDSPI_MasterPcsContinuous;
-
-		if (kStatus_Success == DSPI_MasterTransferBlocking(VSCP_PS_ACCESS_DSPI_MASTER_BASEADDR, &masterXfer))
-		{
-			data = rxBuffer[2];
-		}
+		data = vscp_ps_access_page[addr % VSCP_PS_ACCESS_EEPROM_PAGE_SIZE];
 	}
 
     return data;
@@ -171,40 +189,48 @@ extern uint8_t  vscp_ps_access_read8(uint16_t addr)
 
 /**
  * Write a single byte to the persistent memory.
+ * The byte is written to the cached page and written to the EEPROM, as soon
+ * as another page is accessed or vscp_ps_access_flush() is called.
  *
  * @param[in]   addr    Address in persistent memory
  * @param[in]   value   Value to write
  */
 extern void vscp_ps_access_write8(uint16_t addr, uint8_t value)
 {
-	dspi_transfer_t	masterXfer		= { 0 };
-	const uint8_t	size			= 3;
-	uint8_t			txBuffer[size]; /* [  op-code ] [  address ] [     dummy   ] */
-	uint8_t			rxBuffer[size]; /* [  dummy   ] [  dummy   ] [returned data] */
-
-	if (0xff >= addr)
+	if ((VSCP_PS_ACCESS_EEPROM_SIZE > addr) &&
+		(0 != vscp_ps_access_loadPage(addr)))
 	{
-		masterXfer.txData = txBuffer;
-		masterXfer.rxData = rxBuffer;
-		masterXfer.configFlags = kDSPI_MasterCtar0 | VSCP_PS_ACCESS_DSPI_CS | kDSPI_MasterPcsContinuous;
-
-		/* The WREN instruction must be sent separately to enable writes to the eeprom. This is done
-		 * with its own API call to make the CS line comes back up which sets the WREN latch.
-		 */
-		txBuffer[0] = VSCP_PS_ACCESS_EEPROM_CMD_WREN;	/* Opcode */
+		uint8_t	offset	= addr % VSCP_PS_ACCESS_EEPROM_PAGE_SIZE;
 
-		masterXfer.dataSize = 1;
-
-		(void)DSPI_MasterTransferBlocking(VSCP_PS_ACCESS_DSPI_MASTER_BASEADDR, &masterXfer);
-
-		/* Write data */
-		txBuffer[0] = VSCP_PS_ACCESS_EEPROM_CMD_WRITE;	/* Opcode */
-		txBuffer[1] = (uint8_t)addr;					/* Address */
-		txBuffer[2] = value;							/* Data */
+		/* Avoid a write cycle, if nothing changes. */
+		if (value != vscp_ps_access_page[offset])
+		{
+			vscp_ps_access_page[offset]	= value;
+			vscp_ps_access_pageDirty	= 1;
+		}
+	}
 
-		masterXfer.dataSize = size;
+    return;
+}
 
-		(void)DSPI_MasterTransferBlocking(VSCP_PS_ACCESS_DSPI_MASTER_BASEADDR, &masterXfer);
+/**
+ * Write the cached page to the EEPROM, if it was modified.
+ * Call it cyclic, e.g. in the main loop after the VSCP framework processing.
+ */
+extern void vscp_ps_access_flush(void)
+{
+	if (0 != vscp_ps_access_pageDirty)
+	{
+		if (EEPROM25XX_RET_OK == eeprom25xx_write(&vscp_ps_access_eeprom, vscp_ps_access_pageAddr, vscp_ps_access_page, VSCP_PS_ACCESS_EEPROM_PAGE_SIZE))
+		{
+			vscp_ps_access_pageDirty = 0;
+		}
+		else
+		{
+			/* The EEPROM content is unknown, read it again at next access. */
+			vscp_ps_access_pageAddr		= VSCP_PS_ACCESS_PAGE_INVALID;
+			vscp_ps_access_pageDirty	= 0;
+		}
 	}
 
     return;
@@ -213,3 +239,64 @@ extern void vscp_ps_access_write8(uint16_t addr, uint8_t value)
 /*******************************************************************************
     LOCAL FUNCTIONS
 *******************************************************************************/
+
+/**
+ * SPI transfer function for the 25xx EEPROM driver.
+ *
+ * @param[in]   txData          Data to send, if NULL 0x00 is sent
+ * @param[out]  rxData          Received data, if NULL it is discarded
+ * @param[in]   size            Number of bytes
+ * @param[in]   keepSelected    Keep the chip select asserted after the transfer (1) or not (0)
+ * @return Status
+ */
+static EEPROM25XX_RET vscp_ps_access_transfer(uint8_t const * txData, uint8_t * rxData, uint16_t size, uint8_t keepSelected)
+{
+	EEPROM25XX_RET	status		= EEPROM25XX_RET_ERROR;
+	dspi_transfer_t	masterXfer	= { 0 };
+
+	/* The DSPI driver sends the dummy data for a NULL tx buffer and discards the received data for a NULL rx buffer. */
+	masterXfer.txData		= (uint8_t*)txData;
+	masterXfer.rxData		= rxData;
+	masterXfer.dataSize		= size;
+	masterXfer.configFlags	= kDSPI_MasterCtar0 | VSCP_PS_ACCESS_DSPI_CS | kDSPI_MasterPcsContinuous;
+
+	if (0 != keepSelected)
+	{
+		masterXfer.configFlags |= kDSPI_MasterActiveAfterTransfer;
+	}
+
+	if (kStatus_Success == DSPI_MasterTransferBlocking(VSCP_PS_ACCESS_DSPI_MASTER_BASEADDR, &masterXfer))
+	{
+		status = EEPROM25XX_RET_OK;
+	}
+
+	return status;
+}
+
+/**
+ * Load the page, which contains the given address, into the cache.
+ * A modified cached page of another address is written before.
+ *
+ * @param[in]   addr    Address in persistent memory
+ * @return Page is cached (1) or not (0)
+ */
+static uint8_t vscp_ps_access_loadPage(uint16_t addr)
+{
+	uint16_t	pageAddr	= addr & ~(uint16_t)(VSCP_PS_ACCESS_EEPROM_PAGE_SIZE - 1U);
+
+	if (pageAddr != vscp_ps_access_pageAddr)
+	{
+		vscp_ps_access_flush();
+
+		if (EEPROM25XX_RET_OK == eeprom25xx_read(&vscp_ps_access_eeprom, pageAddr, vscp_ps_access_page, VSCP_PS_ACCESS_EEPROM_PAGE_SIZE))
+		{
+			vscp_ps_access_pageAddr = pageAddr;
+		}
+		else
+		{
+			vscp_ps_access_pageAddr = VSCP_PS_ACCESS_PAGE_INVALID;
+		}
+	}
+
+	return (VSCP_PS_ACCESS_PAGE_INVALID != vscp_ps_access_pageAddr) ? 1 : 0;
+}
@@ -110,6 +110,12 @@ extern uint8_t  vscp_ps_access_read8(uint16_t addr);
  */
 extern void vscp_ps_access_write8(uint16_t addr, uint8_t value);
 
+/**
+ * Write the cached page to the EEPROM, if it was modified.
+ * Call it cyclic, e.g. in the main loop after the VSCP framework processing.
+ */
+extern void vscp_ps_access_flush(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -41,38 +41,42 @@
     INCLUDES
 *******************************************************************************/
 #include "vscp_tp_adapter.h"
+#include "vscp_can_adapter.h"
+#include "vscp_can_hal.h"
+#include "vscp_can_codec.h"
 #include "fsl_flexcan.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
 *******************************************************************************/
 
+#if VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_CAN_ADAPTER )
+#error The transport layer adapter requires VSCP_CONFIG_ENABLE_CAN_ADAPTER.
+#endif
+
 /*******************************************************************************
     CONSTANTS
 *******************************************************************************/
 
 /** Used CAN peripheral */
-#define VSCP_TP_ADAPTER_CAN						CAN0
+#define VSCP_TP_ADAPTER_CAN                     CAN0
+
+/** CAN interrupt of the message buffers and the rx FIFO */
+#define VSCP_TP_ADAPTER_CAN_IRQN                CAN0_ORed_Message_buffer_IRQn
 
 /** CAN clock source */
-#define VSCP_TP_ADAPTER_CAN_CLKSRC				kCLOCK_BusClk
+#define VSCP_TP_ADAPTER_CAN_CLKSRC              kCLOCK_BusClk
 
 /** CAN clock frequency */
-#define VSCP_TP_ADAPTER_CAN_CLK_FREQ			CLOCK_GetFreq(VSCP_TP_ADAPTER_CAN_CLKSRC)
-
-/** Number of CAN receive message buffers */
-#define VSCP_TP_ADAPTER_CAN_RX_MB_COUNT			15
+#define VSCP_TP_ADAPTER_CAN_CLK_FREQ            CLOCK_GetFreq(VSCP_TP_ADAPTER_CAN_CLKSRC)
 
-/** Number of CAN receive message buffers */
-#define VSCP_TP_ADAPTER_CAN_TX_MB_COUNT			1
+/** Transmit message buffer. The rx FIFO occupies the message buffers 0 - 5
+ * and its 8 filter elements the message buffers 6 - 7.
+ */
+#define VSCP_TP_ADAPTER_CAN_TX_MB               8
 
-#if (16 < (VSCP_TP_ADAPTER_CAN_RX_MB_COUNT + VSCP_TP_ADAPTER_CAN_TX_MB_COUNT))
-	#error Max. number of CAN message buffers exceeded!
-#endif
-
-#if (1 != VSCP_TP_ADAPTER_CAN_TX_MB_COUNT)
-	#error Only one CAN transmit message buffer is supported!
-#endif
+/** Number of rx FIFO filter elements */
+#define VSCP_TP_ADAPTER_CAN_RX_FILTER_NUM       8
 
 /*******************************************************************************
     MACROS
@@ -86,10 +90,42 @@
     PROTOTYPES
 *******************************************************************************/
 
+static void vscp_tp_adapter_setupRxFifo(void);
+
 /*******************************************************************************
     LOCAL VARIABLES
 *******************************************************************************/
 
+/** Rx FIFO filter table, every filter element accepts all extended data frames,
+ * until the filters are set.
+ */
+static uint32_t vscp_tp_adapter_rxFifoFilter[VSCP_TP_ADAPTER_CAN_RX_FILTER_NUM] =
+{
+    FLEXCAN_RX_FIFO_EXT_FILTER_TYPE_A(0, 0, 1),
+    FLEXCAN_RX_FIFO_EXT_FILTER_TYPE_A(0, 0, 1),
+    FLEXCAN_RX_FIFO_EXT_FILTER_TYPE_A(0, 0, 1),
+    FLEXCAN_RX_FIFO_EXT_FILTER_TYPE_A(0, 0, 1),
+    FLEXCAN_RX_FIFO_EXT_FILTER_TYPE_A(0, 0, 1),
+    FLEXCAN_RX_FIFO_EXT_FILTER_TYPE_A(0, 0, 1),
+    FLEXCAN_RX_FIFO_EXT_FILTER_TYPE_A(0, 0, 1),
+    FLEXCAN_RX_FIFO_EXT_FILTER_TYPE_A(0, 0, 1)
+};
+
+/** Individual mask per rx FIFO filter element, only the IDE bit is checked,
+ * until the filters are set.
+ */
+static uint32_t vscp_tp_adapter_rxFifoMask[VSCP_TP_ADAPTER_CAN_RX_FILTER_NUM] =
+{
+    FLEXCAN_RX_FIFO_EXT_MASK_TYPE_A(0, 0, 1),
+    FLEXCAN_RX_FIFO_EXT_MASK_TYPE_A(0, 0, 1),
+    FLEXCAN_RX_FIFO_EXT_MASK_TYPE_A(0, 0, 1),
+    FLEXCAN_RX_FIFO_EXT_MASK_TYPE_A(0, 0, 1),
+    FLEXCAN_RX_FIFO_EXT_MASK_TYPE_A(0, 0, 1),
+    FLEXCAN_RX_FIFO_EXT_MASK_TYPE_A(0, 0, 1),
+    FLEXCAN_RX_FIFO_EXT_MASK_TYPE_A(0, 0, 1),
+    FLEXCAN_RX_FIFO_EXT_MASK_TYPE_A(0, 0, 1)
+};
+
 /*******************************************************************************
     GLOBAL VARIABLES
 *******************************************************************************/
@@ -103,9 +139,10 @@
  */
 extern void vscp_tp_adapter_init(void)
 {
-    flexcan_config_t		flexcanConfig	= { 0 };
-    flexcan_rx_mb_config_t	mbConfig		= { 0 };
-    uint8_t					index			= 0;
+    flexcan_config_t            flexcanConfig   = { 0 };
+
+    /* The rings must be ready, before the first interrupt occurs. */
+    vscp_can_adapter_init();
 
     /* Init FlexCAN module. */
     /*
@@ -123,25 +160,25 @@ extern void vscp_tp_adapter_init(void)
     flexcanConfig.clkSrc = kFLEXCAN_ClkSrcPeri;
 #endif /* FSL_FEATURE_FLEXCAN_SUPPORT_ENGINE_CLK_SEL_REMOVE */
 
+    /* Every rx FIFO filter element gets its own mask. */
+    flexcanConfig.enableIndividMask = true;
+
     FLEXCAN_Init(VSCP_TP_ADAPTER_CAN, &flexcanConfig, VSCP_TP_ADAPTER_CAN_CLK_FREQ);
 
-    /* Setup all rx message buffer. */
-    for(index = 0; index < VSCP_TP_ADAPTER_CAN_RX_MB_COUNT; ++index)
-    {
-		mbConfig.format = kFLEXCAN_FrameFormatExtend;
-		mbConfig.type = kFLEXCAN_FrameTypeData;
-		mbConfig.id = FLEXCAN_ID_EXT(0);
+    /* Setup the rx FIFO, which buffers up to 6 frames in hardware. */
+    vscp_tp_adapter_setupRxFifo();
 
-		/* Use lower message buffers */
-		FLEXCAN_SetRxMbConfig(VSCP_TP_ADAPTER_CAN, index, &mbConfig, true);
-    }
+    /* Setup tx message buffer */
+    FLEXCAN_SetTxMbConfig(VSCP_TP_ADAPTER_CAN, VSCP_TP_ADAPTER_CAN_TX_MB, true);
 
-    /* Setup all tx message buffer. */
-    for(index = 0; index < VSCP_TP_ADAPTER_CAN_TX_MB_COUNT; ++index)
-    {
-		/* Use upper message buffers */
-		FLEXCAN_SetTxMbConfig(VSCP_TP_ADAPTER_CAN, (VSCP_TP_ADAPTER_CAN_RX_MB_COUNT + index - 1), true);
-    }
+    /* Frames available in the rx FIFO, rx FIFO overflow and tx complete
+     * are signaled by interrupt.
+     */
+    FLEXCAN_EnableMbInterrupts(VSCP_TP_ADAPTER_CAN,
+                               kFLEXCAN_RxFifoFrameAvlFlag |
+                               kFLEXCAN_RxFifoOverflowFlag |
+                               (1u << VSCP_TP_ADAPTER_CAN_TX_MB));
+    EnableIRQ(VSCP_TP_ADAPTER_CAN_IRQN);
 
     return;
 }
@@ -156,61 +193,7 @@ extern void vscp_tp_adapter_init(void)
  */
 extern BOOL vscp_tp_adapter_readMessage(vscp_RxMessage * const msg)
 {
-    BOOL    		status  = FALSE;
-    static uint8_t	mbIdx	= 0;
-
-    if (NULL != msg)
-    {
-    	/* Walk through the receive message buffers and check whether a single message was received? */
-    	do
-    	{
-    		/* Receive message buffer signaled? */
-			if (FLEXCAN_GetMbStatusFlags(VSCP_TP_ADAPTER_CAN, 1 << mbIdx))
-			{
-				uint8_t 		index   = 0;
-				flexcan_frame_t	rxFrame	= { 0 };
-
-				/* Read CAN message from receive message buffer*/
-				FLEXCAN_ReadRxMb(VSCP_TP_ADAPTER_CAN, mbIdx, &rxFrame);
-
-				/* Build VSCP message */
-	            msg->vscpClass  = (uint16_t)((rxFrame.id >> 16) & 0x01ff);
-	            msg->vscpType   = (uint8_t)((rxFrame.id >> 8) & 0x00ff);
-	            msg->oAddr      = (uint8_t)((rxFrame.id >> 0) & 0x00ff);
-	            msg->hardCoded  = (uint8_t)((rxFrame.id >> 25) & 0x0001);
-	            msg->priority   = (VSCP_PRIORITY)((rxFrame.id >> 26) & 0x0007);
-	            msg->dataNum    = rxFrame.length;
-
-	            for(index = 0; index < msg->dataNum; ++index)
-	            {
-	            	/* Byte 0 - 3 */
-	            	if (4 < index)
-	            	{
-	            		msg->data[index] = (uint8_t)((rxFrame.dataWord0 >> (24 - index * 8)) & 0xff);
-	            	}
-	            	/* Byte 4 - 7 */
-	            	else
-	            	{
-	            		msg->data[index] = (uint8_t)((rxFrame.dataWord0 >> (48 - index * 8)) & 0xff);
-	            	}
-	            }
-
-	            /* Release receive message buffer */
-				FLEXCAN_ClearMbStatusFlags(VSCP_TP_ADAPTER_CAN, 1 << mbIdx);
-
-				status = TRUE;
-			}
-			else
-			{
-				++mbIdx;
-			}
-    	}
-    	while((VSCP_TP_ADAPTER_CAN_RX_MB_COUNT < mbIdx) && (FALSE == status));
-
-    	mbIdx %= VSCP_TP_ADAPTER_CAN_RX_MB_COUNT;
-    }
-
-    return status;
+    return vscp_can_adapter_readMessage(msg);
 }
 
 /**
@@ -223,77 +206,181 @@ extern BOOL vscp_tp_adapter_readMessage(vscp_RxMessage * const msg)
  */
 extern BOOL vscp_tp_adapter_writeMessage(vscp_TxMessage const * const msg)
 {
-    BOOL    status  = FALSE;
+    return vscp_can_adapter_writeMessage(msg);
+}
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_TP_ADAPTER_WRITE_MESSAGES )
 
-    if ((NULL != msg) &&                        /* Message shall exists */
-        (VSCP_L1_DATA_SIZE >= msg->dataNum))    /* Number of data bytes is limited */
+/**
+ * This function writes several messages to the transport layer at once. The
+ * messages shall be written in order, until the first one is not accepted.
+ *
+ * @param[in]   msgs    Message array
+ * @param[in]   num     Number of messages
+ * @return  Number of accepted messages
+ */
+extern uint8_t vscp_tp_adapter_writeMessages(vscp_TxMessage const * const msgs, uint8_t num)
+{
+    return vscp_can_adapter_writeMessages(msgs, num);
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_TP_ADAPTER_WRITE_MESSAGES ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CAN_FILTER )
+
+/**
+ * This function sets the CAN acceptance filters. A frame shall be received,
+ * if it passes at least one of them. The filters replace the previous ones.
+ *
+ * @param[in]   filters Filter array
+ * @param[in]   num     Number of filters, up to VSCP_CONFIG_CAN_FILTER_NUM
+ */
+extern void vscp_tp_adapter_setFilters(vscp_can_filter_Filter const * const filters, uint8_t num)
+{
+    uint8_t index   = 0;
+
+    if ((NULL == filters) ||
+        (0 == num))
+    {
+        return;
+    }
+
+    if (VSCP_TP_ADAPTER_CAN_RX_FILTER_NUM < num)
+    {
+        num = VSCP_TP_ADAPTER_CAN_RX_FILTER_NUM;
+    }
+
+    /* Unused filter elements repeat the last filter. Only extended data frames pass. */
+    for(index = 0; index < VSCP_TP_ADAPTER_CAN_RX_FILTER_NUM; ++index)
     {
-    	uint8_t			index	= 0;
-    	flexcan_frame_t	txFrame = { 0 };
-    	uint8_t			mbIdx	= VSCP_TP_ADAPTER_CAN_RX_MB_COUNT;	/* Right after the receive message buffers */
-
-        txFrame.format = kFLEXCAN_FrameFormatExtend;
-        txFrame.type = kFLEXCAN_FrameTypeData;
-        txFrame.id = FLEXCAN_ID_EXT(((uint32_t)msg->priority << 26) |
-									((uint32_t)msg->hardCoded << 25) |
-									((uint32_t)msg->vscpClass << 16) |
-									((uint32_t)msg->vscpType << 8) |
-									((uint32_t)msg->oAddr));
-        txFrame.length = msg->dataNum;
-
-        for(index = 0; index < msg->dataNum; ++index)
-        {
-        	/* Byte 0 - 3 */
-        	if (4 < index)
-        	{
-        		txFrame.dataWord0 |= msg->data[index] << (24 - index * 8);
-        	}
-        	/* Byte 4 - 7 */
-        	else
-        	{
-        		txFrame.dataWord1 |= msg->data[index] << (48 - index * 8);
-        	}
-        }
-
-        /* Send data through Tx Message Buffer using polling function. */
-        if (kStatus_Success == FLEXCAN_TransferSendBlocking(VSCP_TP_ADAPTER_CAN, mbIdx, &txFrame))
-        {
-        	status = TRUE;
-        }
+        vscp_can_filter_Filter const * const    filter  = &filters[(num > index) ? index : (num - 1)];
+
+        vscp_tp_adapter_rxFifoFilter[index] = FLEXCAN_RX_FIFO_EXT_FILTER_TYPE_A(filter->id, 0, 1);
+        vscp_tp_adapter_rxFifoMask[index]   = FLEXCAN_RX_FIFO_EXT_MASK_TYPE_A(filter->mask, 1, 1);
     }
 
-    return status;
+    /* The rx FIFO is reconfigured in freeze mode, the interrupt must not read it meanwhile. */
+    DisableIRQ(VSCP_TP_ADAPTER_CAN_IRQN);
+    vscp_tp_adapter_setupRxFifo();
+    EnableIRQ(VSCP_TP_ADAPTER_CAN_IRQN);
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CAN_FILTER ) */
+
+/**
+ * This function writes a frame to the transmit message buffer and starts the
+ * transmission. It is only called, if no other frame is pending, either from
+ * vscp_can_adapter_onTxComplete() or with disabled CAN interrupt.
+ *
+ * @param[in]   frame   Frame
+ */
+extern void vscp_can_hal_writeFrame(vscp_can_ring_Frame const * const frame)
+{
+    flexcan_frame_t txFrame = { 0 };
+
+    if (NULL != frame)
+    {
+        txFrame.format      = kFLEXCAN_FrameFormatExtend;
+        txFrame.type        = kFLEXCAN_FrameTypeData;
+        txFrame.id          = FLEXCAN_ID_EXT(frame->id);
+        txFrame.length      = frame->length;
+        txFrame.dataWord0   = frame->dataWord0;
+        txFrame.dataWord1   = frame->dataWord1;
+
+        (void)FLEXCAN_WriteTxMb(VSCP_TP_ADAPTER_CAN, VSCP_TP_ADAPTER_CAN_TX_MB, &txFrame);
+    }
+
+    return;
+}
+
+/**
+ * This function disables the CAN interrupt.
+ */
+extern void vscp_can_hal_disableIrq(void)
+{
+    DisableIRQ(VSCP_TP_ADAPTER_CAN_IRQN);
+
+    return;
+}
+
+/**
+ * This function enables the CAN interrupt.
+ */
+extern void vscp_can_hal_enableIrq(void)
+{
+    EnableIRQ(VSCP_TP_ADAPTER_CAN_IRQN);
+
+    return;
+}
+
+/**
+ * This function is called by the CAN interrupt of the message buffers and
+ * the rx FIFO.
+ */
+extern void CAN0_ORed_Message_buffer_IRQHandler(void)
+{
+    flexcan_frame_t     rxFrame = { 0 };
+    vscp_can_ring_Frame frame;
+
+    /* Empty the rx FIFO completely. */
+    while(0 != FLEXCAN_GetMbStatusFlags(VSCP_TP_ADAPTER_CAN, kFLEXCAN_RxFifoFrameAvlFlag))
+    {
+        (void)FLEXCAN_ReadRxFifo(VSCP_TP_ADAPTER_CAN, &rxFrame);
+
+        /* Release the rx FIFO output, the next frame moves in. */
+        FLEXCAN_ClearMbStatusFlags(VSCP_TP_ADAPTER_CAN, kFLEXCAN_RxFifoFrameAvlFlag);
+
+        /* Only extended data frames pass the filter, see rx FIFO setup. */
+        frame.id        = rxFrame.id & VSCP_CAN_CODEC_ID_MASK;
+        frame.length    = rxFrame.length;
+        frame.dataWord0 = rxFrame.dataWord0;
+        frame.dataWord1 = rxFrame.dataWord1;
+
+        vscp_can_adapter_onRxFrame(&frame);
+    }
+
+    /* Frames lost in hardware are not recoverable, just clear the flag. */
+    if (0 != FLEXCAN_GetMbStatusFlags(VSCP_TP_ADAPTER_CAN, kFLEXCAN_RxFifoOverflowFlag))
+    {
+        FLEXCAN_ClearMbStatusFlags(VSCP_TP_ADAPTER_CAN, kFLEXCAN_RxFifoOverflowFlag);
+    }
+
+    /* Transmission completed? */
+    if (0 != FLEXCAN_GetMbStatusFlags(VSCP_TP_ADAPTER_CAN, 1u << VSCP_TP_ADAPTER_CAN_TX_MB))
+    {
+        FLEXCAN_ClearMbStatusFlags(VSCP_TP_ADAPTER_CAN, 1u << VSCP_TP_ADAPTER_CAN_TX_MB);
+
+        vscp_can_adapter_onTxComplete();
+    }
+
+    return;
 }
 
 /*******************************************************************************
     LOCAL FUNCTIONS
 *******************************************************************************/
 
-static status_t vscp_tp_adapter_transferSendBlocking(CAN_Type *base, uint8_t mbIdx, flexcan_frame_t *txFrame, )
+/**
+ * This function configures the rx FIFO with the filter table and the
+ * individual masks of the filter elements.
+ */
+static void vscp_tp_adapter_setupRxFifo(void)
 {
-	status_t	status	= kStatus_Fail;
+    flexcan_rx_fifo_config_t    rxFifoConfig    = { 0 };
+    uint8_t                     index           = 0;
+
+    rxFifoConfig.idFilterTable  = vscp_tp_adapter_rxFifoFilter;
+    rxFifoConfig.idFilterNum    = VSCP_TP_ADAPTER_CAN_RX_FILTER_NUM;
+    rxFifoConfig.idFilterType   = kFLEXCAN_RxFifoFilterTypeA;
+    rxFifoConfig.priority       = kFLEXCAN_RxFifoPrioHigh;
+    FLEXCAN_SetRxFifoConfig(VSCP_TP_ADAPTER_CAN, &rxFifoConfig, true);
 
-    /* Write Tx Message Buffer to initiate a data sending. */
-    if (kStatus_Success == FLEXCAN_WriteTxMb(base, mbIdx, txFrame))
+    for(index = 0; index < VSCP_TP_ADAPTER_CAN_RX_FILTER_NUM; ++index)
     {
-    	uint32_t 	tickStartValue 		= PIT_GetCurrentTimerCount(PIT, kPIT_Chnl_0);
-    	uint32_t 	tickCurrentValue	= tickStartValue;
-    	bool		isTimeout			= false;
-
-        /* Wait until CAN Message send out. */
-        while (!FLEXCAN_GetMbStatusFlags(base, 1 << mbIdx) && (false == timeout))
-        {
-        	isTimeout = (100u <= (PIT_GetCurrentTimerCount(PIT, kPIT_Chnl_0) - tickStartValue)) ? true : false;
-        }
-
-        /* Clean Tx Message Buffer Flag. */
-        FLEXCAN_ClearMbStatusFlags(base, 1 << mbIdx);
-
-        if (false == timeout)
-        {
-        	status = kStatus_Success;
-        }
+        FLEXCAN_SetRxIndividualMask(VSCP_TP_ADAPTER_CAN, index, vscp_tp_adapter_rxFifoMask[index]);
     }
 
-    return status;
+    return;
 }
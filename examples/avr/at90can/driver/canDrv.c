@@ -32,6 +32,57 @@
 #include <avr/io.h>
 #include "canDrv.h"
 
+// Acceptance filter and mask of the receive MOB
+static unsigned char rxFilter[ 4 ] = { 0, 0, 0, 0 };
+static unsigned char rxMask[ 4 ] = { 0, 0, 0, 0 };
+
+///////////////////////////////////////////////////////////////////////////////
+// enableRxMob
+//
+// A received frame overwrites the id registers of the MOB, therefore the
+// acceptance filter and mask are written again, every time it is enabled.
+//
+
+static void enableRxMob( void )
+{
+    // Clear and disable the receive MOB, before it is changed
+    clrMob( MOB_RECEIVE );
+
+    CANIDT1 = rxFilter[ 0 ];
+    CANIDT2 = rxFilter[ 1 ];
+    CANIDT3 = rxFilter[ 2 ];
+    CANIDT4 = rxFilter[ 3 ];
+
+    CANIDM1 = rxMask[ 0 ];
+    CANIDM2 = rxMask[ 1 ];
+    CANIDM3 = rxMask[ 2 ];
+    CANIDM4 = rxMask[ 3 ];
+
+    // Enable it for receive
+    CANCDMOB |= 0x80;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// updateRxMob
+//
+// Enabling the receive MOB clears it. A received frame, which is not read yet,
+// is kept. The new acceptance filter and mask are written by can_readFrame(),
+// when it enables the MOB again.
+//
+
+static void updateRxMob( void )
+{
+    // Select receive MOB
+    setMob( MOB_RECEIVE );
+
+    // Frame pending?
+    if ( CANSTMOB & 0x20 ) {
+        return;
+    }
+
+    enableRxMob();
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // clrMob
 //
@@ -191,8 +242,7 @@ int can_Open( unsigned char StdSpeed,
      clrAllMob();
 
      // MOB 0 is for reception - enable it for receive
-     setMob( 0 );
-     CANCDMOB |= 0x80;
+     enableRxMob();
 
      CANGCON |= 2;
 
@@ -323,8 +373,7 @@ int can_readFrame( CANMsg *pmsg )
     }
 
     // Make the MOB ready to receive again
-    clrMob( 0 );
-    CANCDMOB |= 0x80;
+    enableRxMob();
 
     return rv;
 }
@@ -350,13 +399,13 @@ int can_setFilter( unsigned char Filter0,
 {
     int rv = ERROR_OK;
 
-    // Select receive MOB
-    setMob( 0 );
+    rxFilter[ 0 ] = Filter0;
+    rxFilter[ 1 ] = Filter1;
+    rxFilter[ 2 ] = Filter2;
+    rxFilter[ 3 ] = Filter3;
 
-    CANIDT1 = Filter0;
-    CANIDT2 = Filter1;
-    CANIDT3 = Filter2;
-    CANIDT4 = Filter3;
+    // Write it to the receive MOB
+    updateRxMob();
 
     return rv;
 }
@@ -372,13 +421,47 @@ int can_setMask( unsigned char Mask0,
 {
     int rv = ERROR_OK;
 
-    // Select receive MOB
-    setMob( 0 );
+    rxMask[ 0 ] = Mask0;
+    rxMask[ 1 ] = Mask1;
+    rxMask[ 2 ] = Mask2;
+    rxMask[ 3 ] = Mask3;
+
+    // Write it to the receive MOB
+    updateRxMob();
+
+    return rv;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// can_setFilterMask
+//
+// Sets the acceptance filter and mask together, therefore the receive MOB is
+// never enabled with the new filter and the old mask.
+//
+
+int can_setFilterMask( unsigned char Filter0,
+                        unsigned char Filter1,
+                        unsigned char Filter2,
+                        unsigned char Filter3,
+                        unsigned char Mask0,
+                        unsigned char Mask1,
+                        unsigned char Mask2,
+                        unsigned char Mask3 )
+{
+    int rv = ERROR_OK;
+
+    rxFilter[ 0 ] = Filter0;
+    rxFilter[ 1 ] = Filter1;
+    rxFilter[ 2 ] = Filter2;
+    rxFilter[ 3 ] = Filter3;
+
+    rxMask[ 0 ] = Mask0;
+    rxMask[ 1 ] = Mask1;
+    rxMask[ 2 ] = Mask2;
+    rxMask[ 3 ] = Mask3;
 
-    CANIDM1 = Mask0;
-    CANIDM2 = Mask1;
-    CANIDM3 = Mask2;
-    CANIDM4 = Mask3;
+    // Write it to the receive MOB
+    updateRxMob();
 
     return rv;
 }
@@ -264,6 +264,14 @@ int can_setMask( unsigned char Mask0,
                     unsigned char Mask1,
                     unsigned char Mask2,
                     unsigned char Mask3 );
+int can_setFilterMask( unsigned char Filter0,
+                        unsigned char Filter1,
+                        unsigned char Filter2,
+                        unsigned char Filter3,
+                        unsigned char Mask0,
+                        unsigned char Mask1,
+                        unsigned char Mask2,
+                        unsigned char Mask3 );
 
 
 #endif // CAN_AT90CAN1238
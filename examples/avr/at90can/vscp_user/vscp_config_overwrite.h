@@ -67,6 +67,10 @@ extern "C"
 
 #define VSCP_CONFIG_HEARTBEAT_NODE              VSCP_CONFIG_BASE_ENABLED
 
+#define VSCP_CONFIG_ENABLE_EVENT_INTEREST_RESPONSE  VSCP_CONFIG_BASE_ENABLED
+
+#define VSCP_CONFIG_ENABLE_CAN_FILTER           VSCP_CONFIG_BASE_ENABLED
+
 /* ---------- Define here your preferred configuration setup. ---------- */
 
 /*
@@ -116,6 +120,9 @@ extern "C"
 
 #define VSCP_CONFIG_DM_ROWS                     2
 
+/* The CAN driver receives with a single message object. */
+#define VSCP_CONFIG_CAN_FILTER_NUM              1
+
 /*
 
 #define VSCP_CONFIG_NODE_SEGMENT_INIT_TIMEOUT   ((uint16_t)5000)
@@ -124,7 +131,7 @@ extern "C"
 
 #define VSCP_CONFIG_MULTI_MSG_TIMEOUT           ((uint16_t)1000)
 
-#define VSCP_CONFIG_HEARTBEAT_NODE_PERIOD       ((uint16_t)30000)
+#define VSCP_CONFIG_HEARTBEAT_NODE_PERIOD       30000
 
 #define VSCP_CONFIG_DM_PAGE                     1
 
@@ -229,6 +229,16 @@ extern BOOL vscp_portable_sendNodeHeartbeatEvent();
 
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CUSTOM_HEARTBEAT ) */
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST_RESPONSE )
+
+/**
+ * This function is called while the event interest is built. Add the classes
+ * and types, the application is interested in, via vscp_interest_add().
+ */
+extern void vscp_portable_addEventInterest(void);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST_RESPONSE ) */
+
 #ifdef __cplusplus
 }
 #endif
@@ -41,6 +41,7 @@
     INCLUDES
 *******************************************************************************/
 #include "vscp_tp_adapter.h"
+#include "vscp_can_codec.h"
 #include "canDrv.h"
 #include <util/delay.h>
 
@@ -113,11 +114,7 @@ extern BOOL vscp_tp_adapter_readMessage(vscp_RxMessage * const msg)
         {
             uint8_t index   = 0;
 
-            msg->vscpClass  = (uint16_t)((canMsg.id >> 16) & 0x01ff);
-            msg->vscpType   = (uint8_t)((canMsg.id >> 8) & 0x00ff);
-            msg->oAddr      = (uint8_t)((canMsg.id >> 0) & 0x00ff);
-            msg->hardCoded  = (uint8_t)((canMsg.id >> 25) & 0x0001);
-            msg->priority   = (VSCP_PRIORITY)((canMsg.id >> 26) & 0x0007);
+            vscp_can_codec_decodeId(canMsg.id, msg);
             msg->dataNum    = canMsg.len;
 
             for(index = 0; index < msg->dataNum; ++index)
@@ -152,11 +149,7 @@ extern BOOL vscp_tp_adapter_writeMessage(vscp_TxMessage const * const msg)
         int8_t  rv          = 0;    /* Return value of CAN driver */
         uint8_t retryCnt    = 0;    /* Retry counter */
 
-        canMsg.id       = ( (unsigned long)msg->priority << 26 ) |
-                          ( (unsigned long)msg->hardCoded << 25) |
-                          ( (unsigned long)msg->vscpClass << 16 ) |
-                          ( (unsigned long)msg->vscpType << 8) |
-                          ( (unsigned long)msg->oAddr);
+        canMsg.id       = vscp_can_codec_encodeId(msg);
         canMsg.flags    = CAN_IDFLAG_EXTENDED;
         canMsg.len      = msg->dataNum;
 
@@ -194,6 +187,44 @@ extern BOOL vscp_tp_adapter_writeMessage(vscp_TxMessage const * const msg)
     return status;
 }
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CAN_FILTER )
+
+/**
+ * This function sets the CAN acceptance filters. A frame shall be received,
+ * if it passes at least one of them. The filters replace the previous ones.
+ *
+ * The CAN driver receives with a single message object, therefore only one
+ * filter is supported (VSCP_CONFIG_CAN_FILTER_NUM = 1). The planner merges
+ * the interests to one filter with a wider mask. In any other case all frames
+ * are accepted.
+ *
+ * @param[in]   filters Filter array
+ * @param[in]   num     Number of filters, up to VSCP_CONFIG_CAN_FILTER_NUM
+ */
+extern void vscp_tp_adapter_setFilters(vscp_can_filter_Filter const * const filters, uint8_t num)
+{
+    uint32_t    id      = 0;
+    uint32_t    mask    = 0;    /* Accept all frames */
+
+    if ((NULL != filters) &&
+        (1 == num))
+    {
+        id      = filters[0].id;
+        mask    = filters[0].mask;
+    }
+
+    /* Identifier and mask registers of the message object (29 bit identifier).
+     * Both are set together, otherwise the message object would be enabled
+     * with the new identifier and the old mask in between.
+     */
+    (void)can_setFilterMask((uint8_t)(id >> 21), (uint8_t)(id >> 13), (uint8_t)(id >> 5), (uint8_t)((id & 0x1F) << 3),
+                            (uint8_t)(mask >> 21), (uint8_t)(mask >> 13), (uint8_t)(mask >> 5), (uint8_t)((mask & 0x1F) << 3));
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CAN_FILTER ) */
+
 /*******************************************************************************
     LOCAL FUNCTIONS
 *******************************************************************************/
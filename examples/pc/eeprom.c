@@ -37,6 +37,7 @@
 
 *******************************************************************************/
 
+
 /*******************************************************************************
     INCLUDES
 *******************************************************************************/
@@ -45,6 +46,8 @@
 #include <memory.h>
 #include <stdlib.h>
 #include "log.h"
+#include "platform.h"
+#include "crc16ccitt.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -69,10 +72,43 @@
 #define TRUE    1
 #endif  /* Undefined TRUE */
 
+/** EEPROM file magic */
+#define EEPROM_MAGIC                "VSCPEEP"
+
+/** EEPROM file magic size in bytes, incl. string termination */
+#define EEPROM_MAGIC_SIZE           (8u)
+
+/** EEPROM file format version */
+#define EEPROM_VERSION              (2u)
+
+/** EEPROM file header size in bytes */
+#define EEPROM_HEADER_SIZE          (16u)
+
+/** Offset of the format version in the file header */
+#define EEPROM_HEADER_VERSION       (8u)
+
+/** Offset of the image size in the file header */
+#define EEPROM_HEADER_IMAGE_SIZE    (10u)
+
+/** Number of image slots */
+#define EEPROM_SLOT_NUM             (2u)
+
+/** Slot header size in bytes */
+#define EEPROM_SLOT_HEADER_SIZE     (8u)
+
+/** Offset of the sequence number in the slot header */
+#define EEPROM_SLOT_SEQUENCE        (0u)
+
+/** Offset of the CRC in the slot header */
+#define EEPROM_SLOT_CRC             (4u)
+
 /*******************************************************************************
     MACROS
 *******************************************************************************/
 
+/** Get the address of a slot in the mapped file. */
+#define EEPROM_SLOT_ADDR(__index)   (&eeprom_file.addr[EEPROM_HEADER_SIZE + (__index) * (EEPROM_SLOT_HEADER_SIZE + eeprom_size)])
+
 /*******************************************************************************
     TYPES AND STRUCTURES
 *******************************************************************************/
@@ -81,18 +117,41 @@
     PROTOTYPES
 *******************************************************************************/
 
+static void eeprom_putUInt16(uint8_t * const buffer, uint16_t value);
+static uint16_t eeprom_getUInt16(uint8_t const * const buffer);
+static void eeprom_putUInt32(uint8_t * const buffer, uint32_t value);
+static uint32_t eeprom_getUInt32(uint8_t const * const buffer);
+static uint16_t eeprom_calculateSlotCrc(uint8_t const * const slot);
+static BOOL eeprom_loadSlots(void);
+static BOOL eeprom_import(char const * const fileName);
+
 /*******************************************************************************
     LOCAL VARIABLES
 *******************************************************************************/
 
 /** EEPROM size in bytes */
-static uint16_t eeprom_size     = 0;
+static uint16_t             eeprom_size         = 0;
 
 /** EEPROM storage in the memory */
-static uint8_t* eeprom_storage  = NULL;
+static uint8_t*             eeprom_storage      = NULL;
+
+/** Mapped EEPROM file */
+static platform_MappedFile  eeprom_file;
+
+/** Is the EEPROM storage backed by a mapped file or not? */
+static BOOL                 eeprom_isMapped     = FALSE;
 
 /** Dirty flag of EEPROM */
-static BOOL     eeprom_dirty    = FALSE;
+static BOOL                 eeprom_dirty        = FALSE;
+
+/** Slot, which contains the last committed image */
+static uint8_t              eeprom_activeSlot   = 0;
+
+/** Sequence number of the last committed image */
+static uint32_t             eeprom_sequence     = 0;
+
+/** Monotonic time of the last flush in us */
+static uint64_t             eeprom_flushTime    = 0;
 
 /*******************************************************************************
     GLOBAL VARIABLES
@@ -115,12 +174,6 @@ extern void eeprom_init(uint16_t size)
         /* EEPROM size must be a multiple of EEPROM_STORAGE_MULTIPLE */
         eeprom_size     = (size / EEPROM_STORAGE_MULTIPLE) * EEPROM_STORAGE_MULTIPLE;
         eeprom_size    += (0 < (size % EEPROM_STORAGE_MULTIPLE)) ? EEPROM_STORAGE_MULTIPLE : 0;
-        eeprom_storage  = (uint8_t*) malloc(eeprom_size);
-
-        if (NULL == eeprom_storage)
-        {
-            eeprom_size = 0;
-        }
     }
 
     return;
@@ -128,11 +181,19 @@ extern void eeprom_init(uint16_t size)
 
 /**
  * This function de-initializes the EEPROM simulation.
+ * All changes are written to the storage device.
  */
 extern void eeprom_deInit(void)
 {
     if (NULL != eeprom_storage)
     {
+        if (TRUE == eeprom_isMapped)
+        {
+            eeprom_flush();
+            platform_unmapFile(&eeprom_file);
+            eeprom_isMapped = FALSE;
+        }
+
         free(eeprom_storage);
         eeprom_storage = NULL;
     }
@@ -141,194 +202,160 @@ extern void eeprom_deInit(void)
 }
 
 /**
- * Load file to EEPROM memory.
+ * Map the EEPROM file into memory and load the last committed image. A new
+ * EEPROM file is initialized with the content of the legacy EEPROM file, if
+ * it exists. Otherwise or if the file is corrupt, the EEPROM is reset.
  *
- * @param[in] fileName  Filename of EEPROM file
+ * @param[in] fileName          Filename of EEPROM file
+ * @param[in] legacyFileName    Filename of the legacy ASCII EEPROM file, which is imported once (may be NULL)
  */
-extern void eeprom_load(char* fileName)
+extern void eeprom_load(char const * const fileName, char const * const legacyFileName)
 {
-    FILE    *fd     = NULL;
     BOOL    psReset = FALSE;
 
     if ((NULL == fileName) ||
-        (NULL == eeprom_storage))
+        (0 == eeprom_size))
     {
         LOG_FATAL("Unexpected NULL pointer.");
         return;
     }
 
-    /* If a EEPROM file exists, it will be loaded. */
-    fd = fopen(fileName, "rb");
+    /* Already loaded? */
+    if (NULL != eeprom_storage)
+    {
+        return;
+    }
+
+    eeprom_storage = (uint8_t*)malloc(eeprom_size);
 
-    if (NULL != fd)
+    if (NULL == eeprom_storage)
     {
-        long    fileSize    = 0;
-        BOOL    error       = FALSE;
+        LOG_FATAL("Out of memory.");
+        return;
+    }
 
-        /* EEPROM file size in bytes. It depends on the used format in ASCII. */
-        const long  calcFileSize    = ((eeprom_size / EEPROM_STORAGE_MULTIPLE) * (3 * EEPROM_STORAGE_MULTIPLE + 7));
+    if (0 != platform_mapFile(&eeprom_file, fileName, EEPROM_HEADER_SIZE + EEPROM_SLOT_NUM * (EEPROM_SLOT_HEADER_SIZE + eeprom_size)))
+    {
+        LOG_ERROR("Couldn't map EEPROM file, changes are not persistent.");
+        psReset = TRUE;
+    }
+    else
+    {
+        uint8_t * const header  = eeprom_file.addr;
 
-        LOG_INFO("EEPROM file found.");
+        eeprom_isMapped = TRUE;
 
-        /* Determine file size */
-        if (0 != fseek(fd, 0L, SEEK_END))
+        /* New file or a file of something else? */
+        if (0 != memcmp(&header[0], EEPROM_MAGIC, EEPROM_MAGIC_SIZE))
         {
-            error = TRUE;
-        }
-        else
-        {
-            fileSize = ftell(fd);
+            memset(header, 0, EEPROM_HEADER_SIZE);
+            memcpy(&header[0], EEPROM_MAGIC, EEPROM_MAGIC_SIZE);
+            header[EEPROM_HEADER_VERSION] = EEPROM_VERSION;
+            eeprom_putUInt16(&header[EEPROM_HEADER_IMAGE_SIZE], eeprom_size);
+
+            eeprom_activeSlot   = 0;
+            eeprom_sequence     = 0;
 
-            if (0 != fseek(fd, 0L, SEEK_SET))
+            if ((NULL != legacyFileName) &&
+                (TRUE == eeprom_import(legacyFileName)))
             {
-                error = TRUE;
+                printf("EEPROM file %s imported to %s.\n", legacyFileName, fileName);
+
+                /* Commit the imported image immediately. */
+                eeprom_dirty = TRUE;
+                eeprom_flush();
             }
             else
             {
-                fileSize -= ftell(fd);
+                psReset = TRUE;
             }
         }
-
-        /* File will be loaded if no error happened and file size is correct. */
-        if ((FALSE == error) &&
-            (calcFileSize == fileSize))
+        /* EEPROM file of a different format or EEPROM layout? */
+        else if ((EEPROM_VERSION != header[EEPROM_HEADER_VERSION]) ||
+                 (eeprom_size != eeprom_getUInt16(&header[EEPROM_HEADER_IMAGE_SIZE])))
         {
-            uint16_t    index   = 0;
+            LOG_WARNING("EEPROM file has a different format.");
 
-            for(index = 0; index < eeprom_size; ++index)
-            {
-                uint32_t    tmp = 0;
-
-                if (0 == (index % EEPROM_STORAGE_MULTIPLE))
-                {
-                    /* Overstep address */
-                    if (0 != fseek(fd, 6L, SEEK_CUR))
-                    {
-                        psReset = TRUE;
-                    }
-                }
-
-                if (1 != fscanf(fd, "%02X", &tmp))
-                {
-                    psReset = TRUE;
-                }
-
-                if (255 >= tmp)
-                {
-                    eeprom_storage[index] = tmp;
-                }
-                else
-                {
-                    psReset = TRUE;
-                }
-
-                if (0 != ((index + 1) % EEPROM_STORAGE_MULTIPLE))
-                {
-                    /* Overstep space */
-                    if (0 != fseek(fd, 1L, SEEK_CUR))
-                    {
-                        psReset = TRUE;
-                    }
-                }
-                else
-                {
-                    /* Overstep CR LF */
-                    if (0 != fseek(fd, 2L, SEEK_CUR))
-                    {
-                        psReset = TRUE;
-                    }
-                }
-
-                if (TRUE == psReset)
-                {
-                    LOG_ERROR("Loading EEPROM file aborted.");
-                    break;
-                }
-            }
+            header[EEPROM_HEADER_VERSION] = EEPROM_VERSION;
+            eeprom_putUInt16(&header[EEPROM_HEADER_IMAGE_SIZE], eeprom_size);
+            memset(EEPROM_SLOT_ADDR(0), 0, EEPROM_SLOT_NUM * (EEPROM_SLOT_HEADER_SIZE + eeprom_size));
 
-            if (FALSE == psReset)
-            {
-                LOG_INFO("EEPROM file loaded.");
-            }
+            psReset = TRUE;
         }
-        else
+        /* No image was committed completely? */
+        else if (FALSE == eeprom_loadSlots())
         {
             LOG_WARNING("EEPROM file corrupt.");
             psReset = TRUE;
         }
-
-        fclose(fd);
-    }
-    else
-    {
-        psReset = TRUE;
+        else
+        {
+            LOG_INFO("EEPROM file loaded.");
+        }
     }
 
     if (TRUE == psReset)
     {
         /* Reset EEPROM. */
         memset(eeprom_storage, 0xff, eeprom_size);
-
         eeprom_dirty = TRUE;
     }
 
+    eeprom_flushTime = platform_getMonotonicTime();
+
     return;
 }
 
 /**
- * Save the EEPROM to file.
- *
- * @param[in] fileName  Filename of EEPROM file.
+ * Write the EEPROM image to the storage device, if it changed. It is written
+ * to the inactive slot, which becomes the active one after it is completely
+ * written. A torn write leaves the last committed image untouched.
  */
-extern void eeprom_save(char* fileName)
+extern void eeprom_flush(void)
 {
-    if ((NULL == fileName) ||
-        (NULL == eeprom_storage))
+    uint8_t     inactiveSlot    = 0;
+    uint8_t*    slot            = NULL;
+
+    /* Flush only, if something has changed in the persistent memory. */
+    if ((FALSE == eeprom_isMapped) ||
+        (FALSE == eeprom_dirty))
     {
-        LOG_FATAL("Unexpected NULL pointer.");
         return;
     }
 
-    /* Save only, if something has changed in the persistent memory. */
-    if (FALSE != eeprom_dirty)
-    {
-        FILE    *fd = NULL;
+    inactiveSlot    = (eeprom_activeSlot + 1) % EEPROM_SLOT_NUM;
+    slot            = EEPROM_SLOT_ADDR(inactiveSlot);
 
-        LOG_INFO("EEPROM will be stored to file.");
+    memcpy(&slot[EEPROM_SLOT_HEADER_SIZE], eeprom_storage, eeprom_size);
+    eeprom_putUInt32(&slot[EEPROM_SLOT_SEQUENCE], eeprom_sequence + 1);
+    eeprom_putUInt16(&slot[EEPROM_SLOT_CRC], eeprom_calculateSlotCrc(slot));
 
-        fd = fopen(fileName, "wb");
+    if (0 != platform_syncMappedFileRange(&eeprom_file, (size_t)(slot - eeprom_file.addr), EEPROM_SLOT_HEADER_SIZE + eeprom_size))
+    {
+        LOG_ERROR("Couldn't write EEPROM file.");
+        return;
+    }
 
-        if (NULL == fd)
-        {
-            LOG_ERROR("Couldn't create EEPROM file.");
-        }
-        else
-        {
-            uint16_t    index       = 0;
+    /* The slot is on the storage device, flip to it. */
+    eeprom_activeSlot   = inactiveSlot;
+    eeprom_sequence    += 1;
+    eeprom_dirty        = FALSE;
 
-            for(index = 0; index < eeprom_size; ++index)
-            {
-                if (0 == (index % EEPROM_STORAGE_MULTIPLE))
-                {
-                    (void)fprintf(fd, "%04X: ", index);
-                }
-
-                (void)fprintf(fd, "%02X", eeprom_storage[index]);
-
-                if (0 != ((index + 1) % EEPROM_STORAGE_MULTIPLE))
-                {
-                    (void)fprintf(fd, " ");
-                }
-                else
-                {
-                    (void)fprintf(fd, "\r\n");
-                }
-            }
+    return;
+}
 
-            LOG_INFO("EEPROM successful stored to file.");
+/**
+ * Write the changed EEPROM to the storage device, if the flush period is
+ * elapsed. Call it periodically.
+ */
+extern void eeprom_process(void)
+{
+    uint64_t    now = platform_getMonotonicTime();
 
-            fclose(fd);
-        }
+    if ((((uint64_t)EEPROM_FLUSH_PERIOD) * 1000u) <= (now - eeprom_flushTime))
+    {
+        eeprom_flush();
+        eeprom_flushTime = now;
     }
 
     return;
@@ -344,7 +371,8 @@ extern uint8_t  eeprom_read8(uint16_t addr)
 {
     uint8_t data    = 0;
 
-    if (eeprom_size > addr)
+    if ((NULL != eeprom_storage) &&
+        (eeprom_size > addr))
     {
         data = eeprom_storage[addr];
     }
@@ -367,11 +395,15 @@ extern uint8_t  eeprom_read8(uint16_t addr)
  */
 extern void eeprom_write8(uint16_t addr, uint8_t value)
 {
-    if (eeprom_size > addr)
+    if ((NULL != eeprom_storage) &&
+        (eeprom_size > addr))
     {
-        eeprom_storage[addr] = value;
-
-        eeprom_dirty = TRUE;
+        /* Writing the same value again changes nothing. */
+        if (value != eeprom_storage[addr])
+        {
+            eeprom_storage[addr]    = value;
+            eeprom_dirty            = TRUE;
+        }
     }
     else
     {
@@ -386,6 +418,7 @@ extern void eeprom_write8(uint16_t addr, uint8_t value)
 
 /**
  * Get base address of EEPROM storage in memory.
+ * Call eeprom_markDirty() before the EEPROM is changed via the base address.
  *
  * @param[out] size EEPROM memory size
  * @return EEPROM memory base address
@@ -400,6 +433,20 @@ extern uint8_t* eeprom_getBase(uint16_t* size)
     return eeprom_storage;
 }
 
+/**
+ * Mark the whole EEPROM as changed. Call it before the EEPROM is changed via
+ * its base address.
+ */
+extern void eeprom_markDirty(void)
+{
+    if (NULL != eeprom_storage)
+    {
+        eeprom_dirty = TRUE;
+    }
+
+    return;
+}
+
 /**
  * Dump the EEPROM to console.
  */
@@ -439,3 +486,183 @@ extern void eeprom_dump(void)
 /*******************************************************************************
     LOCAL FUNCTIONS
 *******************************************************************************/
+
+/**
+ * This function writes a 16-bit value in little endian byte order.
+ *
+ * @param[out]  buffer  Buffer
+ * @param[in]   value   Value
+ */
+static void eeprom_putUInt16(uint8_t * const buffer, uint16_t value)
+{
+    buffer[0] = (uint8_t)((value >> 0) & 0xff);
+    buffer[1] = (uint8_t)((value >> 8) & 0xff);
+
+    return;
+}
+
+/**
+ * This function reads a 16-bit value in little endian byte order.
+ *
+ * @param[in]   buffer  Buffer
+ * @return Value
+ */
+static uint16_t eeprom_getUInt16(uint8_t const * const buffer)
+{
+    return (uint16_t)(((uint16_t)buffer[0]) | (((uint16_t)buffer[1]) << 8));
+}
+
+/**
+ * This function writes a 32-bit value in little endian byte order.
+ *
+ * @param[out]  buffer  Buffer
+ * @param[in]   value   Value
+ */
+static void eeprom_putUInt32(uint8_t * const buffer, uint32_t value)
+{
+    buffer[0] = (uint8_t)((value >>  0) & 0xff);
+    buffer[1] = (uint8_t)((value >>  8) & 0xff);
+    buffer[2] = (uint8_t)((value >> 16) & 0xff);
+    buffer[3] = (uint8_t)((value >> 24) & 0xff);
+
+    return;
+}
+
+/**
+ * This function reads a 32-bit value in little endian byte order.
+ *
+ * @param[in]   buffer  Buffer
+ * @return Value
+ */
+static uint32_t eeprom_getUInt32(uint8_t const * const buffer)
+{
+    return ((uint32_t)buffer[0]) |
+           (((uint32_t)buffer[1]) <<  8) |
+           (((uint32_t)buffer[2]) << 16) |
+           (((uint32_t)buffer[3]) << 24);
+}
+
+/**
+ * This function calculates the CRC of a slot over its sequence number and
+ * its image.
+ *
+ * @param[in]   slot    Slot
+ * @return CRC-16-CCITT
+ */
+static uint16_t eeprom_calculateSlotCrc(uint8_t const * const slot)
+{
+    Crc16CCITT  crc = crc16ccitt_init();
+
+    crc = crc16ccitt_update(crc, &slot[EEPROM_SLOT_SEQUENCE], 4);
+    crc = crc16ccitt_update(crc, &slot[EEPROM_SLOT_HEADER_SIZE], eeprom_size);
+
+    return crc16ccitt_finalize(crc);
+}
+
+/**
+ * This function loads the image of the valid slot with the highest sequence
+ * number.
+ *
+ * @return Image loaded or not
+ * @retval FALSE    No valid slot
+ * @retval TRUE     Image loaded
+ */
+static BOOL eeprom_loadSlots(void)
+{
+    BOOL    isLoaded    = FALSE;
+    uint8_t index       = 0;
+
+    for(index = 0; index < EEPROM_SLOT_NUM; ++index)
+    {
+        uint8_t const * const   slot        = EEPROM_SLOT_ADDR(index);
+        uint32_t                sequence    = eeprom_getUInt32(&slot[EEPROM_SLOT_SEQUENCE]);
+
+        /* Torn or never written? */
+        if (eeprom_calculateSlotCrc(slot) != eeprom_getUInt16(&slot[EEPROM_SLOT_CRC]))
+        {
+            continue;
+        }
+
+        /* The sequence number may wrap around. */
+        if ((FALSE == isLoaded) ||
+            (0 < (int32_t)(sequence - eeprom_sequence)))
+        {
+            memcpy(eeprom_storage, &slot[EEPROM_SLOT_HEADER_SIZE], eeprom_size);
+            eeprom_activeSlot   = index;
+            eeprom_sequence     = sequence;
+            isLoaded            = TRUE;
+        }
+    }
+
+    return isLoaded;
+}
+
+/**
+ * This function imports a legacy EEPROM file in ASCII format, which contains
+ * lines of "AAAA: DD DD DD DD DD DD DD DD" with CR LF.
+ *
+ * @param[in]   fileName    Filename of the legacy EEPROM file
+ * @return Imported or not
+ * @retval FALSE    File doesn't exist or is corrupt
+ * @retval TRUE     Imported
+ */
+static BOOL eeprom_import(char const * const fileName)
+{
+    FILE*       fd          = NULL;
+    BOOL        isImported  = FALSE;
+    long        fileSize    = 0;
+    uint16_t    index       = 0;
+
+    /* EEPROM file size in bytes. It depends on the used format in ASCII. */
+    const long  calcFileSize    = ((eeprom_size / EEPROM_STORAGE_MULTIPLE) * (3 * EEPROM_STORAGE_MULTIPLE + 7));
+
+    fd = fopen(fileName, "rb");
+
+    if (NULL == fd)
+    {
+        return FALSE;
+    }
+
+    /* Determine file size */
+    if ((0 == fseek(fd, 0L, SEEK_END)) &&
+        (0 <= (fileSize = ftell(fd))) &&
+        (0 == fseek(fd, 0L, SEEK_SET)))
+    {
+        isImported = (calcFileSize == fileSize) ? TRUE : FALSE;
+    }
+
+    for(index = 0; (TRUE == isImported) && (index < eeprom_size); ++index)
+    {
+        unsigned int    tmp = 0;
+
+        /* Overstep address */
+        if ((0 == (index % EEPROM_STORAGE_MULTIPLE)) &&
+            (0 != fseek(fd, 6L, SEEK_CUR)))
+        {
+            isImported = FALSE;
+        }
+        else if ((1 != fscanf(fd, "%02X", &tmp)) ||
+                 (255 < tmp))
+        {
+            isImported = FALSE;
+        }
+        /* Overstep space or CR LF */
+        else if (0 != fseek(fd, (0 != ((index + 1) % EEPROM_STORAGE_MULTIPLE)) ? 1L : 2L, SEEK_CUR))
+        {
+            isImported = FALSE;
+        }
+        else
+        {
+            eeprom_storage[index] = (uint8_t)tmp;
+        }
+    }
+
+    fclose(fd);
+
+    if (FALSE == isImported)
+    {
+        LOG_WARNING("Legacy EEPROM file corrupt, not imported.");
+    }
+
+    return isImported;
+}
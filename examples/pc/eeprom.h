@@ -38,6 +38,31 @@ This module simulates a EEPROM.
 *******************************************************************************/
 /** @defgroup eeprom EEPROM simulation
  * This module simulates a EEPROM.
+ *
+ * The EEPROM image is kept in memory and committed to a file, which is mapped
+ * into memory. A changed image is committed periodically by eeprom_process()
+ * and at the end by eeprom_deInit().
+ *
+ * The file starts with a header (16 bytes), followed by two image slots:
+ * - Magic "VSCPEEP" incl. string termination (8 bytes)
+ * - Format version (1 byte)
+ * - Reserved (1 byte)
+ * - Image size in bytes (2 bytes)
+ * - Reserved (4 bytes)
+ *
+ * Every slot contains:
+ * - Sequence number (4 bytes)
+ * - CRC-16-CCITT over the sequence number and the image (2 bytes)
+ * - Reserved (2 bytes)
+ * - Image
+ *
+ * The image is written with the next sequence number to the inactive slot,
+ * which is written to the storage device, before it becomes the active one.
+ * A torn slot fails the CRC and the other slot with the last committed image
+ * is loaded. Only if both slots are invalid, the EEPROM is reset.
+ *
+ * A new EEPROM file is initialized once with the content of the legacy ASCII
+ * EEPROM file, if it exists.
  * @{
  */
 
@@ -70,6 +95,9 @@ extern "C"
 /** The EEPROM storage has always to be a multiple of this number. */
 #define EEPROM_STORAGE_MULTIPLE 8
 
+/** Period in ms, after which changes are written to the storage device. */
+#define EEPROM_FLUSH_PERIOD     1000
+
 /*******************************************************************************
     MACROS
 *******************************************************************************/
@@ -99,18 +127,27 @@ extern void eeprom_init(uint16_t size);
 extern void eeprom_deInit(void);
 
 /**
- * Load file to EEPROM memory.
+ * Map the EEPROM file into memory and load the last committed image. A new
+ * EEPROM file is initialized with the content of the legacy EEPROM file, if
+ * it exists. Otherwise or if the file is corrupt, the EEPROM is reset.
  *
- * @param[in] fileName  Filename of EEPROM file
+ * @param[in] fileName          Filename of EEPROM file
+ * @param[in] legacyFileName    Filename of the legacy ASCII EEPROM file, which is imported once (may be NULL)
  */
-extern void eeprom_load(char* fileName);
+extern void eeprom_load(char const * const fileName, char const * const legacyFileName);
 
 /**
- * Save the EEPROM to file.
- *
- * @param[in] fileName  Filename of EEPROM file
+ * Write the EEPROM image to the storage device, if it changed. It is written
+ * to the inactive slot, which becomes the active one after it is completely
+ * written. A torn write leaves the last committed image untouched.
  */
-extern void eeprom_save(char* fileName);
+extern void eeprom_flush(void);
+
+/**
+ * Write the changed EEPROM to the storage device, if the flush period is
+ * elapsed. Call it periodically.
+ */
+extern void eeprom_process(void);
 
 /**
  * Read a single byte from the EEPROM.
@@ -130,12 +167,19 @@ extern void eeprom_write8(uint16_t addr, uint8_t value);
 
 /**
  * Get base address of EEPROM storage in memory.
+ * Call eeprom_markDirty() before the EEPROM is changed via the base address.
  *
  * @param[out] size EEPROM memory size
  * @return EEPROM memory base address
  */
 extern uint8_t* eeprom_getBase(uint16_t* size);
 
+/**
+ * Mark the whole EEPROM as changed. Call it before the EEPROM is changed via
+ * its base address.
+ */
+extern void eeprom_markDirty(void);
+
 /**
  * Dump the EEPROM to console.
  */
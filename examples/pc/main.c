@@ -58,6 +58,9 @@ This module contains the main entry point.
 #include "temperature_sim.h"
 #include "vscphelperlib.h"
 #include "lamp_sim.h"
+#include "replay.h"
+#include "node_trace.h"
+#include "vscp_portable.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -74,7 +77,10 @@ This module contains the main entry point.
 #define MAIN_COPYRIGHT          "(c) 2014 - 2019 Andreas Merkle"
 
 /** Persistent memory filename */
-#define MAIN_EEPROM_FILENAME    "eeprom.asc"
+#define MAIN_EEPROM_FILENAME    "eeprom.bin"
+
+/** Legacy ASCII EEPROM file name, which is imported once */
+#define MAIN_EEPROM_LEGACY_FILENAME "eeprom.asc"
 
 /** Default log level */
 #define MAIN_LOG_LEVEL_DEFAULT  (LOG_LEVEL_FATAL)
@@ -110,6 +116,11 @@ typedef struct
     char const *        daemonUser;                 /**< User name for daemon ip access */
     char const *        daemonPassword;             /**< Password for daemon ip access */
     char const *        nodeGuid;                   /**< Node GUID */
+    char const *        traceFile;                  /**< Trace file, which records the node activity */
+    char const *        replayFile;                 /**< Capture file, which shall be replayed */
+    char const *        replaySeqFile;              /**< Sequence file, which records the replay sequence */
+    char const *        dmCompileFile;              /**< Compiled decision matrix file, which shall be created */
+    uint32_t            replaySpeed;                /**< Replay speed factor */
     BOOL                disableHeartbeat;           /**< Disable node heartbeat */
     BOOL                disableTemperature;         /**< Disable temperature simulation */
     BOOL                verbose;                    /**< Verbose information */
@@ -129,6 +140,7 @@ static void main_dumpEEPROM(void);
 static void main_loop(main_CmdLineArgs *main_cmdLineArgs);
 static CMDLINEPARSER_RET main_clpUnknown(void* const userData, char const * const arg, char const * const par);
 static CMDLINEPARSER_RET main_clpLevel(void* const userData, char const * const arg, char const * const par);
+static CMDLINEPARSER_RET main_clpSpeed(void* const userData, char const * const arg, char const * const par);
 
 /*******************************************************************************
     LOCAL VARIABLES
@@ -142,6 +154,11 @@ static main_CmdLineArgs         main_cmdLineArgs    =
     NULL,                           /* Daemon user name */
     NULL,                           /* Daemon password */
     NULL,                           /* Node GUID */
+    NULL,                           /* Trace file */
+    NULL,                           /* Replay file */
+    NULL,                           /* Replay sequence file */
+    NULL,                           /* Compiled decision matrix file */
+    REPLAY_SPEED_REAL,              /* Replay speed factor */
     FALSE,                          /* Disable node heartbeat */
     FALSE,                          /* Disable temperature simuluation */
     FALSE,                          /* Verbose output */
@@ -159,10 +176,16 @@ static const cmdLineParser_Arg  main_clpConfig[]    =
     /* Possible command line arguments */
     { "-a <ip-address>",            &main_cmdLineArgs.daemonAddr,       NULL,                                   NULL,               NULL,               "IP address of VSCP daemon"                         },
     { "-dheart",                    NULL,                               &main_cmdLineArgs.disableHeartbeat,     NULL,               NULL,               "Disable node heartbeat"                            },
+    { "-dmc <file name>",           &main_cmdLineArgs.dmCompileFile,    NULL,                                   NULL,               NULL,               "Compile the decision matrix xml files and quit"    },
     { "-dtemp",                     NULL,                               &main_cmdLineArgs.disableTemperature,   NULL,               NULL,               "Disable node temperature simulation"               },
     { "-g <guid>",                  &main_cmdLineArgs.nodeGuid,         NULL,                                   NULL,               NULL,               "Node GUID,\ne.g. 00:00:00:00:00:00:00:00:00:00:00:00:00:00:00:01"      },
     { "-h --help",                  NULL,                               &main_cmdLineArgs.showHelp,             NULL,               NULL,               "Show help"                                         },
+    { "-trace <file name>",         &main_cmdLineArgs.traceFile,        NULL,                                   NULL,               NULL,               "Record the node activity to a binary trace file"   },
     { "-v",                         NULL,                               &main_cmdLineArgs.verbose,              NULL,               NULL,               "Increase verbose level"                            },
+    { NULL,                         NULL,                               NULL,                                   NULL,               NULL,               "Options only for replay (no daemon connection):"   },
+    { "-replay <file name>",        &main_cmdLineArgs.replayFile,       NULL,                                   NULL,               NULL,               "Replay the events of a capture file"               },
+    { "-replayseq <file name>",     &main_cmdLineArgs.replaySeqFile,    NULL,                                   NULL,               NULL,               "Write the replay sequence to a text file"          },
+    { "-speed <factor>",            NULL,                               NULL,                                   main_clpSpeed,      &main_cmdLineArgs,  "1: Real-time (default)\nN: N-times faster\n0: As fast as possible"  },
     { NULL,                         NULL,                               NULL,                                   NULL,               NULL,               "Options only for daemon connection:"               },
     { "-l <level>",                 NULL,                               NULL,                                   main_clpLevel,      &main_cmdLineArgs,  "1: Support L1 events\n12: Support L1 and L1 over L2 events (default)"  },
     { "-p <password>",              &main_cmdLineArgs.daemonPassword,   NULL,                                   NULL,               NULL,               "Password for VSCP daemon access"                   },
@@ -263,6 +286,19 @@ int main(int argc, char* argv[])
         printf("Options:\n");
         cmdLineParser_show(main_clpConfig, MAIN_ARRAY_NUM(main_clpConfig));
     }
+    /* Shall the decision matrix be compiled? */
+    else if (NULL != main_cmdLineArgs.dmCompileFile)
+    {
+        if (FALSE == vscp_portable_compileDM(main_cmdLineArgs.dmCompileFile))
+        {
+            printf("Couldn't compile the decision matrix to %s.\n", main_cmdLineArgs.dmCompileFile);
+            abort = TRUE;
+        }
+        else
+        {
+            printf("Decision matrix compiled to %s.\n", main_cmdLineArgs.dmCompileFile);
+        }
+    }
     /* Abort because of a invalid program argument or continue? */
     else
     {
@@ -273,10 +309,17 @@ int main(int argc, char* argv[])
         }
 
         /* Load EEPROM layout */
-        eeprom_load(MAIN_EEPROM_FILENAME);
+        eeprom_load(MAIN_EEPROM_FILENAME, MAIN_EEPROM_LEGACY_FILENAME);
         
+        /* The replay uses the simulated receive path, which is not available with a daemon connection. */
+        if ((NULL != main_cmdLineArgs.replayFile) &&
+            (NULL != main_cmdLineArgs.daemonAddr))
+        {
+            printf("A replay is not possible with a daemon connection.\n");
+            abort = TRUE;
+        }
         /* Initialize VSCP framework */
-        if (VSCP_CORE_RET_OK != vscp_core_init())
+        else if (VSCP_CORE_RET_OK != vscp_core_init())
         {
             abort = TRUE;
         }
@@ -291,7 +334,7 @@ int main(int argc, char* argv[])
             {
                 VSCP_TP_ADAPTER_RET ret = VSCP_TP_ADAPTER_RET_OK;
 
-                log_printf("Connecting ...\n");
+                printf("Connecting ...\n");
 
                 ret = vscp_tp_adapter_connect(  main_cmdLineArgs.daemonAddr,
                                                 main_cmdLineArgs.daemonUser,
@@ -304,22 +347,22 @@ int main(int argc, char* argv[])
 
                     if (VSCP_TP_ADAPTER_RET_INVALID_USER == ret)
                     {
-                        log_printf("Invalid user.\n");
+                        printf("Invalid user.\n");
                     }
                     else if (VSCP_TP_ADAPTER_RET_INVALID_PASSWORD == ret)
                     {
-                        log_printf("Invalid password.\n");
+                        printf("Invalid password.\n");
                     }
                     else if (VSCP_TP_ADAPTER_RET_TIMEOUT == ret)
                     {
-                        log_printf("Connection timeout.\n");
+                        printf("Connection timeout.\n");
                     }
 
                     abort = TRUE;
                 }
                 else
                 {
-                    log_printf("Connection successful.\n");
+                    printf("Connection successful.\n");
                 }
             }
         }
@@ -335,7 +378,7 @@ int main(int argc, char* argv[])
                 /* Convert node GUID from string */
                 if (VSCP_ERROR_SUCCESS != vscphlp_getGuidFromStringToArray(nodeGuid, main_cmdLineArgs.nodeGuid))
                 {
-                    log_printf("Invalid node GUID.\n");
+                    printf("Invalid node GUID.\n");
                 }
                 else
                 {
@@ -343,6 +386,9 @@ int main(int argc, char* argv[])
                     {
                         vscp_ps_writeGUID(MAIN_ARRAY_NUM(nodeGuid) - index - 1, nodeGuid[index]);
                     }
+
+                    /* The who is there response contains the GUID. */
+                    vscp_core_invalidateWhoIsThere();
                 }
             }
         
@@ -352,11 +398,25 @@ int main(int argc, char* argv[])
                 vscp_core_enableHeartbeat(FALSE);
             }
 
+            /* Shall the node activity be traced? */
+            if ((NULL != main_cmdLineArgs.traceFile) &&
+                (NODE_TRACE_RET_OK != node_trace_start(main_cmdLineArgs.traceFile)))
+            {
+                printf("Couldn't create trace file %s.\n", main_cmdLineArgs.traceFile);
+                abort = TRUE;
+            }
             /* Start the whole VSCP framework */
-            if (VSCP_THREAD_RET_OK != vscp_thread_start())
+            else if (VSCP_THREAD_RET_OK != vscp_thread_start())
             {
                 abort = TRUE;
             }
+            /* Shall a capture file be replayed? */
+            else if ((NULL != main_cmdLineArgs.replayFile) &&
+                     (REPLAY_RET_OK != replay_start(main_cmdLineArgs.replayFile, main_cmdLineArgs.replaySpeed, main_cmdLineArgs.replaySeqFile)))
+            {
+                printf("Couldn't replay %s.\n", main_cmdLineArgs.replayFile);
+                abort = TRUE;
+            }
             /* Shall the temperature simulation be started? */
             else if (FALSE == main_cmdLineArgs.disableTemperature)
             {
@@ -376,12 +436,18 @@ int main(int argc, char* argv[])
 
         printf("Please wait ...\n");
 
+        /* Stop replay */
+        replay_stop();
+
         /* Stop temperature simulation */
         temperature_sim_stop();
 
         /* Stop the whole VSCP framework */
         vscp_thread_stop();
 
+        /* Stop the node trace */
+        node_trace_stop();
+
         /* Shall a connection to a VSCP daemon be disconnected? */
         if (NULL != main_cmdLineArgs.daemonAddr)
         {
@@ -420,6 +486,12 @@ static MAIN_RET main_init(void)
     /* Initialize platform specific functions */
     platform_init();
 
+    /* Initialize logging, which writes from now on asynchronous. The user
+     * messages in main() are written with printf() directly, otherwise they
+     * could appear out of order.
+     */
+    log_init();
+
     /* Initialize EEPROM simulation */
     eeprom_init(VSCP_PS_ADDR_NEXT);
 
@@ -429,6 +501,12 @@ static MAIN_RET main_init(void)
     /* Initialize temperature simulation */
     temperature_sim_init();
 
+    /* Initialize replay */
+    replay_init();
+
+    /* Initialize node trace */
+    node_trace_init();
+
     return status;
 }
 
@@ -437,9 +515,12 @@ static MAIN_RET main_init(void)
  */
 static void main_deInit(void)
 {
-    eeprom_save(MAIN_EEPROM_FILENAME);
+    /* Write all EEPROM changes to the file */
     eeprom_deInit();
 
+    /* Write all pending log messages */
+    log_deInit();
+
     platform_deInit();
     
     return;
@@ -457,6 +538,7 @@ static void main_showKeyTable(void)
     printf("i       Start node segment initialization\n");
     printf("l       Show the state of all lamps\n");
     printf("q       Quit program\n");
+    printf("r       Show replay report\n");
     printf("1-5     Send info button event\n");
 
     return;
@@ -844,6 +926,12 @@ static void main_loop(main_CmdLineArgs *main_cmdLineArgs)
                 printf("Quit.\n");
                 vscp_thread_unlock();
             }
+            /* Show replay report */
+            else if (('r' == keyValue) &&
+                     (NULL != main_cmdLineArgs->replayFile))
+            {
+                replay_showReport();
+            }
             /* Send a button message to the VSCP thread */
             else if (('1' <= keyValue) && ('5' >= keyValue))
             {
@@ -864,14 +952,29 @@ static void main_loop(main_CmdLineArgs *main_cmdLineArgs)
                 rxMsg.data[6]   = 0;
 
                 vscp_thread_lock();
-                vscp_tp_adapter_simulateReceivedMessage(&rxMsg);
+                if (FALSE == vscp_tp_adapter_simulateReceivedMessage(&rxMsg))
+                {
+                    printf("Receive queue full, button event dropped.\n");
+                }
                 vscp_thread_unlock();
             }
 
             platform_echoOff();
         }
+        /* Replay finished? */
+        else if ((NULL != main_cmdLineArgs->replayFile) &&
+                 (TRUE == replay_isFinished()))
+        {
+            replay_showReport();
+            keyValue = 'q';
+        }
         else
         {
+            /* Write the EEPROM changes to the file from time to time. */
+            vscp_thread_lock();
+            eeprom_process();
+            vscp_thread_unlock();
+
             /* Give other programs a chance. */
             platform_delay(10);
         }
@@ -942,3 +1045,43 @@ static CMDLINEPARSER_RET main_clpLevel(void* const userData, char const * const
 
     return ret;
 }
+
+/**
+ * This function is called by the command line parser for the replay speed.
+ *
+ * @param[in]   userData    User data
+ * @param[in]   arg         Argument name
+ * @param[in]   par         Array of parameter
+ *
+ * @return Status
+ */
+static CMDLINEPARSER_RET main_clpSpeed(void* const userData, char const * const arg, char const * const par)
+{
+    CMDLINEPARSER_RET       ret         = CMDLINEPARSER_RET_OK;
+    main_CmdLineArgs* const cmdLineArgs = (main_CmdLineArgs* const)userData;
+    int                     value       = 0;
+
+    if ((NULL == userData) ||
+        (NULL == arg) ||
+        (NULL == par))
+    {
+        ret = CMDLINEPARSER_RET_ERROR;
+    }
+    else
+    {
+        value = atoi(par);
+
+        if ((0 > value) ||
+            ((0 == value) && ('0' != par[0])))
+        {
+            printf("Invalid replay speed %s\n", par);
+            ret = CMDLINEPARSER_RET_ERROR;
+        }
+        else
+        {
+            cmdLineArgs->replaySpeed = (uint32_t)value;
+        }
+    }
+
+    return ret;
+}
@@ -0,0 +1,228 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2019, Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  Node trace
+@file   node_trace.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see node_trace.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "node_trace.h"
+#include <string.h>
+#include "trace.h"
+#include "vscp_core.h"
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+static void node_trace_prepare(trace_Record * const record, TRACE_KIND kind, vscp_Message const * const msg);
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/** Trace file writer */
+static trace_Writer node_trace_writer;
+
+/** Is the trace started? */
+static BOOL         node_trace_isStarted    = FALSE;
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function intializes the module.
+ */
+extern void node_trace_init(void)
+{
+    memset(&node_trace_writer, 0, sizeof(node_trace_writer));
+    node_trace_isStarted = FALSE;
+
+    return;
+}
+
+/**
+ * This function starts the trace. An already existing trace file will be
+ * overwritten.
+ *
+ * @param[in]   fileName    Name of the trace file
+ *
+ * @return Status
+ */
+extern NODE_TRACE_RET node_trace_start(char const * const fileName)
+{
+    NODE_TRACE_RET  status  = NODE_TRACE_RET_OK;
+
+    if (FALSE == node_trace_isStarted)
+    {
+        if (TRACE_RET_OK != trace_openWriter(&node_trace_writer, fileName, TRACE_RECORD_NUM_DEFAULT))
+        {
+            status = NODE_TRACE_RET_ERROR;
+        }
+        else
+        {
+            node_trace_isStarted = TRUE;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * This function stops the trace and closes the trace file.
+ */
+extern void node_trace_stop(void)
+{
+    if (TRUE == node_trace_isStarted)
+    {
+        (void)trace_closeWriter(&node_trace_writer);
+        node_trace_isStarted = FALSE;
+    }
+
+    return;
+}
+
+/**
+ * This function traces a received or transmitted message.
+ *
+ * @param[in]   msg         VSCP message
+ * @param[in]   isReceived  Is message received or transmitted?
+ */
+extern void node_trace_message(vscp_Message const * const msg, BOOL isReceived)
+{
+    trace_Record    record;
+
+    if ((TRUE == node_trace_isStarted) &&
+        (NULL != msg))
+    {
+        node_trace_prepare(&record, (TRUE == isReceived) ? TRACE_KIND_RX : TRACE_KIND_TX, msg);
+
+        (void)trace_write(&node_trace_writer, &record);
+    }
+
+    return;
+}
+
+/**
+ * This function traces a executed action.
+ *
+ * @param[in]   action  Action id
+ * @param[in]   par     Action parameter
+ * @param[in]   msg     Received VSCP message which triggered the action
+ */
+extern void node_trace_action(uint8_t action, uint8_t par, vscp_RxMessage const * const msg)
+{
+    trace_Record    record;
+
+    if ((TRUE == node_trace_isStarted) &&
+        (NULL != msg))
+    {
+        node_trace_prepare(&record, TRACE_KIND_ACTION, msg);
+
+        record.action       = action;
+        record.actionPar    = par;
+
+        (void)trace_write(&node_trace_writer, &record);
+    }
+
+    return;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function prepares a trace record with the message and the node state.
+ *
+ * @param[out]  record  Trace record
+ * @param[in]   kind    Record kind
+ * @param[in]   msg     VSCP message
+ */
+static void node_trace_prepare(trace_Record * const record, TRACE_KIND kind, vscp_Message const * const msg)
+{
+    uint8_t dataNum = msg->dataNum;
+
+    if (TRACE_DATA_SIZE < dataNum)
+    {
+        dataNum = TRACE_DATA_SIZE;
+    }
+
+    memset(record, 0, sizeof(*record));
+
+    record->kind        = (uint8_t)kind;
+    record->nickname    = vscp_core_readNicknameId();
+    record->oAddr       = msg->oAddr;
+    record->vscpClass   = msg->vscpClass;
+    record->vscpType    = msg->vscpType;
+    record->priority    = (uint8_t)msg->priority;
+    record->dataNum     = msg->dataNum;
+    memcpy(record->data, msg->data, dataNum);
+
+    if (TRUE == vscp_core_isActive())
+    {
+        record->flags |= TRACE_FLAG_ACTIVE;
+    }
+
+    if (TRUE == msg->hardCoded)
+    {
+        record->flags |= TRACE_FLAG_HARD_CODED;
+    }
+
+    return;
+}
@@ -0,0 +1,146 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2019, Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  Node trace
+@file   node_trace.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module records what the node did to a binary trace file: every received
+and transmitted message and every executed action, together with the node
+nickname id and whether the node was active. In contrast to the verbose text
+output, a trace record costs only a memory copy, therefore the trace can be
+always enabled. Use the decoder (projects/pc/decoder) to show a trace file.
+
+The trace points are called in the VSCP framework thread. The trace shall be
+started before and stopped after the VSCP framework thread runs.
+
+*******************************************************************************/
+/** @defgroup node_trace Node trace
+ * Records the node activity to a binary trace file.
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __NODE_TRACE_H__
+#define __NODE_TRACE_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include "platform.h"
+#include "vscp_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/** This type defines the supported function return values. */
+typedef enum
+{
+    NODE_TRACE_RET_OK = 0,  /**< Successful */
+    NODE_TRACE_RET_ERROR    /**< Failed */
+
+} NODE_TRACE_RET;
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function intializes the module.
+ */
+extern void node_trace_init(void);
+
+/**
+ * This function starts the trace. An already existing trace file will be
+ * overwritten.
+ *
+ * @param[in]   fileName    Name of the trace file
+ *
+ * @return Status
+ */
+extern NODE_TRACE_RET node_trace_start(char const * const fileName);
+
+/**
+ * This function stops the trace and closes the trace file.
+ */
+extern void node_trace_stop(void);
+
+/**
+ * This function traces a received or transmitted message.
+ *
+ * @param[in]   msg         VSCP message
+ * @param[in]   isReceived  Is message received or transmitted?
+ */
+extern void node_trace_message(vscp_Message const * const msg, BOOL isReceived);
+
+/**
+ * This function traces a executed action.
+ *
+ * @param[in]   action  Action id
+ * @param[in]   par     Action parameter
+ * @param[in]   msg     Received VSCP message which triggered the action
+ */
+extern void node_trace_action(uint8_t action, uint8_t par, vscp_RxMessage const * const msg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __NODE_TRACE_H__ */
+
+/** @} */
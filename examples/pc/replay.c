@@ -0,0 +1,637 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2019, Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  Event replay
+@file   replay.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see replay.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "replay.h"
+#include <memory.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include "capture.h"
+#include "crc16ccitt.h"
+#include "log.h"
+#include "vscp_thread.h"
+#include "vscp_tp_adapter.h"
+#include "vscp_action.h"
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Max. wait time in ms, before the quit flag is checked again. */
+#define REPLAY_WAIT_TIME_MAX    (10u)
+
+/** Max. length of a sequence line, including the string termination. */
+#define REPLAY_SEQ_LINE_SIZE    (128u)
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/** This type contains the necessary thread data. */
+typedef struct
+{
+    pthread_t           id;             /**< Thread id */
+    int                 status;         /**< Thread creation status */
+    pthread_mutex_t*    mutex;          /**< Mutex to protect the thread data */
+    BOOL                quitFlag;       /**< Flag to signal the thread to quit */
+    BOOL                isFinished;     /**< Flag which signals that the replay is finished */
+    capture_Reader      reader;         /**< Capture file reader */
+    uint32_t            speed;          /**< Speed factor */
+    uint64_t            startTime;      /**< Monotonic time of the replay start in us */
+    uint64_t            endTime;        /**< Monotonic time of the replay end in us */
+    uint64_t            captureTime;    /**< Timestamp of the last replayed record in us */
+    uint32_t            readCnt;        /**< Number of read records */
+    uint32_t            injectedCnt;    /**< Number of injected events */
+    uint32_t            skippedCnt;     /**< Number of skipped events, which are not supported by the node */
+    uint32_t            actionCnt;      /**< Number of executed actions before the replay started */
+    uint32_t            txCnt;          /**< Number of sent messages before the replay started */
+
+} replay_Context;
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+static void* replay_thread(void* par);
+static BOOL replay_isQuitRequested(replay_Context * const threadData);
+static BOOL replay_wait(replay_Context * const threadData, uint64_t timestamp);
+static BOOL replay_inject(replay_Context * const threadData, vscp_RxMessage const * const msg);
+static void replay_convertRecord(vscpEventEx * const daemonEvent, capture_Record const * const record);
+static void replay_addSequence(char const * const line);
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/** Mutex used to protect the thread data against concurrent access. */
+static pthread_mutex_t  replay_mutex    = PTHREAD_MUTEX_INITIALIZER;
+
+/** Thread data */
+static replay_Context   replay_thrdData;
+
+/* The sequence variables are protected by the VSCP framework lock, because
+ * they are written in the context of the VSCP framework thread.
+ */
+
+/** Sequence file (optional) */
+static FILE*            replay_seqFile      = NULL;
+
+/** Is the sequence recorded? */
+static BOOL             replay_seqIsActive  = FALSE;
+
+/** Number of sequence entries */
+static uint32_t         replay_seqCnt       = 0;
+
+/** CRC over all sequence entries */
+static Crc16CCITT       replay_seqCrc       = 0;
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function intializes the module.
+ */
+extern void replay_init(void)
+{
+    /* Clear thread data */
+    memset(&replay_thrdData, 0, sizeof(replay_thrdData));
+
+    /* Set error value here, to be able to check if replay_start is called and
+     * the thread is already started.
+     */
+    replay_thrdData.status = 1;
+
+    /* Set mutex */
+    replay_thrdData.mutex = &replay_mutex;
+
+    return;
+}
+
+/**
+ * This function starts the replay of a capture file.
+ *
+ * @param[in]   fileName    Name of the capture file
+ * @param[in]   speed       Speed factor, 1 for real-time or REPLAY_SPEED_MAX for as fast as possible
+ * @param[in]   seqFileName Name of the sequence file, which will be overwritten (optional, may be NULL)
+ *
+ * @return Status
+ */
+extern REPLAY_RET replay_start(char const * const fileName, uint32_t speed, char const * const seqFileName)
+{
+    REPLAY_RET  status  = REPLAY_RET_OK;
+
+    if (NULL == fileName)
+    {
+        return REPLAY_RET_ERROR;
+    }
+
+    if (0 != replay_thrdData.status)
+    {
+        CAPTURE_RET ret = capture_openReader(&replay_thrdData.reader, fileName);
+
+        if (CAPTURE_RET_INVALID == ret)
+        {
+            printf("%s is not a valid capture file.\n", fileName);
+            status = REPLAY_RET_ERROR;
+        }
+        else if (CAPTURE_RET_OK != ret)
+        {
+            printf("Couldn't open %s.\n", fileName);
+            status = REPLAY_RET_ERROR;
+        }
+        else if ((NULL != seqFileName) &&
+                 (NULL == (replay_seqFile = fopen(seqFileName, "w"))))
+        {
+            printf("Couldn't create %s.\n", seqFileName);
+            capture_closeReader(&replay_thrdData.reader);
+            status = REPLAY_RET_ERROR;
+        }
+        else
+        {
+            /* Avoid that the thread stops immediately */
+            replay_thrdData.quitFlag    = FALSE;
+            replay_thrdData.isFinished  = FALSE;
+            replay_thrdData.speed       = speed;
+            replay_thrdData.captureTime = 0;
+            replay_thrdData.readCnt     = 0;
+            replay_thrdData.injectedCnt = 0;
+            replay_thrdData.skippedCnt  = 0;
+
+            /* Remember the counters, to report only the changes caused by the replay. */
+            vscp_thread_lock();
+            replay_thrdData.actionCnt   = vscp_action_getExecutedCnt();
+            replay_thrdData.txCnt       = vscp_tp_adapter_getTxCnt();
+            replay_seqCnt               = 0;
+            replay_seqCrc               = crc16ccitt_init();
+            replay_seqIsActive          = TRUE;
+            vscp_thread_unlock();
+
+            replay_thrdData.startTime   = platform_getMonotonicTime();
+            replay_thrdData.endTime     = replay_thrdData.startTime;
+
+            /* Create thread with default attributes */
+            replay_thrdData.status = pthread_create(&replay_thrdData.id, NULL, replay_thread, (void*)&replay_thrdData);
+
+            /* Failed to create the thread? */
+            if (0 != replay_thrdData.status)
+            {
+                capture_closeReader(&replay_thrdData.reader);
+                replay_stop();
+                status = REPLAY_RET_ERROR;
+            }
+        }
+    }
+
+    return status;
+}
+
+/**
+ * This function stops the replay.
+ */
+extern void replay_stop(void)
+{
+    /* Is thread running? */
+    if (0 == replay_thrdData.status)
+    {
+        (void)pthread_mutex_lock(&replay_mutex);
+        replay_thrdData.quitFlag = TRUE;
+        (void)pthread_mutex_unlock(&replay_mutex);
+
+        /* Wait for the replay thread until its finished. */
+        (void)pthread_join(replay_thrdData.id, NULL);
+
+        /* Set error value here, to be able to check if replay_start is called and
+         * the thread is already started.
+         */
+        replay_thrdData.status = 1;
+    }
+
+    vscp_thread_lock();
+    replay_seqIsActive = FALSE;
+
+    if (NULL != replay_seqFile)
+    {
+        fclose(replay_seqFile);
+        replay_seqFile = NULL;
+    }
+    vscp_thread_unlock();
+
+    return;
+}
+
+/**
+ * This function returns whether all events of the capture file are
+ * replayed and processed by the node.
+ *
+ * @return If finished, it will return TRUE otherwise FALSE.
+ */
+extern BOOL replay_isFinished(void)
+{
+    BOOL    isFinished  = FALSE;
+
+    (void)pthread_mutex_lock(&replay_mutex);
+    isFinished = replay_thrdData.isFinished;
+    (void)pthread_mutex_unlock(&replay_mutex);
+
+    return isFinished;
+}
+
+/**
+ * This function shows the replay report.
+ */
+extern void replay_showReport(void)
+{
+    replay_Context  data;
+    uint32_t        actionCnt   = 0;
+    uint32_t        txCnt       = 0;
+    uint64_t        duration    = 0;
+    uint32_t        seqCnt      = 0;
+    Crc16CCITT      seqCrc      = 0;
+
+    (void)pthread_mutex_lock(&replay_mutex);
+    data = replay_thrdData;
+    (void)pthread_mutex_unlock(&replay_mutex);
+
+    vscp_thread_lock();
+    actionCnt   = vscp_action_getExecutedCnt() - data.actionCnt;
+    txCnt       = vscp_tp_adapter_getTxCnt() - data.txCnt;
+    seqCnt      = replay_seqCnt;
+    seqCrc      = crc16ccitt_finalize(replay_seqCrc);
+    vscp_thread_unlock();
+
+    if (FALSE == data.isFinished)
+    {
+        duration = platform_getMonotonicTime() - data.startTime;
+    }
+    else
+    {
+        duration = data.endTime - data.startTime;
+    }
+
+    printf("Replay %s:\n", (FALSE == data.isFinished) ? "running" : "finished");
+    printf("Read records    : %u\n", data.readCnt);
+    printf("Injected events : %u\n", data.injectedCnt);
+    printf("Skipped events  : %u\n", data.skippedCnt);
+    printf("Executed actions: %u\n", actionCnt);
+    printf("Sent messages   : %u\n", txCnt);
+    printf("Capture time    : %llu ms\n", (unsigned long long)(data.captureTime / 1000u));
+    printf("Replay time     : %llu ms\n", (unsigned long long)(duration / 1000u));
+    printf("Sequence entries: %u\n", seqCnt);
+    printf("Sequence CRC    : 0x%04X\n", seqCrc);
+
+    return;
+}
+
+/**
+ * This function adds a received or transmitted message to the replay
+ * sequence. It shall be called in the context of the VSCP framework thread.
+ *
+ * @param[in]   msg         VSCP message
+ * @param[in]   isReceived  Is message received or transmitted?
+ */
+extern void replay_traceMessage(vscp_Message const * const msg, BOOL isReceived)
+{
+    char    line[REPLAY_SEQ_LINE_SIZE];
+    int     length  = 0;
+    uint8_t index   = 0;
+    uint8_t dataNum = 0;
+
+    if ((FALSE == replay_seqIsActive) ||
+        (NULL == msg))
+    {
+        return;
+    }
+
+    dataNum = msg->dataNum;
+
+    if (VSCP_L1_DATA_SIZE < dataNum)
+    {
+        dataNum = VSCP_L1_DATA_SIZE;
+    }
+
+    length = snprintf(line, sizeof(line), "%s class=0x%03X type=0x%02X oAddr=0x%02X prio=%u hardCoded=%u data=%u:",
+                        (TRUE == isReceived) ? "RX" : "TX",
+                        msg->vscpClass,
+                        msg->vscpType,
+                        msg->oAddr,
+                        (unsigned int)msg->priority,
+                        (TRUE == msg->hardCoded) ? 1u : 0u,
+                        msg->dataNum);
+
+    for(index = 0; index < dataNum; ++index)
+    {
+        length += snprintf(&line[length], sizeof(line) - length, " %02X", msg->data[index]);
+    }
+
+    replay_addSequence(line);
+
+    return;
+}
+
+/**
+ * This function adds a executed action to the replay sequence. It shall be
+ * called in the context of the VSCP framework thread.
+ *
+ * @param[in]   action  Action id
+ * @param[in]   par     Action parameter
+ */
+extern void replay_traceAction(uint8_t action, uint8_t par)
+{
+    char    line[REPLAY_SEQ_LINE_SIZE];
+
+    if (FALSE == replay_seqIsActive)
+    {
+        return;
+    }
+
+    snprintf(line, sizeof(line), "ACTION id=0x%02X par=0x%02X", action, par);
+
+    replay_addSequence(line);
+
+    return;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This thread reads the capture file and injects the events into the node.
+ *
+ * @param[in]   par Thread parameters
+ * @return Not used
+ */
+static void* replay_thread(void* par)
+{
+    replay_Context* threadData      = (replay_Context*)par;
+    BOOL            quitFlag        = FALSE;
+    BOOL            isFirst         = TRUE;
+    uint64_t        firstTimestamp  = 0;
+    capture_Record  record;
+    vscpEventEx     daemonEvent;
+    vscp_RxMessage  rxMsg;
+
+    while((FALSE == quitFlag) &&
+          (CAPTURE_RET_OK == capture_read(&threadData->reader, &record)))
+    {
+        if (TRUE == isFirst)
+        {
+            firstTimestamp  = record.timestamp;
+            isFirst         = FALSE;
+        }
+
+        /* Keep the time between the events, accelerated by the speed factor. */
+        quitFlag = replay_wait(threadData, record.timestamp - firstTimestamp);
+
+        if (FALSE == quitFlag)
+        {
+            replay_convertRecord(&daemonEvent, &record);
+
+            (void)pthread_mutex_lock(threadData->mutex);
+            ++threadData->readCnt;
+            threadData->captureTime = record.timestamp - firstTimestamp;
+            (void)pthread_mutex_unlock(threadData->mutex);
+
+            /* Level 2 events are not supported by the node. */
+            if (FALSE == vscp_tp_adapter_convertEvent(&rxMsg, &daemonEvent))
+            {
+                (void)pthread_mutex_lock(threadData->mutex);
+                ++threadData->skippedCnt;
+                (void)pthread_mutex_unlock(threadData->mutex);
+            }
+            else
+            {
+                quitFlag = replay_inject(threadData, &rxMsg);
+            }
+        }
+    }
+
+    capture_closeReader(&threadData->reader);
+
+    /* Wait until the node processed all injected events. */
+    while(FALSE == quitFlag)
+    {
+        uint8_t pendingNum  = 0;
+
+        vscp_thread_lock();
+        pendingNum = vscp_tp_adapter_getSimulatedRxNum();
+        vscp_thread_unlock();
+
+        if (0 == pendingNum)
+        {
+            break;
+        }
+
+        platform_delay(1);
+        quitFlag = replay_isQuitRequested(threadData);
+    }
+
+    /* Messages after the replay, e.g. sent by the node timers, are not part of the sequence. */
+    vscp_thread_lock();
+    replay_seqIsActive = FALSE;
+    vscp_thread_unlock();
+
+    (void)pthread_mutex_lock(threadData->mutex);
+    threadData->endTime     = platform_getMonotonicTime();
+    threadData->isFinished  = TRUE;
+    (void)pthread_mutex_unlock(threadData->mutex);
+
+    pthread_exit(NULL);
+
+    return NULL;
+}
+
+/**
+ * This function returns whether the thread shall quit.
+ *
+ * @param[in]   threadData  Thread data
+ * @return If quit is requested, it will return TRUE otherwise FALSE.
+ */
+static BOOL replay_isQuitRequested(replay_Context * const threadData)
+{
+    BOOL    quitFlag    = FALSE;
+
+    (void)pthread_mutex_lock(threadData->mutex);
+    quitFlag = threadData->quitFlag;
+    (void)pthread_mutex_unlock(threadData->mutex);
+
+    return quitFlag;
+}
+
+/**
+ * This function waits until the given time since replay start is reached.
+ * The time is divided by the speed factor. If the replay runs as fast as
+ * possible, it will return immediately.
+ *
+ * @param[in]   threadData  Thread data
+ * @param[in]   timestamp   Time since the first replayed event in us
+ * @return If quit is requested, it will return TRUE otherwise FALSE.
+ */
+static BOOL replay_wait(replay_Context * const threadData, uint64_t timestamp)
+{
+    BOOL        quitFlag    = replay_isQuitRequested(threadData);
+    uint64_t    dueTime     = 0;
+    uint64_t    elapsed     = 0;
+
+    if (REPLAY_SPEED_MAX == threadData->speed)
+    {
+        return quitFlag;
+    }
+
+    dueTime = timestamp / threadData->speed;
+    elapsed = platform_getMonotonicTime() - threadData->startTime;
+
+    while((FALSE == quitFlag) &&
+          ((dueTime / 1000u) > (elapsed / 1000u)))
+    {
+        uint64_t    waitTime    = (dueTime - elapsed) / 1000u;
+
+        if (REPLAY_WAIT_TIME_MAX < waitTime)
+        {
+            waitTime = REPLAY_WAIT_TIME_MAX;
+        }
+
+        platform_delay((uint32_t)waitTime);
+
+        quitFlag    = replay_isQuitRequested(threadData);
+        elapsed     = platform_getMonotonicTime() - threadData->startTime;
+    }
+
+    return quitFlag;
+}
+
+/**
+ * This function injects a message into the node. If the receive queue is
+ * full, it will wait until the node processed a message.
+ *
+ * @param[in]   threadData  Thread data
+ * @param[in]   msg         Message
+ * @return If quit is requested, it will return TRUE otherwise FALSE.
+ */
+static BOOL replay_inject(replay_Context * const threadData, vscp_RxMessage const * const msg)
+{
+    BOOL    quitFlag    = FALSE;
+    BOOL    isQueued    = FALSE;
+
+    while((FALSE == quitFlag) &&
+          (FALSE == isQueued))
+    {
+        vscp_thread_lock();
+        isQueued = vscp_tp_adapter_simulateReceivedMessage(msg);
+        vscp_thread_unlock();
+
+        if (FALSE == isQueued)
+        {
+            platform_delay(1);
+            quitFlag = replay_isQuitRequested(threadData);
+        }
+    }
+
+    if (TRUE == isQueued)
+    {
+        (void)pthread_mutex_lock(threadData->mutex);
+        ++threadData->injectedCnt;
+        (void)pthread_mutex_unlock(threadData->mutex);
+    }
+
+    return quitFlag;
+}
+
+/**
+ * This function converts a capture record to a daemon event.
+ *
+ * @param[out]  daemonEvent Daemon event
+ * @param[in]   record      Capture record
+ */
+static void replay_convertRecord(vscpEventEx * const daemonEvent, capture_Record const * const record)
+{
+    uint16_t    dataNum = record->dataSize;
+
+    if (CAPTURE_DATA_SIZE < dataNum)
+    {
+        dataNum = CAPTURE_DATA_SIZE;
+    }
+
+    memset(daemonEvent, 0, sizeof(vscpEventEx));
+    daemonEvent->obid       = record->obid;
+    daemonEvent->timestamp  = record->eventTimestamp;
+    daemonEvent->head       = record->head;
+    daemonEvent->vscp_class = record->vscpClass;
+    daemonEvent->vscp_type  = record->vscpType;
+    daemonEvent->sizeData   = dataNum;
+    memcpy(daemonEvent->GUID, record->guid, CAPTURE_GUID_SIZE);
+    memcpy(daemonEvent->data, record->data, dataNum);
+
+    return;
+}
+
+/**
+ * This function adds a line to the replay sequence. The line is written to
+ * the sequence file and considered in the sequence CRC.
+ *
+ * @param[in]   line    Sequence line, without line feed
+ */
+static void replay_addSequence(char const * const line)
+{
+    ++replay_seqCnt;
+    replay_seqCrc = crc16ccitt_update(replay_seqCrc, (uint8_t const *)line, strlen(line));
+
+    if (NULL != replay_seqFile)
+    {
+        fprintf(replay_seqFile, "%u %s\n", replay_seqCnt, line);
+    }
+
+    return;
+}
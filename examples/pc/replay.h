@@ -0,0 +1,174 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2019, Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  Event replay
+@file   replay.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module replays the events of a capture file, recorded by the VSCP logger,
+into the node. The events are injected via the simulated receive path of the
+transport adapter, therefore no daemon connection is allowed during a replay.
+
+The replay runs in real-time, N-times faster or as fast as the node can
+process the events. After the replay, a report with the number of injected
+events, executed actions and sent messages is shown.
+
+The sequence of replayed events, sent messages and executed actions can be
+written to a text file. It contains no timestamps, therefore the sequence
+files of two runs (e.g. before and after a decision matrix change) can be
+compared with diff. The report contains a CRC of the sequence too, for a
+quick comparison without file.
+
+Note, the node timers (e.g. heartbeat) run always in real-time.
+
+*******************************************************************************/
+/** @defgroup replay Event replay
+ * Replays captured events into the node.
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __REPLAY_H__
+#define __REPLAY_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include "platform.h"
+#include "vscp_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Speed factor for a replay as fast as possible */
+#define REPLAY_SPEED_MAX    (0u)
+
+/** Speed factor for a replay in real-time */
+#define REPLAY_SPEED_REAL   (1u)
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/** This type defines the supported function return values. */
+typedef enum
+{
+    REPLAY_RET_OK = 0,  /**< Successful */
+    REPLAY_RET_ERROR    /**< Failed */
+
+} REPLAY_RET;
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function intializes the module.
+ */
+extern void replay_init(void);
+
+/**
+ * This function starts the replay of a capture file.
+ *
+ * @param[in]   fileName    Name of the capture file
+ * @param[in]   speed       Speed factor, 1 for real-time or REPLAY_SPEED_MAX for as fast as possible
+ * @param[in]   seqFileName Name of the sequence file, which will be overwritten (optional, may be NULL)
+ *
+ * @return Status
+ */
+extern REPLAY_RET replay_start(char const * const fileName, uint32_t speed, char const * const seqFileName);
+
+/**
+ * This function stops the replay.
+ */
+extern void replay_stop(void);
+
+/**
+ * This function returns whether all events of the capture file are
+ * replayed and processed by the node.
+ *
+ * @return If finished, it will return TRUE otherwise FALSE.
+ */
+extern BOOL replay_isFinished(void);
+
+/**
+ * This function shows the replay report.
+ */
+extern void replay_showReport(void);
+
+/**
+ * This function adds a received or transmitted message to the replay
+ * sequence. It shall be called in the context of the VSCP framework thread.
+ *
+ * @param[in]   msg         VSCP message
+ * @param[in]   isReceived  Is message received or transmitted?
+ */
+extern void replay_traceMessage(vscp_Message const * const msg, BOOL isReceived);
+
+/**
+ * This function adds a executed action to the replay sequence. It shall be
+ * called in the context of the VSCP framework thread.
+ *
+ * @param[in]   action  Action id
+ * @param[in]   par     Action parameter
+ */
+extern void replay_traceAction(uint8_t action, uint8_t par);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __REPLAY_H__ */
+
+/** @} */
@@ -48,6 +48,7 @@
 #include "vscp_timer.h"
 #include "vscp_portable.h"
 #include "vscp_bootloader.h"
+#include "vscp_tp_adapter.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -253,6 +254,7 @@ static void* vscp_thread_frameworkThread(void* par)
     BOOL                    quitFlag        = FALSE;
     vscp_thread_Context*    threadData      = (vscp_thread_Context*)par;
     BOOL                    bootloaderMode  = FALSE;
+    uint8_t                 rxPendingNum    = 0;
 
     (void)pthread_mutex_lock(threadData->mutex);
     quitFlag = threadData->quitFlag;
@@ -281,12 +283,18 @@ static void* vscp_thread_frameworkThread(void* par)
             vscp_core_init();
         }
 
-        quitFlag = threadData->quitFlag;
+        quitFlag        = threadData->quitFlag;
+        rxPendingNum    = vscp_tp_adapter_getSimulatedRxNum();
 
         (void)pthread_mutex_unlock(threadData->mutex);
 
-        /* Give a other threads a minimal chance. */
-        platform_delay(1);
+        /* Give a other threads a minimal chance, but process simulated
+         * received messages without delay, e.g. during a fast replay.
+         */
+        if (0 == rxPendingNum)
+        {
+            platform_delay(1);
+        }
     }
 
     pthread_exit(NULL);
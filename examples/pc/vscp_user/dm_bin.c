@@ -0,0 +1,393 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2019, Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  Compiled decision matrix
+@file   dm_bin.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see dm_bin.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "dm_bin.h"
+#include "crc16ccitt.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Magic at the begin of every compiled decision matrix file */
+#define DM_BIN_MAGIC                "VSCPDMB"
+
+/** Size of the magic in bytes, incl. string termination */
+#define DM_BIN_MAGIC_SIZE           (8u)
+
+/** File header size in bytes */
+#define DM_BIN_HEADER_SIZE          (16u)
+
+/** Offset of the format version in the file header */
+#define DM_BIN_HEADER_VERSION       (8u)
+
+/** Offset of the number of sections in the file header */
+#define DM_BIN_HEADER_SECTION_NUM   (9u)
+
+/** Offset of the CRC in the file header */
+#define DM_BIN_HEADER_CRC           (10u)
+
+/** Section header size in bytes */
+#define DM_BIN_SECTION_HEADER_SIZE  (4u)
+
+/** Offset of the data size in the section header */
+#define DM_BIN_SECTION_HEADER_SIZE_OFFSET   (2u)
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+static void dm_bin_putUInt16(uint8_t * const buffer, uint16_t value);
+static uint16_t dm_bin_getUInt16(uint8_t const * const buffer);
+static uint8_t* dm_bin_loadFileToMem(char const * const fileName, uint32_t * const size);
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function initializes this module.
+ */
+extern void dm_bin_init(void)
+{
+    /* Nothing to do */
+
+    return;
+}
+
+/**
+ * This function writes all available regions to a compiled decision matrix file.
+ * The region index is the section id.
+ *
+ * @param[in]   fileName    Compiled decision matrix file name
+ * @param[in]   regions     Regions
+ * @param[in]   num         Number of regions
+ * @return Status
+ */
+extern DM_BIN_RET dm_bin_save(char const * const fileName, dm_bin_Region const * const regions, uint8_t num)
+{
+    DM_BIN_RET  ret         = DM_BIN_RET_OK;
+    uint8_t     header[DM_BIN_HEADER_SIZE];
+    uint8_t     sectionHeader[DM_BIN_SECTION_HEADER_SIZE];
+    uint8_t     index       = 0;
+    uint8_t     sectionNum  = 0;
+    Crc16CCITT  crc         = crc16ccitt_init();
+    FILE*       fd          = NULL;
+
+    if ((NULL == fileName) ||
+        (NULL == regions))
+    {
+        return DM_BIN_RET_ENULL;
+    }
+
+    /* The CRC covers all sections, therefore it is calculated before writing. */
+    memset(sectionHeader, 0, sizeof(sectionHeader));
+
+    for(index = 0; index < num; ++index)
+    {
+        if (NULL != regions[index].data)
+        {
+            sectionHeader[0] = index;
+            dm_bin_putUInt16(&sectionHeader[DM_BIN_SECTION_HEADER_SIZE_OFFSET], regions[index].size);
+
+            crc = crc16ccitt_update(crc, sectionHeader, sizeof(sectionHeader));
+            crc = crc16ccitt_update(crc, regions[index].data, regions[index].size);
+
+            ++sectionNum;
+        }
+    }
+
+    memset(header, 0, sizeof(header));
+    memcpy(header, DM_BIN_MAGIC, DM_BIN_MAGIC_SIZE);
+    header[DM_BIN_HEADER_VERSION]       = DM_BIN_VERSION;
+    header[DM_BIN_HEADER_SECTION_NUM]   = sectionNum;
+    dm_bin_putUInt16(&header[DM_BIN_HEADER_CRC], crc16ccitt_finalize(crc));
+
+    fd = fopen(fileName, "wb");
+
+    if (NULL == fd)
+    {
+        return DM_BIN_RET_EFILE;
+    }
+
+    if (sizeof(header) != fwrite(header, 1, sizeof(header), fd))
+    {
+        ret = DM_BIN_RET_ERROR;
+    }
+
+    for(index = 0; (index < num) && (DM_BIN_RET_OK == ret); ++index)
+    {
+        if (NULL != regions[index].data)
+        {
+            sectionHeader[0] = index;
+            dm_bin_putUInt16(&sectionHeader[DM_BIN_SECTION_HEADER_SIZE_OFFSET], regions[index].size);
+
+            if ((sizeof(sectionHeader) != fwrite(sectionHeader, 1, sizeof(sectionHeader), fd)) ||
+                (regions[index].size != fwrite(regions[index].data, 1, regions[index].size, fd)))
+            {
+                ret = DM_BIN_RET_ERROR;
+            }
+        }
+    }
+
+    if (0 != fclose(fd))
+    {
+        ret = DM_BIN_RET_ERROR;
+    }
+    fd = NULL;
+
+    return ret;
+}
+
+/**
+ * This function loads a compiled decision matrix file to the regions. The region
+ * index is the section id. The file is completely verified, before any region
+ * is written. Available regions without section in the file are cleared.
+ *
+ * @param[in]   fileName    Compiled decision matrix file name
+ * @param[in]   regions     Regions
+ * @param[in]   num         Number of regions
+ * @return Status
+ */
+extern DM_BIN_RET dm_bin_load(char const * const fileName, dm_bin_Region const * const regions, uint8_t num)
+{
+    DM_BIN_RET  ret         = DM_BIN_RET_OK;
+    uint8_t*    buffer      = NULL;
+    uint32_t    size        = 0;
+    uint32_t    pos         = 0;
+    uint8_t     index       = 0;
+    uint8_t     sectionNum  = 0;
+    uint8_t     id          = 0;
+    uint16_t    sectionSize = 0;
+
+    if ((NULL == fileName) ||
+        (NULL == regions))
+    {
+        return DM_BIN_RET_ENULL;
+    }
+
+    buffer = dm_bin_loadFileToMem(fileName, &size);
+
+    if (NULL == buffer)
+    {
+        return DM_BIN_RET_EFILE;
+    }
+
+    /* Verify header and checksum */
+    if ((DM_BIN_HEADER_SIZE > size) ||
+        (0 != memcmp(buffer, DM_BIN_MAGIC, DM_BIN_MAGIC_SIZE)) ||
+        (DM_BIN_VERSION != buffer[DM_BIN_HEADER_VERSION]) ||
+        (dm_bin_getUInt16(&buffer[DM_BIN_HEADER_CRC]) != crc16ccitt_calculate(&buffer[DM_BIN_HEADER_SIZE], size - DM_BIN_HEADER_SIZE)))
+    {
+        ret = DM_BIN_RET_EFORMAT;
+    }
+    else
+    {
+        sectionNum = buffer[DM_BIN_HEADER_SECTION_NUM];
+    }
+
+    /* Verify sections against the regions */
+    pos = DM_BIN_HEADER_SIZE;
+    for(index = 0; (index < sectionNum) && (DM_BIN_RET_OK == ret); ++index)
+    {
+        if ((DM_BIN_SECTION_HEADER_SIZE > (size - pos)) ||
+            ((DM_BIN_SECTION_HEADER_SIZE + dm_bin_getUInt16(&buffer[pos + DM_BIN_SECTION_HEADER_SIZE_OFFSET])) > (size - pos)))
+        {
+            ret = DM_BIN_RET_EFORMAT;
+        }
+        else
+        {
+            id          = buffer[pos];
+            sectionSize = dm_bin_getUInt16(&buffer[pos + DM_BIN_SECTION_HEADER_SIZE_OFFSET]);
+
+            /* The node configuration differs from the one, the file was compiled with. */
+            if ((num <= id) ||
+                (NULL == regions[id].data) ||
+                (regions[id].size < sectionSize))
+            {
+                ret = DM_BIN_RET_ESIZE;
+            }
+
+            pos += DM_BIN_SECTION_HEADER_SIZE + sectionSize;
+        }
+    }
+
+    if ((DM_BIN_RET_OK == ret) &&
+        (pos != size))
+    {
+        ret = DM_BIN_RET_EFORMAT;
+    }
+
+    /* Copy the sections to its regions */
+    if (DM_BIN_RET_OK == ret)
+    {
+        for(index = 0; index < num; ++index)
+        {
+            if (NULL != regions[index].data)
+            {
+                memset(regions[index].data, 0, regions[index].size);
+            }
+        }
+
+        pos = DM_BIN_HEADER_SIZE;
+        for(index = 0; index < sectionNum; ++index)
+        {
+            id          = buffer[pos];
+            sectionSize = dm_bin_getUInt16(&buffer[pos + DM_BIN_SECTION_HEADER_SIZE_OFFSET]);
+
+            memcpy(regions[id].data, &buffer[pos + DM_BIN_SECTION_HEADER_SIZE], sectionSize);
+
+            pos += DM_BIN_SECTION_HEADER_SIZE + sectionSize;
+        }
+    }
+
+    /* Free allocated ressources */
+    free(buffer);
+    buffer = NULL;
+
+    return ret;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function writes a 16-bit value in little endian byte order to a buffer.
+ *
+ * @param[out]  buffer  Buffer
+ * @param[in]   value   Value
+ */
+static void dm_bin_putUInt16(uint8_t * const buffer, uint16_t value)
+{
+    buffer[0] = (uint8_t)(value >> 0);
+    buffer[1] = (uint8_t)(value >> 8);
+
+    return;
+}
+
+/**
+ * This function reads a 16-bit value in little endian byte order from a buffer.
+ *
+ * @param[in]   buffer  Buffer
+ * @return Value
+ */
+static uint16_t dm_bin_getUInt16(uint8_t const * const buffer)
+{
+    return (uint16_t)(((uint16_t)buffer[0]) << 0) |
+           (uint16_t)(((uint16_t)buffer[1]) << 8);
+}
+
+/**
+ * This function loads a file to memory.
+ * Don't forget to free the buffer later!
+ *
+ * @param[in]   fileName    Compiled decision matrix file name
+ * @param[out]  size        File size in bytes
+ * @return Pointer to buffer
+ */
+static uint8_t* dm_bin_loadFileToMem(char const * const fileName, uint32_t * const size)
+{
+    FILE*       fd          = NULL;
+    long        fileSize    = 0;
+    uint8_t*    buffer      = NULL;
+
+    fd = fopen(fileName, "rb");
+
+    if (NULL == fd)
+    {
+        return NULL;
+    }
+
+    /* Determine file size */
+    if (0 == fseek(fd, 0L, SEEK_END))
+    {
+        fileSize = ftell(fd);
+    }
+
+    if ((0 < fileSize) &&
+        (0 == fseek(fd, 0L, SEEK_SET)))
+    {
+        buffer = (uint8_t*)malloc(fileSize);
+    }
+
+    if (NULL != buffer)
+    {
+        /* Read whole file to memory */
+        if (fileSize != (long)fread(buffer, 1, fileSize, fd))
+        {
+            free(buffer);
+            buffer = NULL;
+        }
+        else
+        {
+            *size = (uint32_t)fileSize;
+        }
+    }
+
+    fclose(fd);
+    fd = NULL;
+
+    return buffer;
+}
@@ -0,0 +1,174 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2019, Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  Compiled decision matrix
+@file   dm_bin.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module reads and writes the compiled decision matrix file format.
+
+*******************************************************************************/
+/** @defgroup dm_bin Compiled decision matrix
+ * A compiled decision matrix file contains the persistent memory regions of the
+ * standard decision matrix, its extension and the decision matrix next generation
+ * rule set. Loading it needs no parsing, the regions are copied straight into
+ * the persistent memory.
+ *
+ * All values are stored in little endian byte order.
+ *
+ * File header (16 bytes):
+ * - Magic "VSCPDMB" incl. string termination (8 bytes)
+ * - Format version (1 byte)
+ * - Number of sections (1 byte)
+ * - CRC-16-CCITT over all sections (2 bytes)
+ * - Reserved (4 bytes)
+ *
+ * Every section starts with a header (4 bytes), followed by the region data:
+ * - Section id, see DM_BIN_SECTION (1 byte)
+ * - Reserved (1 byte)
+ * - Region data size in bytes (2 bytes)
+ *
+ * The XML files stay the source for authoring, the compiled file is derived from
+ * them.
+ *
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __DM_BIN_H__
+#define __DM_BIN_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <inttypes.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Current compiled decision matrix file format version */
+#define DM_BIN_VERSION  (1u)
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/** This type defines the supported function return values. */
+typedef enum
+{
+    DM_BIN_RET_OK = 0,  /**< Successful */
+    DM_BIN_RET_ERROR,   /**< Failed */
+    DM_BIN_RET_ENULL,   /**< Unexpected NULL pointer */
+    DM_BIN_RET_EFILE,   /**< File not found */
+    DM_BIN_RET_EFORMAT, /**< Invalid file format, version or checksum */
+    DM_BIN_RET_ESIZE    /**< Section doesn't fit into its region */
+
+} DM_BIN_RET;
+
+/** This type defines the section ids. */
+typedef enum
+{
+    DM_BIN_SECTION_DM = 0,  /**< Standard decision matrix */
+    DM_BIN_SECTION_DM_EXT,  /**< Decision matrix extension */
+    DM_BIN_SECTION_DM_NG,   /**< Decision matrix next generation rule set */
+    DM_BIN_SECTION_NUM      /**< Number of sections */
+
+} DM_BIN_SECTION;
+
+/** This type defines a persistent memory region, which belongs to a section. */
+typedef struct
+{
+    uint8_t*    data;   /**< Region data, NULL if not available */
+    uint16_t    size;   /**< Region size in bytes */
+
+} dm_bin_Region;
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function initializes this module.
+ */
+extern void dm_bin_init(void);
+
+/**
+ * This function writes all available regions to a compiled decision matrix file.
+ * The region index is the section id.
+ *
+ * @param[in]   fileName    Compiled decision matrix file name
+ * @param[in]   regions     Regions
+ * @param[in]   num         Number of regions
+ * @return Status
+ */
+extern DM_BIN_RET dm_bin_save(char const * const fileName, dm_bin_Region const * const regions, uint8_t num);
+
+/**
+ * This function loads a compiled decision matrix file to the regions. The region
+ * index is the section id. The file is completely verified, before any region
+ * is written. Available regions without section in the file are cleared.
+ *
+ * @param[in]   fileName    Compiled decision matrix file name
+ * @param[in]   regions     Regions
+ * @param[in]   num         Number of regions
+ * @return Status
+ */
+extern DM_BIN_RET dm_bin_load(char const * const fileName, dm_bin_Region const * const regions, uint8_t num);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __DM_BIN_H__ */
+
+/** @} */
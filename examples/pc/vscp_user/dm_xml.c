@@ -0,0 +1,1957 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2019, Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  Decision matrix XML parser engine
+@file   dm_xml.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see dm_xml.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "dm_xml.h"
+#include "log.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "expat.h"
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM )
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/** Set it to 1 to shows log debug information. */
+#define DM_XML_ENABLE_DEBUG_INFO    0
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Current decision matrix xml version */
+#define DM_XML_VERSION              "1.0"
+
+/** Decision matrix level (node level) */
+#define DM_XML_LEVEL                "1"
+
+/** Max. depth of the parse tree: dm - row - data - byte */
+#define DM_XML_DEPTH_MAX            4
+
+/** Max. number of attributes per element */
+#define DM_XML_ATTR_MAX             4
+
+/** Size of the character buffer for the text between xml tags in bytes.
+ * Only values are evaluated, longer texts like descriptions are truncated.
+ */
+#define DM_XML_TEXT_SIZE            32
+
+/** Number of slots in the name hash table. Must be a power of two. */
+#define DM_XML_HASH_TABLE_SIZE      64
+
+/** Max. number of seeds, which are tried to find a perfect hash. */
+#define DM_XML_HASH_SEED_MAX        1024
+
+/** FNV-1a offset basis */
+#define DM_XML_FNV_OFFSET_BASIS     2166136261u
+
+/** FNV-1a prime */
+#define DM_XML_FNV_PRIME            16777619u
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/** Validate pointer */
+#define DM_XML_VALIDATE_PTR(__ptr)  do{ if (NULL == (__ptr)) return DM_XML_RET_ENULL; }while(0)
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/** This type defines the ids of all known element and attribute names. */
+typedef enum
+{
+    DM_XML_NAME_DM = 0,         /**< Element "dm" */
+    DM_XML_NAME_ROW,            /**< Element "row" */
+    DM_XML_NAME_DESCRIPTION,    /**< Element "description" */
+    DM_XML_NAME_OADDR,          /**< Element "oaddr" */
+    DM_XML_NAME_HARDCODED,      /**< Element "hardcoded" */
+    DM_XML_NAME_MASK,           /**< Element "mask" */
+    DM_XML_NAME_FILTER,         /**< Element "filter" */
+    DM_XML_NAME_ZONE,           /**< Element "zone" */
+    DM_XML_NAME_SUBZONE,        /**< Element "subzone" */
+    DM_XML_NAME_ACTION,         /**< Element "action" */
+    DM_XML_NAME_PARAM,          /**< Element "param" */
+    DM_XML_NAME_DATA,           /**< Element "data" */
+    DM_XML_NAME_BYTE,           /**< Element "byte" */
+    DM_XML_NAME_VERSION,        /**< Attribute "version" */
+    DM_XML_NAME_LEVEL,          /**< Attribute "level" */
+    DM_XML_NAME_TYPE,           /**< Attribute "type" */
+    DM_XML_NAME_ENABLED,        /**< Attribute "enabled" */
+    DM_XML_NAME_CLASS,          /**< Attribute "class" */
+    DM_XML_NAME_ID,             /**< Attribute "id" */
+    DM_XML_NAME_NUM,            /**< Number of known names */
+    DM_XML_NAME_UNKNOWN = DM_XML_NAME_NUM   /**< Unknown name, marks the end of a descriptor list too */
+
+} DM_XML_NAME;
+
+/** This type defines the decision matrix xml parser context. */
+typedef struct
+{
+    XML_Parser                      xmlParser;                  /**< XML parser */
+    struct _dm_xml_Element const *  root;                       /**< Root of the parse tree */
+    struct _dm_xml_Element const *  stack[DM_XML_DEPTH_MAX];    /**< Currently open elements */
+    uint8_t                         depth;                      /**< Idendention depth */
+    char const *                    type;                       /**< Expected decision matrix type */
+    vscp_dm_MatrixRow*              dmStorage;                  /**< Standard decision matrix storage */
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION )
+    vscp_dm_ExtRow*                 extStorage;                 /**< Decision matrix extension storage */
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION ) */
+    uint8_t                         maxRows;                    /**< Max. decision matrix rows */
+    uint8_t                         index;                      /**< Decision matrix row index */
+    XML_Char                        text[DM_XML_TEXT_SIZE];     /**< Text between xml tags, without leading whitespaces */
+    uint8_t                         textLen;                    /**< Text length */
+    BOOL                            isAborted;                  /**< Parsing aborted or not */
+    uint8_t                         id;                         /**< ID of BYTE element */
+
+} dm_xml_Context;
+
+typedef DM_XML_RET (*dm_xml_AttrCb)(dm_xml_Context* const con, char const * const value);
+
+typedef struct _dm_xml_Attribute
+{
+    DM_XML_NAME     name;
+    BOOL            required;
+    dm_xml_AttrCb   callBack;
+
+} dm_xml_Attribute;
+
+typedef DM_XML_RET (*dm_xml_ElementStartCb)(dm_xml_Context* const con);
+
+typedef DM_XML_RET (*dm_xml_ElementEndCb)(dm_xml_Context* const con);
+
+typedef struct _dm_xml_Element
+{
+    DM_XML_NAME                     name;
+    dm_xml_ElementStartCb           startCallback;
+    dm_xml_ElementEndCb             endCallback;
+    dm_xml_Attribute const *        attributes;
+    struct _dm_xml_Element const *  children;
+
+} dm_xml_Element;
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+static BOOL dm_xml_buildNameTable(uint32_t seed);
+static uint32_t dm_xml_hash(XML_Char const * name, uint32_t seed);
+static DM_XML_NAME dm_xml_getName(XML_Char const * const name);
+static long dm_xml_getFileSize(FILE* fd);
+static char* dm_xml_loadFileToMem(char const * const fileName);
+static int dm_xml_strcmpi(char const * str1, char const * str2);
+static unsigned long dm_xml_getDataValue(char const * const str);
+static DM_XML_RET dm_xml_getBool(dm_xml_Context* const con, char const * const value, BOOL* const state);
+static DM_XML_RET dm_xml_getTextByte(dm_xml_Context* const con, uint8_t* const value);
+static DM_XML_RET dm_xml_setRowFlag(dm_xml_Context* const con, char const * const value, uint8_t flag);
+static BOOL dm_xml_isExtRow(dm_xml_Context* const con);
+static DM_XML_RET dm_xml_load(dm_xml_Context* const con, char const * const fileName);
+static void dm_xml_clear(dm_xml_Context* const con);
+static DM_XML_RET dm_xml_parse(dm_xml_Context* const con, char const * const xml);
+static void XMLCALL dm_xml_characterDataHandler(void *userData, const XML_Char *str, int len);
+static void XMLCALL dm_xml_startElement(void *userData, const XML_Char *name, const XML_Char **atts);
+static void XMLCALL dm_xml_endElement(void *userData, const XML_Char *name);
+static BOOL dm_xml_handleAttributes(dm_xml_Context* const con, dm_xml_Attribute const * const attributes, const XML_Char **atts);
+static DM_XML_RET dm_xml_handleDmAttrVersion(dm_xml_Context* const con, char const * const value);
+static DM_XML_RET dm_xml_handleDmAttrLevel(dm_xml_Context* const con, char const * const value);
+static DM_XML_RET dm_xml_handleDmAttrType(dm_xml_Context* const con, char const * const value);
+static DM_XML_RET dm_xml_handleRowAttrEnabled(dm_xml_Context* const con, char const * const value);
+static DM_XML_RET dm_xml_handleRowStart(dm_xml_Context* const con);
+static DM_XML_RET dm_xml_handleRowEnd(dm_xml_Context* const con);
+static DM_XML_RET dm_xml_handleOAddrAttrEnabled(dm_xml_Context* const con, char const * const value);
+static DM_XML_RET dm_xml_handleHardcodedAttrEnabled(dm_xml_Context* const con, char const * const value);
+static DM_XML_RET dm_xml_handleMaskAttrClass(dm_xml_Context* const con, char const * const value);
+static DM_XML_RET dm_xml_handleMaskAttrType(dm_xml_Context* const con, char const * const value);
+static DM_XML_RET dm_xml_handleFilterAttrClass(dm_xml_Context* const con, char const * const value);
+static DM_XML_RET dm_xml_handleFilterAttrType(dm_xml_Context* const con, char const * const value);
+static DM_XML_RET dm_xml_handleZoneAttrEnabled(dm_xml_Context* const con, char const * const value);
+static DM_XML_RET dm_xml_handleSubZoneAttrEnabled(dm_xml_Context* const con, char const * const value);
+static DM_XML_RET dm_xml_handleOAddrEnd(dm_xml_Context* const con);
+static DM_XML_RET dm_xml_handleActionEnd(dm_xml_Context* const con);
+static DM_XML_RET dm_xml_handleParamEnd(dm_xml_Context* const con);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION )
+
+static DM_XML_RET dm_xml_handleRowAttrType(dm_xml_Context* const con, char const * const value);
+static DM_XML_RET dm_xml_handleZoneEnd(dm_xml_Context* const con);
+static DM_XML_RET dm_xml_handleSubZoneEnd(dm_xml_Context* const con);
+static DM_XML_RET dm_xml_handleByteEnd(dm_xml_Context* const con);
+static DM_XML_RET dm_xml_handleByteAttrEnabled(dm_xml_Context* const con, char const * const value);
+static DM_XML_RET dm_xml_handleByteAttrId(dm_xml_Context* const con, char const * const value);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION ) */
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/** All known element and attribute names, indexed by DM_XML_NAME. */
+static char const * const       dm_xml_names[DM_XML_NAME_NUM] =
+{
+    "dm",
+    "row",
+    "description",
+    "oaddr",
+    "hardcoded",
+    "mask",
+    "filter",
+    "zone",
+    "subzone",
+    "action",
+    "param",
+    "data",
+    "byte",
+    "version",
+    "level",
+    "type",
+    "enabled",
+    "class",
+    "id"
+};
+
+/** Name hash table, every slot contains a name id or DM_XML_NAME_UNKNOWN. */
+static DM_XML_NAME              dm_xml_hashTable[DM_XML_HASH_TABLE_SIZE];
+
+/** Seed of the name hash, which is used for the current hash table. */
+static uint32_t                 dm_xml_hashSeed         = 0;
+
+/** Is the name hash table built or not? */
+static BOOL                     dm_xml_isInitialized    = FALSE;
+
+/** Attributes of the SUBZONE element. */
+static const dm_xml_Attribute   dm_xml_attrSUBZONE[] =
+{
+    /* Name                     Required    Callback */
+    { DM_XML_NAME_ENABLED,      TRUE,       dm_xml_handleSubZoneAttrEnabled     },
+    { DM_XML_NAME_UNKNOWN,      FALSE,      NULL                                }
+};
+
+/** Attributes of the ZONE element. */
+static const dm_xml_Attribute   dm_xml_attrZONE[] =
+{
+    /* Name                     Required    Callback */
+    { DM_XML_NAME_ENABLED,      TRUE,       dm_xml_handleZoneAttrEnabled        },
+    { DM_XML_NAME_UNKNOWN,      FALSE,      NULL                                }
+};
+
+/** Attributes of the FILTER element. */
+static const dm_xml_Attribute   dm_xml_attrFILTER[] =
+{
+    /* Name                     Required    Callback */
+    { DM_XML_NAME_CLASS,        TRUE,       dm_xml_handleFilterAttrClass        },
+    { DM_XML_NAME_TYPE,         TRUE,       dm_xml_handleFilterAttrType         },
+    { DM_XML_NAME_UNKNOWN,      FALSE,      NULL                                }
+};
+
+/** Attributes of the MASK element. */
+static const dm_xml_Attribute   dm_xml_attrMASK[] =
+{
+    /* Name                     Required    Callback */
+    { DM_XML_NAME_CLASS,        TRUE,       dm_xml_handleMaskAttrClass          },
+    { DM_XML_NAME_TYPE,         TRUE,       dm_xml_handleMaskAttrType           },
+    { DM_XML_NAME_UNKNOWN,      FALSE,      NULL                                }
+};
+
+/** Attributes of the HARDCODED element. */
+static const dm_xml_Attribute   dm_xml_attrHARDCODED[] =
+{
+    /* Name                     Required    Callback */
+    { DM_XML_NAME_ENABLED,      TRUE,       dm_xml_handleHardcodedAttrEnabled   },
+    { DM_XML_NAME_UNKNOWN,      FALSE,      NULL                                }
+};
+
+/** Attributes of the OADDR element. */
+static const dm_xml_Attribute   dm_xml_attrOADDR[] =
+{
+    /* Name                     Required    Callback */
+    { DM_XML_NAME_ENABLED,      TRUE,       dm_xml_handleOAddrAttrEnabled       },
+    { DM_XML_NAME_UNKNOWN,      FALSE,      NULL                                }
+};
+
+/** Attributes of the DM element. */
+static const dm_xml_Attribute   dm_xml_attrDM[] =
+{
+    /* Name                     Required    Callback */
+    { DM_XML_NAME_VERSION,      TRUE,       dm_xml_handleDmAttrVersion          },
+    { DM_XML_NAME_LEVEL,        TRUE,       dm_xml_handleDmAttrLevel            },
+    { DM_XML_NAME_TYPE,         TRUE,       dm_xml_handleDmAttrType             },
+    { DM_XML_NAME_UNKNOWN,      FALSE,      NULL                                }
+};
+
+/** Attributes of the standard ROW element. */
+static const dm_xml_Attribute   dm_xml_attrRowStd[] =
+{
+    /* Name                     Required    Callback */
+    { DM_XML_NAME_ENABLED,      TRUE,       dm_xml_handleRowAttrEnabled         },
+    { DM_XML_NAME_UNKNOWN,      FALSE,      NULL                                }
+};
+
+/** Children of the standard ROW element. */
+static const dm_xml_Element     dm_xml_elemRowStd[] =
+{
+    /* Name                     Start                   End                         Attributes              Children */
+    { DM_XML_NAME_DESCRIPTION,  NULL,                   NULL,                       NULL,                   NULL                },
+    { DM_XML_NAME_OADDR,        NULL,                   dm_xml_handleOAddrEnd,      dm_xml_attrOADDR,       NULL                },
+    { DM_XML_NAME_HARDCODED,    NULL,                   NULL,                       dm_xml_attrHARDCODED,   NULL                },
+    { DM_XML_NAME_MASK,         NULL,                   NULL,                       dm_xml_attrMASK,        NULL                },
+    { DM_XML_NAME_FILTER,       NULL,                   NULL,                       dm_xml_attrFILTER,      NULL                },
+    { DM_XML_NAME_ZONE,         NULL,                   NULL,                       dm_xml_attrZONE,        NULL                },
+    { DM_XML_NAME_SUBZONE,      NULL,                   NULL,                       dm_xml_attrSUBZONE,     NULL                },
+    { DM_XML_NAME_ACTION,       NULL,                   dm_xml_handleActionEnd,     NULL,                   NULL                },
+    { DM_XML_NAME_PARAM,        NULL,                   dm_xml_handleParamEnd,      NULL,                   NULL                },
+    { DM_XML_NAME_UNKNOWN,      NULL,                   NULL,                       NULL,                   NULL                }
+};
+
+/** Children of the standard DM element. */
+static const dm_xml_Element     dm_xml_elemDmStd[] =
+{
+    /* Name                     Start                   End                         Attributes              Children */
+    { DM_XML_NAME_ROW,          dm_xml_handleRowStart,  dm_xml_handleRowEnd,        dm_xml_attrRowStd,      dm_xml_elemRowStd   },
+    { DM_XML_NAME_UNKNOWN,      NULL,                   NULL,                       NULL,                   NULL                }
+};
+
+/** Standard decision matrix root element of the parse tree. */
+static const dm_xml_Element     dm_xml_elemRootStd[] =
+{
+    /* Name                     Start                   End                         Attributes              Children */
+    { DM_XML_NAME_DM,           NULL,                   NULL,                       dm_xml_attrDM,          dm_xml_elemDmStd    },
+    { DM_XML_NAME_UNKNOWN,      NULL,                   NULL,                       NULL,                   NULL                }
+};
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION )
+
+/** Attributes of the BYTE element. */
+static const dm_xml_Attribute   dm_xml_attrBYTE[] =
+{
+    /* Name                     Required    Callback */
+    { DM_XML_NAME_ID,           TRUE,       dm_xml_handleByteAttrId             },
+    { DM_XML_NAME_ENABLED,      TRUE,       dm_xml_handleByteAttrEnabled        },
+    { DM_XML_NAME_UNKNOWN,      FALSE,      NULL                                }
+};
+
+/** Children of the DATA element. */
+static const dm_xml_Element     dm_xml_elemData[] =
+{
+    /* Name                     Start                   End                         Attributes              Children */
+    { DM_XML_NAME_BYTE,         NULL,                   dm_xml_handleByteEnd,       dm_xml_attrBYTE,        NULL                },
+    { DM_XML_NAME_UNKNOWN,      NULL,                   NULL,                       NULL,                   NULL                }
+};
+
+/** Attributes of the extended ROW element. The type is handled before the row is enabled. */
+static const dm_xml_Attribute   dm_xml_attrRowExt[] =
+{
+    /* Name                     Required    Callback */
+    { DM_XML_NAME_TYPE,         TRUE,       dm_xml_handleRowAttrType            },
+    { DM_XML_NAME_ENABLED,      TRUE,       dm_xml_handleRowAttrEnabled         },
+    { DM_XML_NAME_UNKNOWN,      FALSE,      NULL                                }
+};
+
+/** Children of the extended ROW element. */
+static const dm_xml_Element     dm_xml_elemRowExt[] =
+{
+    /* Name                     Start                   End                         Attributes              Children */
+    { DM_XML_NAME_DESCRIPTION,  NULL,                   NULL,                       NULL,                   NULL                },
+    { DM_XML_NAME_OADDR,        NULL,                   dm_xml_handleOAddrEnd,      dm_xml_attrOADDR,       NULL                },
+    { DM_XML_NAME_HARDCODED,    NULL,                   NULL,                       dm_xml_attrHARDCODED,   NULL                },
+    { DM_XML_NAME_MASK,         NULL,                   NULL,                       dm_xml_attrMASK,        NULL                },
+    { DM_XML_NAME_FILTER,       NULL,                   NULL,                       dm_xml_attrFILTER,      NULL                },
+    { DM_XML_NAME_ZONE,         NULL,                   dm_xml_handleZoneEnd,       dm_xml_attrZONE,        NULL                },
+    { DM_XML_NAME_SUBZONE,      NULL,                   dm_xml_handleSubZoneEnd,    dm_xml_attrSUBZONE,     NULL                },
+    { DM_XML_NAME_ACTION,       NULL,                   dm_xml_handleActionEnd,     NULL,                   NULL                },
+    { DM_XML_NAME_PARAM,        NULL,                   dm_xml_handleParamEnd,      NULL,                   NULL                },
+    { DM_XML_NAME_DATA,         NULL,                   NULL,                       NULL,                   dm_xml_elemData     },
+    { DM_XML_NAME_UNKNOWN,      NULL,                   NULL,                       NULL,                   NULL                }
+};
+
+/** Children of the extended DM element. */
+static const dm_xml_Element     dm_xml_elemDmExt[] =
+{
+    /* Name                     Start                   End                         Attributes              Children */
+    { DM_XML_NAME_ROW,          dm_xml_handleRowStart,  dm_xml_handleRowEnd,        dm_xml_attrRowExt,      dm_xml_elemRowExt   },
+    { DM_XML_NAME_UNKNOWN,      NULL,                   NULL,                       NULL,                   NULL                }
+};
+
+/** Extended decision matrix root element of the parse tree. */
+static const dm_xml_Element     dm_xml_elemRootExt[] =
+{
+    /* Name                     Start                   End                         Attributes              Children */
+    { DM_XML_NAME_DM,           NULL,                   NULL,                       dm_xml_attrDM,          dm_xml_elemDmExt    },
+    { DM_XML_NAME_UNKNOWN,      NULL,                   NULL,                       NULL,                   NULL                }
+};
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION ) */
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function initializes this module and builds the name hash table.
+ */
+extern void dm_xml_init(void)
+{
+    uint32_t    seed    = 0;
+
+    /* Search for a seed, which maps every known name to its own slot. */
+    while((DM_XML_HASH_SEED_MAX > seed) &&
+          (FALSE == dm_xml_buildNameTable(seed)))
+    {
+        ++seed;
+    }
+
+    /* No perfect hash found? The linear probing of the last built table
+     * resolves the collisions, only the lookup is a little bit slower.
+     */
+    if (DM_XML_HASH_SEED_MAX <= seed)
+    {
+        LOG_WARNING("No perfect hash for the decision matrix xml names found.");
+    }
+
+    dm_xml_isInitialized = TRUE;
+
+    return;
+}
+
+/**
+ * This function loads the content of a standard decision matrix xml file to the
+ * specified memory location.
+ *
+ * @param[in]   fileName    Standard decision matrix xml file name
+ * @param[out]  dm          Decision matrix storage
+ * @param[in]   rows        Max. number of decision matrix rows in the storage
+ * @return Status
+ */
+extern DM_XML_RET dm_xml_loadStd(char const * const fileName, vscp_dm_MatrixRow * const dm, uint8_t rows)
+{
+    dm_xml_Context  parserContext;
+
+    DM_XML_VALIDATE_PTR(fileName);
+    DM_XML_VALIDATE_PTR(dm);
+
+    /* Initialize parser context */
+    memset(&parserContext, 0, sizeof(parserContext));
+
+    parserContext.root      = dm_xml_elemRootStd;
+    parserContext.type      = "std";
+    parserContext.dmStorage = dm;
+    parserContext.maxRows   = rows;
+
+    return dm_xml_load(&parserContext, fileName);
+}
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION )
+
+/**
+ * This function loads the content of a extended decision matrix xml file to the
+ * specified memory locations.
+ *
+ * @param[in]   fileName    Extended decision matrix xml file name
+ * @param[out]  dm          Decision matrix storage
+ * @param[out]  ext         Decision matrix extension storage
+ * @param[in]   rows        Max. number of decision matrix rows in the storage
+ * @return Status
+ */
+extern DM_XML_RET dm_xml_loadExt(char const * const fileName, vscp_dm_MatrixRow * const dm, vscp_dm_ExtRow * const ext, uint8_t rows)
+{
+    dm_xml_Context  parserContext;
+
+    DM_XML_VALIDATE_PTR(fileName);
+    DM_XML_VALIDATE_PTR(dm);
+    DM_XML_VALIDATE_PTR(ext);
+
+    /* Initialize parser context */
+    memset(&parserContext, 0, sizeof(parserContext));
+
+    parserContext.root          = dm_xml_elemRootExt;
+    parserContext.type          = "ext";
+    parserContext.dmStorage     = dm;
+    parserContext.extStorage    = ext;
+    parserContext.maxRows       = rows;
+
+    return dm_xml_load(&parserContext, fileName);
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION ) */
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function builds the name hash table with the given seed.
+ * Collisions are resolved by linear probing.
+ *
+ * @param[in]   seed    Hash seed
+ * @return Perfect hash or not
+ * @retval FALSE    At least one collision happened
+ * @retval TRUE     Every name got its own slot
+ */
+static BOOL dm_xml_buildNameTable(uint32_t seed)
+{
+    BOOL        isPerfect   = TRUE;
+    uint32_t    slot        = 0;
+    uint8_t     name        = 0;
+
+    for(slot = 0; DM_XML_HASH_TABLE_SIZE > slot; ++slot)
+    {
+        dm_xml_hashTable[slot] = DM_XML_NAME_UNKNOWN;
+    }
+
+    for(name = 0; DM_XML_NAME_NUM > name; ++name)
+    {
+        slot = dm_xml_hash(dm_xml_names[name], seed) & (DM_XML_HASH_TABLE_SIZE - 1);
+
+        while(DM_XML_NAME_UNKNOWN != dm_xml_hashTable[slot])
+        {
+            isPerfect = FALSE;
+            slot = (slot + 1) & (DM_XML_HASH_TABLE_SIZE - 1);
+        }
+
+        dm_xml_hashTable[slot] = (DM_XML_NAME)name;
+    }
+
+    dm_xml_hashSeed = seed;
+
+    return isPerfect;
+}
+
+/**
+ * This function calculates the case-insensitive FNV-1a hash of a name.
+ *
+ * @param[in]   name    Name
+ * @param[in]   seed    Hash seed
+ * @return Hash
+ */
+static uint32_t dm_xml_hash(XML_Char const * name, uint32_t seed)
+{
+    uint32_t    hash    = DM_XML_FNV_OFFSET_BASIS ^ seed;
+
+    while('\0' != *name)
+    {
+        hash ^= (uint8_t)tolower((unsigned char)*name);
+        hash *= DM_XML_FNV_PRIME;
+        ++name;
+    }
+
+    /* Fold the upper bits in, because only the lower bits select the slot. */
+    hash ^= hash >> 16;
+
+    return hash;
+}
+
+/**
+ * This function returns the id of a element or attribute name.
+ *
+ * @param[in]   name    Element or attribute name
+ * @return Name id
+ * @retval DM_XML_NAME_UNKNOWN  Name is unknown
+ */
+static DM_XML_NAME dm_xml_getName(XML_Char const * const name)
+{
+    DM_XML_NAME result  = DM_XML_NAME_UNKNOWN;
+    uint32_t    slot    = dm_xml_hash(name, dm_xml_hashSeed) & (DM_XML_HASH_TABLE_SIZE - 1);
+
+    /* The table contains always empty slots, which terminates the search. */
+    while(DM_XML_NAME_UNKNOWN != dm_xml_hashTable[slot])
+    {
+        /* A different name may have the same hash, therefore verify it. */
+        if (0 == dm_xml_strcmpi(dm_xml_names[dm_xml_hashTable[slot]], name))
+        {
+            result = dm_xml_hashTable[slot];
+            break;
+        }
+
+        slot = (slot + 1) & (DM_XML_HASH_TABLE_SIZE - 1);
+    }
+
+    return result;
+}
+
+/**
+ * This function returns the file size.
+ *
+ * @param[in]   fd  File descriptor
+ * @return File size in byte
+ */
+static long dm_xml_getFileSize(FILE* fd)
+{
+    long    fileSize    = 0;
+    long    oldPos      = 0;
+    BOOL    error       = FALSE;
+
+    if (NULL == fd)
+    {
+        return 0;
+    }
+
+    /* Remember current position */
+    oldPos = ftell(fd);
+
+    /* Determine file size */
+    if (0 != fseek(fd, 0L, SEEK_END))
+    {
+        error = TRUE;
+    }
+    else
+    {
+        fileSize = ftell(fd);
+
+        if (0 != fseek(fd, 0L, SEEK_SET))
+        {
+            error = TRUE;
+        }
+        else
+        {
+            fileSize -= ftell(fd);
+        }
+    }
+
+    if (TRUE == error)
+    {
+        fileSize = 0;
+    }
+
+    /* Jump back to old position */
+    (void)fseek(fd, oldPos, SEEK_SET);
+
+    return fileSize;
+}
+
+/**
+ * This function loads a file to memory.
+ * The returned buffer will be '\0' terminated.
+ * Don't forget to free the buffer later!
+ *
+ * @param[in]   fileName    Decision matrix xml file name
+ * @return Pointer to buffer
+ */
+static char* dm_xml_loadFileToMem(char const * const fileName)
+{
+    FILE    *fd         = NULL;
+    long    fileSize    = 0;
+    char    *buffer     = NULL;
+
+    /* If a decision matrix file exists, it will be loaded. */
+    fd = fopen(fileName, "rb");
+
+    /* No decision matrix file found? */
+    if (NULL == fd)
+    {
+        return NULL;
+    }
+
+    /* Determine file size */
+    fileSize = dm_xml_getFileSize(fd);
+
+    /* Read the whole file to the memory and process it. */
+    buffer = (char*)malloc(fileSize + 1);
+
+    if (NULL != buffer)
+    {
+        /* Read whole file to memory */
+        if (fileSize != fread(buffer, 1, fileSize, fd))
+        {
+            /* Error happened, clear buffer */
+            free(buffer);
+            buffer = NULL;
+        }
+        else
+        {
+            buffer[fileSize] = '\0';
+        }
+    }
+
+    /* Close decision matrix file */
+    fclose(fd);
+    fd = NULL;
+
+    return buffer;
+}
+
+/**
+ * This function compares case-insensitive.
+ *
+ * @param[in] str1  String 1
+ * @param[in] str2  String 2
+ * @return Compare result
+ * @retval <0   The first character that does not match has a lower value in str1 than in str2.
+ * @retval 0    The content of both strings is equal.
+ * @retval >0   The first character that does not match has a greater value in str1 than in str2.
+ */
+static int dm_xml_strcmpi(char const * str1, char const * str2)
+{
+    int result = 0;
+
+    if ((NULL == str1) && (NULL == str2))
+    {
+        result = 0;
+    }
+    else if ((NULL == str1) && (NULL != str2))
+    {
+        result = -1;
+    }
+    else if ((NULL != str1) && (NULL == str2))
+    {
+        result = 1;
+    }
+    else
+    {
+        /* The string termination is compared too, otherwise a prefix would be equal. */
+        while(0 == result)
+        {
+            const char character1 = tolower((unsigned char)*str1);
+            const char character2 = tolower((unsigned char)*str2);
+
+            if (character1 < character2)
+            {
+                result = -1;
+            }
+            else if (character1 > character2)
+            {
+                result = 1;
+            }
+            else if ('\0' == character1)
+            {
+                break;
+            }
+            else
+            {
+                ++str1;
+                ++str2;
+            }
+        }
+    }
+
+    return result;
+}
+
+/**
+ * This function returns a data value from the string.
+ * The data can be coded as decimal value or hexa-decimal value.
+ *
+ * @param[in]   str Data string
+ * @return Value
+ */
+static unsigned long dm_xml_getDataValue(char const * const str)
+{
+    unsigned long   value   = 0;
+    char*           nstop   = NULL;
+
+    if ((NULL != strchr(str, 'x' )) ||
+        (NULL != strchr(str, 'X' )))
+    {
+        value = strtoul(str, &nstop, 16);
+    }
+    else
+    {
+        value = strtoul(str, &nstop, 10);
+    }
+
+    return value;
+}
+
+/**
+ * This function converts a "true" or "false" attribute value.
+ *
+ * @param[in]   con     Parser context
+ * @param[in]   value   Attribute value
+ * @param[out]  state   State
+ * @return Status
+ */
+static DM_XML_RET dm_xml_getBool(dm_xml_Context* const con, char const * const value, BOOL* const state)
+{
+    DM_XML_RET  ret = DM_XML_RET_OK;
+
+    DM_XML_VALIDATE_PTR(con);
+    DM_XML_VALIDATE_PTR(value);
+    DM_XML_VALIDATE_PTR(state);
+
+    if (0 == dm_xml_strcmpi(value, "true"))
+    {
+        *state = TRUE;
+    }
+    else if (0 == dm_xml_strcmpi(value, "false"))
+    {
+        *state = FALSE;
+    }
+    else
+    {
+        LOG_ERROR_INT32("Attribute value invalid at line", XML_GetCurrentLineNumber(con->xmlParser));
+
+        ret = DM_XML_RET_ERROR;
+    }
+
+    return ret;
+}
+
+/**
+ * This function returns the byte value of the current element text.
+ *
+ * @param[in]   con     Parser context
+ * @param[out]  value   Value
+ * @return Status
+ */
+static DM_XML_RET dm_xml_getTextByte(dm_xml_Context* const con, uint8_t* const value)
+{
+    DM_XML_RET  ret = DM_XML_RET_OK;
+
+    DM_XML_VALIDATE_PTR(con);
+    DM_XML_VALIDATE_PTR(value);
+
+    if (0 < con->textLen)
+    {
+        unsigned long valueUL = dm_xml_getDataValue(con->text);
+
+        if (0xff >= valueUL)
+        {
+            *value = (uint8_t)valueUL;
+        }
+        else
+        {
+            LOG_ERROR_INT32("Invalid value. Can only be in the range 0 - 255. Line", XML_GetCurrentLineNumber(con->xmlParser));
+
+            ret = DM_XML_RET_ERROR;
+        }
+    }
+    else
+    {
+        LOG_ERROR_INT32("Missing value. Line", XML_GetCurrentLineNumber(con->xmlParser));
+
+        ret = DM_XML_RET_ERROR;
+    }
+
+    return ret;
+}
+
+/**
+ * This function sets or clears a flag of the current decision matrix row,
+ * depended on a "true" or "false" attribute value.
+ *
+ * @param[in]   con     Parser context
+ * @param[in]   value   Attribute value
+ * @param[in]   flag    Decision matrix row flag
+ * @return Status
+ */
+static DM_XML_RET dm_xml_setRowFlag(dm_xml_Context* const con, char const * const value, uint8_t flag)
+{
+    DM_XML_RET  ret     = DM_XML_RET_OK;
+    BOOL        state   = FALSE;
+
+    DM_XML_VALIDATE_PTR(con);
+    DM_XML_VALIDATE_PTR(value);
+
+    ret = dm_xml_getBool(con, value, &state);
+
+    if (DM_XML_RET_OK == ret)
+    {
+        if (TRUE == state)
+        {
+            con->dmStorage[con->index].flags |= flag;
+        }
+        else
+        {
+            con->dmStorage[con->index].flags &= ~flag;
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * This function returns whether the current decision matrix row is extended.
+ *
+ * @param[in]   con Parser context
+ * @return Extended row or not
+ * @retval FALSE    Standard row
+ * @retval TRUE     Extended row
+ */
+static BOOL dm_xml_isExtRow(dm_xml_Context* const con)
+{
+    BOOL    isExtRow    = FALSE;
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION )
+
+    if ((NULL != con->extStorage) &&
+        (VSCP_DM_ACTION_EXTENDED_DM == con->dmStorage[con->index].action))
+    {
+        isExtRow = TRUE;
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION ) */
+
+    return isExtRow;
+}
+
+/**
+ * This function loads a decision matrix xml file with the prepared parser
+ * context. If any error happened, the decision matrix storage is cleared.
+ *
+ * @param[in]   con         Parser context
+ * @param[in]   fileName    Decision matrix xml file name
+ * @return Status
+ */
+static DM_XML_RET dm_xml_load(dm_xml_Context* const con, char const * const fileName)
+{
+    DM_XML_RET  ret         = DM_XML_RET_OK;
+    char*       fileBuffer  = NULL;
+
+    DM_XML_VALIDATE_PTR(con);
+    DM_XML_VALIDATE_PTR(fileName);
+
+    /* Load decision matrix xml file */
+    fileBuffer = dm_xml_loadFileToMem(fileName);
+
+    if (NULL == fileBuffer)
+    {
+        return DM_XML_RET_EFILE;
+    }
+
+    /* Build the name hash table on demand */
+    if (FALSE == dm_xml_isInitialized)
+    {
+        dm_xml_init();
+    }
+
+    /* Clear decision matrix */
+    dm_xml_clear(con);
+
+    ret = dm_xml_parse(con, fileBuffer);
+
+    /* If any error happened, clear the decision matrix. */
+    if ((DM_XML_RET_OK != ret) ||
+        (TRUE == con->isAborted))
+    {
+        dm_xml_clear(con);
+
+        if ((DM_XML_RET_OK == ret) &&
+            (TRUE == con->isAborted))
+        {
+            ret = DM_XML_RET_ERROR;
+        }
+    }
+    else
+    {
+        LOG_INFO_UINT32("Number of configured decision matrix rows:", con->index);
+    }
+
+    /* Free allocated ressources */
+    free(fileBuffer);
+    fileBuffer = NULL;
+
+    return ret;
+}
+
+/**
+ * This function clears the decision matrix storage of the parser context.
+ *
+ * @param[in]   con Parser context
+ */
+static void dm_xml_clear(dm_xml_Context* const con)
+{
+    memset(con->dmStorage, 0, sizeof(vscp_dm_MatrixRow) * con->maxRows);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION )
+
+    if (NULL != con->extStorage)
+    {
+        memset(con->extStorage, 0, sizeof(vscp_dm_ExtRow) * con->maxRows);
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION ) */
+
+    return;
+}
+
+/**
+ * This function parse the decision matrix xml and writes it to the storage
+ * of the parser context.
+ *
+ * @param[in]   con Parser context
+ * @param[in]   xml Decision matrix xml as terminated string.
+ * @return Status
+ */
+static DM_XML_RET dm_xml_parse(dm_xml_Context* const con, char const * const xml)
+{
+    DM_XML_RET  ret = DM_XML_RET_OK;
+
+    DM_XML_VALIDATE_PTR(con);
+    DM_XML_VALIDATE_PTR(xml);
+
+    /* Setup expat XML parser */
+    con->xmlParser = XML_ParserCreate(NULL);
+
+    if (NULL == con->xmlParser)
+    {
+        return DM_XML_RET_ERROR;
+    }
+
+    XML_SetUserData(con->xmlParser, con);
+    XML_SetElementHandler(con->xmlParser, dm_xml_startElement, dm_xml_endElement);
+    XML_SetCharacterDataHandler(con->xmlParser, dm_xml_characterDataHandler);
+
+    if (XML_STATUS_ERROR == XML_Parse(con->xmlParser, xml, strlen(xml), 1))
+    {
+        /* Parser error */
+        LOG_ERROR_INT32(XML_ErrorString(XML_GetErrorCode(con->xmlParser)), XML_GetCurrentLineNumber(con->xmlParser));
+        ret = DM_XML_RET_ERROR;
+    }
+
+    XML_ParserFree(con->xmlParser);
+    con->xmlParser = NULL;
+
+    return ret;
+}
+
+/**
+ * This function is called by the xml parser for every element text.
+ * The text may be delivered in several chunks, which are appended.
+ *
+ * @param[in]   userData    User data
+ * @param[in]   str         Element text
+ * @param[in]   len         Element text length
+ */
+static void XMLCALL dm_xml_characterDataHandler(void *userData, const XML_Char *str, int len)
+{
+    dm_xml_Context* con = (dm_xml_Context*)userData;
+
+    if ((NULL == userData) ||
+        (NULL == str))
+    {
+        return;
+    }
+
+    /* Skip leading whitespaces */
+    if (0 == con->textLen)
+    {
+        while((0 < len) && (0 != isspace((unsigned char)*str)))
+        {
+            ++str;
+            --len;
+        }
+    }
+
+    /* Keep space for the string termination, the rest is truncated. */
+    if ((DM_XML_TEXT_SIZE - 1 - con->textLen) < len)
+    {
+        len = DM_XML_TEXT_SIZE - 1 - con->textLen;
+    }
+
+    if (0 < len)
+    {
+        memcpy(&con->text[con->textLen], str, len);
+        con->textLen += len;
+        con->text[con->textLen] = '\0';
+    }
+
+    return;
+}
+
+/**
+ * This function is called by the xml parser for every found element start (xml tag).
+ *
+ * @param[in]   userData    User data
+ * @param[in]   name        Element name
+ * @param[in]   atts        Array of attributes
+ */
+static void XMLCALL dm_xml_startElement(void *userData, const XML_Char *name, const XML_Char **atts)
+{
+    dm_xml_Context*         con         = (dm_xml_Context*)userData;
+    BOOL                    abort       = FALSE;
+    dm_xml_Element const *  elem        = NULL;
+
+    if ((NULL == userData) ||
+        (NULL == name))
+    {
+        return;
+    }
+
+    /* Get the children of the current element. */
+    if (0 == con->depth)
+    {
+        elem = con->root;
+    }
+    else
+    {
+        elem = con->stack[con->depth - 1]->children;
+    }
+
+    /* Bottom of parse tree reached? */
+    if ((NULL == elem) ||
+        (DM_XML_DEPTH_MAX <= con->depth))
+    {
+        LOG_ERROR_INT32("Bottom of parse tree reached at line", XML_GetCurrentLineNumber(con->xmlParser));
+        abort = TRUE;
+    }
+    else
+    {
+        DM_XML_NAME const   elemName    = dm_xml_getName(name);
+
+        /* Find this element in the children. */
+        while((DM_XML_NAME_UNKNOWN != elem->name) &&
+              (elemName != elem->name))
+        {
+            ++elem;
+        }
+
+        /* Element not found? */
+        if (DM_XML_NAME_UNKNOWN == elem->name)
+        {
+            LOG_DEBUG_STR("Unknown element:", name);
+            LOG_ERROR_INT32("Unknown element at line", XML_GetCurrentLineNumber(con->xmlParser));
+            abort = TRUE;
+        }
+        /* Element is known */
+        else
+        {
+#if (1 == DM_XML_ENABLE_DEBUG_INFO)
+            LOG_DEBUG_STR("Element start:", dm_xml_names[elem->name]);
+#endif  /* (1 == DM_XML_ENABLE_DEBUG_INFO) */
+
+            /* Start with an empty element text */
+            con->textLen = 0;
+            con->text[0] = '\0';
+
+            /* Get element information */
+            if (NULL != elem->startCallback)
+            {
+                if (DM_XML_RET_OK != elem->startCallback(con))
+                {
+                    LOG_ERROR_INT32("Internal error happened at line", XML_GetCurrentLineNumber(con->xmlParser));
+                    abort = TRUE;
+                }
+            }
+
+            /* Handle all attributes of the known element */
+            if ((FALSE == abort) &&
+                (NULL != elem->attributes))
+            {
+                if (FALSE == dm_xml_handleAttributes(con, elem->attributes, atts))
+                {
+                    abort = TRUE;
+                }
+            }
+
+            /* One step down in the tree */
+            con->stack[con->depth] = elem;
+            ++con->depth;
+        }
+    }
+
+    /* Abort parsing? */
+    if (TRUE == abort)
+    {
+        con->isAborted = TRUE;
+
+        XML_SetElementHandler(con->xmlParser, NULL, NULL);
+        XML_SetCharacterDataHandler(con->xmlParser, NULL);
+    }
+
+    return;
+}
+
+/**
+ * This function is called by the xml parser for every found element end (xml tag).
+ * The xml parser ensures that it belongs to the last started element.
+ *
+ * @param[in]   userData    User data
+ * @param[in]   name        Element name
+ */
+static void XMLCALL dm_xml_endElement(void *userData, const XML_Char *name)
+{
+    dm_xml_Context*         con     = (dm_xml_Context*)userData;
+    dm_xml_Element const *  elem    = NULL;
+
+    if ((NULL == userData) ||
+        (NULL == name) ||
+        (0 == con->depth))
+    {
+        return;
+    }
+
+    /* One step up in the tree */
+    --con->depth;
+    elem = con->stack[con->depth];
+
+#if (1 == DM_XML_ENABLE_DEBUG_INFO)
+    LOG_DEBUG_STR("Element end:", name);
+#endif  /* (1 == DM_XML_ENABLE_DEBUG_INFO) */
+
+    /* Get element information */
+    if (NULL != elem->endCallback)
+    {
+        if (DM_XML_RET_OK != elem->endCallback(con))
+        {
+            LOG_ERROR_INT32("Internal error happened at line", XML_GetCurrentLineNumber(con->xmlParser));
+
+            con->isAborted = TRUE;
+
+            XML_SetElementHandler(con->xmlParser, NULL, NULL);
+            XML_SetCharacterDataHandler(con->xmlParser, NULL);
+        }
+    }
+
+    return;
+}
+
+/**
+ * This function handles all attributes of a element. The attribute values are
+ * extracted in a single pass over the element attributes, afterwards the
+ * callbacks are called in the order of the attribute descriptors.
+ *
+ * @param[in]   con         Parser context
+ * @param[in]   attributes  Attribute descriptors of the element
+ * @param[in]   atts        Array of attributes
+ * @return Successful or not
+ * @retval FALSE    Failed
+ * @retval TRUE     Successful
+ */
+static BOOL dm_xml_handleAttributes(dm_xml_Context* const con, dm_xml_Attribute const * const attributes, const XML_Char **atts)
+{
+    BOOL                isSuccessful            = TRUE;
+    XML_Char const *    values[DM_XML_ATTR_MAX];
+    uint8_t             index                   = 0;
+
+    memset(values, 0, sizeof(values));
+
+    if (NULL != atts)
+    {
+        uint32_t    attsIndex   = 0;
+
+        while((NULL != atts[attsIndex]) &&
+              (NULL != atts[attsIndex + 1]))
+        {
+            DM_XML_NAME const   attrName    = dm_xml_getName(atts[attsIndex]);
+
+            /* Unknown attributes, e.g. xml namespaces, are skipped. */
+            if (DM_XML_NAME_UNKNOWN != attrName)
+            {
+                for(index = 0; (DM_XML_ATTR_MAX > index) && (DM_XML_NAME_UNKNOWN != attributes[index].name); ++index)
+                {
+                    if (attrName == attributes[index].name)
+                    {
+                        values[index] = atts[attsIndex + 1];
+                        break;
+                    }
+                }
+            }
+
+            attsIndex += 2;
+        }
+    }
+
+    for(index = 0; (DM_XML_ATTR_MAX > index) && (DM_XML_NAME_UNKNOWN != attributes[index].name); ++index)
+    {
+        /* Attribute not found? */
+        if (NULL == values[index])
+        {
+            /* Is the attribute required? */
+            if (TRUE == attributes[index].required)
+            {
+                LOG_DEBUG_STR("Attribute missing:", dm_xml_names[attributes[index].name]);
+                LOG_ERROR_INT32("Attribute missing at line", XML_GetCurrentLineNumber(con->xmlParser));
+                isSuccessful = FALSE;
+            }
+        }
+        /* Attribute found */
+        else
+        {
+#if (1 == DM_XML_ENABLE_DEBUG_INFO)
+            LOG_DEBUG_STR("Attribute:", dm_xml_names[attributes[index].name]);
+#endif  /* (1 == DM_XML_ENABLE_DEBUG_INFO) */
+
+            /* Notify application */
+            if (NULL != attributes[index].callBack)
+            {
+                if (DM_XML_RET_OK != attributes[index].callBack(con, values[index]))
+                {
+                    LOG_ERROR_INT32("Internal error happened at line", XML_GetCurrentLineNumber(con->xmlParser));
+                    isSuccessful = FALSE;
+                }
+            }
+        }
+    }
+
+    return isSuccessful;
+}
+
+/**
+ * This function handles the "version" attribute of the DM element.
+ *
+ * @param[in]   con     Parser context
+ * @param[in]   value   Attribute value
+ * @return Status
+ */
+static DM_XML_RET dm_xml_handleDmAttrVersion(dm_xml_Context* const con, char const * const value)
+{
+    DM_XML_RET ret = DM_XML_RET_OK;
+
+    DM_XML_VALIDATE_PTR(con);
+    DM_XML_VALIDATE_PTR(value);
+
+    /* Check the version */
+    if (0 != dm_xml_strcmpi(value, DM_XML_VERSION))
+    {
+        /* Wrong xml version */
+        LOG_ERROR("Wrong decision matrix file format version.");
+
+        ret = DM_XML_RET_ERROR;
+    }
+
+    return ret;
+}
+
+/**
+ * This function handles the "level" attribute of the DM element.
+ *
+ * @param[in]   con     Parser context
+ * @param[in]   value   Attribute value
+ * @return Status
+ */
+static DM_XML_RET dm_xml_handleDmAttrLevel(dm_xml_Context* const con, char const * const value)
+{
+    DM_XML_RET ret = DM_XML_RET_OK;
+
+    DM_XML_VALIDATE_PTR(con);
+    DM_XML_VALIDATE_PTR(value);
+
+    /* Check the level */
+    if (0 != dm_xml_strcmpi(value, DM_XML_LEVEL))
+    {
+        /* Wrong decision matrix level */
+        LOG_ERROR("Wrong decision matrix level.");
+
+        ret = DM_XML_RET_ERROR;
+    }
+
+    return ret;
+}
+
+/**
+ * This function handles the "type" attribute of the DM element.
+ *
+ * @param[in]   con     Parser context
+ * @param[in]   value   Attribute value
+ * @return Status
+ */
+static DM_XML_RET dm_xml_handleDmAttrType(dm_xml_Context* const con, char const * const value)
+{
+    DM_XML_RET ret = DM_XML_RET_OK;
+
+    DM_XML_VALIDATE_PTR(con);
+    DM_XML_VALIDATE_PTR(value);
+
+    /* Check the type */
+    if (0 != dm_xml_strcmpi(value, con->type))
+    {
+        /* Wrong decision matrix type */
+        LOG_ERROR("Wrong decision matrix type.");
+
+        ret = DM_XML_RET_ERROR;
+    }
+
+    return ret;
+}
+
+/**
+ * This function handles the "enabled" attribute of the ROW element.
+ *
+ * @param[in]   con     Parser context
+ * @param[in]   value   Attribute value
+ * @return Status
+ */
+static DM_XML_RET dm_xml_handleRowAttrEnabled(dm_xml_Context* const con, char const * const value)
+{
+    return dm_xml_setRowFlag(con, value, VSCP_DM_FLAG_ENABLE);
+}
+
+/**
+ * This function handle the start of the ROW element.
+ *
+ * @param[in]   con Parser context
+ * @return Status
+ */
+static DM_XML_RET dm_xml_handleRowStart(dm_xml_Context* const con)
+{
+    DM_XML_RET ret = DM_XML_RET_OK;
+
+    DM_XML_VALIDATE_PTR(con);
+
+    /* Avoid decision matrix storage overflow by writing more rows than reserved for the decision matrix. */
+    if (con->maxRows <= con->index)
+    {
+        LOG_ERROR("DM XML file contains more rows, than max. possible.");
+
+        ret = DM_XML_RET_ERROR;
+    }
+    else
+    {
+        /* Clear decision matrix row */
+        memset(&con->dmStorage[con->index], 0, sizeof(vscp_dm_MatrixRow));
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION )
+
+        if (NULL != con->extStorage)
+        {
+            memset(&con->extStorage[con->index], 0, sizeof(vscp_dm_ExtRow));
+        }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION ) */
+    }
+
+    return ret;
+}
+
+/**
+ * This function handle the end of the ROW element.
+ *
+ * @param[in]   con Parser context
+ * @return Status
+ */
+static DM_XML_RET dm_xml_handleRowEnd(dm_xml_Context* const con)
+{
+    DM_XML_VALIDATE_PTR(con);
+
+    ++con->index;
+
+    return DM_XML_RET_OK;
+}
+
+/**
+ * This function handles the "enabled" attribute of the OADDR element.
+ *
+ * @param[in]   con     Parser context
+ * @param[in]   value   Attribute value
+ * @return Status
+ */
+static DM_XML_RET dm_xml_handleOAddrAttrEnabled(dm_xml_Context* const con, char const * const value)
+{
+    return dm_xml_setRowFlag(con, value, VSCP_DM_FLAG_CHECK_OADDR);
+}
+
+/**
+ * This function handles the "enabled" attribute of the HARDCODED element.
+ *
+ * @param[in]   con     Parser context
+ * @param[in]   value   Attribute value
+ * @return Status
+ */
+static DM_XML_RET dm_xml_handleHardcodedAttrEnabled(dm_xml_Context* const con, char const * const value)
+{
+    return dm_xml_setRowFlag(con, value, VSCP_DM_FLAG_HARDCODED);
+}
+
+/**
+ * This function handles the "class" attribute of the MASK element.
+ *
+ * @param[in]   con     Parser context
+ * @param[in]   value   Attribute value
+ * @return Status
+ */
+static DM_XML_RET dm_xml_handleMaskAttrClass(dm_xml_Context* const con, char const * const value)
+{
+    DM_XML_RET      ret     = DM_XML_RET_OK;
+    unsigned long   valueUL = 0;
+
+    DM_XML_VALIDATE_PTR(con);
+    DM_XML_VALIDATE_PTR(value);
+
+    valueUL = dm_xml_getDataValue(value);
+
+    if (0x1ff >= valueUL)
+    {
+        con->dmStorage[con->index].classMask = (uint8_t)(valueUL & 0xff);
+
+        if (0 != (valueUL & 0x100))
+        {
+            con->dmStorage[con->index].flags |= VSCP_DM_FLAG_CLASS_MASK_BIT8;
+        }
+    }
+    else
+    {
+        LOG_ERROR_INT32("Attribute class out of range at line", XML_GetCurrentLineNumber(con->xmlParser));
+
+        ret = DM_XML_RET_ERROR;
+    }
+
+    return ret;
+}
+
+/**
+ * This function handles the "type" attribute of the MASK element.
+ *
+ * @param[in]   con     Parser context
+ * @param[in]   value   Attribute value
+ * @return Status
+ */
+static DM_XML_RET dm_xml_handleMaskAttrType(dm_xml_Context* const con, char const * const value)
+{
+    DM_XML_RET      ret     = DM_XML_RET_OK;
+    unsigned long   valueUL = 0;
+
+    DM_XML_VALIDATE_PTR(con);
+    DM_XML_VALIDATE_PTR(value);
+
+    valueUL = dm_xml_getDataValue(value);
+
+    if (0xff >= valueUL)
+    {
+        con->dmStorage[con->index].typeMask = valueUL;
+    }
+    else
+    {
+        LOG_ERROR_INT32("Attribute type out of range at line", XML_GetCurrentLineNumber(con->xmlParser));
+
+        ret = DM_XML_RET_ERROR;
+    }
+
+    return ret;
+}
+
+/**
+ * This function handles the "class" attribute of the FILTER element.
+ *
+ * @param[in]   con     Parser context
+ * @param[in]   value   Attribute value
+ * @return Status
+ */
+static DM_XML_RET dm_xml_handleFilterAttrClass(dm_xml_Context* const con, char const * const value)
+{
+    DM_XML_RET      ret     = DM_XML_RET_OK;
+    unsigned long   valueUL = 0;
+
+    DM_XML_VALIDATE_PTR(con);
+    DM_XML_VALIDATE_PTR(value);
+
+    valueUL = dm_xml_getDataValue(value);
+
+    if (0x1ff >= valueUL)
+    {
+        con->dmStorage[con->index].classFilter = (uint8_t)(valueUL & 0xff);
+
+        if (0 != (valueUL & 0x100))
+        {
+            con->dmStorage[con->index].flags |= VSCP_DM_FLAG_CLASS_FILTER_BIT8;
+        }
+    }
+    else
+    {
+        LOG_ERROR_INT32("Attribute class out of range at line", XML_GetCurrentLineNumber(con->xmlParser));
+
+        ret = DM_XML_RET_ERROR;
+    }
+
+    return ret;
+}
+
+/**
+ * This function handles the "type" attribute of the FILTER element.
+ *
+ * @param[in]   con     Parser context
+ * @param[in]   value   Attribute value
+ * @return Status
+ */
+static DM_XML_RET dm_xml_handleFilterAttrType(dm_xml_Context* const con, char const * const value)
+{
+    DM_XML_RET      ret     = DM_XML_RET_OK;
+    unsigned long   valueUL = 0;
+
+    DM_XML_VALIDATE_PTR(con);
+    DM_XML_VALIDATE_PTR(value);
+
+    valueUL = dm_xml_getDataValue(value);
+
+    if (0xff >= valueUL)
+    {
+        con->dmStorage[con->index].typeFilter = valueUL;
+    }
+    else
+    {
+        LOG_ERROR_INT32("Attribute type out of range at line", XML_GetCurrentLineNumber(con->xmlParser));
+
+        ret = DM_XML_RET_ERROR;
+    }
+
+    return ret;
+}
+
+/**
+ * This function handles the "enabled" attribute of the ZONE element.
+ *
+ * @param[in]   con     Parser context
+ * @param[in]   value   Attribute value
+ * @return Status
+ */
+static DM_XML_RET dm_xml_handleZoneAttrEnabled(dm_xml_Context* const con, char const * const value)
+{
+    return dm_xml_setRowFlag(con, value, VSCP_DM_FLAG_MATCH_ZONE);
+}
+
+/**
+ * This function handles the "enabled" attribute of the SUBZONE element.
+ *
+ * @param[in]   con     Parser context
+ * @param[in]   value   Attribute value
+ * @return Status
+ */
+static DM_XML_RET dm_xml_handleSubZoneAttrEnabled(dm_xml_Context* const con, char const * const value)
+{
+    return dm_xml_setRowFlag(con, value, VSCP_DM_FLAG_MATCH_SUB_ZONE);
+}
+
+/**
+ * This function handle the end of the OADDR element.
+ *
+ * @param[in]   con Parser context
+ * @return Status
+ */
+static DM_XML_RET dm_xml_handleOAddrEnd(dm_xml_Context* const con)
+{
+    DM_XML_VALIDATE_PTR(con);
+
+    return dm_xml_getTextByte(con, &con->dmStorage[con->index].oaddr);
+}
+
+/**
+ * This function handle the end of the ACTION element.
+ *
+ * @param[in]   con Parser context
+ * @return Status
+ */
+static DM_XML_RET dm_xml_handleActionEnd(dm_xml_Context* const con)
+{
+    DM_XML_RET  ret     = DM_XML_RET_OK;
+    uint8_t     value   = 0;
+
+    DM_XML_VALIDATE_PTR(con);
+
+    ret = dm_xml_getTextByte(con, &value);
+
+    if (DM_XML_RET_OK == ret)
+    {
+        /* Standard decision matrix? */
+        if (FALSE == dm_xml_isExtRow(con))
+        {
+            con->dmStorage[con->index].action = value;
+        }
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION )
+        /* Extended decision matrix */
+        else
+        {
+            con->extStorage[con->index].action = value;
+        }
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION ) */
+    }
+
+    return ret;
+}
+
+/**
+ * This function handle the end of the PARAM element.
+ *
+ * @param[in]   con Parser context
+ * @return Status
+ */
+static DM_XML_RET dm_xml_handleParamEnd(dm_xml_Context* const con)
+{
+    DM_XML_RET  ret     = DM_XML_RET_OK;
+    uint8_t     value   = 0;
+
+    DM_XML_VALIDATE_PTR(con);
+
+    ret = dm_xml_getTextByte(con, &value);
+
+    if (DM_XML_RET_OK == ret)
+    {
+        /* Standard decision matrix? */
+        if (FALSE == dm_xml_isExtRow(con))
+        {
+            con->dmStorage[con->index].actionPar = value;
+        }
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION )
+        /* Extended decision matrix */
+        else
+        {
+            con->extStorage[con->index].actionPar = value;
+        }
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION ) */
+    }
+
+    return ret;
+}
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION )
+
+/**
+ * This function handles the "type" attribute of the ROW element.
+ *
+ * @param[in]   con     Parser context
+ * @param[in]   value   Attribute value
+ * @return Status
+ */
+static DM_XML_RET dm_xml_handleRowAttrType(dm_xml_Context* const con, char const * const value)
+{
+    DM_XML_RET ret = DM_XML_RET_OK;
+
+    DM_XML_VALIDATE_PTR(con);
+    DM_XML_VALIDATE_PTR(value);
+
+    if (0 == dm_xml_strcmpi(value, "std"))
+    {
+        con->dmStorage[con->index].action = VSCP_DM_ACTION_NO_OPERATION;
+    }
+    else if (0 == dm_xml_strcmpi(value, "ext"))
+    {
+        /* Extend the standard decision matrix row */
+        con->dmStorage[con->index].action = VSCP_DM_ACTION_EXTENDED_DM;
+    }
+    else
+    {
+        LOG_ERROR_INT32("Attribute type is invalid line", XML_GetCurrentLineNumber(con->xmlParser));
+
+        ret = DM_XML_RET_ERROR;
+    }
+
+    return ret;
+}
+
+/**
+ * This function handle the end of the ZONE element.
+ * The value is ignored in case of a standard row.
+ *
+ * @param[in]   con Parser context
+ * @return Status
+ */
+static DM_XML_RET dm_xml_handleZoneEnd(dm_xml_Context* const con)
+{
+    DM_XML_RET  ret     = DM_XML_RET_OK;
+    uint8_t     value   = 0;
+
+    DM_XML_VALIDATE_PTR(con);
+
+    ret = dm_xml_getTextByte(con, &value);
+
+    if ((DM_XML_RET_OK == ret) &&
+        (TRUE == dm_xml_isExtRow(con)))
+    {
+        con->extStorage[con->index].zone = value;
+    }
+
+    return ret;
+}
+
+/**
+ * This function handle the end of the SUBZONE element.
+ * The value is ignored in case of a standard row.
+ *
+ * @param[in]   con Parser context
+ * @return Status
+ */
+static DM_XML_RET dm_xml_handleSubZoneEnd(dm_xml_Context* const con)
+{
+    DM_XML_RET  ret     = DM_XML_RET_OK;
+    uint8_t     value   = 0;
+
+    DM_XML_VALIDATE_PTR(con);
+
+    ret = dm_xml_getTextByte(con, &value);
+
+    if ((DM_XML_RET_OK == ret) &&
+        (TRUE == dm_xml_isExtRow(con)))
+    {
+        con->extStorage[con->index].subZone = value;
+    }
+
+    return ret;
+}
+
+/**
+ * This function handle the end of the BYTE element.
+ *
+ * @param[in]   con Parser context
+ * @return Status
+ */
+static DM_XML_RET dm_xml_handleByteEnd(dm_xml_Context* const con)
+{
+    DM_XML_RET  ret     = DM_XML_RET_OK;
+    uint8_t     value   = 0;
+
+    DM_XML_VALIDATE_PTR(con);
+
+    ret = dm_xml_getTextByte(con, &value);
+
+    if (DM_XML_RET_OK == ret)
+    {
+        switch(con->id)
+        {
+        case 0:
+            con->extStorage[con->index].par0 = value;
+            break;
+
+        case 3:
+            con->extStorage[con->index].par3 = value;
+            break;
+
+        case 4:
+            con->extStorage[con->index].par4 = value;
+            break;
+
+        case 5:
+            con->extStorage[con->index].par5 = value;
+            break;
+
+        default:
+            LOG_ERROR_INT32("Attribute id invalid at line", XML_GetCurrentLineNumber(con->xmlParser));
+            ret = DM_XML_RET_ERROR;
+            break;
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * This function handles the "enabled" attribute of the BYTE element.
+ *
+ * @param[in]   con     Parser context
+ * @param[in]   value   Attribute value
+ * @return Status
+ */
+static DM_XML_RET dm_xml_handleByteAttrEnabled(dm_xml_Context* const con, char const * const value)
+{
+    DM_XML_RET  ret     = DM_XML_RET_OK;
+    BOOL        state   = FALSE;
+    uint8_t     flag    = 0;
+
+    DM_XML_VALIDATE_PTR(con);
+    DM_XML_VALIDATE_PTR(value);
+
+    switch(con->id)
+    {
+    case 0:
+        flag = VSCP_DM_EXTFLAG_MATCH_PAR_0;
+        break;
+
+    case 3:
+        flag = VSCP_DM_EXTFLAG_MATCH_PAR_3;
+        break;
+
+    case 4:
+        flag = VSCP_DM_EXTFLAG_MATCH_PAR_4;
+        break;
+
+    case 5:
+        flag = VSCP_DM_EXTFLAG_MATCH_PAR_5;
+        break;
+
+    default:
+        break;
+    }
+
+    if (0 == flag)
+    {
+        LOG_ERROR_INT32("Attribute id invalid at line", XML_GetCurrentLineNumber(con->xmlParser));
+
+        ret = DM_XML_RET_ERROR;
+    }
+    else
+    {
+        ret = dm_xml_getBool(con, value, &state);
+    }
+
+    if (DM_XML_RET_OK == ret)
+    {
+        if (TRUE == state)
+        {
+            con->dmStorage[con->index].actionPar |= flag;
+        }
+        else
+        {
+            con->dmStorage[con->index].actionPar &= ~flag;
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * This function handles the "id" attribute of the BYTE element.
+ *
+ * @param[in]   con     Parser context
+ * @param[in]   value   Attribute value
+ * @return Status
+ */
+static DM_XML_RET dm_xml_handleByteAttrId(dm_xml_Context* const con, char const * const value)
+{
+    DM_XML_RET      ret     = DM_XML_RET_OK;
+    unsigned long   valueUL = 0;
+
+    DM_XML_VALIDATE_PTR(con);
+    DM_XML_VALIDATE_PTR(value);
+
+    valueUL = dm_xml_getDataValue(value);
+
+    if ((0 == valueUL) ||
+        ((3 <= valueUL) && (5 >= valueUL)))
+    {
+        con->id = valueUL;
+    }
+    else
+    {
+        LOG_ERROR_INT32("Attribute id out of range at line", XML_GetCurrentLineNumber(con->xmlParser));
+
+        ret = DM_XML_RET_ERROR;
+    }
+
+    return ret;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION ) */
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) */
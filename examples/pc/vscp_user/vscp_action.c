@@ -48,6 +48,8 @@
 #include "log.h"
 #include "vscp_information.h"
 #include "lamp_sim.h"
+#include "node_trace.h"
+#include "replay.h"
 #include "vscp_class_l1.h"
 #include "vscp_type_control.h"
 
@@ -122,6 +124,9 @@ static void vscp_action_dimLamp(uint8_t par, vscp_RxMessage const * const msg);
     LOCAL VARIABLES
 *******************************************************************************/
 
+/** Number of executed actions */
+static uint32_t vscp_action_executedCnt = 0;
+
 /*******************************************************************************
     GLOBAL VARIABLES
 *******************************************************************************/
@@ -149,6 +154,12 @@ extern void vscp_action_init(void)
  */
 extern void vscp_action_execute(uint8_t action, uint8_t par, vscp_RxMessage const * const msg)
 {
+    ++vscp_action_executedCnt;
+
+    LOG_DEBUG_UINT32("Execute action:", action);
+    node_trace_action(action, par, msg);
+    replay_traceAction(action, par);
+
     switch(action)
     {
     case VSCP_ACTION_NO_OPERATION:
@@ -181,6 +192,16 @@ extern void vscp_action_execute(uint8_t action, uint8_t par, vscp_RxMessage cons
     return;
 }
 
+/**
+ * This function returns the number of executed actions.
+ *
+ * @return Number of executed actions
+ */
+extern uint32_t vscp_action_getExecutedCnt(void)
+{
+    return vscp_action_executedCnt;
+}
+
 /*******************************************************************************
     LOCAL FUNCTIONS
 *******************************************************************************/
@@ -109,6 +109,13 @@ extern void vscp_action_init(void);
  */
 extern void vscp_action_execute(uint8_t action, uint8_t par, vscp_RxMessage const * const msg);
 
+/**
+ * This function returns the number of executed actions.
+ *
+ * @return Number of executed actions
+ */
+extern uint32_t vscp_action_getExecutedCnt(void);
+
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) || VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
 
 #ifdef __cplusplus
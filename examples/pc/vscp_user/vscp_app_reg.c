@@ -44,6 +44,7 @@
 #include "vscp_types.h"
 #include "vscp_ps.h"
 #include "vscp_config.h"
+#include "vscp_interest.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -415,6 +416,13 @@ extern uint8_t  vscp_app_reg_writeRegister(uint16_t page, uint8_t addr, uint8_t
         {
             vscp_ps_writeDMNextGeneration(addr - VSCP_APP_REG_PAGE_2_OFFSET_DM_NG, value);
             readBackValue = vscp_ps_readDMNextGeneration(addr - VSCP_APP_REG_PAGE_2_OFFSET_DM_NG);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST )
+
+            /* The rule set changed, which may change the event interest too. */
+            vscp_interest_invalidate();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST ) */
         }
     }
 
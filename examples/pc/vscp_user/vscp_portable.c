@@ -49,10 +49,13 @@
 #include "vscp_class_l1.h"
 #include "vscp_type_information.h"
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include "eeprom.h"
 #include "log.h"
 #include "dm_std_xml.h"
 #include "dm_ext_xml.h"
+#include "dm_bin.h"
 #include "vscp_bootloader.h"
 
 /*******************************************************************************
@@ -63,6 +66,15 @@
     CONSTANTS
 *******************************************************************************/
 
+/** Compiled decision matrix file name */
+#define VSCP_PORTABLE_DM_BIN_FILENAME   "dm.bin"
+
+/** Standard decision matrix xml file name */
+#define VSCP_PORTABLE_DM_STD_FILENAME   "dmStd.xml"
+
+/** Extended decision matrix xml file name */
+#define VSCP_PORTABLE_DM_EXT_FILENAME   "dmExt.xml"
+
 /*******************************************************************************
     MACROS
 *******************************************************************************/
@@ -79,7 +91,7 @@
 
 #if VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION )
 
-static void vscp_portable_loadDMStd(void);
+static BOOL vscp_portable_loadDMStd(uint8_t * const ps);
 
 #endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION ) */
 
@@ -87,10 +99,14 @@ static void vscp_portable_loadDMStd(void);
 
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION )
 
-static void vscp_portable_loadDMExt(void);
+static BOOL vscp_portable_loadDMExt(uint8_t * const ps);
 
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION ) */
 
+static BOOL vscp_portable_loadDMXml(uint8_t * const ps);
+static BOOL vscp_portable_isDMBinOutdated(void);
+static void vscp_portable_getDMRegions(uint8_t * const ps, dm_bin_Region * const regions);
+
 /*******************************************************************************
     LOCAL VARIABLES
 *******************************************************************************/
@@ -143,6 +159,8 @@ extern void vscp_portable_init(void)
     dm_ext_xml_init();
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION ) */
 
+    dm_bin_init();
+
     return;
 }
 
@@ -151,50 +169,96 @@ extern void vscp_portable_init(void)
  */
 extern void vscp_portable_restoreFactoryDefaultSettings(void)
 {
-#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION )
-
-    uint8_t*    dmNG    = NULL;
-    uint8_t     index   = 0;
-    uint8_t*    ps      = eeprom_getBase(NULL);
-
-#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
+    uint8_t*        ps  = eeprom_getBase(NULL);
+    dm_bin_Region   regions[DM_BIN_SECTION_NUM];
+    DM_BIN_RET      ret = DM_BIN_RET_OK;
 
     log_printf("Restore application factory default settings.\n");
 
-#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM )
+    if (NULL == ps)
+    {
+        LOG_ERROR("Couldn't get EEPROM base address.");
+        return;
+    }
 
-#if VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION )
+    /* The decision matrix is written via the EEPROM base address. */
+    eeprom_markDirty();
 
-    vscp_portable_loadDMStd();
+    /* A compiled decision matrix is copied without parsing, therefore it is
+     * preferred, as long as it is not older than the decision matrix xml
+     * file. Otherwise the decision matrix xml files are loaded.
+     */
+    if (FALSE != vscp_portable_isDMBinOutdated())
+    {
+        log_printf("%s is older than the decision matrix xml file and skipped. Compile it again.\n", VSCP_PORTABLE_DM_BIN_FILENAME);
+        ret = DM_BIN_RET_EFILE;
+    }
+    else
+    {
+        vscp_portable_getDMRegions(ps, regions);
+        ret = dm_bin_load(VSCP_PORTABLE_DM_BIN_FILENAME, regions, DM_BIN_SECTION_NUM);
+    }
 
-#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION ) */
+    if (DM_BIN_RET_OK == ret)
+    {
+        LOG_INFO("Compiled decision matrix file successful loaded.");
+    }
+    else
+    {
+        if (DM_BIN_RET_EFILE != ret)
+        {
+            LOG_ERROR("Compiled decision matrix file is invalid.");
+        }
 
-#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) */
+        (void)vscp_portable_loadDMXml(ps);
+    }
 
-#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION )
+    return;
+}
 
-    vscp_portable_loadDMExt();
+/**
+ * This function compiles the decision matrix xml files and the decision matrix
+ * next generation rule set to a compiled decision matrix file. The EEPROM
+ * is not changed.
+ *
+ * @param[in]   fileName    Compiled decision matrix file name
+ * @return Status
+ * @retval FALSE    Failed
+ * @retval TRUE     Successful
+ */
+extern BOOL vscp_portable_compileDM(char const * const fileName)
+{
+    BOOL            status  = FALSE;
+    uint8_t*        ps      = NULL;
+    dm_bin_Region   regions[DM_BIN_SECTION_NUM];
 
-#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION ) */
+    if (NULL == fileName)
+    {
+        return FALSE;
+    }
 
-#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION )
+    /* Load the decision matrix to a separate persistent memory image. */
+    ps = (uint8_t*)calloc(VSCP_PS_ADDR_NEXT, 1);
 
     if (NULL == ps)
     {
-        LOG_ERROR("Couldn't get EEPROM base address.");
-        return;
+        return FALSE;
     }
 
-    dmNG = &ps[VSCP_PS_ADDR_DM_NEXT_GENERATION];
-
-    for(index = 0; index < sizeof(vscp_portable_ruleSet); ++index)
+    if (TRUE == vscp_portable_loadDMXml(ps))
     {
-        dmNG[index] = vscp_portable_ruleSet[index];
+        vscp_portable_getDMRegions(ps, regions);
+
+        if (DM_BIN_RET_OK == dm_bin_save(fileName, regions, DM_BIN_SECTION_NUM))
+        {
+            status = TRUE;
+        }
     }
 
-#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
+    free(ps);
+    ps = NULL;
 
-    return;
+    return status;
 }
 
 /**
@@ -421,6 +485,21 @@ extern BOOL vscp_portable_sendNodeHeartbeatEvent() {
 
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CUSTOM_HEARTBEAT ) */
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST_RESPONSE )
+
+/**
+ * This function is called while the event interest is built. Add the classes
+ * and types, the application is interested in, via vscp_interest_add().
+ */
+extern void vscp_portable_addEventInterest(void)
+{
+    /* Implement your code here ... */
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST_RESPONSE ) */
+
 /*******************************************************************************
     LOCAL FUNCTIONS
 *******************************************************************************/
@@ -431,27 +510,21 @@ extern BOOL vscp_portable_sendNodeHeartbeatEvent() {
 
 /**
  * This function loads a standard decision matrix xml file.
+ *
+ * @param[in]   ps  Persistent memory image
+ * @return If the file is available and valid, it will return TRUE otherwise FALSE.
  */
-static void vscp_portable_loadDMStd(void)
+static BOOL vscp_portable_loadDMStd(uint8_t * const ps)
 {
-    uint8_t*            ps      = eeprom_getBase(NULL);
     DM_STD_XML_RET      ret     = DM_STD_XML_RET_OK;
-    vscp_dm_MatrixRow*  dm      = NULL;
-
-    if (NULL == ps)
-    {
-        LOG_ERROR("Couldn't get EEPROM base address.");
-        return;
-    }
-
-    dm = (vscp_dm_MatrixRow*)&ps[VSCP_PS_ADDR_DM];
+    vscp_dm_MatrixRow*  dm      = (vscp_dm_MatrixRow*)&ps[VSCP_PS_ADDR_DM];
 
     /* If a decision matrix file is available, load it and configure the internal
      * decision matrix with the content.
      *
      * Otherwise the decision matrix will be empty.
      */
-    ret = dm_std_xml_load("dmStd.xml", dm, VSCP_CONFIG_DM_ROWS);
+    ret = dm_std_xml_load(VSCP_PORTABLE_DM_STD_FILENAME, dm, VSCP_CONFIG_DM_ROWS);
 
     if (ret == DM_STD_XML_RET_EFILE)
     {
@@ -466,7 +539,7 @@ static void vscp_portable_loadDMStd(void)
         LOG_INFO("Standard decision matrix xml file successful loaded.");
     }
 
-    return;
+    return (DM_STD_XML_RET_OK == ret) ? TRUE : FALSE;
 }
 
 #endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION ) */
@@ -477,30 +550,22 @@ static void vscp_portable_loadDMStd(void)
 
 /**
  * This function loads a extended decision matrix xml file.
+ *
+ * @param[in]   ps  Persistent memory image
+ * @return If the file is available and valid, it will return TRUE otherwise FALSE.
  */
-static void vscp_portable_loadDMExt(void)
+static BOOL vscp_portable_loadDMExt(uint8_t * const ps)
 {
-    uint8_t*            ps      = eeprom_getBase(NULL);
     DM_EXT_XML_RET      ret     = DM_EXT_XML_RET_OK;
-    vscp_dm_MatrixRow*  dm      = NULL;
-    vscp_dm_ExtRow*     dmExt   = NULL;
-
-    if (NULL == ps)
-    {
-        LOG_ERROR("Couldn't get EEPROM base address.");
-        return;
-    }
-
-    dm = (vscp_dm_MatrixRow*)&ps[VSCP_PS_ADDR_DM];
-
-    dmExt = (vscp_dm_ExtRow*)&ps[VSCP_PS_ADDR_DM_EXTENSION];
+    vscp_dm_MatrixRow*  dm      = (vscp_dm_MatrixRow*)&ps[VSCP_PS_ADDR_DM];
+    vscp_dm_ExtRow*     dmExt   = (vscp_dm_ExtRow*)&ps[VSCP_PS_ADDR_DM_EXTENSION];
 
     /* If a extended decision matrix file is available, load it and configure the internal
      * decision matrix with the content.
      *
      * Otherwise the decision matrix will be empty.
      */
-    ret = dm_ext_xml_load("dmExt.xml", dm, dmExt, VSCP_CONFIG_DM_ROWS);
+    ret = dm_ext_xml_load(VSCP_PORTABLE_DM_EXT_FILENAME, dm, dmExt, VSCP_CONFIG_DM_ROWS);
 
     if (ret == DM_EXT_XML_RET_EFILE)
     {
@@ -515,7 +580,131 @@ static void vscp_portable_loadDMExt(void)
         LOG_INFO("Extended decision matrix xml file successful loaded.");
     }
 
+    return (DM_EXT_XML_RET_OK == ret) ? TRUE : FALSE;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION ) */
+
+/**
+ * This function loads the decision matrix xml files and the decision matrix
+ * next generation rule set.
+ *
+ * @param[in]   ps  Persistent memory image
+ * @return If all decision matrix xml files are available and valid, it will return TRUE otherwise FALSE.
+ */
+static BOOL vscp_portable_loadDMXml(uint8_t * const ps)
+{
+    BOOL    status  = TRUE;
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION )
+
+    uint8_t*    dmNG    = &ps[VSCP_PS_ADDR_DM_NEXT_GENERATION];
+    uint8_t     index   = 0;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM )
+
+#if VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION )
+
+    status = vscp_portable_loadDMStd(ps);
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION ) */
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION )
+
+    status = vscp_portable_loadDMExt(ps);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION )
+
+    for(index = 0; index < sizeof(vscp_portable_ruleSet); ++index)
+    {
+        dmNG[index] = vscp_portable_ruleSet[index];
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
+
+    return status;
+}
+
+/**
+ * This function determines the decision matrix regions in the persistent memory
+ * image. The region index is the compiled decision matrix section id.
+ *
+ * @param[in]   ps      Persistent memory image
+ * @param[out]  regions Regions (DM_BIN_SECTION_NUM)
+ */
+static void vscp_portable_getDMRegions(uint8_t * const ps, dm_bin_Region * const regions)
+{
+    memset(regions, 0, sizeof(dm_bin_Region) * DM_BIN_SECTION_NUM);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM )
+
+    regions[DM_BIN_SECTION_DM].data     = &ps[VSCP_PS_ADDR_DM];
+    regions[DM_BIN_SECTION_DM].size     = VSCP_PS_SIZE_DM;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION )
+
+    regions[DM_BIN_SECTION_DM_EXT].data = &ps[VSCP_PS_ADDR_DM_EXTENSION];
+    regions[DM_BIN_SECTION_DM_EXT].size = VSCP_PS_SIZE_DM_EXTENSION;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION )
+
+    regions[DM_BIN_SECTION_DM_NG].data  = &ps[VSCP_PS_ADDR_DM_NEXT_GENERATION];
+    regions[DM_BIN_SECTION_DM_NG].size  = VSCP_PS_SIZE_DM_NEXT_GENERATION;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
+
     return;
 }
 
+/**
+ * This function checks whether the compiled decision matrix file is older than
+ * the decision matrix xml file, it was compiled from. If one of the files
+ * doesn't exist, it is not outdated.
+ *
+ * @return Outdated or not
+ * @retval FALSE    Not outdated
+ * @retval TRUE     Outdated
+ */
+static BOOL vscp_portable_isDMBinOutdated(void)
+{
+    BOOL        isOutdated  = FALSE;
+    char const* xmlFileName = NULL;
+    time_t      binTime     = 0;
+    time_t      xmlTime     = 0;
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM )
+
+#if VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION )
+
+    xmlFileName = VSCP_PORTABLE_DM_STD_FILENAME;
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION ) */
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION )
+
+    xmlFileName = VSCP_PORTABLE_DM_EXT_FILENAME;
+
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION ) */
+
+    if ((NULL != xmlFileName) &&
+        (0 == platform_getFileTime(VSCP_PORTABLE_DM_BIN_FILENAME, &binTime)) &&
+        (0 == platform_getFileTime(xmlFileName, &xmlTime)) &&
+        (binTime < xmlTime))
+    {
+        isOutdated = TRUE;
+    }
+
+    return isOutdated;
+}
@@ -229,6 +229,28 @@ extern BOOL vscp_portable_sendNodeHeartbeatEvent();
 
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CUSTOM_HEARTBEAT ) */
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST_RESPONSE )
+
+/**
+ * This function is called while the event interest is built. Add the classes
+ * and types, the application is interested in, via vscp_interest_add().
+ */
+extern void vscp_portable_addEventInterest(void);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST_RESPONSE ) */
+
+/**
+ * This function compiles the decision matrix xml files and the decision matrix
+ * next generation rule set to a compiled decision matrix file. The EEPROM
+ * is not changed.
+ *
+ * @param[in]   fileName    Compiled decision matrix file name
+ * @return Status
+ * @retval FALSE    Failed
+ * @retval TRUE     Successful
+ */
+extern BOOL vscp_portable_compileDM(char const * const fileName);
+
 #ifdef __cplusplus
 }
 #endif
@@ -48,6 +48,8 @@
 #include "vscp_class_l1.h"
 #include "vscp_class_l1_l2.h"
 #include "vscp_util.h"
+#include "node_trace.h"
+#include "replay.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -69,6 +71,9 @@
 /** Daemon wait time after a command was executed in ms */
 #define VSCP_TP_ADAPTER_CMD_WAIT_TIME       250
 
+/** Number of simulated received messages, which can be queued. */
+#define VSCP_TP_ADAPTER_SIM_RX_NUM          32
+
 /*******************************************************************************
     MACROS
 *******************************************************************************/
@@ -99,11 +104,17 @@ static const char* vscp_tp_adapter_getErrorStr(int value);
     LOCAL VARIABLES
 *******************************************************************************/
 
-/** Flag which signals that a message is received. */
-static BOOL                     vscp_tp_adapter_messageReceived  = FALSE;
+/** Queue of simulated received messages */
+static vscp_RxMessage           vscp_tp_adapter_rxMessages[VSCP_TP_ADAPTER_SIM_RX_NUM];
+
+/** Read index of the simulated received messages queue */
+static uint8_t                  vscp_tp_adapter_rxReadIndex     = 0;
 
-/** Receive message */
-static vscp_RxMessage           vscp_tp_adapter_rxMessage;
+/** Number of queued simulated received messages */
+static uint8_t                  vscp_tp_adapter_rxNum           = 0;
+
+/** Number of successful sent messages */
+static uint32_t                 vscp_tp_adapter_txCnt           = 0;
 
 /** Network client parameter */
 static vscp_tp_adapter_NetPar   vscp_tp_adapter_clientPar;
@@ -311,11 +322,13 @@ extern BOOL vscp_tp_adapter_readMessage(vscp_RxMessage * const msg)
             }
         }
         /* Any simulated message available? */
-        else if (TRUE == vscp_tp_adapter_messageReceived)
+        else if (0 < vscp_tp_adapter_rxNum)
         {
-            *msg = vscp_tp_adapter_rxMessage;
+            *msg = vscp_tp_adapter_rxMessages[vscp_tp_adapter_rxReadIndex];
 
-            vscp_tp_adapter_messageReceived = FALSE;
+            ++vscp_tp_adapter_rxReadIndex;
+            vscp_tp_adapter_rxReadIndex %= VSCP_TP_ADAPTER_SIM_RX_NUM;
+            --vscp_tp_adapter_rxNum;
 
             status = TRUE;
         }
@@ -323,6 +336,8 @@ extern BOOL vscp_tp_adapter_readMessage(vscp_RxMessage * const msg)
         if (FALSE != status)
         {
             vscp_tp_adapter_showMessage(msg, TRUE);
+            node_trace_message(msg, TRUE);
+            replay_traceMessage(msg, TRUE);
         }
     }
 
@@ -399,7 +414,10 @@ extern BOOL vscp_tp_adapter_writeMessage(vscp_TxMessage const * const msg)
 
         if (FALSE != status)
         {
+            ++vscp_tp_adapter_txCnt;
             vscp_tp_adapter_showMessage(msg, FALSE);
+            node_trace_message(msg, FALSE);
+            replay_traceMessage(msg, FALSE);
         }
     }
 
@@ -654,15 +672,85 @@ extern void vscp_tp_adapter_disconnect(void)
 }
 
 /**
- * This function simulates a received message.
+ * This function simulates a received message. The message is queued and
+ * read in the order of simulation.
  *
  * @param[in]   msg Received message
+ * @return  Message queued or not
+ * @retval  FALSE   Queue is full
+ * @retval  TRUE    Message queued
  */
-extern void vscp_tp_adapter_simulateReceivedMessage(vscp_RxMessage const * const msg)
+extern BOOL vscp_tp_adapter_simulateReceivedMessage(vscp_RxMessage const * const msg)
 {
-    vscp_tp_adapter_rxMessage        = *msg;
-    vscp_tp_adapter_messageReceived  = TRUE;
-    return;
+    uint8_t writeIndex  = 0;
+
+    if ((NULL == msg) ||
+        (VSCP_TP_ADAPTER_SIM_RX_NUM <= vscp_tp_adapter_rxNum))
+    {
+        return FALSE;
+    }
+
+    writeIndex = (vscp_tp_adapter_rxReadIndex + vscp_tp_adapter_rxNum) % VSCP_TP_ADAPTER_SIM_RX_NUM;
+
+    vscp_tp_adapter_rxMessages[writeIndex] = *msg;
+    ++vscp_tp_adapter_rxNum;
+
+    return TRUE;
+}
+
+/**
+ * This function returns the number of simulated received messages, which
+ * are not read yet.
+ *
+ * @return Number of pending messages
+ */
+extern uint8_t vscp_tp_adapter_getSimulatedRxNum(void)
+{
+    return vscp_tp_adapter_rxNum;
+}
+
+/**
+ * This function returns the number of successful sent messages.
+ *
+ * @return Number of sent messages
+ */
+extern uint32_t vscp_tp_adapter_getTxCnt(void)
+{
+    return vscp_tp_adapter_txCnt;
+}
+
+/**
+ * This function converts a daemon event to a received message. Level 1
+ * events and level 1 events over level 2 are supported.
+ *
+ * @param[out]  msg         Received message
+ * @param[in]   daemonEvent Daemon event
+ * @return  Successful or not
+ * @retval  FALSE   Unsupported event
+ * @retval  TRUE    Successful converted
+ */
+extern BOOL vscp_tp_adapter_convertEvent(vscp_RxMessage * const msg, vscpEventEx const * const daemonEvent)
+{
+    BOOL    isError = TRUE;
+
+    if ((NULL == msg) ||
+        (NULL == daemonEvent))
+    {
+        return FALSE;
+    }
+
+    /* Level 1 event? */
+    if (VSCP_CLASS_L1_L2_BASE > daemonEvent->vscp_class)
+    {
+        isError = vscp_tp_adapter_handleL1Event(msg, daemonEvent);
+    }
+    /* Level 1 over level 2 event? */
+    else if (VSCP_TP_ADAPTER_CLASS_L2_BASE > daemonEvent->vscp_class)
+    {
+        isError = vscp_tp_adapter_handleL1OverL2Event(msg, daemonEvent);
+    }
+
+    return (FALSE == isError) ? TRUE : FALSE;
 }
 
 /*******************************************************************************
@@ -788,41 +876,50 @@ static BOOL vscp_tp_adapter_handleL1OverL2Event(vscp_RxMessage * const msg, vscp
  */
 static void vscp_tp_adapter_showMessage(vscp_Message const * const msg, BOOL isReceived)
 {
-    uint8_t index = 0;
+    uint8_t         index       = 0;
+    char            dataStr[3 * VSCP_L1_DATA_SIZE + 1];
+    size_t          dataStrLen  = 0;
+    char const *    typeSep     = "";
+    char const *    typeStr     = "";
 
-    log_printf("%cx: class=0x%04X type=0x%02X prio=%2d oAddr=0x%02X %c num=%u data=",
-        (TRUE == isReceived) ? 'R' : 'T',
-        msg->vscpClass,
-        msg->vscpType,
-        msg->priority,
-        msg->oAddr,
-        (FALSE == msg->hardCoded) ? '-' : 'h',
-        msg->dataNum);
+    /* The whole message is logged at once, to avoid that it is torn apart by
+     * other log messages.
+     */
+    dataStr[0] = '\0';
 
     for(index = 0; index < msg->dataNum; ++index)
     {
-        printf("%02X", msg->data[index]);
-
-        if ((index + 1) < msg->dataNum)
-        {
-            printf(" ");
-        }
+        dataStrLen += snprintf(&dataStr[dataStrLen], sizeof(dataStr) - dataStrLen,
+            ((index + 1) < msg->dataNum) ? "%02X " : "%02X",
+            msg->data[index]);
     }
 
     if ((VSCP_CLASS_L1_PROTOCOL == msg->vscpClass) ||
         (VSCP_CLASS_L1_L2_PROTOCOL == msg->vscpClass))
     {
+        typeSep = " ";
+
         if (VSCP_UTIL_ARRAY_NUM(vscp_tp_adapter_protocolTypes) <= msg->vscpType)
         {
-            printf(" ?");
+            typeStr = "?";
         }
         else
         {
-            printf(" %s", vscp_tp_adapter_protocolTypes[msg->vscpType]);
+            typeStr = vscp_tp_adapter_protocolTypes[msg->vscpType];
         }
     }
 
-    printf("\n");
+    log_printf("%cx: class=0x%04X type=0x%02X prio=%2d oAddr=0x%02X %c num=%u data=%s%s%s\n",
+        (TRUE == isReceived) ? 'R' : 'T',
+        msg->vscpClass,
+        msg->vscpType,
+        msg->priority,
+        msg->oAddr,
+        (FALSE == msg->hardCoded) ? '-' : 'h',
+        msg->dataNum,
+        dataStr,
+        typeSep,
+        typeStr);
 
     return;
 }
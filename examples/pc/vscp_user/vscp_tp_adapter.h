@@ -66,6 +66,7 @@ the transport layer of VSCP.
 *******************************************************************************/
 #include <inttypes.h>
 #include "vscp_types.h"
+#include "vscphelperlib.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -159,11 +160,42 @@ extern VSCP_TP_ADAPTER_RET vscp_tp_adapter_connect(char const * const ipAddr, ch
 extern void vscp_tp_adapter_disconnect(void);
 
 /**
- * This function simulates a received message.
+ * This function simulates a received message. The message is queued and
+ * read in the order of simulation.
  *
  * @param[in]   msg Received message
+ * @return  Message queued or not
+ * @retval  FALSE   Queue is full
+ * @retval  TRUE    Message queued
  */
-extern void vscp_tp_adapter_simulateReceivedMessage(vscp_RxMessage const * const msg);
+extern BOOL vscp_tp_adapter_simulateReceivedMessage(vscp_RxMessage const * const msg);
+
+/**
+ * This function returns the number of simulated received messages, which
+ * are not read yet.
+ *
+ * @return Number of pending messages
+ */
+extern uint8_t vscp_tp_adapter_getSimulatedRxNum(void);
+
+/**
+ * This function returns the number of successful sent messages.
+ *
+ * @return Number of sent messages
+ */
+extern uint32_t vscp_tp_adapter_getTxCnt(void);
+
+/**
+ * This function converts a daemon event to a received message. Level 1
+ * events and level 1 events over level 2 are supported.
+ *
+ * @param[out]  msg         Received message
+ * @param[in]   daemonEvent Daemon event
+ * @return  Successful or not
+ * @retval  FALSE   Unsupported event
+ * @retval  TRUE    Successful converted
+ */
+extern BOOL vscp_tp_adapter_convertEvent(vscp_RxMessage * const msg, vscpEventEx const * const daemonEvent);
 
 #ifdef __cplusplus
 }
@@ -142,7 +142,7 @@ extern "C"
 
 #define VSCP_CONFIG_MULTI_MSG_TIMEOUT           ((uint16_t)1000)
 
-#define VSCP_CONFIG_HEARTBEAT_NODE_PERIOD       ((uint16_t)30000)
+#define VSCP_CONFIG_HEARTBEAT_NODE_PERIOD       30000
 
 #define VSCP_CONFIG_DM_PAGE                     1
 
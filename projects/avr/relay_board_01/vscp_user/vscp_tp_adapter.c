@@ -44,6 +44,7 @@
 #include <avr/pgmspace.h>
 #include <util/delay.h>
 #include "can.h"
+#include "vscp_can_codec.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -142,11 +143,7 @@ extern BOOL vscp_tp_adapter_readMessage(vscp_RxMessage * const msg)
                 /* Extended CAN frame? */
                 if (0 != canMsg.flags.extended)
                 {
-                    msg->vscpClass  = (canMsg.id >> 16) & 0x01FF;
-                    msg->vscpType   = (canMsg.id >>  8) & 0x00FF;
-                    msg->oAddr      = (canMsg.id >>  0) & 0x00FF;
-                    msg->hardCoded  = (canMsg.id >> 25) & 0x0001;
-                    msg->priority   = (uint16_t)( (canMsg.id >> 26) & 0x07 );
+                    vscp_can_codec_decodeId(canMsg.id, msg);
                     msg->dataNum    = canMsg.length;
 
                     if (0 < canMsg.length)
@@ -188,11 +185,7 @@ extern BOOL vscp_tp_adapter_writeMessage(vscp_TxMessage const * const msg)
         uint8_t rv          = 0;    /* Return value of CAN driver */
         uint8_t retryCnt    = 0;    /* Retry counter */
 
-        canMsg.id = (((uint32_t)msg->priority)  << 26) |
-                    (((uint32_t)msg->hardCoded) << 25) |
-                    (((uint32_t)msg->vscpClass) << 16) |
-                    (((uint32_t)msg->vscpType)  <<  8) |
-                    msg->oAddr;
+        canMsg.id = vscp_can_codec_encodeId(msg);
 
         canMsg.flags.rtr        = 0;
         canMsg.flags.extended   = 1;
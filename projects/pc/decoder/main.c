@@ -0,0 +1,637 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2019, Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  Main entry point
+@file   main.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module contains the main entry point of the capture file decoder.
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "log.h"
+#include "platform.h"
+#include "cmdLineParser.h"
+#include "capture.h"
+#include "captureIndex.h"
+#include "trace.h"
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Program name */
+#define MAIN_PROG_NAME          "VSCP capture file decoder"
+
+/** Copyright */
+#define MAIN_COPYRIGHT          "(c) 2014 - 2019 Andreas Merkle"
+
+/** Default log level */
+#define MAIN_LOG_LEVEL_DEFAULT  (LOG_LEVEL_FATAL)
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/** Use this macro to state that a variable is not used. */
+#define MAIN_NOT_USED(__var)    (void)(__var)
+
+/** Number of elements in a array */
+#define MAIN_ARRAY_NUM(__array) (sizeof(__array) / sizeof((__array)[0]))
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/** This type contains the information from the command line arguments. */
+typedef struct
+{
+    char const *    progName;       /**< Program name without path */
+    char const *    captureFile;    /**< Capture file name */
+    char const *    traceFile;      /**< Node trace file name */
+    char const *    vscpClass;      /**< VSCP class filter */
+    char const *    nickname;       /**< Nickname filter */
+    char const *    from;           /**< Begin of the time range */
+    char const *    to;             /**< End of the time range */
+    BOOL            showHelp;       /**< Show help to the user */
+    BOOL            verbose;        /**< Verbose output */
+
+} main_CmdLineArgs;
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+static void main_init(void);
+static int main_decode(char const * const fileName);
+static int main_decodeTrace(char const * const fileName);
+static int main_query(char const * const fileName);
+static BOOL main_parseQuery(captureIndex_Query * const query, uint64_t startTime);
+static BOOL main_parseNumber(char const * const str, uint32_t max, uint32_t * const value);
+static BOOL main_parseTime(char const * const str, uint64_t startTime, BOOL isEnd, uint64_t * const timestamp);
+static CMDLINEPARSER_RET main_clpUnknown(void* const userData, char const * const arg, char const * const par);
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/** Command line argument structure, which is initialized after parsing. */
+static main_CmdLineArgs         main_cmdLineArgs    =
+{
+    NULL,   /* Program name */
+    NULL,   /* Capture file name */
+    NULL,   /* Node trace file name */
+    NULL,   /* VSCP class filter */
+    NULL,   /* Nickname filter */
+    NULL,   /* Begin of the time range */
+    NULL,   /* End of the time range */
+    FALSE,  /* Show help */
+    FALSE   /* Verbose output */
+};
+
+/** Configuration for the command line parser. */
+static const cmdLineParser_Arg  main_clpConfig[]    =
+{
+    /* Special to retrieve the program name without path */
+    { CMDLINEPARSER_PROG_NAME_WP,   &main_cmdLineArgs.progName,     NULL,                       NULL,               NULL,   NULL                    },
+    /* Get every unknown command line argument */
+    { CMDLINEPARSER_UNKONWN,        NULL,                           NULL,                       main_clpUnknown,    NULL,   NULL                    },
+    /* Possible command line arguments */
+    { "-f <file name>",             &main_cmdLineArgs.captureFile,  NULL,                       NULL,               NULL,   "Capture file"          },
+    { "--trace <file name>",        &main_cmdLineArgs.traceFile,    NULL,                       NULL,               NULL,   "Node trace file, recorded by the PC example (-trace)"  },
+    { "-c <class>",                 &main_cmdLineArgs.vscpClass,    NULL,                       NULL,               NULL,   "Show only events of this VSCP class"       },
+    { "-n <nickname>",              &main_cmdLineArgs.nickname,     NULL,                       NULL,               NULL,   "Show only events of this node nickname"    },
+    { "--from <time>",              &main_cmdLineArgs.from,         NULL,                       NULL,               NULL,   "Show only events since [YYYY-MM-DD ]HH:MM[:SS]"    },
+    { "--to <time>",                &main_cmdLineArgs.to,           NULL,                       NULL,               NULL,   "Show only events until [YYYY-MM-DD ]HH:MM[:SS]"    },
+    { "-h --help",                  NULL,                           &main_cmdLineArgs.showHelp, NULL,               NULL,   "Show help"             },
+    { "-v",                         NULL,                           &main_cmdLineArgs.verbose,  NULL,               NULL,   "Increase verbose level"}
+};
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Main entry point.
+ *
+ * @param[in]   argc    Number of arguments
+ * @param[in]   argv    Argument list
+ * @return Program status
+ * @retval  0       Successful
+ * @retval  others  Failed
+ */
+int main(int argc, char* argv[])
+{
+    int status  = 0;
+
+    main_init();
+
+    /* Parse command line arguments */
+    if (CMDLINEPARSER_RET_OK != cmdLineParser_parse(main_clpConfig, MAIN_ARRAY_NUM(main_clpConfig), argc, argv))
+    {
+        status = 1;
+    }
+    /* Show help? */
+    else if (TRUE == main_cmdLineArgs.showHelp)
+    {
+        printf("\n%s\n", MAIN_PROG_NAME);
+        printf("Version: %s (%s)\n", VERSION, BUILDTYPE);
+        printf("%s\n\n", MAIN_COPYRIGHT);
+        printf("Usage: %s <options>\n\n", main_cmdLineArgs.progName);
+        printf("Options:\n");
+        cmdLineParser_show(main_clpConfig, MAIN_ARRAY_NUM(main_clpConfig));
+    }
+    /* Shall a node trace file be decoded? */
+    else if (NULL != main_cmdLineArgs.traceFile)
+    {
+        if (TRUE == main_cmdLineArgs.verbose)
+        {
+            /* Set log level */
+            log_setLevel(LOG_LEVEL_INFO | LOG_LEVEL_DEBUG | LOG_LEVEL_WARNING | LOG_LEVEL_ERROR | LOG_LEVEL_FATAL);
+        }
+
+        status = main_decodeTrace(main_cmdLineArgs.traceFile);
+    }
+    /* Is the capture file missing? */
+    else if (NULL == main_cmdLineArgs.captureFile)
+    {
+        printf("Which capture file shall be decoded?\n");
+        status = 1;
+    }
+    else
+    {
+        if (TRUE == main_cmdLineArgs.verbose)
+        {
+            /* Set log level */
+            log_setLevel(LOG_LEVEL_INFO | LOG_LEVEL_DEBUG | LOG_LEVEL_WARNING | LOG_LEVEL_ERROR | LOG_LEVEL_FATAL);
+        }
+
+        /* Any filter given? */
+        if ((NULL != main_cmdLineArgs.vscpClass) ||
+            (NULL != main_cmdLineArgs.nickname) ||
+            (NULL != main_cmdLineArgs.from) ||
+            (NULL != main_cmdLineArgs.to))
+        {
+            status = main_query(main_cmdLineArgs.captureFile);
+        }
+        else
+        {
+            status = main_decode(main_cmdLineArgs.captureFile);
+        }
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function initializes all relevant modules.
+ */
+static void main_init(void)
+{
+    /* Set log level */
+    log_setLevel(MAIN_LOG_LEVEL_DEFAULT);
+
+    /* Initialize command line parser */
+    cmdLineParser_init();
+
+    return;
+}
+
+/**
+ * This function decodes a capture file and shows all records in the logger
+ * text format on the console.
+ *
+ * @param[in]   fileName    Capture file name
+ * @return Program status
+ * @retval  0       Successful
+ * @retval  others  Failed
+ */
+static int main_decode(char const * const fileName)
+{
+    int             status  = 0;
+    capture_Reader  reader;
+    capture_Record  record;
+    CAPTURE_RET     ret     = capture_openReader(&reader, fileName);
+
+    if (CAPTURE_RET_INVALID == ret)
+    {
+        printf("%s is not a valid capture file.\n", fileName);
+        status = 1;
+    }
+    else if (CAPTURE_RET_OK != ret)
+    {
+        printf("Couldn't open %s.\n", fileName);
+        status = 1;
+    }
+    else
+    {
+        uint32_t    count   = 0;
+
+        while(CAPTURE_RET_OK == capture_read(&reader, &record))
+        {
+            capture_show(&record, reader.startTime);
+            ++count;
+        }
+
+        capture_closeReader(&reader);
+
+        LOG_INFO_UINT32("Number of decoded records:", count);
+    }
+
+    return status;
+}
+
+/**
+ * This function decodes a node trace file and shows all records from the
+ * oldest to the newest on the console.
+ *
+ * @param[in]   fileName    Node trace file name
+ * @return Program status
+ * @retval  0       Successful
+ * @retval  others  Failed
+ */
+static int main_decodeTrace(char const * const fileName)
+{
+    int             status  = 0;
+    trace_Reader    reader;
+    trace_Record    record;
+    TRACE_RET       ret     = trace_openReader(&reader, fileName);
+
+    if (TRACE_RET_INVALID == ret)
+    {
+        printf("%s is not a valid trace file.\n", fileName);
+        status = 1;
+    }
+    else if (TRACE_RET_OK != ret)
+    {
+        printf("Couldn't open %s.\n", fileName);
+        status = 1;
+    }
+    else
+    {
+        uint32_t    count   = 0;
+
+        while(TRACE_RET_OK == trace_read(&reader, &record))
+        {
+            trace_show(&record, reader.startTime);
+            ++count;
+        }
+
+        trace_closeReader(&reader);
+
+        LOG_INFO_UINT32("Number of decoded records:", count);
+    }
+
+    return status;
+}
+
+/**
+ * This function shows all records of a capture file, which match the filters
+ * given on the command line. The capture file index is used to read only the
+ * blocks, which may contain matching records. If the index is missing or
+ * outdated, it will be rebuilt.
+ *
+ * @param[in]   fileName    Capture file name
+ * @return Program status
+ * @retval  0       Successful
+ * @retval  others  Failed
+ */
+static int main_query(char const * const fileName)
+{
+    int                 status      = 0;
+    capture_Reader      reader;
+    capture_Record      record;
+    captureIndex_Index  index;
+    captureIndex_Query  query;
+    captureIndex_List   blocks;
+    uint64_t            recordCnt   = 0;
+    CAPTURE_RET         ret         = capture_openReader(&reader, fileName);
+
+    memset(&blocks, 0, sizeof(blocks));
+
+    if (CAPTURE_RET_INVALID == ret)
+    {
+        printf("%s is not a valid capture file.\n", fileName);
+        return 1;
+    }
+    else if (CAPTURE_RET_OK != ret)
+    {
+        printf("Couldn't open %s.\n", fileName);
+        return 1;
+    }
+
+    if (FALSE == main_parseQuery(&query, reader.startTime))
+    {
+        capture_closeReader(&reader);
+        return 1;
+    }
+
+    if (CAPTURE_RET_OK != capture_getRecordCnt(&reader, &recordCnt))
+    {
+        printf("Couldn't read %s.\n", fileName);
+        capture_closeReader(&reader);
+        return 1;
+    }
+
+    /* Load the index and rebuild it, if it doesn't cover the whole capture. */
+    if ((CAPTURE_RET_OK != captureIndex_load(&index, fileName)) ||
+        (recordCnt != index.recordCnt))
+    {
+        LOG_INFO("Capture index missing or outdated, rebuild it.");
+
+        captureIndex_release(&index);
+
+        if (CAPTURE_RET_OK != captureIndex_build(&index, fileName))
+        {
+            printf("Couldn't build the index of %s.\n", fileName);
+            capture_closeReader(&reader);
+            return 1;
+        }
+
+        if (CAPTURE_RET_OK != captureIndex_save(&index, fileName))
+        {
+            LOG_WARNING("Couldn't write the capture index file.");
+        }
+    }
+
+    if (CAPTURE_RET_OK != captureIndex_find(&index, &query, &blocks))
+    {
+        printf("Query failed.\n");
+        status = 1;
+    }
+    else
+    {
+        uint32_t    blockIdx    = 0;
+        uint32_t    recordIdx   = 0;
+        uint32_t    count       = 0;
+        BOOL        isEnd       = FALSE;
+
+        LOG_INFO_UINT32("Number of candidate blocks:", blocks.num);
+
+        for(blockIdx = 0; (FALSE == isEnd) && (blockIdx < blocks.num); ++blockIdx)
+        {
+            if (CAPTURE_RET_OK != capture_seek(&reader, ((uint64_t)blocks.items[blockIdx]) * CAPTURE_INDEX_BLOCK_SIZE))
+            {
+                printf("Couldn't read %s.\n", fileName);
+                status = 1;
+                break;
+            }
+
+            for(recordIdx = 0; (FALSE == isEnd) && (recordIdx < CAPTURE_INDEX_BLOCK_SIZE); ++recordIdx)
+            {
+                if (CAPTURE_RET_OK != capture_read(&reader, &record))
+                {
+                    isEnd = TRUE;
+                }
+                /* The records are in chronological order, nothing left to find after the time range. */
+                else if (query.to < record.timestamp)
+                {
+                    isEnd = TRUE;
+                }
+                else if (TRUE == captureIndex_isMatch(&query, &record))
+                {
+                    capture_show(&record, reader.startTime);
+                    ++count;
+                }
+            }
+        }
+
+        LOG_INFO_UINT32("Number of matching records:", count);
+    }
+
+    captureIndex_releaseList(&blocks);
+    captureIndex_release(&index);
+    capture_closeReader(&reader);
+
+    return status;
+}
+
+/**
+ * This function sets up the query from the command line arguments.
+ *
+ * @param[out]  query       Query
+ * @param[in]   startTime   Wall clock time of the capture start in s since epoch (UTC)
+ * @return If successful, it will return TRUE otherwise FALSE.
+ */
+static BOOL main_parseQuery(captureIndex_Query * const query, uint64_t startTime)
+{
+    uint32_t    value   = 0;
+
+    captureIndex_initQuery(query);
+
+    if (NULL != main_cmdLineArgs.vscpClass)
+    {
+        if (FALSE == main_parseNumber(main_cmdLineArgs.vscpClass, UINT16_MAX, &value))
+        {
+            printf("Invalid VSCP class %s.\n", main_cmdLineArgs.vscpClass);
+            return FALSE;
+        }
+
+        query->useClass     = TRUE;
+        query->vscpClass    = (uint16_t)value;
+    }
+
+    if (NULL != main_cmdLineArgs.nickname)
+    {
+        if (FALSE == main_parseNumber(main_cmdLineArgs.nickname, UINT8_MAX, &value))
+        {
+            printf("Invalid nickname %s.\n", main_cmdLineArgs.nickname);
+            return FALSE;
+        }
+
+        query->useNickname  = TRUE;
+        query->nickname     = (uint8_t)value;
+    }
+
+    if (NULL != main_cmdLineArgs.from)
+    {
+        if (FALSE == main_parseTime(main_cmdLineArgs.from, startTime, FALSE, &query->from))
+        {
+            printf("Invalid time %s.\n", main_cmdLineArgs.from);
+            return FALSE;
+        }
+    }
+
+    if (NULL != main_cmdLineArgs.to)
+    {
+        if (FALSE == main_parseTime(main_cmdLineArgs.to, startTime, TRUE, &query->to))
+        {
+            printf("Invalid time %s.\n", main_cmdLineArgs.to);
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * This function converts a decimal or hexadecimal (0x prefix) number.
+ *
+ * @param[in]   str     String
+ * @param[in]   max     Max. allowed value
+ * @param[out]  value   Value
+ * @return If successful, it will return TRUE otherwise FALSE.
+ */
+static BOOL main_parseNumber(char const * const str, uint32_t max, uint32_t * const value)
+{
+    char*           end     = NULL;
+    unsigned long   number  = strtoul(str, &end, 0);
+
+    if ((str == end) ||
+        ('\0' != *end) ||
+        (max < number))
+    {
+        return FALSE;
+    }
+
+    *value = (uint32_t)number;
+
+    return TRUE;
+}
+
+/**
+ * This function converts a local time in the format "YYYY-MM-DD HH:MM[:SS]"
+ * or "HH:MM[:SS]" to the time since capture start. Without date, the day of
+ * the capture start is used.
+ *
+ * @param[in]   str         String
+ * @param[in]   startTime   Wall clock time of the capture start in s since epoch (UTC)
+ * @param[in]   isEnd       If TRUE, the end of the given second is used.
+ * @param[out]  timestamp   Time since capture start in us
+ * @return If successful, it will return TRUE otherwise FALSE.
+ */
+static BOOL main_parseTime(char const * const str, uint64_t startTime, BOOL isEnd, uint64_t * const timestamp)
+{
+    time_t      rawtime = (time_t)startTime;
+    struct tm   timeInfo;
+    int         year    = 0;
+    int         month   = 0;
+    int         day     = 0;
+    int         hour    = 0;
+    int         minute  = 0;
+    int         second  = 0;
+    int         num     = 0;
+    time_t      value   = 0;
+
+    timeInfo = *localtime(&rawtime);
+
+    num = sscanf(str, "%d-%d-%d %d:%d:%d", &year, &month, &day, &hour, &minute, &second);
+
+    if (5 <= num)
+    {
+        timeInfo.tm_year    = year - 1900;
+        timeInfo.tm_mon     = month - 1;
+        timeInfo.tm_mday    = day;
+    }
+    else
+    {
+        second  = 0;
+        num     = sscanf(str, "%d:%d:%d", &hour, &minute, &second);
+
+        if (2 > num)
+        {
+            return FALSE;
+        }
+    }
+
+    timeInfo.tm_hour    = hour;
+    timeInfo.tm_min     = minute;
+    timeInfo.tm_sec     = second;
+    timeInfo.tm_isdst   = -1;
+
+    value = mktime(&timeInfo);
+
+    if ((time_t)-1 == value)
+    {
+        return FALSE;
+    }
+
+    if (TRUE == isEnd)
+    {
+        ++value;
+    }
+
+    if ((time_t)startTime >= value)
+    {
+        *timestamp = 0;
+    }
+    else
+    {
+        *timestamp = ((uint64_t)(value - (time_t)startTime)) * 1000000u;
+    }
+
+    if ((TRUE == isEnd) &&
+        (0 < *timestamp))
+    {
+        --(*timestamp);
+    }
+
+    return TRUE;
+}
+
+/**
+ * This function is called by the command line parser for every unknown argument.
+ *
+ * @param[in]   userData    User data
+ * @param[in]   arg         Argument name
+ * @param[in]   par         Array of parameter
+ *
+ * @return Status
+ */
+static CMDLINEPARSER_RET main_clpUnknown(void* const userData, char const * const arg, char const * const par)
+{
+    MAIN_NOT_USED(userData);
+    MAIN_NOT_USED(par);
+
+    printf("Unknown command line argument: %s\n", arg);
+
+    return CMDLINEPARSER_RET_ERROR;
+}
@@ -0,0 +1,530 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2019, Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  Event filter
+@file   eventFilter.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see eventFilter.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "eventFilter.h"
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "vscp_class.h"
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Offset of a level 1 class to its level 1 over level 2 class */
+#define EVENTFILTER_CLASS_L1_OVER_L2_OFFSET (512u)
+
+/** Size of the GUID, which is prepended to the data of a level 1 over level 2 event. */
+#define EVENTFILTER_L1_OVER_L2_GUID_SIZE    (16u)
+
+/** Index of the node nickname in the GUID */
+#define EVENTFILTER_GUID_NICKNAME_INDEX     (15u)
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/** Set a bit in a bitmap. */
+#define EVENTFILTER_BIT_SET(__bitmap, __index)  ((__bitmap)[(__index) / 8u] |= (uint8_t)(1u << ((__index) % 8u)))
+
+/** Get a bit from a bitmap. */
+#define EVENTFILTER_BIT_GET(__bitmap, __index)  (0u != ((__bitmap)[(__index) / 8u] & (1u << ((__index) % 8u))))
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+static EVENTFILTER_RET eventFilter_parseList(char const * const list, uint8_t * const bitmap, uint32_t num);
+static EVENTFILTER_RET eventFilter_parseNumber(char const ** const str, uint32_t * const value);
+static void eventFilter_getMaskFilter(uint8_t const * const bitmap, uint32_t num, uint32_t * const mask, uint32_t * const value);
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function initializes a filter, which accepts all events.
+ *
+ * @param[out]  filter  Filter
+ */
+extern void eventFilter_init(eventFilter_Filter * const filter)
+{
+    if (NULL != filter)
+    {
+        memset(filter, 0, sizeof(eventFilter_Filter));
+    }
+
+    return;
+}
+
+/**
+ * This function sets the accepted VSCP classes.
+ *
+ * @param[in]   filter  Filter
+ * @param[in]   list    List of classes and class ranges, e.g. "10,20-30"
+ *
+ * @return Status
+ */
+extern EVENTFILTER_RET eventFilter_setClasses(eventFilter_Filter * const filter, char const * const list)
+{
+    EVENTFILTER_RET status  = EVENTFILTER_RET_OK;
+    uint32_t        index   = 0;
+
+    if ((NULL == filter) ||
+        (NULL == list))
+    {
+        return EVENTFILTER_RET_ENULL;
+    }
+
+    status = eventFilter_parseList(list, filter->classes, EVENTFILTER_CLASS_NUM);
+
+    if (EVENTFILTER_RET_OK == status)
+    {
+        /* A level 1 class is forwarded by a level 2 gateway as level 1 over level 2 class. */
+        for(index = 0; index < EVENTFILTER_CLASS_L1_OVER_L2_OFFSET; ++index)
+        {
+            if (TRUE == EVENTFILTER_BIT_GET(filter->classes, index))
+            {
+                EVENTFILTER_BIT_SET(filter->classes, index + EVENTFILTER_CLASS_L1_OVER_L2_OFFSET);
+            }
+        }
+
+        filter->useClass = TRUE;
+    }
+
+    return status;
+}
+
+/**
+ * This function sets the accepted VSCP types.
+ *
+ * @param[in]   filter  Filter
+ * @param[in]   list    List of types and type ranges, e.g. "1,3-5"
+ *
+ * @return Status
+ */
+extern EVENTFILTER_RET eventFilter_setTypes(eventFilter_Filter * const filter, char const * const list)
+{
+    EVENTFILTER_RET status  = EVENTFILTER_RET_OK;
+
+    if ((NULL == filter) ||
+        (NULL == list))
+    {
+        return EVENTFILTER_RET_ENULL;
+    }
+
+    status = eventFilter_parseList(list, filter->types, EVENTFILTER_TYPE_NUM);
+
+    if (EVENTFILTER_RET_OK == status)
+    {
+        filter->useType = TRUE;
+    }
+
+    return status;
+}
+
+/**
+ * This function sets the accepted node nicknames.
+ *
+ * @param[in]   filter  Filter
+ * @param[in]   list    List of nicknames and nickname ranges, e.g. "1,0x10-0x1F"
+ *
+ * @return Status
+ */
+extern EVENTFILTER_RET eventFilter_setNicknames(eventFilter_Filter * const filter, char const * const list)
+{
+    EVENTFILTER_RET status  = EVENTFILTER_RET_OK;
+
+    if ((NULL == filter) ||
+        (NULL == list))
+    {
+        return EVENTFILTER_RET_ENULL;
+    }
+
+    status = eventFilter_parseList(list, filter->nicknames, EVENTFILTER_NICKNAME_NUM);
+
+    if (EVENTFILTER_RET_OK == status)
+    {
+        filter->useNickname = TRUE;
+    }
+
+    return status;
+}
+
+/**
+ * This function sets the accepted log ids of CLASS1.LOG events.
+ *
+ * @param[in]   filter  Filter
+ * @param[in]   list    List of log ids and log id ranges, e.g. "0-3"
+ *
+ * @return Status
+ */
+extern EVENTFILTER_RET eventFilter_setLogIds(eventFilter_Filter * const filter, char const * const list)
+{
+    EVENTFILTER_RET status  = EVENTFILTER_RET_OK;
+
+    if ((NULL == filter) ||
+        (NULL == list))
+    {
+        return EVENTFILTER_RET_ENULL;
+    }
+
+    status = eventFilter_parseList(list, filter->logIds, EVENTFILTER_LOG_ID_NUM);
+
+    if (EVENTFILTER_RET_OK == status)
+    {
+        filter->useLogId = TRUE;
+    }
+
+    return status;
+}
+
+/**
+ * This function returns whether the filter accepts all events.
+ *
+ * @param[in]   filter  Filter
+ *
+ * @return If all events are accepted, it will return TRUE otherwise FALSE.
+ */
+extern BOOL eventFilter_isAll(eventFilter_Filter const * const filter)
+{
+    BOOL    isAll   = TRUE;
+
+    if (NULL != filter)
+    {
+        if ((TRUE == filter->useClass) ||
+            (TRUE == filter->useType) ||
+            (TRUE == filter->useNickname) ||
+            (TRUE == filter->useLogId))
+        {
+            isAll = FALSE;
+        }
+    }
+
+    return isAll;
+}
+
+/**
+ * This function determines the daemon event filter, which passes at least
+ * all events accepted by the filter.
+ *
+ * The daemon passes an event, if all bits selected by the mask are equal to
+ * the filter. Therefore the mask contains only the bits, which are equal in
+ * all accepted values.
+ *
+ * @param[in]   filter          Filter
+ * @param[out]  daemonFilter    Daemon event filter
+ */
+extern void eventFilter_getDaemonFilter(eventFilter_Filter const * const filter, vscpEventFilter * const daemonFilter)
+{
+    uint32_t    mask    = 0;
+    uint32_t    value   = 0;
+
+    if ((NULL == filter) ||
+        (NULL == daemonFilter))
+    {
+        return;
+    }
+
+    /* Receive all events by default */
+    memset(daemonFilter, 0, sizeof(vscpEventFilter));
+
+    if (TRUE == filter->useClass)
+    {
+        eventFilter_getMaskFilter(filter->classes, EVENTFILTER_CLASS_NUM, &mask, &value);
+        daemonFilter->mask_class    = (uint16_t)mask;
+        daemonFilter->filter_class  = (uint16_t)value;
+    }
+
+    if (TRUE == filter->useType)
+    {
+        eventFilter_getMaskFilter(filter->types, EVENTFILTER_TYPE_NUM, &mask, &value);
+        daemonFilter->mask_type     = (uint16_t)mask;
+        daemonFilter->filter_type   = (uint16_t)value;
+    }
+
+    if (TRUE == filter->useNickname)
+    {
+        eventFilter_getMaskFilter(filter->nicknames, EVENTFILTER_NICKNAME_NUM, &mask, &value);
+        daemonFilter->mask_GUID[EVENTFILTER_GUID_NICKNAME_INDEX]    = (uint8_t)mask;
+        daemonFilter->filter_GUID[EVENTFILTER_GUID_NICKNAME_INDEX]  = (uint8_t)value;
+    }
+
+    /* The log id is part of the event data and can't be filtered by the daemon. */
+
+    return;
+}
+
+/**
+ * This function checks whether an event is accepted by the filter.
+ *
+ * @param[in]   filter      Filter
+ * @param[in]   daemonEvent Event
+ *
+ * @return If the event is accepted, it will return TRUE otherwise FALSE.
+ */
+extern BOOL eventFilter_isMatch(eventFilter_Filter const * const filter, vscpEventEx const * const daemonEvent)
+{
+    if ((NULL == filter) ||
+        (NULL == daemonEvent))
+    {
+        return FALSE;
+    }
+
+    if ((TRUE == filter->useClass) &&
+        (FALSE == EVENTFILTER_BIT_GET(filter->classes, daemonEvent->vscp_class)))
+    {
+        return FALSE;
+    }
+
+    if ((TRUE == filter->useType) &&
+        (FALSE == EVENTFILTER_BIT_GET(filter->types, daemonEvent->vscp_type)))
+    {
+        return FALSE;
+    }
+
+    if ((TRUE == filter->useNickname) &&
+        (FALSE == EVENTFILTER_BIT_GET(filter->nicknames, daemonEvent->GUID[EVENTFILTER_GUID_NICKNAME_INDEX])))
+    {
+        return FALSE;
+    }
+
+    if (TRUE == filter->useLogId)
+    {
+        uint16_t    logIdIndex  = 0;
+        BOOL        isLog       = TRUE;
+
+        if (VSCP_CLASS1_LOG == daemonEvent->vscp_class)
+        {
+            logIdIndex = 0;
+        }
+        else if ((VSCP_CLASS1_LOG + EVENTFILTER_CLASS_L1_OVER_L2_OFFSET) == daemonEvent->vscp_class)
+        {
+            /* The interface GUID is only in front of the payload, if data
+             * follows it. Usually a level 1 event over level 2 carries the
+             * level 1 payload only, with the log id in the first data byte.
+             */
+            if ((EVENTFILTER_L1_OVER_L2_GUID_SIZE + 1u) <= daemonEvent->sizeData)
+            {
+                logIdIndex = EVENTFILTER_L1_OVER_L2_GUID_SIZE;
+            }
+            else
+            {
+                logIdIndex = 0;
+            }
+        }
+        else
+        {
+            isLog = FALSE;
+        }
+
+        /* Only log events are filtered by log id. */
+        if ((TRUE == isLog) &&
+            ((daemonEvent->sizeData <= logIdIndex) ||
+             (FALSE == EVENTFILTER_BIT_GET(filter->logIds, daemonEvent->data[logIdIndex]))))
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function parses a list of values and value ranges and sets the
+ * corresponding bits in the bitmap.
+ *
+ * @param[in]   list    List, e.g. "1,3-5,0x10"
+ * @param[out]  bitmap  Bitmap
+ * @param[in]   num     Number of bits in the bitmap
+ *
+ * @return Status
+ */
+static EVENTFILTER_RET eventFilter_parseList(char const * const list, uint8_t * const bitmap, uint32_t num)
+{
+    char const *    str     = list;
+    uint32_t        first   = 0;
+    uint32_t        last    = 0;
+
+    memset(bitmap, 0, num / 8u);
+
+    while('\0' != *str)
+    {
+        if (EVENTFILTER_RET_OK != eventFilter_parseNumber(&str, &first))
+        {
+            return EVENTFILTER_RET_ERROR;
+        }
+
+        last = first;
+
+        /* Range? */
+        if ('-' == *str)
+        {
+            ++str;
+
+            if (EVENTFILTER_RET_OK != eventFilter_parseNumber(&str, &last))
+            {
+                return EVENTFILTER_RET_ERROR;
+            }
+        }
+
+        if ((num <= last) ||
+            (last < first))
+        {
+            return EVENTFILTER_RET_ERROR;
+        }
+
+        while(first <= last)
+        {
+            EVENTFILTER_BIT_SET(bitmap, first);
+            ++first;
+        }
+
+        if (',' == *str)
+        {
+            ++str;
+
+            /* No trailing separator */
+            if ('\0' == *str)
+            {
+                return EVENTFILTER_RET_ERROR;
+            }
+        }
+        else if ('\0' != *str)
+        {
+            return EVENTFILTER_RET_ERROR;
+        }
+    }
+
+    /* Empty list? */
+    if (list == str)
+    {
+        return EVENTFILTER_RET_ERROR;
+    }
+
+    return EVENTFILTER_RET_OK;
+}
+
+/**
+ * This function parses a decimal or hexadecimal number and moves the string
+ * pointer behind it.
+ *
+ * @param[in,out]   str     String
+ * @param[out]      value   Number
+ *
+ * @return Status
+ */
+static EVENTFILTER_RET eventFilter_parseNumber(char const ** const str, uint32_t * const value)
+{
+    char*           end     = NULL;
+    unsigned long   number  = 0;
+
+    /* strtoul() accepts leading white spaces and signs, which are not wanted. */
+    if (0 == isdigit((unsigned char)**str))
+    {
+        return EVENTFILTER_RET_ERROR;
+    }
+
+    number = strtoul(*str, &end, 0);
+
+    if ((*str == end) ||
+        (0xFFFFFFFFul < number))
+    {
+        return EVENTFILTER_RET_ERROR;
+    }
+
+    *value  = (uint32_t)number;
+    *str    = end;
+
+    return EVENTFILTER_RET_OK;
+}
+
+/**
+ * This function determines mask and filter value for the daemon. The mask
+ * contains all bits, which are equal in every accepted value.
+ *
+ * @param[in]   bitmap  Bitmap of accepted values
+ * @param[in]   num     Number of bits in the bitmap
+ * @param[out]  mask    Mask
+ * @param[out]  value   Filter value
+ */
+static void eventFilter_getMaskFilter(uint8_t const * const bitmap, uint32_t num, uint32_t * const mask, uint32_t * const value)
+{
+    uint32_t    index   = 0;
+    uint32_t    andBits = 0xFFFFFFFFu;
+    uint32_t    orBits  = 0;
+
+    for(index = 0; index < num; ++index)
+    {
+        if (TRUE == EVENTFILTER_BIT_GET(bitmap, index))
+        {
+            andBits &= index;
+            orBits  |= index;
+        }
+    }
+
+    /* Only the bits inside the value range are relevant. */
+    *mask   = ~(andBits ^ orBits) & (num - 1u);
+    *value  = andBits & *mask;
+
+    return;
+}
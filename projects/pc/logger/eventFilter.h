@@ -0,0 +1,214 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2019, Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  Event filter
+@file   eventFilter.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module provides an event filter for the logger. The filter is configured
+by lists of values and ranges, e.g. "10,20-30,0x200". It can filter by
+
+- VSCP class, a level 1 class matches its level 1 over level 2 class too,
+- VSCP type,
+- node nickname (GUID LSB) and
+- log id of CLASS1.LOG events. Other events are not affected by it.
+
+Every list is compiled into a bitmap, which is used to check a received
+event. Additional the filter is approximated by a daemon event filter
+(mask/filter pair), so the daemon sends only a superset of the matching events.
+
+*******************************************************************************/
+/** @defgroup eventFilter Event filter
+ * Filter received events by class, type, nickname and log id.
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __EVENTFILTER_H__
+#define __EVENTFILTER_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include "platform.h"
+#include "vscphelperlib.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Number of possible VSCP classes */
+#define EVENTFILTER_CLASS_NUM       (65536u)
+
+/** Number of possible VSCP types */
+#define EVENTFILTER_TYPE_NUM        (65536u)
+
+/** Number of possible nicknames */
+#define EVENTFILTER_NICKNAME_NUM    (256u)
+
+/** Number of possible log ids */
+#define EVENTFILTER_LOG_ID_NUM      (256u)
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/** This type defines the supported function return values. */
+typedef enum
+{
+    EVENTFILTER_RET_OK = 0, /**< Successful */
+    EVENTFILTER_RET_ERROR,  /**< Failed, e.g. invalid list */
+    EVENTFILTER_RET_ENULL   /**< Unexpected NULL pointer */
+
+} EVENTFILTER_RET;
+
+/** This type defines a compiled event filter. */
+typedef struct
+{
+    BOOL    useClass;                                   /**< Filter by VSCP class */
+    BOOL    useType;                                    /**< Filter by VSCP type */
+    BOOL    useNickname;                                /**< Filter by nickname */
+    BOOL    useLogId;                                   /**< Filter by log id */
+    uint8_t classes[EVENTFILTER_CLASS_NUM / 8u];        /**< Bitmap of the accepted VSCP classes */
+    uint8_t types[EVENTFILTER_TYPE_NUM / 8u];           /**< Bitmap of the accepted VSCP types */
+    uint8_t nicknames[EVENTFILTER_NICKNAME_NUM / 8u];   /**< Bitmap of the accepted nicknames */
+    uint8_t logIds[EVENTFILTER_LOG_ID_NUM / 8u];        /**< Bitmap of the accepted log ids */
+
+} eventFilter_Filter;
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function initializes a filter, which accepts all events.
+ *
+ * @param[out]  filter  Filter
+ */
+extern void eventFilter_init(eventFilter_Filter * const filter);
+
+/**
+ * This function sets the accepted VSCP classes.
+ *
+ * @param[in]   filter  Filter
+ * @param[in]   list    List of classes and class ranges, e.g. "10,20-30"
+ *
+ * @return Status
+ */
+extern EVENTFILTER_RET eventFilter_setClasses(eventFilter_Filter * const filter, char const * const list);
+
+/**
+ * This function sets the accepted VSCP types.
+ *
+ * @param[in]   filter  Filter
+ * @param[in]   list    List of types and type ranges, e.g. "1,3-5"
+ *
+ * @return Status
+ */
+extern EVENTFILTER_RET eventFilter_setTypes(eventFilter_Filter * const filter, char const * const list);
+
+/**
+ * This function sets the accepted node nicknames.
+ *
+ * @param[in]   filter  Filter
+ * @param[in]   list    List of nicknames and nickname ranges, e.g. "1,0x10-0x1F"
+ *
+ * @return Status
+ */
+extern EVENTFILTER_RET eventFilter_setNicknames(eventFilter_Filter * const filter, char const * const list);
+
+/**
+ * This function sets the accepted log ids of CLASS1.LOG events.
+ *
+ * @param[in]   filter  Filter
+ * @param[in]   list    List of log ids and log id ranges, e.g. "0-3"
+ *
+ * @return Status
+ */
+extern EVENTFILTER_RET eventFilter_setLogIds(eventFilter_Filter * const filter, char const * const list);
+
+/**
+ * This function returns whether the filter accepts all events.
+ *
+ * @param[in]   filter  Filter
+ *
+ * @return If all events are accepted, it will return TRUE otherwise FALSE.
+ */
+extern BOOL eventFilter_isAll(eventFilter_Filter const * const filter);
+
+/**
+ * This function determines the daemon event filter, which passes at least
+ * all events accepted by the filter.
+ *
+ * @param[in]   filter          Filter
+ * @param[out]  daemonFilter    Daemon event filter
+ */
+extern void eventFilter_getDaemonFilter(eventFilter_Filter const * const filter, vscpEventFilter * const daemonFilter);
+
+/**
+ * This function checks whether an event is accepted by the filter.
+ *
+ * @param[in]   filter      Filter
+ * @param[in]   daemonEvent Event
+ *
+ * @return If the event is accepted, it will return TRUE otherwise FALSE.
+ */
+extern BOOL eventFilter_isMatch(eventFilter_Filter const * const filter, vscpEventEx const * const daemonEvent);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __EVENTFILTER_H__ */
+
+/** @} */
@@ -44,10 +44,14 @@ This module contains the main entry point.
 #include <pthread.h>
 #include <stdio.h>
 #include <string.h>
+#include <time.h>
 #include "log.h"
 #include "platform.h"
 #include "vscphelperlib.h"
 #include "cmdLineParser.h"
+#include "capture.h"
+#include "captureIndex.h"
+#include "eventFilter.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -72,6 +76,9 @@ This module contains the main entry point.
 /** Daemon wait time after a command was executed in ms */
 #define MAIN_CMD_WAIT_TIME      250
 
+/** Max. number of events, which are received in a row without checking the keyboard. */
+#define MAIN_RX_BURST_NUM       256
+
 /*******************************************************************************
     MACROS
 *******************************************************************************/
@@ -105,6 +112,11 @@ typedef struct
     char const *    daemonAddr;     /**< Daemon ip address */
     char const *    daemonUser;     /**< User name for daemon ip access */
     char const *    daemonPassword; /**< Password for daemon ip access */
+    char const *    recordFile;     /**< Capture file name for record mode */
+    char const *    classes;        /**< Accepted VSCP classes */
+    char const *    types;          /**< Accepted VSCP types */
+    char const *    nicknames;      /**< Accepted node nicknames */
+    char const *    logIds;         /**< Accepted log ids of CLASS1.LOG events */
     BOOL            showHelp;       /**< Show help to the user */
     BOOL            verbose;        /**< Verbose output */
 
@@ -124,10 +136,13 @@ typedef struct _main_Msg
 *******************************************************************************/
 
 static MAIN_RET main_init(void);
+static MAIN_RET main_setupFilter(void);
 static void main_deInit(void);
 static void main_showKeyTable(void);
 static void main_loop(long hSession);
+static void main_handleEvent(vscpEventEx const * const daemonEvent);
 static MAIN_RET main_connect(long * const hSession, char const * const ipAddr, char const * const user, char const * const password);
+static MAIN_RET main_setDaemonFilter(long hSession);
 static void main_disconnect(long * const hSession);
 static CMDLINEPARSER_RET main_clpUnknown(void* const userData, char const * const arg, char const * const par);
 
@@ -142,6 +157,11 @@ static main_CmdLineArgs         main_cmdLineArgs    =
     NULL,   /* Daemon address */
     NULL,   /* Daemon user name */
     NULL,   /* Daemon password */
+    NULL,   /* Capture file name */
+    NULL,   /* Classes */
+    NULL,   /* Types */
+    NULL,   /* Nicknames */
+    NULL,   /* Log ids */
     FALSE,  /* Show help */
     FALSE   /* Verbose output */
 };
@@ -158,9 +178,29 @@ static const cmdLineParser_Arg  main_clpConfig[]    =
     { "-v",                         NULL,                               &main_cmdLineArgs.verbose,  NULL,               NULL,   "Increase verbose level"            },
     { "-a <ip-address>",            &main_cmdLineArgs.daemonAddr,       NULL,                       NULL,               NULL,   "IP address of VSCP daemon"         },
     { "-u <user>",                  &main_cmdLineArgs.daemonUser,       NULL,                       NULL,               NULL,   "User name for VSCP daemon access"  },
-    { "-p <password>",              &main_cmdLineArgs.daemonPassword,   NULL,                       NULL,               NULL,   "Password for VSCP daemon access"   }
+    { "-p <password>",              &main_cmdLineArgs.daemonPassword,   NULL,                       NULL,               NULL,   "Password for VSCP daemon access"   },
+    { "-r <file name>",             &main_cmdLineArgs.recordFile,       NULL,                       NULL,               NULL,   "Record events to a capture file"   },
+    { "-c <classes>",               &main_cmdLineArgs.classes,          NULL,                       NULL,               NULL,   "Filter by classes, e.g. 10,20-30"  },
+    { "-t <types>",                 &main_cmdLineArgs.types,            NULL,                       NULL,               NULL,   "Filter by types, e.g. 1,3-5"       },
+    { "-n <nicknames>",             &main_cmdLineArgs.nicknames,        NULL,                       NULL,               NULL,   "Filter by nicknames, e.g. 0x10-0x1F" },
+    { "-l <log ids>",               &main_cmdLineArgs.logIds,           NULL,                       NULL,               NULL,   "Filter CLASS1.LOG by log ids"      }
 };
 
+/** Capture file writer, used in record mode. */
+static capture_Writer           main_captureWriter;
+
+/** Capture file index, which is built in record mode and written after the capture. */
+static captureIndex_Index       main_captureIndex;
+
+/** Record mode active or not */
+static BOOL                     main_recordMode     = FALSE;
+
+/** Event filter, configured by command line arguments. */
+static eventFilter_Filter       main_eventFilter;
+
+/** Number of events, which were received but rejected by the event filter. */
+static uint64_t                 main_filteredCnt    = 0;
+
 /*******************************************************************************
     GLOBAL VARIABLES
 *******************************************************************************/
@@ -214,6 +254,11 @@ int main(int argc, char* argv[])
         printf("Where to connect to?\n");
         abort = TRUE;
     }
+    /* Invalid event filter? */
+    else if (MAIN_RET_OK != main_setupFilter())
+    {
+        abort = TRUE;
+    }
     else
     {
         if (TRUE == main_cmdLineArgs.verbose)
@@ -222,6 +267,25 @@ int main(int argc, char* argv[])
             log_setLevel(LOG_LEVEL_INFO | LOG_LEVEL_DEBUG | LOG_LEVEL_WARNING | LOG_LEVEL_ERROR | LOG_LEVEL_FATAL);
         }
     
+        if (NULL != main_cmdLineArgs.recordFile)
+        {
+            if (CAPTURE_RET_OK != capture_openWriter(&main_captureWriter, main_cmdLineArgs.recordFile, CAPTURE_SYNC_PERIOD_DEFAULT))
+            {
+                printf("Couldn't create capture file %s.\n", main_cmdLineArgs.recordFile);
+                abort = TRUE;
+            }
+            else
+            {
+                printf("Recording to %s\n", main_cmdLineArgs.recordFile);
+                captureIndex_init(&main_captureIndex);
+                main_recordMode = TRUE;
+            }
+        }
+    }
+
+    if ((FALSE == abort) &&
+        (FALSE == main_cmdLineArgs.showHelp))
+    {
         printf("Connecting to %s", main_cmdLineArgs.daemonAddr);
         printf(" with credentials: %s@%s\n", main_cmdLineArgs.daemonUser, main_cmdLineArgs.daemonPassword);
         
@@ -267,6 +331,29 @@ int main(int argc, char* argv[])
         }
     }
 
+    if (TRUE == main_recordMode)
+    {
+        if (CAPTURE_RET_OK != capture_closeWriter(&main_captureWriter))
+        {
+            printf("Failed to write capture file.\n");
+            status = 1;
+        }
+        else if (CAPTURE_RET_OK != captureIndex_save(&main_captureIndex, main_cmdLineArgs.recordFile))
+        {
+            printf("Failed to write capture index file.\n");
+            status = 1;
+        }
+
+        captureIndex_release(&main_captureIndex);
+
+        printf("%llu events recorded.\n", (unsigned long long)main_captureWriter.recordCnt);
+    }
+
+    if (0 < main_filteredCnt)
+    {
+        printf("%llu events filtered.\n", (unsigned long long)main_filteredCnt);
+    }
+
     if (TRUE == abort)
     {
         printf("\nAborted.\n");
@@ -307,6 +394,46 @@ static MAIN_RET main_init(void)
     return status;
 }
 
+/**
+ * This function sets up the event filter by the command line arguments.
+ *
+ * @return Status
+ */
+static MAIN_RET main_setupFilter(void)
+{
+    eventFilter_init(&main_eventFilter);
+
+    if ((NULL != main_cmdLineArgs.classes) &&
+        (EVENTFILTER_RET_OK != eventFilter_setClasses(&main_eventFilter, main_cmdLineArgs.classes)))
+    {
+        printf("Invalid class list: %s\n", main_cmdLineArgs.classes);
+        return MAIN_RET_ERROR;
+    }
+
+    if ((NULL != main_cmdLineArgs.types) &&
+        (EVENTFILTER_RET_OK != eventFilter_setTypes(&main_eventFilter, main_cmdLineArgs.types)))
+    {
+        printf("Invalid type list: %s\n", main_cmdLineArgs.types);
+        return MAIN_RET_ERROR;
+    }
+
+    if ((NULL != main_cmdLineArgs.nicknames) &&
+        (EVENTFILTER_RET_OK != eventFilter_setNicknames(&main_eventFilter, main_cmdLineArgs.nicknames)))
+    {
+        printf("Invalid nickname list: %s\n", main_cmdLineArgs.nicknames);
+        return MAIN_RET_ERROR;
+    }
+
+    if ((NULL != main_cmdLineArgs.logIds) &&
+        (EVENTFILTER_RET_OK != eventFilter_setLogIds(&main_eventFilter, main_cmdLineArgs.logIds)))
+    {
+        printf("Invalid log id list: %s\n", main_cmdLineArgs.logIds);
+        return MAIN_RET_ERROR;
+    }
+
+    return MAIN_RET_OK;
+}
+
 /**
  * This function de-initializes all relevant modules and release all resources.
  */
@@ -326,6 +453,15 @@ static void main_showKeyTable(void)
     printf("?   Show this key table\n");
     printf("q   Quit program\n");
 
+    if (TRUE == main_recordMode)
+    {
+        printf("s   Show number of recorded events\n");
+    }
+    else if (FALSE == eventFilter_isAll(&main_eventFilter))
+    {
+        printf("s   Show number of filtered events\n");
+    }
+
     return;
 }
 
@@ -356,6 +492,19 @@ static void main_loop(long hSession)
             {
                 main_showKeyTable();
             }
+            /* Show number of recorded events */
+            else if ('s' == keyValue)
+            {
+                if (TRUE == main_recordMode)
+                {
+                    printf("%llu events recorded.\n", (unsigned long long)main_captureWriter.recordCnt);
+                }
+
+                if (FALSE == eventFilter_isAll(&main_eventFilter))
+                {
+                    printf("%llu events filtered.\n", (unsigned long long)main_filteredCnt);
+                }
+            }
             /* Quit program */
             else if ('q' == keyValue)
             {
@@ -368,6 +517,7 @@ static void main_loop(long hSession)
         else
         {
             uint32_t    count       = 0;
+            uint32_t    received    = 0;
             vscpEventEx daemonEvent;
             int         vscphlpRet  = 0;
 
@@ -384,131 +534,44 @@ static void main_loop(long hSession)
             /* Any event available? */
             else if (0 < count)
             {
-                if (VSCP_ERROR_SUCCESS != (vscphlpRet = vscphlp_receiveEventEx(hSession, &daemonEvent)))
+                /* Receive all available events in a row, to keep up with a busy bus. */
+                if (MAIN_RX_BURST_NUM < count)
                 {
-                    LOG_WARNING_INT32("Couldn't receive event: ", vscphlpRet);
+                    count = MAIN_RX_BURST_NUM;
                 }
-                else if (((VSCP_CLASS1_LOG == daemonEvent.vscp_class) || ((VSCP_CLASS1_LOG + 512) == daemonEvent.vscp_class)) &&
-                         (VSCP_TYPE_LOG_MESSAGE == daemonEvent.vscp_type) &&
-                         (8 == daemonEvent.sizeData))
-                {
-                    uint32_t index = 0;
-
-                    log_printf("Rx: %s class=0x%04X type=0x%02X prio=%2d oAddr=0x%02X %c num=%u id=0x%02X level=0x%02X idx=0x%02X data=",
-                        (VSCP_CLASS1_LOG == daemonEvent.vscp_class) ? "L1   " : "L1_L2",
-                        daemonEvent.vscp_class,
-                        daemonEvent.vscp_type,
-                        (daemonEvent.head >> 5) & 0x07,
-                        daemonEvent.GUID[15],
-                        (0 == ((daemonEvent.head >> 4) & 0x01)) ? '-' : 'h',
-                        daemonEvent.sizeData,
-                        daemonEvent.data[0],
-                        daemonEvent.data[1],
-                        daemonEvent.data[2]);
-
-                    for(index = 3; index < daemonEvent.sizeData; ++index)
-                    {
-                        printf("%02X", daemonEvent.data[index]);
 
-                        if ((index + 1) < daemonEvent.sizeData)
-                        {
-                            printf(" ");
-                        }
-                    }
-
-                    printf("\n");
-                }
-                else if (512 > daemonEvent.vscp_class)
+                while(received < count)
                 {
-                    uint32_t index = 0;
-
-                    log_printf("Rx: L1    class=0x%04X type=0x%02X prio=%2d oAddr=0x%02X %c num=%u data=",
-                        daemonEvent.vscp_class,
-                        daemonEvent.vscp_type,
-                        (daemonEvent.head >> 5) & 0x07,
-                        daemonEvent.GUID[15], /* Node GUID LSB */
-                        (0 == ((daemonEvent.head >> 4) & 0x01)) ? '-' : 'h',
-                        daemonEvent.sizeData);
-
-                    for(index = 0; index < daemonEvent.sizeData; ++index)
+                    if (VSCP_ERROR_SUCCESS != (vscphlpRet = vscphlp_receiveEventEx(hSession, &daemonEvent)))
                     {
-                        printf("%02X", daemonEvent.data[index]);
-
-                        if ((index + 1) < daemonEvent.sizeData)
-                        {
-                            printf(" ");
-                        }
+                        LOG_WARNING_INT32("Couldn't receive event: ", vscphlpRet);
+                        break;
                     }
 
-                    printf("\n");
-                }
-                else if (1024 > daemonEvent.vscp_class)
-                {
-                    uint32_t index = 0;
-
-                    log_printf("Rx: L2_L1 class=0x%04X type=0x%02X prio=%2d oAddr=0x%02X %c num=%u data=",
-                        daemonEvent.vscp_class,
-                        daemonEvent.vscp_type,
-                        (daemonEvent.head >> 5) & 0x07,
-                        daemonEvent.GUID[15], /* Node GUID LSB */
-                        (0 == ((daemonEvent.head >> 4) & 0x01)) ? '-' : 'h',
-                        daemonEvent.sizeData);
-
-                    for(index = 0; index < daemonEvent.sizeData; ++index)
-                    {
-                        printf("%02X", daemonEvent.data[index]);
-
-                        if ((index + 1) < daemonEvent.sizeData)
-                        {
-                            printf(" ");
-                        }
-                    }
+                    main_handleEvent(&daemonEvent);
 
-                    printf("\n");
+                    ++received;
                 }
-                else
-                {
-                    uint32_t index  = 0;
-                    uint8_t  max    = 0;
-
-                    log_printf("Rx: L2    class=0x%02X type=0x%02X prio=%2d oAddr=0x%02X %c num=%u data=",
-                        daemonEvent.vscp_class,
-                        daemonEvent.vscp_type,
-                        (daemonEvent.head >> 5) & 0x07,
-                        daemonEvent.GUID[15], /* Node GUID LSB */
-                        (0 == ((daemonEvent.head >> 4) & 0x01)) ? '-' : 'h',
-                        daemonEvent.sizeData);
-
-                    if (8 < daemonEvent.sizeData)
-                    {
-                        max = 8;
-                    }
-                    else
-                    {
-                        max = daemonEvent.sizeData;
-                    }
-
-                    for(index = 0; index < max; ++index)
-                    {
-                        printf("%02X", daemonEvent.data[index]);
+            }
 
-                        if ((index + 1) < max)
-                        {
-                            printf(" ");
-                        }
-                    }
+            if (TRUE == main_recordMode)
+            {
+                if (CAPTURE_RET_OK != capture_processWriter(&main_captureWriter))
+                {
+                    LOG_ERROR("Couldn't write to capture file.");
 
-                    if (8 < daemonEvent.sizeData)
-                    {
-                        printf("...");
-                    }
+                    printf("Capture file write error.\n");
 
-                    printf("\n");
+                    /* Abort */
+                    quit = TRUE;
                 }
             }
 
-            /* Give other programs a chance. */
-            platform_delay(1);
+            /* Give other programs a chance, but only if no event was pending. */
+            if (0 == received)
+            {
+                platform_delay(1);
+            }
         }
     }
 
@@ -517,6 +580,58 @@ static void main_loop(long hSession)
     return;
 }
 
+/**
+ * This function handles a received event. In record mode it is written to
+ * the capture file, otherwise it is shown on the console.
+ *
+ * @param[in] daemonEvent   Received event
+ */
+static void main_handleEvent(vscpEventEx const * const daemonEvent)
+{
+    capture_Record  record;
+    uint16_t        dataNum = daemonEvent->sizeData;
+
+    /* The daemon filter is only a superset, therefore check it here exactly. */
+    if (FALSE == eventFilter_isMatch(&main_eventFilter, daemonEvent))
+    {
+        ++main_filteredCnt;
+        return;
+    }
+
+    if (CAPTURE_DATA_SIZE < dataNum)
+    {
+        dataNum = CAPTURE_DATA_SIZE;
+    }
+
+    memset(&record, 0, sizeof(record));
+    record.obid             = daemonEvent->obid;
+    record.eventTimestamp   = daemonEvent->timestamp;
+    record.head             = daemonEvent->head;
+    record.vscpClass        = daemonEvent->vscp_class;
+    record.vscpType         = daemonEvent->vscp_type;
+    record.dataSize         = daemonEvent->sizeData;
+    memcpy(record.guid, daemonEvent->GUID, CAPTURE_GUID_SIZE);
+    memcpy(record.data, daemonEvent->data, dataNum);
+
+    if (TRUE == main_recordMode)
+    {
+        if (CAPTURE_RET_OK != capture_write(&main_captureWriter, &record))
+        {
+            LOG_ERROR("Couldn't write to capture file.");
+        }
+        else if (CAPTURE_RET_OK != captureIndex_add(&main_captureIndex, &record))
+        {
+            LOG_ERROR("Couldn't index the captured event.");
+        }
+    }
+    else
+    {
+        capture_show(&record, (uint64_t)time(NULL));
+    }
+
+    return;
+}
+
 /**
  * This function connects to a VSCP daemon.
  *
@@ -613,6 +728,11 @@ static MAIN_RET main_connect(long * const hSession, char const * const ipAddr, c
         LOG_ERROR_INT32("Channel communication error:", vscphlpRet);
         status = MAIN_RET_ERROR;
     }
+    /* Reduce the traffic by letting the daemon pre-filter the events. */
+    else if (MAIN_RET_OK != main_setDaemonFilter(*hSession))
+    {
+        status = MAIN_RET_ERROR;
+    }
     /* Clear rx event queue and go sure that no L2 event is in the queue right now. */
     else if (VSCP_ERROR_SUCCESS != (vscphlpRet = vscphlp_clearDaemonEventQueue(*hSession)))
     {
@@ -676,6 +796,40 @@ static MAIN_RET main_connect(long * const hSession, char const * const ipAddr, c
     return status;
 }
 
+/**
+ * This function sets the daemon event filter, derived from the event filter.
+ * If all events are accepted, the daemon filter is left untouched.
+ *
+ * @param[in]   hSession    Session handle
+ *
+ * @return Status
+ */
+static MAIN_RET main_setDaemonFilter(long hSession)
+{
+    vscpEventFilter daemonFilter;
+    int             vscphlpRet      = 0;
+
+    if (TRUE == eventFilter_isAll(&main_eventFilter))
+    {
+        return MAIN_RET_OK;
+    }
+
+    eventFilter_getDaemonFilter(&main_eventFilter, &daemonFilter);
+
+    LOG_DEBUG_UINT32("Daemon filter class : ", daemonFilter.filter_class);
+    LOG_DEBUG_UINT32("Daemon mask class   : ", daemonFilter.mask_class);
+    LOG_DEBUG_UINT32("Daemon filter type  : ", daemonFilter.filter_type);
+    LOG_DEBUG_UINT32("Daemon mask type    : ", daemonFilter.mask_type);
+
+    if (VSCP_ERROR_SUCCESS != (vscphlpRet = vscphlp_setFilter(hSession, &daemonFilter)))
+    {
+        LOG_ERROR_INT32("Couldn't set daemon filter:", vscphlpRet);
+        return MAIN_RET_ERROR;
+    }
+
+    return MAIN_RET_OK;
+}
+
 /**
  * This function disconnects a connection to a VSCP daemon.
  *
@@ -834,7 +834,6 @@ static CMDLINEPARSER_RET main_clpUnknown(void* const userData, char const * cons
 static Crc16CCITT main_calculateCrc(intelHexParser_Record* recSet, uint32_t recNum, uint32_t blockSize, BOOL fillBlock)
 {
     uint32_t    recIndex    = 0;
-    uint32_t    dataIndex   = 0;
     uint32_t    blockIndex  = 0;
     uint8_t     fillByte    = MAIN_BLOCK_FILL_BYTE;
     Crc16CCITT  crc         = crc16ccitt_init();
@@ -848,13 +847,10 @@ static Crc16CCITT main_calculateCrc(intelHexParser_Record* recSet, uint32_t recN
     {
         if (INTELHEXPARSER_REC_TYPE_DATA == recSet[recIndex].type)
         {
-            for(dataIndex = 0; dataIndex < recSet[recIndex].dataSize; ++dataIndex)
-            {    
-                crc = crc16ccitt_update(crc, &recSet[recIndex].data[dataIndex], 1);
-                
-                ++blockIndex;
-                blockIndex %= blockSize;
-            }
+            crc = crc16ccitt_update(crc, recSet[recIndex].data, recSet[recIndex].dataSize);
+
+            blockIndex += recSet[recIndex].dataSize;
+            blockIndex %= blockSize;
         }
         else
         {
@@ -866,7 +862,7 @@ static Crc16CCITT main_calculateCrc(intelHexParser_Record* recSet, uint32_t recN
     {
         while(0 < (blockIndex % blockSize))
         {
-            crc = crc16ccitt_update(crc, &fillByte, 1);
+            crc = crc16ccitt_updateByte(crc, fillByte);
             
             ++blockIndex;
         }
@@ -1154,7 +1150,7 @@ static void main_programNode(main_Programming * const progCon, long hSession, in
             {
                 txEvent.data[index] = recSet[progCon->recIndex].data[progCon->recDataIndex];
 
-                progCon->blockCrcCalculated = crc16ccitt_update(progCon->blockCrcCalculated, &txEvent.data[index], 1);
+                progCon->blockCrcCalculated = crc16ccitt_updateByte(progCon->blockCrcCalculated, txEvent.data[index]);
 
                 ++progCon->recDataIndex;
                 ++txEvent.sizeData;
@@ -1171,7 +1167,7 @@ static void main_programNode(main_Programming * const progCon, long hSession, in
             {
                 txEvent.data[index] = MAIN_BLOCK_FILL_BYTE;
 
-                progCon->blockCrcCalculated = crc16ccitt_update(progCon->blockCrcCalculated, &txEvent.data[index], 1);
+                progCon->blockCrcCalculated = crc16ccitt_updateByte(progCon->blockCrcCalculated, txEvent.data[index]);
                 
                 ++txEvent.sizeData;
             }
@@ -1408,4 +1404,4 @@ static void main_programNode(main_Programming * const progCon, long hSession, in
     }
 
     return;
-}
\ No newline at end of file
+}
\ No newline at end of file
@@ -0,0 +1,355 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2019, Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  CAN codec benchmark
+@file   main.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module contains the main entry point of the CAN codec benchmark.
+It verifies the word-wise packing of the VSCP CAN codec against a byte-wise
+reference, like it was used in the transport layer adapters before.
+Afterwards it measures the throughput of both.
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "vscp_can_codec.h"
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Number of different messages */
+#define MAIN_MSG_NUM            (1024u)
+
+/** Number of messages, which shall be processed for the measurement. */
+#define MAIN_BENCHMARK_MSGS     (64u * 1024u * 1024u)
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/** Encoded CAN frame */
+typedef struct
+{
+    uint32_t    id;     /**< 29-bit identifier */
+    uint32_t    word0;  /**< Data byte 0 - 3 */
+    uint32_t    word1;  /**< Data byte 4 - 7 */
+    uint8_t     length; /**< Number of data bytes */
+
+} main_Frame;
+
+/** Encoder/decoder function */
+typedef void (*main_Codec)(vscp_Message * const msg, main_Frame * const frame);
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+static void main_encodeReference(vscp_Message * const msg, main_Frame * const frame);
+static void main_decodeReference(vscp_Message * const msg, main_Frame * const frame);
+static void main_encodeCodec(vscp_Message * const msg, main_Frame * const frame);
+static void main_decodeCodec(vscp_Message * const msg, main_Frame * const frame);
+static int main_verify(void);
+static void main_measure(char const * const name, main_Codec encode, main_Codec decode);
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/** Benchmark messages */
+static vscp_Message main_msgs[MAIN_MSG_NUM];
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Main entry point.
+ *
+ * @param[in]   argc    Number of arguments
+ * @param[in]   argv    Argument list
+ * @return Program status
+ * @retval  0       Successful
+ * @retval  others  Failed
+ */
+int main(int argc, char* argv[])
+{
+    int     status      = 0;
+    size_t  index       = 0;
+    size_t  byteIndex   = 0;
+
+    (void)argc;
+    (void)argv;
+
+    /* Pseudo random messages, but reproducible */
+    srand(1);
+    for(index = 0; index < MAIN_MSG_NUM; ++index)
+    {
+        main_msgs[index].priority   = (VSCP_PRIORITY)(rand() & 0x07);
+        main_msgs[index].hardCoded  = (BOOL)(rand() & 0x01);
+        main_msgs[index].vscpClass  = (uint16_t)(rand() & 0x01ff);
+        main_msgs[index].vscpType   = (uint8_t)rand();
+        main_msgs[index].oAddr      = (uint8_t)rand();
+        main_msgs[index].dataNum    = (uint8_t)(rand() % (VSCP_L1_DATA_SIZE + 1));
+
+        for(byteIndex = 0; byteIndex < VSCP_L1_DATA_SIZE; ++byteIndex)
+        {
+            main_msgs[index].data[byteIndex] = (byteIndex < main_msgs[index].dataNum) ? (uint8_t)rand() : 0;
+        }
+    }
+
+    status = main_verify();
+
+    if (0 == status)
+    {
+        main_measure("byte-wise reference", main_encodeReference, main_decodeReference);
+        main_measure("word-wise codec", main_encodeCodec, main_decodeCodec);
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Encode a message byte by byte.
+ *
+ * @param[in]   msg     Message
+ * @param[out]  frame   CAN frame
+ */
+static void main_encodeReference(vscp_Message * const msg, main_Frame * const frame)
+{
+    uint8_t index   = 0;
+
+    frame->id = ((uint32_t)msg->priority << 26) |
+                ((uint32_t)msg->hardCoded << 25) |
+                ((uint32_t)msg->vscpClass << 16) |
+                ((uint32_t)msg->vscpType << 8) |
+                ((uint32_t)msg->oAddr);
+    frame->length   = msg->dataNum;
+    frame->word0    = 0;
+    frame->word1    = 0;
+
+    for(index = 0; index < msg->dataNum; ++index)
+    {
+        /* Byte 0 - 3 */
+        if (4 > index)
+        {
+            frame->word0 |= (uint32_t)msg->data[index] << (24 - index * 8);
+        }
+        /* Byte 4 - 7 */
+        else
+        {
+            frame->word1 |= (uint32_t)msg->data[index] << (56 - index * 8);
+        }
+    }
+
+    return;
+}
+
+/**
+ * Decode a message byte by byte.
+ *
+ * @param[out]  msg     Message
+ * @param[in]   frame   CAN frame
+ */
+static void main_decodeReference(vscp_Message * const msg, main_Frame * const frame)
+{
+    uint8_t index   = 0;
+
+    msg->vscpClass  = (uint16_t)((frame->id >> 16) & 0x01ff);
+    msg->vscpType   = (uint8_t)((frame->id >> 8) & 0x00ff);
+    msg->oAddr      = (uint8_t)((frame->id >> 0) & 0x00ff);
+    msg->hardCoded  = (BOOL)((frame->id >> 25) & 0x0001);
+    msg->priority   = (VSCP_PRIORITY)((frame->id >> 26) & 0x0007);
+    msg->dataNum    = frame->length;
+
+    for(index = 0; index < msg->dataNum; ++index)
+    {
+        /* Byte 0 - 3 */
+        if (4 > index)
+        {
+            msg->data[index] = (uint8_t)((frame->word0 >> (24 - index * 8)) & 0xff);
+        }
+        /* Byte 4 - 7 */
+        else
+        {
+            msg->data[index] = (uint8_t)((frame->word1 >> (56 - index * 8)) & 0xff);
+        }
+    }
+
+    return;
+}
+
+/**
+ * Encode a message with the VSCP CAN codec.
+ *
+ * @param[in]   msg     Message
+ * @param[out]  frame   CAN frame
+ */
+static void main_encodeCodec(vscp_Message * const msg, main_Frame * const frame)
+{
+    frame->id       = vscp_can_codec_encodeId(msg);
+    frame->length   = msg->dataNum;
+    vscp_can_codec_packData(msg, &frame->word0, &frame->word1);
+
+    return;
+}
+
+/**
+ * Decode a message with the VSCP CAN codec.
+ *
+ * @param[out]  msg     Message
+ * @param[in]   frame   CAN frame
+ */
+static void main_decodeCodec(vscp_Message * const msg, main_Frame * const frame)
+{
+    vscp_can_codec_decodeId(frame->id, msg);
+    vscp_can_codec_unpackData(frame->word0, frame->word1, frame->length, msg);
+
+    return;
+}
+
+/**
+ * Verify that the codec results in the same frames and messages like the
+ * byte-wise reference.
+ *
+ * @return Status
+ * @retval  0       Successful
+ * @retval  others  Failed
+ */
+static int main_verify(void)
+{
+    int     status  = 0;
+    size_t  index   = 0;
+
+    for(index = 0; index < MAIN_MSG_NUM; ++index)
+    {
+        main_Frame      frameRef;
+        main_Frame      frameCodec;
+        vscp_Message    msgRef;
+        vscp_Message    msgCodec;
+
+        memset(&msgRef, 0, sizeof(msgRef));
+        memset(&msgCodec, 0, sizeof(msgCodec));
+
+        main_encodeReference(&main_msgs[index], &frameRef);
+        main_encodeCodec(&main_msgs[index], &frameCodec);
+
+        if ((frameRef.id != frameCodec.id) ||
+            (frameRef.word0 != frameCodec.word0) ||
+            (frameRef.word1 != frameCodec.word1) ||
+            (frameRef.length != frameCodec.length))
+        {
+            printf("Encoding of message %u failed.\n", (unsigned int)index);
+            status = 1;
+        }
+
+        main_decodeReference(&msgRef, &frameRef);
+        main_decodeCodec(&msgCodec, &frameCodec);
+
+        if ((msgRef.priority != msgCodec.priority) ||
+            (msgRef.hardCoded != msgCodec.hardCoded) ||
+            (msgRef.vscpClass != msgCodec.vscpClass) ||
+            (msgRef.vscpType != msgCodec.vscpType) ||
+            (msgRef.oAddr != msgCodec.oAddr) ||
+            (msgRef.dataNum != msgCodec.dataNum) ||
+            (0 != memcmp(msgRef.data, msgCodec.data, msgRef.dataNum)))
+        {
+            printf("Decoding of message %u failed.\n", (unsigned int)index);
+            status = 1;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * Measure the throughput of a encoder/decoder pair and show it.
+ *
+ * @param[in]   name    Name of the encoder/decoder
+ * @param[in]   encode  Encoder
+ * @param[in]   decode  Decoder
+ */
+static void main_measure(char const * const name, main_Codec encode, main_Codec decode)
+{
+    main_Frame      frame;
+    vscp_Message    msg;
+    unsigned long   processed   = 0;
+    uint32_t        checksum    = 0;
+    clock_t         start       = clock();
+    double          duration    = 0.0;
+
+    memset(&msg, 0, sizeof(msg));
+
+    while(MAIN_BENCHMARK_MSGS > processed)
+    {
+        encode(&main_msgs[processed % MAIN_MSG_NUM], &frame);
+        decode(&msg, &frame);
+        checksum += frame.id ^ frame.word0 ^ frame.word1 ^ msg.oAddr;
+        ++processed;
+    }
+
+    duration = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    /* Print the checksum too, to avoid that the calculation is optimized away. */
+    printf("Codec: %s\n", name);
+    printf("Checksum: 0x%08X\n", (unsigned int)checksum);
+
+    if (0.0 < duration)
+    {
+        printf("Throughput: %.1f Mmsg/s\n", ((double)processed / 1000000.0) / duration);
+    }
+
+    return;
+}
@@ -0,0 +1,242 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2019, Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  CRC16-CCITT benchmark
+@file   main.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module contains the main entry point of the CRC16-CCITT benchmark.
+It verifies the selected algorithm against the well known check value and
+the streaming interface against the one-shot calculation. Afterwards it
+measures the throughput.
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "crc16ccitt.h"
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Size of the benchmark buffer in bytes */
+#define MAIN_BUFFER_SIZE        (64u * 1024u)
+
+/** Number of bytes, which shall be processed at least for the measurement. */
+#define MAIN_BENCHMARK_BYTES    (64u * 1024u * 1024u)
+
+/** Expected CRC of the ASCII string "123456789" (CRC-16/CCITT-FALSE) */
+#define MAIN_CHECK_VALUE        (0x29b1u)
+
+/** Frame size used to verify the streaming interface (CAN payload size) */
+#define MAIN_FRAME_SIZE         (8u)
+
+/** Name of the algorithm, which is under test. */
+#if defined(CRC16CCITT_SLICING)
+#define MAIN_ALGORITHM_NAME     "slicing-by-8"
+#elif defined(CRC16CCITT_FAST)
+#define MAIN_ALGORITHM_NAME     "byte-wise table"
+#elif defined(CRC16CCITT_NIBBLE)
+#define MAIN_ALGORITHM_NAME     "nibble-wise table"
+#else
+#define MAIN_ALGORITHM_NAME     "bit by bit"
+#endif
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+static int main_verify(uint8_t const * const buffer, size_t size);
+static void main_measure(uint8_t const * const buffer, size_t size);
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/** Benchmark buffer */
+static uint8_t  main_buffer[MAIN_BUFFER_SIZE];
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Main entry point.
+ *
+ * @param[in]   argc    Number of arguments
+ * @param[in]   argv    Argument list
+ * @return Program status
+ * @retval  0       Successful
+ * @retval  others  Failed
+ */
+int main(int argc, char* argv[])
+{
+    int     status  = 0;
+    size_t  index   = 0;
+
+    (void)argc;
+    (void)argv;
+
+    /* Pseudo random data, but reproducible */
+    srand(1);
+    for(index = 0; index < MAIN_BUFFER_SIZE; ++index)
+    {
+        main_buffer[index] = (uint8_t)rand();
+    }
+
+    printf("Algorithm: %s\n", MAIN_ALGORITHM_NAME);
+
+    status = main_verify(main_buffer, MAIN_BUFFER_SIZE);
+
+    if (0 == status)
+    {
+        main_measure(main_buffer, MAIN_BUFFER_SIZE);
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Verify the algorithm against the check value and verify that the streaming
+ * interface results in the same crc like the one-shot calculation.
+ *
+ * @param[in]   buffer  Data buffer
+ * @param[in]   size    Data buffer size in bytes
+ * @return Status
+ * @retval  0       Successful
+ * @retval  others  Failed
+ */
+static int main_verify(uint8_t const * const buffer, size_t size)
+{
+    int         status      = 0;
+    uint8_t     check[]     = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+    Crc16CCITT  crcOneShot  = crc16ccitt_calculate(check, sizeof(check));
+    Crc16CCITT  crcFrames   = crc16ccitt_init();
+    Crc16CCITT  crcBytes    = crc16ccitt_init();
+    size_t      index       = 0;
+
+    if (MAIN_CHECK_VALUE != crcOneShot)
+    {
+        printf("Check value failed: 0x%04X != 0x%04X\n", crcOneShot, MAIN_CHECK_VALUE);
+        status = 1;
+    }
+
+    crcOneShot = crc16ccitt_finalize(crc16ccitt_update(crc16ccitt_init(), buffer, size));
+
+    /* Simulate received frames with odd sizes, to hit every unaligned case. */
+    index = 0;
+    while(index < size)
+    {
+        size_t  frameSize = (index % MAIN_FRAME_SIZE) + 1u;
+
+        if ((index + frameSize) > size)
+        {
+            frameSize = size - index;
+        }
+
+        crcFrames = crc16ccitt_update(crcFrames, &buffer[index], frameSize);
+        index += frameSize;
+    }
+    crcFrames = crc16ccitt_finalize(crcFrames);
+
+    for(index = 0; index < size; ++index)
+    {
+        crcBytes = crc16ccitt_updateByte(crcBytes, buffer[index]);
+    }
+    crcBytes = crc16ccitt_finalize(crcBytes);
+
+    if ((crcOneShot != crcFrames) ||
+        (crcOneShot != crcBytes))
+    {
+        printf("Streaming failed: 0x%04X 0x%04X 0x%04X\n", crcOneShot, crcFrames, crcBytes);
+        status = 1;
+    }
+
+    return status;
+}
+
+/**
+ * Measure the throughput of the algorithm and show it.
+ *
+ * @param[in]   buffer  Data buffer
+ * @param[in]   size    Data buffer size in bytes
+ */
+static void main_measure(uint8_t const * const buffer, size_t size)
+{
+    Crc16CCITT      crc         = crc16ccitt_init();
+    unsigned long   processed   = 0;
+    clock_t         start       = clock();
+    double          duration    = 0.0;
+
+    while(MAIN_BENCHMARK_BYTES > processed)
+    {
+        crc = crc16ccitt_update(crc, buffer, size);
+        processed += size;
+    }
+
+    duration = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    /* Print the crc too, to avoid that the calculation is optimized away. */
+    printf("CRC: 0x%04X\n", crc16ccitt_finalize(crc));
+
+    if (0.0 < duration)
+    {
+        printf("Throughput: %.1f MiB/s\n", ((double)processed / (1024.0 * 1024.0)) / duration);
+    }
+
+    return;
+}
@@ -0,0 +1,533 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2019, Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  25xx SPI EEPROM driver test
+@file   main.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module contains the main entry point of the 25xx SPI EEPROM driver test.
+The driver runs against a simulated 25xx EEPROM, which checks the protocol
+like the real device: a write without write enable latch is ignored, a write
+beyond the page boundary wraps around and no command except RDSR is accepted
+during a write cycle. Afterwards the bus time of block/page access is
+compared with byte by byte access.
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "eeprom25xx.h"
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Max. simulated memory size in bytes */
+#define MAIN_SIM_SIZE_MAX       (8u * 1024u)
+
+/** Max. simulated page size in bytes */
+#define MAIN_SIM_PAGE_SIZE_MAX  (64u)
+
+/** Number of status polls, the simulated write cycle takes. */
+#define MAIN_SIM_WRITE_POLLS    (3u)
+
+/** SPI clock in Hz, like on the FRDM-K64F */
+#define MAIN_SPI_CLOCK          (1000000u)
+
+/** Write cycle time in us (25AA02E48: max. 5 ms) */
+#define MAIN_WRITE_CYCLE_TIME   (5000u)
+
+/** Number of random write/read rounds */
+#define MAIN_ROUNDS             (2000u)
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/** This type defines the simulated EEPROM. */
+typedef struct
+{
+    uint8_t     memory[MAIN_SIM_SIZE_MAX];          /**< Memory array */
+    uint16_t    size;                               /**< Memory size in bytes */
+    uint8_t     pageSize;                           /**< Page size in bytes */
+    uint8_t     addrSize;                           /**< Number of address bytes */
+    uint8_t     selected;                           /**< Chip select asserted */
+    uint16_t    index;                              /**< Byte index since chip select */
+    uint8_t     cmd;                                /**< Current command */
+    uint16_t    addr;                               /**< Current address */
+    uint8_t     wel;                                /**< Write enable latch */
+    uint16_t    wip;                                /**< Remaining status polls of the write cycle */
+    uint8_t     stuck;                              /**< Write cycle never finishes */
+    uint8_t     latch[MAIN_SIM_PAGE_SIZE_MAX];      /**< Page latch */
+    uint8_t     latchUsed[MAIN_SIM_PAGE_SIZE_MAX];  /**< Page latch bytes used */
+    unsigned long   violations;                     /**< Number of protocol violations */
+    unsigned long   bytes;                          /**< Number of clocked bytes */
+    unsigned long   selects;                        /**< Number of chip selects */
+    unsigned long   writeCycles;                    /**< Number of write cycles */
+
+} main_Sim;
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+static void main_simInit(uint16_t size, uint8_t pageSize, uint8_t addrSize);
+static uint8_t main_simByte(uint8_t txByte);
+static void main_simDeselect(void);
+static EEPROM25XX_RET main_transfer(uint8_t const * txData, uint8_t * rxData, uint16_t size, uint8_t keepSelected);
+static int main_test(uint16_t size, uint8_t pageSize, uint8_t addrSize);
+static int main_testErrors(void);
+static void main_compare(void);
+static unsigned long main_getBusTime(void);
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/** Simulated EEPROM */
+static main_Sim             main_sim;
+
+/** Shadow memory, which contains the expected content. */
+static uint8_t              main_shadow[MAIN_SIM_SIZE_MAX];
+
+/** Driver instance for the simulated EEPROM */
+static eeprom25xx_Device    main_dev;
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Main entry point.
+ *
+ * @param[in]   argc    Number of arguments
+ * @param[in]   argv    Argument list
+ * @return Program status
+ * @retval  0       Successful
+ * @retval  others  Failed
+ */
+int main(int argc, char* argv[])
+{
+    int status  = 0;
+
+    (void)argc;
+    (void)argv;
+
+    /* Reproducible pseudo random data and addresses */
+    srand(1);
+
+    /* 25AA02E48: 256 bytes, 16 byte pages, 8-bit address */
+    status |= main_test(256, 16, 1);
+
+    /* 25LC640: 8 KiB, 32 byte pages, 16-bit address */
+    status |= main_test(8192, 32, 2);
+
+    status |= main_testErrors();
+
+    if (0 == status)
+    {
+        printf("All tests passed.\n\n");
+        main_compare();
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Initialize the simulated EEPROM and the driver instance.
+ *
+ * @param[in]   size        Memory size in bytes
+ * @param[in]   pageSize    Page size in bytes
+ * @param[in]   addrSize    Number of address bytes
+ */
+static void main_simInit(uint16_t size, uint8_t pageSize, uint8_t addrSize)
+{
+    memset(&main_sim, 0, sizeof(main_sim));
+    memset(main_sim.memory, 0xff, sizeof(main_sim.memory));
+    memset(main_shadow, 0xff, sizeof(main_shadow));
+
+    main_sim.size       = size;
+    main_sim.pageSize   = pageSize;
+    main_sim.addrSize   = addrSize;
+
+    main_dev.transfer   = main_transfer;
+    main_dev.size       = size;
+    main_dev.pageSize   = pageSize;
+    main_dev.addrSize   = addrSize;
+    main_dev.pollMax    = 100;
+
+    return;
+}
+
+/**
+ * Clock a single byte through the simulated EEPROM.
+ *
+ * @param[in]   txByte  Byte from the master
+ * @return Byte to the master
+ */
+static uint8_t main_simByte(uint8_t txByte)
+{
+    uint8_t rxByte  = 0xff;
+
+    ++main_sim.bytes;
+
+    if (0 == main_sim.index)
+    {
+        main_sim.cmd = txByte;
+
+        /* Only the status can be read during a write cycle. */
+        if ((0 < main_sim.wip) &&
+            (EEPROM25XX_CMD_RDSR != txByte))
+        {
+            ++main_sim.violations;
+        }
+    }
+    else if (EEPROM25XX_CMD_RDSR == main_sim.cmd)
+    {
+        rxByte = (0 < main_sim.wip) ? EEPROM25XX_STATUS_WIP : 0;
+        rxByte |= (0 != main_sim.wel) ? EEPROM25XX_STATUS_WEL : 0;
+
+        if ((0 < main_sim.wip) &&
+            (0 == main_sim.stuck))
+        {
+            --main_sim.wip;
+        }
+    }
+    else if ((EEPROM25XX_CMD_READ == main_sim.cmd) ||
+             (EEPROM25XX_CMD_WRITE == main_sim.cmd))
+    {
+        if (main_sim.addrSize >= main_sim.index)
+        {
+            main_sim.addr = (uint16_t)((main_sim.addr << 8) | txByte);
+            main_sim.addr %= main_sim.size;
+        }
+        else if (EEPROM25XX_CMD_READ == main_sim.cmd)
+        {
+            /* Sequential read, the address wraps around at the end. */
+            rxByte = main_sim.memory[main_sim.addr];
+            main_sim.addr = (main_sim.addr + 1) % main_sim.size;
+        }
+        else
+        {
+            /* Page write, the address wraps around at the page boundary. */
+            uint8_t offset = main_sim.addr & (main_sim.pageSize - 1);
+
+            main_sim.latch[offset]      = txByte;
+            main_sim.latchUsed[offset]  = 1;
+            main_sim.addr = (main_sim.addr & ~(uint16_t)(main_sim.pageSize - 1)) | ((offset + 1) & (main_sim.pageSize - 1));
+        }
+    }
+
+    ++main_sim.index;
+
+    return rxByte;
+}
+
+/**
+ * Release the chip select of the simulated EEPROM.
+ */
+static void main_simDeselect(void)
+{
+    if (0 < main_sim.index)
+    {
+        if (EEPROM25XX_CMD_WREN == main_sim.cmd)
+        {
+            main_sim.wel = 1;
+        }
+        else if ((EEPROM25XX_CMD_WRITE == main_sim.cmd) &&
+                 (main_sim.addrSize < main_sim.index))
+        {
+            uint16_t    pageBase    = main_sim.addr & ~(uint16_t)(main_sim.pageSize - 1);
+            uint8_t     offset      = 0;
+
+            if (0 == main_sim.wel)
+            {
+                /* Write is ignored by the device. */
+                ++main_sim.violations;
+            }
+            else
+            {
+                for(offset = 0; offset < main_sim.pageSize; ++offset)
+                {
+                    if (0 != main_sim.latchUsed[offset])
+                    {
+                        main_sim.memory[pageBase + offset] = main_sim.latch[offset];
+                    }
+                }
+
+                main_sim.wip = MAIN_SIM_WRITE_POLLS;
+                ++main_sim.writeCycles;
+            }
+
+            main_sim.wel = 0;
+        }
+    }
+
+    memset(main_sim.latchUsed, 0, sizeof(main_sim.latchUsed));
+    main_sim.selected   = 0;
+    main_sim.index      = 0;
+    main_sim.addr       = 0;
+
+    return;
+}
+
+/**
+ * SPI transfer function of the simulated EEPROM.
+ *
+ * @param[in]   txData          Data to send, if NULL 0x00 is sent
+ * @param[out]  rxData          Received data, if NULL it is discarded
+ * @param[in]   size            Number of bytes
+ * @param[in]   keepSelected    Keep the chip select asserted after the transfer (1) or not (0)
+ * @return Status
+ */
+static EEPROM25XX_RET main_transfer(uint8_t const * txData, uint8_t * rxData, uint16_t size, uint8_t keepSelected)
+{
+    uint16_t    index   = 0;
+
+    if (0 == main_sim.selected)
+    {
+        main_sim.selected = 1;
+        ++main_sim.selects;
+    }
+
+    for(index = 0; index < size; ++index)
+    {
+        uint8_t rxByte = main_simByte((NULL != txData) ? txData[index] : 0x00);
+
+        if (NULL != rxData)
+        {
+            rxData[index] = rxByte;
+        }
+    }
+
+    if (0 == keepSelected)
+    {
+        main_simDeselect();
+    }
+
+    return EEPROM25XX_RET_OK;
+}
+
+/**
+ * Write random blocks to random addresses and read them back.
+ *
+ * @param[in]   size        Memory size in bytes
+ * @param[in]   pageSize    Page size in bytes
+ * @param[in]   addrSize    Number of address bytes
+ * @return Status
+ * @retval  0       Successful
+ * @retval  others  Failed
+ */
+static int main_test(uint16_t size, uint8_t pageSize, uint8_t addrSize)
+{
+    int         status  = 0;
+    uint16_t    round   = 0;
+    uint8_t     buffer[MAIN_SIM_SIZE_MAX];
+
+    main_simInit(size, pageSize, addrSize);
+
+    for(round = 0; (round < MAIN_ROUNDS) && (0 == status); ++round)
+    {
+        uint16_t    addr    = (uint16_t)(rand() % size);
+        uint16_t    num     = (uint16_t)(rand() % (3u * pageSize)) + 1u;
+        uint16_t    index   = 0;
+
+        if ((size - addr) < num)
+        {
+            num = size - addr;
+        }
+
+        for(index = 0; index < num; ++index)
+        {
+            buffer[index] = (uint8_t)rand();
+        }
+
+        memcpy(&main_shadow[addr], buffer, num);
+
+        if (EEPROM25XX_RET_OK != eeprom25xx_write(&main_dev, addr, buffer, num))
+        {
+            printf("Write of %u bytes at 0x%04X failed.\n", num, addr);
+            status = 1;
+        }
+        else if (0 != memcmp(main_sim.memory, main_shadow, size))
+        {
+            printf("Memory differs after write of %u bytes at 0x%04X.\n", num, addr);
+            status = 1;
+        }
+        else if ((EEPROM25XX_RET_OK != eeprom25xx_read(&main_dev, addr, buffer, num)) ||
+                 (0 != memcmp(buffer, &main_shadow[addr], num)))
+        {
+            printf("Read of %u bytes at 0x%04X failed.\n", num, addr);
+            status = 1;
+        }
+    }
+
+    /* Whole memory in one block */
+    if ((0 == status) &&
+        ((EEPROM25XX_RET_OK != eeprom25xx_read(&main_dev, 0, buffer, size)) ||
+         (0 != memcmp(buffer, main_shadow, size))))
+    {
+        printf("Read of the whole memory failed.\n");
+        status = 1;
+    }
+
+    if (0 < main_sim.violations)
+    {
+        printf("%lu protocol violations.\n", main_sim.violations);
+        status = 1;
+    }
+
+    printf("%u bytes, %u byte pages, %u address bytes: %s\n", size, pageSize, addrSize, (0 == status) ? "OK" : "FAILED");
+
+    return status;
+}
+
+/**
+ * Test parameter errors and a write cycle, which never finishes.
+ *
+ * @return Status
+ * @retval  0       Successful
+ * @retval  others  Failed
+ */
+static int main_testErrors(void)
+{
+    int     status      = 0;
+    uint8_t buffer[4]   = { 0 };
+
+    main_simInit(256, 16, 1);
+
+    if ((EEPROM25XX_RET_EPAR != eeprom25xx_read(&main_dev, 254, buffer, 4)) ||
+        (EEPROM25XX_RET_EPAR != eeprom25xx_write(&main_dev, 253, buffer, 4)) ||
+        (EEPROM25XX_RET_ENULL != eeprom25xx_read(&main_dev, 0, NULL, 4)) ||
+        (EEPROM25XX_RET_ENULL != eeprom25xx_write(NULL, 0, buffer, 4)))
+    {
+        printf("Parameter check failed.\n");
+        status = 1;
+    }
+
+    /* Nothing shall be sent for invalid parameters. */
+    if (0 < main_sim.bytes)
+    {
+        printf("Bus access with invalid parameters.\n");
+        status = 1;
+    }
+
+    main_sim.stuck = 1;
+
+    if (EEPROM25XX_RET_TIMEOUT != eeprom25xx_write(&main_dev, 0, buffer, 4))
+    {
+        printf("Write cycle timeout not detected.\n");
+        status = 1;
+    }
+
+    printf("Error handling: %s\n", (0 == status) ? "OK" : "FAILED");
+
+    return status;
+}
+
+/**
+ * Compare the bus time of block/page access with byte by byte access.
+ */
+static void main_compare(void)
+{
+    uint8_t     buffer[256];
+    uint16_t    index       = 0;
+
+    for(index = 0; index < sizeof(buffer); ++index)
+    {
+        buffer[index] = (uint8_t)index;
+    }
+
+    main_simInit(sizeof(buffer), 16, 1);
+
+    for(index = 0; index < sizeof(buffer); ++index)
+    {
+        (void)eeprom25xx_write(&main_dev, index, &buffer[index], 1);
+    }
+    printf("Write 256 bytes byte by byte: %lu write cycles, %lu bytes clocked, ~%lu ms\n",
+        main_sim.writeCycles, main_sim.bytes, main_getBusTime() / 1000u);
+
+    main_simInit(sizeof(buffer), 16, 1);
+    (void)eeprom25xx_write(&main_dev, 0, buffer, sizeof(buffer));
+    printf("Write 256 bytes page by page: %lu write cycles, %lu bytes clocked, ~%lu ms\n",
+        main_sim.writeCycles, main_sim.bytes, main_getBusTime() / 1000u);
+
+    main_simInit(sizeof(buffer), 16, 1);
+    for(index = 0; index < sizeof(buffer); ++index)
+    {
+        (void)eeprom25xx_read(&main_dev, index, &buffer[index], 1);
+    }
+    printf("Read 256 bytes byte by byte: %lu chip selects, %lu bytes clocked, ~%lu us\n",
+        main_sim.selects, main_sim.bytes, main_getBusTime());
+
+    main_simInit(sizeof(buffer), 16, 1);
+    (void)eeprom25xx_read(&main_dev, 0, buffer, sizeof(buffer));
+    printf("Read 256 bytes in one block: %lu chip selects, %lu bytes clocked, ~%lu us\n",
+        main_sim.selects, main_sim.bytes, main_getBusTime());
+
+    return;
+}
+
+/**
+ * Estimate the bus time in us of the last simulation run. The status polls
+ * during a write cycle are not counted, the write cycle time is used instead.
+ *
+ * @return Bus time in us
+ */
+static unsigned long main_getBusTime(void)
+{
+    /* Each write cycle is polled until WIP is cleared, one RDSR command byte and one status byte per poll. */
+    unsigned long   polls   = main_sim.writeCycles * (MAIN_SIM_WRITE_POLLS + 1u) * 2u;
+    unsigned long   bytes   = main_sim.bytes - polls;
+
+    return (bytes * 8u * 1000000u) / MAIN_SPI_CLOCK + main_sim.writeCycles * MAIN_WRITE_CYCLE_TIME;
+}
@@ -0,0 +1,297 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2019, Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  Logger event filter test
+@file   main.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module contains the main entry point of the logger event filter test.
+Constructed daemon events run through the event filter of the PC logger and
+the result is compared with the expected one. Especially the log id position
+of level 1 events over level 2 is checked, with and without interface GUID in
+front of the payload.
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "eventFilter.h"
+#include "vscp_class.h"
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Class offset of level 1 events over level 2 */
+#define MAIN_CLASS_L1_OVER_L2_OFFSET    (512u)
+
+/** Size of the interface GUID in front of the payload */
+#define MAIN_GUID_SIZE                  (16u)
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+static void main_prepare(vscpEventEx * const daemonEvent, uint16_t vscpClass, uint16_t vscpType, uint8_t const * const data, uint16_t dataSize);
+static int main_check(char const * const name, eventFilter_Filter const * const filter, vscpEventEx const * const daemonEvent, BOOL expected);
+static int main_testLogId(void);
+static int main_testOthers(void);
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Main entry point.
+ *
+ * @param[in]   argc    Number of arguments
+ * @param[in]   argv    Arguments
+ * @return Status
+ */
+int main(int argc, char* argv[])
+{
+    int status  = 0;
+
+    (void)argc;
+    (void)argv;
+
+    status |= main_testLogId();
+    status |= main_testOthers();
+
+    if (0 == status)
+    {
+        printf("All tests passed.\n");
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Prepare a daemon event.
+ *
+ * @param[out]  daemonEvent Daemon event
+ * @param[in]   vscpClass   VSCP class
+ * @param[in]   vscpType    VSCP type
+ * @param[in]   data        Event data
+ * @param[in]   dataSize    Number of event data bytes
+ */
+static void main_prepare(vscpEventEx * const daemonEvent, uint16_t vscpClass, uint16_t vscpType, uint8_t const * const data, uint16_t dataSize)
+{
+    memset(daemonEvent, 0, sizeof(vscpEventEx));
+
+    daemonEvent->vscp_class = vscpClass;
+    daemonEvent->vscp_type  = vscpType;
+    daemonEvent->sizeData   = dataSize;
+    daemonEvent->GUID[15]   = 0x01;
+
+    if (0 < dataSize)
+    {
+        memcpy(daemonEvent->data, data, dataSize);
+    }
+
+    return;
+}
+
+/**
+ * Run a daemon event through the filter and compare the result.
+ *
+ * @param[in]   name        Test case name
+ * @param[in]   filter      Event filter
+ * @param[in]   daemonEvent Daemon event
+ * @param[in]   expected    Expected result
+ * @return Status
+ * @retval  0       Successful
+ * @retval  others  Failed
+ */
+static int main_check(char const * const name, eventFilter_Filter const * const filter, vscpEventEx const * const daemonEvent, BOOL expected)
+{
+    BOOL    isMatch = eventFilter_isMatch(filter, daemonEvent);
+
+    if (expected != isMatch)
+    {
+        printf("%s: %s expected.\n", name, (TRUE == expected) ? "Match" : "No match");
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * Test the log id filter with level 1 events and level 1 events over level 2.
+ *
+ * @return Status
+ * @retval  0       Successful
+ * @retval  others  Failed
+ */
+static int main_testLogId(void)
+{
+    int                 status                      = 0;
+    eventFilter_Filter  filter;
+    vscpEventEx         daemonEvent;
+    uint8_t             data[MAIN_GUID_SIZE + 8u];
+    uint8_t             index                       = 0;
+
+    for(index = 0; index < sizeof(data); ++index)
+    {
+        data[index] = 0xAA;
+    }
+
+    eventFilter_init(&filter);
+
+    if (EVENTFILTER_RET_OK != eventFilter_setLogIds(&filter, "3"))
+    {
+        printf("Log id list not accepted.\n");
+        return 1;
+    }
+
+    /* Level 1 log event, log id in the first data byte */
+    data[0] = 3;
+    main_prepare(&daemonEvent, VSCP_CLASS1_LOG, 1, data, 8);
+    status |= main_check("L1 log id 3", &filter, &daemonEvent, TRUE);
+
+    data[0] = 4;
+    main_prepare(&daemonEvent, VSCP_CLASS1_LOG, 1, data, 8);
+    status |= main_check("L1 log id 4", &filter, &daemonEvent, FALSE);
+
+    /* Level 1 over level 2 log event without interface GUID, log id in the first data byte */
+    data[0] = 3;
+    main_prepare(&daemonEvent, VSCP_CLASS1_LOG + MAIN_CLASS_L1_OVER_L2_OFFSET, 1, data, 8);
+    status |= main_check("L1 over L2 (8 bytes) log id 3", &filter, &daemonEvent, TRUE);
+
+    data[0] = 4;
+    main_prepare(&daemonEvent, VSCP_CLASS1_LOG + MAIN_CLASS_L1_OVER_L2_OFFSET, 1, data, 8);
+    status |= main_check("L1 over L2 (8 bytes) log id 4", &filter, &daemonEvent, FALSE);
+
+    /* Exactly the GUID size is no interface GUID with empty payload, the log id is in the first data byte. */
+    data[0] = 3;
+    main_prepare(&daemonEvent, VSCP_CLASS1_LOG + MAIN_CLASS_L1_OVER_L2_OFFSET, 1, data, MAIN_GUID_SIZE);
+    status |= main_check("L1 over L2 (16 bytes) log id 3", &filter, &daemonEvent, TRUE);
+
+    /* Level 1 over level 2 log event with interface GUID in front of the payload */
+    data[0]                 = 4;
+    data[MAIN_GUID_SIZE]    = 3;
+    main_prepare(&daemonEvent, VSCP_CLASS1_LOG + MAIN_CLASS_L1_OVER_L2_OFFSET, 1, data, MAIN_GUID_SIZE + 8u);
+    status |= main_check("L1 over L2 with GUID log id 3", &filter, &daemonEvent, TRUE);
+
+    data[0]                 = 3;
+    data[MAIN_GUID_SIZE]    = 4;
+    main_prepare(&daemonEvent, VSCP_CLASS1_LOG + MAIN_CLASS_L1_OVER_L2_OFFSET, 1, data, MAIN_GUID_SIZE + 8u);
+    status |= main_check("L1 over L2 with GUID log id 4", &filter, &daemonEvent, FALSE);
+
+    /* Log events without log id */
+    main_prepare(&daemonEvent, VSCP_CLASS1_LOG, 1, data, 0);
+    status |= main_check("L1 log without data", &filter, &daemonEvent, FALSE);
+
+    main_prepare(&daemonEvent, VSCP_CLASS1_LOG + MAIN_CLASS_L1_OVER_L2_OFFSET, 1, data, 0);
+    status |= main_check("L1 over L2 log without data", &filter, &daemonEvent, FALSE);
+
+    /* Other events are not affected by the log id filter. */
+    data[0] = 4;
+    main_prepare(&daemonEvent, VSCP_CLASS1_CONTROL, 1, data, 3);
+    status |= main_check("Control event", &filter, &daemonEvent, TRUE);
+
+    printf("Log id filter: %s\n", (0 == status) ? "OK" : "FAILED");
+
+    return status;
+}
+
+/**
+ * Test the class, type and nickname filter.
+ *
+ * @return Status
+ * @retval  0       Successful
+ * @retval  others  Failed
+ */
+static int main_testOthers(void)
+{
+    int                 status      = 0;
+    eventFilter_Filter  filter;
+    vscpEventEx         daemonEvent;
+    uint8_t             data[8]     = { 0 };
+
+    eventFilter_init(&filter);
+
+    main_prepare(&daemonEvent, VSCP_CLASS1_CONTROL, 5, data, sizeof(data));
+    status |= main_check("No filter", &filter, &daemonEvent, TRUE);
+
+    if ((EVENTFILTER_RET_OK != eventFilter_setClasses(&filter, "30,0x1E")) ||
+        (EVENTFILTER_RET_OK != eventFilter_setTypes(&filter, "1-5")) ||
+        (EVENTFILTER_RET_OK != eventFilter_setNicknames(&filter, "1")))
+    {
+        printf("Filter lists not accepted.\n");
+        return 1;
+    }
+
+    main_prepare(&daemonEvent, VSCP_CLASS1_CONTROL, 5, data, sizeof(data));
+    status |= main_check("Class, type and nickname match", &filter, &daemonEvent, TRUE);
+
+    main_prepare(&daemonEvent, VSCP_CLASS1_CONTROL, 6, data, sizeof(data));
+    status |= main_check("Type mismatch", &filter, &daemonEvent, FALSE);
+
+    main_prepare(&daemonEvent, VSCP_CLASS1_MEASUREMENT, 5, data, sizeof(data));
+    status |= main_check("Class mismatch", &filter, &daemonEvent, FALSE);
+
+    main_prepare(&daemonEvent, VSCP_CLASS1_CONTROL, 5, data, sizeof(data));
+    daemonEvent.GUID[15] = 0x02;
+    status |= main_check("Nickname mismatch", &filter, &daemonEvent, FALSE);
+
+    printf("Class, type and nickname filter: %s\n", (0 == status) ? "OK" : "FAILED");
+
+    return status;
+}
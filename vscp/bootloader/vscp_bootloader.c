@@ -101,6 +101,7 @@ typedef struct
     uint32_t    programBlockNumber; /**< Block number to program */
     uint8_t     blockBufferIndex;   /**< Current index in the block buffer */
     BOOL        programmingStarted; /**< Programming started or not */
+    Crc16CCITT  blockCrc;           /**< CRC of the block, updated with every received block data event */
 
 } vscp_bootloader_ProgParam;
 
@@ -377,7 +378,7 @@ static void vscp_bootloader_sendNakEnterBootLoader(uint8_t errorCode)
 static void vscp_bootloader_programmingProcedure(void)
 {
     BOOL                        abortFlag   = FALSE;
-    vscp_bootloader_ProgParam   progParam   = { vscp_bootloader_blockBuffer, 0, 0, 0, TRUE };
+    vscp_bootloader_ProgParam   progParam   = { vscp_bootloader_blockBuffer, 0, 0, 0, TRUE, 0 };
     vscp_RxMessage              rxMsg;
 
     /* Only with a "activate new image" or "drop nickname/reset device" event we can leave. */
@@ -477,6 +478,9 @@ static void vscp_bootloader_handleProtocolStartBlockDataTransfer(vscp_RxMessage
 
             /* Reset block buffer index */
             progParam->blockBufferIndex = 0;
+
+            /* Reset block CRC */
+            progParam->blockCrc = crc16ccitt_init();
         }
     }
 
@@ -520,11 +524,14 @@ static void vscp_bootloader_handleProtocolBlockData(vscp_RxMessage const * const
             ++(progParam->blockBufferIndex);
         }
 
+        /* Calculate the CRC16-CCITT on the fly, to avoid a pass over the whole block at the end. */
+        progParam->blockCrc = crc16ccitt_update(progParam->blockCrc, rxMsg->data, rxMsg->dataNum);
+
         /* Complete block received? */
         if (VSCP_PLATFORM_PROG_MEM_BLOCK_SIZE <= progParam->blockBufferIndex)
         {
-            /* Calculate CRC16-CCITT over the whole block and send it back for verification. */
-            Crc16CCITT  crcCalculated = crc16ccitt_calculate(progParam->blockBuffer, VSCP_PLATFORM_PROG_MEM_BLOCK_SIZE);
+            /* Send CRC16-CCITT of the whole block back for verification. */
+            Crc16CCITT  crcCalculated = crc16ccitt_finalize(progParam->blockCrc);
 
             vscp_bootloader_sendAckBlockData(crcCalculated, progParam->blockNumber * VSCP_PLATFORM_PROG_MEM_BLOCK_SIZE);
         }
@@ -828,9 +835,7 @@ static BOOL vscp_bootloader_handleProtocolActivateNewImage(vscp_RxMessage const
         /* Calculate CRC from 0 to the last programmed block (inclusive) */
         for(index = 0; index < (VSCP_PLATFORM_PROG_MEM_BLOCK_SIZE * (progParam->programBlockNumber + 1)); ++index)
         {
-            uint8_t data = vscp_bl_adapter_readProgMem(index);
-
-            crcCalculated = crc16ccitt_update(crcCalculated, &data, 1);
+            crcCalculated = crc16ccitt_updateByte(crcCalculated, vscp_bl_adapter_readProgMem(index));
         }
 
         crcCalculated = crc16ccitt_finalize(crcCalculated);
@@ -36,7 +36,7 @@
 Alarm events that indicate that something not ordinary has occurred. Note that the priority bits
 can be used as a mean to level alarm for severity.
 
-This file is automatically generated. Don't change it manually.
+This file was generated once and is maintained by hand now.
 
 *******************************************************************************/
 /** @defgroup vscp_alarm Alarm events abstraction
@@ -53,6 +53,9 @@ This file is automatically generated. Don't change it manually.
 *******************************************************************************/
 #include <stdint.h>
 #include "vscp_types.h"
+#include "vscp_class_l1.h"
+#include "vscp_type_alarm.h"
+#include "vscp_event_encoder.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -86,7 +89,10 @@ This file is automatically generated. Don't change it manually.
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_alarm_sendUndefinedEvent(void);
+static inline BOOL vscp_alarm_sendUndefinedEvent(void)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_ALARM, VSCP_TYPE_ALARM_UNDEFINED, VSCP_EVENT_ENCODER_LAYOUT_NONE, 0, 0, 0, 0, 0);
+}
 
 /**
  * Indicates a warning condition.
@@ -99,7 +105,10 @@ extern BOOL vscp_alarm_sendUndefinedEvent(void);
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_alarm_sendWarningEvent(uint8_t state, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_alarm_sendWarningEvent(uint8_t state, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_ALARM, VSCP_TYPE_ALARM_WARNING, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, state, zone, subZone, 0, 0);
+}
 
 /**
  * Indicates an alarm condition.
@@ -112,7 +121,10 @@ extern BOOL vscp_alarm_sendWarningEvent(uint8_t state, uint8_t zone, uint8_t sub
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_alarm_sendAlarmOccurredEvent(uint8_t state, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_alarm_sendAlarmOccurredEvent(uint8_t state, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_ALARM, VSCP_TYPE_ALARM_ALARM_OCCURRED, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, state, zone, subZone, 0, 0);
+}
 
 /**
  * Alarm sound should be turned on or off.
@@ -125,7 +137,10 @@ extern BOOL vscp_alarm_sendAlarmOccurredEvent(uint8_t state, uint8_t zone, uint8
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_alarm_sendAlarmSoundOnOffEvent(uint8_t state, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_alarm_sendAlarmSoundOnOffEvent(uint8_t state, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_ALARM, VSCP_TYPE_ALARM_ALARM_SOUND_ON_OFF, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, state, zone, subZone, 0, 0);
+}
 
 /**
  * Alarm light should be turned on or off.
@@ -138,7 +153,10 @@ extern BOOL vscp_alarm_sendAlarmSoundOnOffEvent(uint8_t state, uint8_t zone, uin
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_alarm_sendAlarmLightOnOffEvent(uint8_t state, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_alarm_sendAlarmLightOnOffEvent(uint8_t state, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_ALARM, VSCP_TYPE_ALARM_ALARM_LIGHT_ON_OFF, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, state, zone, subZone, 0, 0);
+}
 
 /**
  * Power has been lost or is available again.
@@ -151,7 +169,10 @@ extern BOOL vscp_alarm_sendAlarmLightOnOffEvent(uint8_t state, uint8_t zone, uin
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_alarm_sendPowerOnOffEvent(uint8_t state, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_alarm_sendPowerOnOffEvent(uint8_t state, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_ALARM, VSCP_TYPE_ALARM_POWER_ON_OFF, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, state, zone, subZone, 0, 0);
+}
 
 /**
  * Emergency stop has been hit/activated. All systems on the zone/sub-zone should go to their
@@ -165,7 +186,10 @@ extern BOOL vscp_alarm_sendPowerOnOffEvent(uint8_t state, uint8_t zone, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_alarm_sendEmergencyStopEvent(uint8_t state, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_alarm_sendEmergencyStopEvent(uint8_t state, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_ALARM, VSCP_TYPE_ALARM_EMERGENCY_STOP, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, state, zone, subZone, 0, 0);
+}
 
 /**
  * Emergency pause has been hit/activated. All systems on the zone/sub-zone should go to their
@@ -179,7 +203,10 @@ extern BOOL vscp_alarm_sendEmergencyStopEvent(uint8_t state, uint8_t zone, uint8
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_alarm_sendEmergencyPauseEvent(uint8_t state, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_alarm_sendEmergencyPauseEvent(uint8_t state, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_ALARM, VSCP_TYPE_ALARM_EMERGENCY_PAUSE, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, state, zone, subZone, 0, 0);
+}
 
 /**
  * Issued after an emergency stop or pause in order for nodes to reset and start operating .
@@ -192,7 +219,10 @@ extern BOOL vscp_alarm_sendEmergencyPauseEvent(uint8_t state, uint8_t zone, uint
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_alarm_sendEmergencyResetEvent(uint8_t state, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_alarm_sendEmergencyResetEvent(uint8_t state, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_ALARM, VSCP_TYPE_ALARM_EMERGENCY_RESET, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, state, zone, subZone, 0, 0);
+}
 
 /**
  * Issued after an emergency pause in order for nodes to start operating from where they left of
@@ -206,7 +236,10 @@ extern BOOL vscp_alarm_sendEmergencyResetEvent(uint8_t state, uint8_t zone, uint
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_alarm_sendEmergencyResumeEvent(uint8_t state, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_alarm_sendEmergencyResumeEvent(uint8_t state, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_ALARM, VSCP_TYPE_ALARM_EMERGENCY_RESUME, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, state, zone, subZone, 0, 0);
+}
 
 /**
  * Issued after an alarm system has been armed.
@@ -219,7 +252,10 @@ extern BOOL vscp_alarm_sendEmergencyResumeEvent(uint8_t state, uint8_t zone, uin
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_alarm_sendArm(uint8_t state, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_alarm_sendArm(uint8_t state, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_ALARM, VSCP_TYPE_ALARM_EMERGENCY_ARM, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, state, zone, subZone, 0, 0);
+}
 
 /**
  * Issued after an alarm system has been disarmed.
@@ -232,7 +268,10 @@ extern BOOL vscp_alarm_sendArm(uint8_t state, uint8_t zone, uint8_t subZone);
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_alarm_sendDisarm(uint8_t state, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_alarm_sendDisarm(uint8_t state, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_ALARM, VSCP_TYPE_ALARM_EMERGENCY_DISARM, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, state, zone, subZone, 0, 0);
+}
 
 /**
  * Issued when a watchdog has been triggered.
@@ -245,7 +284,10 @@ extern BOOL vscp_alarm_sendDisarm(uint8_t state, uint8_t zone, uint8_t subZone);
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_alarm_sendWatchdogEvent(uint8_t state, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_alarm_sendWatchdogEvent(uint8_t state, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_ALARM, VSCP_TYPE_ALARM_WATCHDOG, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, state, zone, subZone, 0, 0);
+}
 
 #endif /* __VSCP_ALARM_H__ */
 
@@ -39,7 +39,7 @@ belong to a zone which select limit events of interest for the particular node..
 to control a specific device the registry model should be used. This is the only way to directly
 control a device.
 
-This file is automatically generated. Don't change it manually.
+This file was generated once and is maintained by hand now.
 
 *******************************************************************************/
 /** @defgroup vscp_control Control events abstraction
@@ -56,6 +56,9 @@ This file is automatically generated. Don't change it manually.
 *******************************************************************************/
 #include <stdint.h>
 #include "vscp_types.h"
+#include "vscp_class_l1.h"
+#include "vscp_type_control.h"
+#include "vscp_event_encoder.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -89,7 +92,10 @@ This file is automatically generated. Don't change it manually.
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_control_sendUndefinedEvent(void);
+static inline BOOL vscp_control_sendUndefinedEvent(void)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_CONTROL, VSCP_TYPE_CONTROL_UNDEFINED, VSCP_EVENT_ENCODER_LAYOUT_NONE, 0, 0, 0, 0, 0);
+}
 
 /**
  * Mute/Un-mute all sound generating nodes in a zone
@@ -102,7 +108,10 @@ extern BOOL vscp_control_sendUndefinedEvent(void);
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_control_sendMuteOnOffEvent(uint8_t mute, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_control_sendMuteOnOffEvent(uint8_t mute, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_CONTROL, VSCP_TYPE_CONTROL_MUTE_ON_OFF, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, mute, zone, subZone, 0, 0);
+}
 
 /**
  * Turn on/off lamps on nodes in zone.
@@ -115,7 +124,10 @@ extern BOOL vscp_control_sendMuteOnOffEvent(uint8_t mute, uint8_t zone, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_control_sendLampOnOffEvent(uint8_t on, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_control_sendLampOnOffEvent(uint8_t on, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_CONTROL, VSCP_TYPE_CONTROL_LAMP_ON_OFF, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, on, zone, subZone, 0, 0);
+}
 
 /**
  * Perform open on all nodes in zone.
@@ -128,7 +140,10 @@ extern BOOL vscp_control_sendLampOnOffEvent(uint8_t on, uint8_t zone, uint8_t su
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_control_sendOpenEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_control_sendOpenEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_CONTROL, VSCP_TYPE_CONTROL_OPEN, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * Perform close on all nodes in zone.
@@ -141,7 +156,10 @@ extern BOOL vscp_control_sendOpenEvent(uint8_t userData, uint8_t zone, uint8_t s
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_control_sendCloseEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_control_sendCloseEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_CONTROL, VSCP_TYPE_CONTROL_CLOSE, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * Turn On a nodes in a zone/subzone.
@@ -154,7 +172,10 @@ extern BOOL vscp_control_sendCloseEvent(uint8_t userData, uint8_t zone, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_control_sendTurnOnEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_control_sendTurnOnEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_CONTROL, VSCP_TYPE_CONTROL_TURN_ON, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * Turn Off a nodes in a zone/subzone.
@@ -167,7 +188,10 @@ extern BOOL vscp_control_sendTurnOnEvent(uint8_t userData, uint8_t zone, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_control_sendTurnOffEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_control_sendTurnOffEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_CONTROL, VSCP_TYPE_CONTROL_TURN_OFF, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * Start all nodes in a zone.
@@ -180,7 +204,10 @@ extern BOOL vscp_control_sendTurnOffEvent(uint8_t userData, uint8_t zone, uint8_
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_control_sendStartEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_control_sendStartEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_CONTROL, VSCP_TYPE_CONTROL_START, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * Stop all nodes in zone.
@@ -193,7 +220,10 @@ extern BOOL vscp_control_sendStartEvent(uint8_t userData, uint8_t zone, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_control_sendStopEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_control_sendStopEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_CONTROL, VSCP_TYPE_CONTROL_STOP, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * Perform Reset on all nodes in zone.
@@ -206,7 +236,10 @@ extern BOOL vscp_control_sendStopEvent(uint8_t userData, uint8_t zone, uint8_t s
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_control_sendResetEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_control_sendResetEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_CONTROL, VSCP_TYPE_CONTROL_RESET, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * Perform Interrupt on all nodes in zone.
@@ -219,7 +252,10 @@ extern BOOL vscp_control_sendResetEvent(uint8_t userData, uint8_t zone, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_control_sendInterruptEvent(uint8_t level, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_control_sendInterruptEvent(uint8_t level, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_CONTROL, VSCP_TYPE_CONTROL_INTERRUPT, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, level, zone, subZone, 0, 0);
+}
 
 /**
  * Perform Sleep on all nodes in zone.
@@ -232,7 +268,10 @@ extern BOOL vscp_control_sendInterruptEvent(uint8_t level, uint8_t zone, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_control_sendSleepEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_control_sendSleepEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_CONTROL, VSCP_TYPE_CONTROL_SLEEP, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * Wakeup all nodes in zone.
@@ -245,7 +284,10 @@ extern BOOL vscp_control_sendSleepEvent(uint8_t userData, uint8_t zone, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_control_sendWakeupEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_control_sendWakeupEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_CONTROL, VSCP_TYPE_CONTROL_WAKEUP, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * Resume all nodes in zone.
@@ -258,7 +300,10 @@ extern BOOL vscp_control_sendWakeupEvent(uint8_t userData, uint8_t zone, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_control_sendResumeEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_control_sendResumeEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_CONTROL, VSCP_TYPE_CONTROL_RESUME, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * Pause all nodes in zone.
@@ -271,7 +316,10 @@ extern BOOL vscp_control_sendResumeEvent(uint8_t userData, uint8_t zone, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_control_sendPauseEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_control_sendPauseEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_CONTROL, VSCP_TYPE_CONTROL_PAUSE, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * Activate all nodes in zone.
@@ -284,7 +332,10 @@ extern BOOL vscp_control_sendPauseEvent(uint8_t userData, uint8_t zone, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_control_sendActivateEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_control_sendActivateEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_CONTROL, VSCP_TYPE_CONTROL_ACTIVATE, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * Deactivate all nodes in zone.
@@ -297,7 +348,10 @@ extern BOOL vscp_control_sendActivateEvent(uint8_t userData, uint8_t zone, uint8
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_control_sendDeactivateEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_control_sendDeactivateEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_CONTROL, VSCP_TYPE_CONTROL_DEACTIVATE, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * Dim all dimmer devices on a segment to a specified dim value.
@@ -311,7 +365,10 @@ extern BOOL vscp_control_sendDeactivateEvent(uint8_t userData, uint8_t zone, uin
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_control_sendDimLampEvent(uint8_t value, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_control_sendDimLampEvent(uint8_t value, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_CONTROL, VSCP_TYPE_CONTROL_DIM_LAMP, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, value, zone, subZone, 0, 0);
+}
 
 /**
  * This is typical for changing TV channels or for changing AV amp input source etc.
@@ -327,7 +384,10 @@ extern BOOL vscp_control_sendDimLampEvent(uint8_t value, uint8_t zone, uint8_t s
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_control_sendChangeChannelEvent(uint8_t value, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_control_sendChangeChannelEvent(uint8_t value, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_CONTROL, VSCP_TYPE_CONTROL_CHANGE_CHANNEL, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, value, zone, subZone, 0, 0);
+}
 
 /**
  * Change an absolute level.
@@ -340,7 +400,10 @@ extern BOOL vscp_control_sendChangeChannelEvent(uint8_t value, uint8_t zone, uin
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_control_sendChangeLevelEvent(uint8_t level, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_control_sendChangeLevelEvent(uint8_t level, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_CONTROL, VSCP_TYPE_CONTROL_CHANGE_LEVEL, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, level, zone, subZone, 0, 0);
+}
 
 /**
  *
@@ -353,7 +416,10 @@ extern BOOL vscp_control_sendChangeLevelEvent(uint8_t level, uint8_t zone, uint8
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_control_sendRelativeChangeLevelEvent(uint8_t level, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_control_sendRelativeChangeLevelEvent(uint8_t level, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_CONTROL, VSCP_TYPE_CONTROL_RELATIVE_CHANGE_LEVEL, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, level, zone, subZone, 0, 0);
+}
 
 /**
  *
@@ -367,7 +433,10 @@ extern BOOL vscp_control_sendRelativeChangeLevelEvent(uint8_t level, uint8_t zon
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_control_sendMeasurementRequestEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_control_sendMeasurementRequestEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_CONTROL, VSCP_TYPE_CONTROL_MEASUREMENT_REQUEST, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  *
@@ -393,7 +462,10 @@ extern BOOL vscp_control_sendStreamDataEvent(uint8_t sequenceNumber, uint8_t con
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_control_sendSynchronizeEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_control_sendSynchronizeEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_CONTROL, VSCP_TYPE_CONTROL_SYNCHRONIZE, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  *
@@ -426,7 +498,10 @@ extern BOOL vscp_control_sendStreamDataWithZoneEvent(uint8_t sequenceNumber, uin
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_control_sendSetPresetEvent(uint8_t code, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_control_sendSetPresetEvent(uint8_t code, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_CONTROL, VSCP_TYPE_CONTROL_SET_PRESET, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, code, zone, subZone, 0, 0);
+}
 
 /**
  * Toggle the state of a node.
@@ -442,7 +517,10 @@ extern BOOL vscp_control_sendSetPresetEvent(uint8_t code, uint8_t zone, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_control_sendToggleStateEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_control_sendToggleStateEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_CONTROL, VSCP_TYPE_CONTROL_TOGGLE_STATE, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * With this event it is possible to generate a timed pulse that is on for a specified time.
@@ -520,7 +598,10 @@ extern BOOL vscp_control_sendBigChangeLevelEvent(uint8_t index, uint8_t zone, ui
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_control_sendMoveShutterUpEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_control_sendMoveShutterUpEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_CONTROL, VSCP_TYPE_CONTROL_MOVE_SHUTTER_UP, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Move shutter down.
@@ -533,7 +614,10 @@ extern BOOL vscp_control_sendMoveShutterUpEvent(uint8_t index, uint8_t zone, uin
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_control_sendMoveShutterDownEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_control_sendMoveShutterDownEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_CONTROL, VSCP_TYPE_CONTROL_MOVE_SHUTTER_DOWN, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Move shutter left.
@@ -546,7 +630,10 @@ extern BOOL vscp_control_sendMoveShutterDownEvent(uint8_t index, uint8_t zone, u
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_control_sendMoveShutterLeftEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_control_sendMoveShutterLeftEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_CONTROL, VSCP_TYPE_CONTROL_MOVE_SHUTTER_LEFT, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Move shutter right.
@@ -559,7 +646,10 @@ extern BOOL vscp_control_sendMoveShutterLeftEvent(uint8_t index, uint8_t zone, u
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_control_sendMoveShutterRightEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_control_sendMoveShutterRightEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_CONTROL, VSCP_TYPE_CONTROL_MOVE_SHUTTER_RIGHT, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Move shutter to middle position.
@@ -572,7 +662,10 @@ extern BOOL vscp_control_sendMoveShutterRightEvent(uint8_t index, uint8_t zone,
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_control_sendMoveShutterMiddlePosEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_control_sendMoveShutterMiddlePosEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_CONTROL, VSCP_TYPE_CONTROL_MOVE_SHUTTER_MIDDLE_POS, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Turn on (all) lamps in zone/sub-zone.
@@ -584,7 +677,10 @@ extern BOOL vscp_control_sendMoveShutterMiddlePosEvent(uint8_t index, uint8_t zo
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_control_sendLampOnEvent(uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_control_sendLampOnEvent(uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_CONTROL, VSCP_TYPE_CONTROL_LAMP_ON, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, 0, zone, subZone, 0, 0);
+}
 
 /**
  * Lock devices in zone.
@@ -596,7 +692,10 @@ extern BOOL vscp_control_sendLampOnEvent(uint8_t zone, uint8_t subZone);
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_control_sendLockEvent(uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_control_sendLockEvent(uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_CONTROL, VSCP_TYPE_CONTROL_LOCK, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, 0, zone, subZone, 0, 0);
+}
 
 /**
  * Unlock devices in zone.
@@ -608,7 +707,10 @@ extern BOOL vscp_control_sendLockEvent(uint8_t zone, uint8_t subZone);
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_control_sendUnlockEvent(uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_control_sendUnlockEvent(uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_CONTROL, VSCP_TYPE_CONTROL_UNLOCK, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, 0, zone, subZone, 0, 0);
+}
 
 #endif /* __VSCP_CONTROL_H__ */
 
@@ -0,0 +1,141 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2019, Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP generic event encoder
+@file   vscp_event_encoder.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see vscp_event_encoder.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "vscp_event_encoder.h"
+#include "vscp_core.h"
+#include "vscp_data_coding.h"
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function builds a event according to its descriptor and sends it
+ * with normal priority.
+ *
+ * @param[in] vscpClass VSCP class
+ * @param[in] vscpType  VSCP type
+ * @param[in] layout    Payload layout (@see VSCP_EVENT_ENCODER_LAYOUT)
+ * @param[in] par0      First parameter byte
+ * @param[in] par1      Second parameter byte
+ * @param[in] par2      Third parameter byte
+ * @param[in] data      The data as signed integer, only used by normalized layouts.
+ * @param[in] exp       The exponent of the data (10^exponent), only used by normalized layouts.
+ * @return Status
+ * @retval FALSE Failed to send the event
+ * @retval TRUE  Event successul sent
+ */
+extern BOOL vscp_event_encoder_send(uint16_t vscpClass, uint8_t vscpType, uint8_t layout, uint8_t par0, uint8_t par1, uint8_t par2, int32_t data, int8_t exp)
+{
+    vscp_TxMessage  txMsg;
+
+    vscp_core_prepareTxMessage(&txMsg, vscpClass, vscpType, VSCP_PRIORITY_3_NORMAL);
+
+    txMsg.data[0] = par0;
+    txMsg.data[1] = par1;
+    txMsg.data[2] = par2;
+
+    switch(layout)
+    {
+    /* Raw bytes, the layout is the number of bytes. */
+    case VSCP_EVENT_ENCODER_LAYOUT_NONE:
+    case VSCP_EVENT_ENCODER_LAYOUT_BYTES_1:
+    case VSCP_EVENT_ENCODER_LAYOUT_BYTES_2:
+    case VSCP_EVENT_ENCODER_LAYOUT_BYTES_3:
+        txMsg.dataNum = layout;
+        break;
+
+    /* Data coding byte and normalized integer */
+    case VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED:
+        txMsg.dataNum = 1;
+        txMsg.data[0] = vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, par1, par0);
+
+        txMsg.dataNum += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[1], VSCP_L1_DATA_SIZE - txMsg.dataNum);
+        break;
+
+    /* Index, zone, sub-zone and normalized integer */
+    case VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED:
+        txMsg.dataNum = 3;
+
+        txMsg.dataNum += vscp_data_coding_int32ToNormalizedInteger(data, exp, &txMsg.data[3], VSCP_L1_DATA_SIZE - txMsg.dataNum);
+        break;
+
+    /* Unknown layout */
+    default:
+        return FALSE;
+    }
+
+    return vscp_core_sendEvent(&txMsg);
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
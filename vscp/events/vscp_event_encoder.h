@@ -0,0 +1,117 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2019, Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP generic event encoder
+@file   vscp_event_encoder.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+Most level 1 events differ only in class, type and a few payload bytes. The
+generic encoder builds and sends all of them by a descriptor, which consists
+of the class, the type and the payload layout. The event abstraction functions
+are thin inline wrappers, which pass their descriptor as constants. Only the
+wrappers, which are really used, cost code space.
+
+*******************************************************************************/
+/** @defgroup vscp_event_encoder Generic event encoder
+ * Generic level 1 event encoder
+ * @{
+ * @ingroup vscp_l1_events_abstraction
+ */
+
+#ifndef __VSCP_EVENT_ENCODER_H__
+#define __VSCP_EVENT_ENCODER_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include "vscp_types.h"
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/**
+ * Payload layouts. The layouts with raw bytes correspond to the number of
+ * data bytes.
+ */
+typedef enum
+{
+    VSCP_EVENT_ENCODER_LAYOUT_NONE = 0,         /**< No data */
+    VSCP_EVENT_ENCODER_LAYOUT_BYTES_1,          /**< par0 */
+    VSCP_EVENT_ENCODER_LAYOUT_BYTES_2,          /**< par0, par1 */
+    VSCP_EVENT_ENCODER_LAYOUT_BYTES_3,          /**< par0, par1, par2 */
+    VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED,       /**< Data coding byte with index (par0) and unit (par1), normalized integer */
+    VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED   /**< Index (par0), zone (par1), sub-zone (par2), normalized integer */
+
+} VSCP_EVENT_ENCODER_LAYOUT;
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function builds a event according to its descriptor and sends it
+ * with normal priority.
+ *
+ * @param[in] vscpClass VSCP class
+ * @param[in] vscpType  VSCP type
+ * @param[in] layout    Payload layout (@see VSCP_EVENT_ENCODER_LAYOUT)
+ * @param[in] par0      First parameter byte
+ * @param[in] par1      Second parameter byte
+ * @param[in] par2      Third parameter byte
+ * @param[in] data      The data as signed integer, only used by normalized layouts.
+ * @param[in] exp       The exponent of the data (10^exponent), only used by normalized layouts.
+ * @return Status
+ * @retval FALSE Failed to send the event
+ * @retval TRUE  Event successul sent
+ */
+extern BOOL vscp_event_encoder_send(uint16_t vscpClass, uint8_t vscpType, uint8_t layout, uint8_t par0, uint8_t par1, uint8_t par2, int32_t data, int8_t exp);
+
+#endif /* __VSCP_EVENT_ENCODER_H__ */
+
+/** @} */
@@ -37,7 +37,7 @@ Most of the events below have an index parameter that can be used to indicate wh
 (sensor/control) units on a node originated the event. Set to zero if the node only control one
 item.
 
-This file is automatically generated. Don't change it manually.
+This file was generated once and is maintained by hand now.
 
 *******************************************************************************/
 /** @defgroup vscp_information Information events abstraction
@@ -54,6 +54,9 @@ This file is automatically generated. Don't change it manually.
 *******************************************************************************/
 #include <stdint.h>
 #include "vscp_types.h"
+#include "vscp_class_l1.h"
+#include "vscp_type_information.h"
+#include "vscp_event_encoder.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -87,7 +90,10 @@ This file is automatically generated. Don't change it manually.
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendUndefinedEvent(void);
+static inline BOOL vscp_information_sendUndefinedEvent(void)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_UNDEFINED, VSCP_EVENT_ENCODER_LAYOUT_NONE, 0, 0, 0, 0, 0);
+}
 
 /**
  * A button has been pressed/released.
@@ -132,7 +138,10 @@ extern BOOL vscp_information_sendMouseEvent(uint8_t coordinateType, uint8_t zone
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendOnEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendOnEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_ON, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * A node indicates that a condition is in its off state. Heater off, lights off are two examples.
@@ -145,7 +154,10 @@ extern BOOL vscp_information_sendOnEvent(uint8_t index, uint8_t zone, uint8_t su
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendOffEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendOffEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_OFF, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * A node tells the world that it is alive.
@@ -158,7 +170,10 @@ extern BOOL vscp_information_sendOffEvent(uint8_t index, uint8_t zone, uint8_t s
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendAliveEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendAliveEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_ALIVE, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * A node tells the world that it is terminating.
@@ -171,7 +186,10 @@ extern BOOL vscp_information_sendAliveEvent(uint8_t userData, uint8_t zone, uint
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendTerminatingEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendTerminatingEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_TERMINATING, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * A node indicates that an open has occurred. This can be a door/window open, a modem line open etc.
@@ -184,7 +202,10 @@ extern BOOL vscp_information_sendTerminatingEvent(uint8_t userData, uint8_t zone
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendOpenedEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendOpenedEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_OPENED, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * A node indicates that a close has occurred. This can be a door/window close, a modem line closure
@@ -198,7 +219,10 @@ extern BOOL vscp_information_sendOpenedEvent(uint8_t userData, uint8_t zone, uin
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendClosedEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendClosedEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_CLOSED, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * Heartbeats can be used to indicate that a unit is alive or to send periodic data. This can be sent
@@ -258,7 +282,10 @@ extern BOOL vscp_information_sendNodeHeartbeatEventEx(uint8_t userData, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendBelowLimitEvent(uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendBelowLimitEvent(uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_BELOW_LIMIT, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, 0, zone, subZone, 0, 0);
+}
 
 /**
  * This indicates that the node has a condition that is above a configurable limit.
@@ -270,7 +297,10 @@ extern BOOL vscp_information_sendBelowLimitEvent(uint8_t zone, uint8_t subZone);
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendAboveLimitEvent(uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendAboveLimitEvent(uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_ABOVE_LIMIT, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, 0, zone, subZone, 0, 0);
+}
 
 /**
  * This can be used for slow pulse counts. This can be an S0-pulse interface or something similar.
@@ -282,7 +312,10 @@ extern BOOL vscp_information_sendAboveLimitEvent(uint8_t zone, uint8_t subZone);
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendPulseEvent(uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendPulseEvent(uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_PULSE, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, 0, zone, subZone, 0, 0);
+}
 
 /**
  * A node indicates that an error occurred.
@@ -294,7 +327,10 @@ extern BOOL vscp_information_sendPulseEvent(uint8_t zone, uint8_t subZone);
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendErrorEvent(uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendErrorEvent(uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_ERROR, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, 0, zone, subZone, 0, 0);
+}
 
 /**
  * A node indicates that it has resumed operation.
@@ -306,7 +342,10 @@ extern BOOL vscp_information_sendErrorEvent(uint8_t zone, uint8_t subZone);
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendResumedEvent(uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendResumedEvent(uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_RESUMED, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, 0, zone, subZone, 0, 0);
+}
 
 /**
  * A node indicates that it has paused.
@@ -318,7 +357,10 @@ extern BOOL vscp_information_sendResumedEvent(uint8_t zone, uint8_t subZone);
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendPausedEvent(uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendPausedEvent(uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_PAUSED, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, 0, zone, subZone, 0, 0);
+}
 
 /**
  * A node indicates that it entered a sleeping state.
@@ -330,7 +372,10 @@ extern BOOL vscp_information_sendPausedEvent(uint8_t zone, uint8_t subZone);
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendSleepingEvent(uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendSleepingEvent(uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_SLEEPING, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, 0, zone, subZone, 0, 0);
+}
 
 /**
  * The system should enter its morning state. This can be a user pressing a button to set his/her
@@ -343,7 +388,10 @@ extern BOOL vscp_information_sendSleepingEvent(uint8_t zone, uint8_t subZone);
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendGoodMorningEvent(uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendGoodMorningEvent(uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_GOOD_MORNING, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, 0, zone, subZone, 0, 0);
+}
 
 /**
  * The system should enter its day state. This can be a user pressing a button to set his/her house to
@@ -356,7 +404,10 @@ extern BOOL vscp_information_sendGoodMorningEvent(uint8_t zone, uint8_t subZone)
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendGoodDayEvent(uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendGoodDayEvent(uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_GOOD_DAY, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, 0, zone, subZone, 0, 0);
+}
 
 /**
  * The system should enter its afternoon state. This can be a user pressing a button to set his/her
@@ -369,7 +420,10 @@ extern BOOL vscp_information_sendGoodDayEvent(uint8_t zone, uint8_t subZone);
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendGoodAfternoonEvent(uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendGoodAfternoonEvent(uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_GOOD_AFTERNOON, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, 0, zone, subZone, 0, 0);
+}
 
 /**
  * The system should enter its evening state. This can be a user pressing a button to set his/her
@@ -382,7 +436,10 @@ extern BOOL vscp_information_sendGoodAfternoonEvent(uint8_t zone, uint8_t subZon
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendGoodEveningEvent(uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendGoodEveningEvent(uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_GOOD_EVENING, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, 0, zone, subZone, 0, 0);
+}
 
 /**
  * The system should enter its night state. This can be a user pressing a button to set his/her house
@@ -395,7 +452,10 @@ extern BOOL vscp_information_sendGoodEveningEvent(uint8_t zone, uint8_t subZone)
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendGoodNightEvent(uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendGoodNightEvent(uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_GOOD_NIGHT, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, 0, zone, subZone, 0, 0);
+}
 
 /**
  * The system should be on a temporary alert. This can be a user locking the door to go out to the
@@ -408,7 +468,10 @@ extern BOOL vscp_information_sendGoodNightEvent(uint8_t zone, uint8_t subZone);
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendSeeYouSoonEvent(uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendSeeYouSoonEvent(uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_SEE_YOU_SOON, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, 0, zone, subZone, 0, 0);
+}
 
 /**
  * The system should be on a goodbye alert. This can be a user locking the door to go out for a days
@@ -421,7 +484,10 @@ extern BOOL vscp_information_sendSeeYouSoonEvent(uint8_t zone, uint8_t subZone);
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendGoodbyeEvent(uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendGoodbyeEvent(uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_GOODBYE, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, 0, zone, subZone, 0, 0);
+}
 
 /**
  * A node indicates that a stop event occurred. This can for example be a motor stopping.
@@ -434,7 +500,10 @@ extern BOOL vscp_information_sendGoodbyeEvent(uint8_t zone, uint8_t subZone);
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendStopEvent(uint8_t reserved, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendStopEvent(uint8_t reserved, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_STOP, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, reserved, zone, subZone, 0, 0);
+}
 
 /**
  * A node indicates that a start event occurred. This can be a motor starting.
@@ -446,7 +515,10 @@ extern BOOL vscp_information_sendStopEvent(uint8_t reserved, uint8_t zone, uint8
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendStartEvent(uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendStartEvent(uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_START, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, 0, zone, subZone, 0, 0);
+}
 
 /**
  * A node indicates that a reset occurred. This can be a node doing a warm start.
@@ -458,7 +530,10 @@ extern BOOL vscp_information_sendStartEvent(uint8_t zone, uint8_t subZone);
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendResetCompletedEvent(uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendResetCompletedEvent(uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_RESET_COMPLETED, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, 0, zone, subZone, 0, 0);
+}
 
 /**
  * A node indicates that a reset occurred. This can also be a node doing a warm start.
@@ -470,7 +545,10 @@ extern BOOL vscp_information_sendResetCompletedEvent(uint8_t zone, uint8_t subZo
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendInterruptedEvent(uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendInterruptedEvent(uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_INTERRUPTED, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, 0, zone, subZone, 0, 0);
+}
 
 /**
  * A node indicates that a sleep event occurred. This can be a node going to its inactive state.
@@ -482,7 +560,10 @@ extern BOOL vscp_information_sendInterruptedEvent(uint8_t zone, uint8_t subZone)
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendPreparingToSleepEvent(uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendPreparingToSleepEvent(uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_PREPARING_TO_SLEEP, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, 0, zone, subZone, 0, 0);
+}
 
 /**
  * A node indicates that a wakeup event occurred. This can be a node going to it awake state.
@@ -494,7 +575,10 @@ extern BOOL vscp_information_sendPreparingToSleepEvent(uint8_t zone, uint8_t sub
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendWokenUpEvent(uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendWokenUpEvent(uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_WOKEN_UP, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, 0, zone, subZone, 0, 0);
+}
 
 /**
  * A node indicates that the system should enter its dusk state.
@@ -506,7 +590,10 @@ extern BOOL vscp_information_sendWokenUpEvent(uint8_t zone, uint8_t subZone);
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendDuskEvent(uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendDuskEvent(uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_DUSK, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, 0, zone, subZone, 0, 0);
+}
 
 /**
  * A node indicates that the system should enter its dawn state.
@@ -518,7 +605,10 @@ extern BOOL vscp_information_sendDuskEvent(uint8_t zone, uint8_t subZone);
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendDawnEvent(uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendDawnEvent(uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_DAWN, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, 0, zone, subZone, 0, 0);
+}
 
 /**
  * A node indicates that its active.
@@ -530,7 +620,10 @@ extern BOOL vscp_information_sendDawnEvent(uint8_t zone, uint8_t subZone);
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendActiveEvent(uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendActiveEvent(uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_ACTIVE, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, 0, zone, subZone, 0, 0);
+}
 
 /**
  * A node indicates that its inactive.
@@ -542,7 +635,10 @@ extern BOOL vscp_information_sendActiveEvent(uint8_t zone, uint8_t subZone);
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendInactiveEvent(uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendInactiveEvent(uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_INACTIVE, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, 0, zone, subZone, 0, 0);
+}
 
 /**
  * A node indicates that its busy.
@@ -554,7 +650,10 @@ extern BOOL vscp_information_sendInactiveEvent(uint8_t zone, uint8_t subZone);
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendBusyEvent(uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendBusyEvent(uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_BUSY, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, 0, zone, subZone, 0, 0);
+}
 
 /**
  * A node indicates that its idle.
@@ -566,7 +665,10 @@ extern BOOL vscp_information_sendBusyEvent(uint8_t zone, uint8_t subZone);
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendIdleEvent(uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendIdleEvent(uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_IDLE, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, 0, zone, subZone, 0, 0);
+}
 
 /**
  * A steam of information from a node can be reported with this event. This can be a serial RS-232
@@ -651,7 +753,10 @@ extern BOOL vscp_information_sendConfirmEvent(uint8_t zone, uint8_t subZone, uin
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendLevelChangedEvent(uint8_t levelType, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendLevelChangedEvent(uint8_t levelType, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_LEVEL_CHANGED, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, levelType, zone, subZone, 0, 0);
+}
 
 /**
  * A node indicates that a warning condition occurred.
@@ -664,7 +769,10 @@ extern BOOL vscp_information_sendLevelChangedEvent(uint8_t levelType, uint8_t zo
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendWarningEvent(uint8_t levelType, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendWarningEvent(uint8_t levelType, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_WARNING, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, levelType, zone, subZone, 0, 0);
+}
 
 /**
  * A node indicates that a state change has occurred. Th numerical ID for the current state and the
@@ -693,7 +801,10 @@ extern BOOL vscp_information_sendStateEvent(uint8_t userData, uint8_t zone, uint
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendActionTriggerEvent(uint8_t actionId, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendActionTriggerEvent(uint8_t actionId, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_ACTION_TRIGGER, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, actionId, zone, subZone, 0, 0);
+}
 
 /**
  * A node indicates that sunrise is detected/calculated.
@@ -706,7 +817,10 @@ extern BOOL vscp_information_sendActionTriggerEvent(uint8_t actionId, uint8_t zo
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendSunriseEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendSunriseEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_SUNRISE, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * A node indicates that sunset is detected/calculated.
@@ -719,7 +833,10 @@ extern BOOL vscp_information_sendSunriseEvent(uint8_t userData, uint8_t zone, ui
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendSunsetEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendSunsetEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_SUNSET, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * This event is used to mark the start of a multi-frame data transfer. This can typically be a GPS
@@ -749,7 +866,10 @@ extern BOOL vscp_information_sendStartOfRecordEvent(uint8_t index, uint8_t zone,
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendEndOfRecordEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendEndOfRecordEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_END_OF_RECORD, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * This event is used to tell the system that a pre-set configuration is active. Usually a response
@@ -776,7 +896,10 @@ extern BOOL vscp_information_sendPresetActiveEvent(uint8_t zone, uint8_t subZone
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendDetectEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendDetectEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_DETECT, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * This event is used to tell the system that an overflow of some kind has occurred.
@@ -789,7 +912,10 @@ extern BOOL vscp_information_sendDetectEvent(uint8_t index, uint8_t zone, uint8_
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendOverflowEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendOverflowEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_OVERFLOW, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * This is meant to be used as a confirmation event for CLASS1.CONTROL, Type=33 events.
@@ -835,7 +961,10 @@ extern BOOL vscp_information_sendBigLevelChangedEvent(uint8_t index, uint8_t zon
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendCivilSunriseTwilightTimeEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendCivilSunriseTwilightTimeEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_CIVIL_SUNRISE_TWILIGHT_TIME, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * A node indicates that sunset twilight time is detected/calculated.
@@ -865,7 +994,10 @@ extern BOOL vscp_information_sendCivilSunriseTwilightTimeEvent(uint8_t userData,
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendCivilSunsetTwilightTimeEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendCivilSunsetTwilightTimeEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_CIVIL_SUNSET_TWILIGHT_TIME, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * A node indicates that nautical sunrise twilight time is detected/calculated.
@@ -893,7 +1025,10 @@ extern BOOL vscp_information_sendCivilSunsetTwilightTimeEvent(uint8_t userData,
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendNauticalSunriseTwilightTimeEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendNauticalSunriseTwilightTimeEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_NAUTICAL_SUNRISE_TWILIGHT_TIME, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * A node indicates that nautical sunset twilight time is detected/calculated.
@@ -921,7 +1056,10 @@ extern BOOL vscp_information_sendNauticalSunriseTwilightTimeEvent(uint8_t userDa
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendNauticalSunsetTwilightTimeEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendNauticalSunsetTwilightTimeEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_NAUTICAL_SUNSET_TWILIGHT_TIME, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * A node indicates that astronomical sunrise twilight time is detected/calculated.
@@ -949,7 +1087,10 @@ extern BOOL vscp_information_sendNauticalSunsetTwilightTimeEvent(uint8_t userDat
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendAstronomicalSunriseTwilightTimeEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendAstronomicalSunriseTwilightTimeEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_ASTRONOMICAL_SUNRISE_TWILIGHT_TIME, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * A node indicates that astronomical sunset twilight time is detected/calculated.
@@ -977,7 +1118,10 @@ extern BOOL vscp_information_sendAstronomicalSunriseTwilightTimeEvent(uint8_t us
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendAstronomicalSunsetTwilightTimeEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendAstronomicalSunsetTwilightTimeEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_ASTRONOMICAL_SUNSET_TWILIGHT_TIME, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * This event is used for reporting of a calculated noon (real noon).
@@ -989,7 +1133,10 @@ extern BOOL vscp_information_sendAstronomicalSunsetTwilightTimeEvent(uint8_t use
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendCalculatedNoonEvent(uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendCalculatedNoonEvent(uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_CALCULATED_NOON, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, 0, zone, subZone, 0, 0);
+}
 
 /**
  * Shutter is moving up.
@@ -1002,7 +1149,10 @@ extern BOOL vscp_information_sendCalculatedNoonEvent(uint8_t zone, uint8_t subZo
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendShutterUpEvent(uint8_t reserved, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendShutterUpEvent(uint8_t reserved, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_SHUTTER_UP, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, reserved, zone, subZone, 0, 0);
+}
 
 /**
  * Shutter is moving down.
@@ -1015,7 +1165,10 @@ extern BOOL vscp_information_sendShutterUpEvent(uint8_t reserved, uint8_t zone,
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendShutterDownEvent(uint8_t reserved, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendShutterDownEvent(uint8_t reserved, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_SHUTTER_DOWN, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, reserved, zone, subZone, 0, 0);
+}
 
 /**
  * Shutter is moving left.
@@ -1028,7 +1181,10 @@ extern BOOL vscp_information_sendShutterDownEvent(uint8_t reserved, uint8_t zone
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendShutterLeftEvent(uint8_t reserved, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendShutterLeftEvent(uint8_t reserved, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_SHUTTER_LEFT, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, reserved, zone, subZone, 0, 0);
+}
 
 /**
  * Shutter is moving right.
@@ -1041,7 +1197,10 @@ extern BOOL vscp_information_sendShutterLeftEvent(uint8_t reserved, uint8_t zone
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendShutterRightEvent(uint8_t reserved, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendShutterRightEvent(uint8_t reserved, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_SHUTTER_RIGHT, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, reserved, zone, subZone, 0, 0);
+}
 
 /**
  * Shutter reached top end.
@@ -1054,7 +1213,10 @@ extern BOOL vscp_information_sendShutterRightEvent(uint8_t reserved, uint8_t zon
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendShutterReachedTopEndEvent(uint8_t reserved, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendShutterReachedTopEndEvent(uint8_t reserved, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_SHUTTER_REACHED_TOP_END, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, reserved, zone, subZone, 0, 0);
+}
 
 /**
  * Shutter reached bottom end.
@@ -1067,7 +1229,10 @@ extern BOOL vscp_information_sendShutterReachedTopEndEvent(uint8_t reserved, uin
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendShutterReachedBottomEndEvent(uint8_t reserved, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendShutterReachedBottomEndEvent(uint8_t reserved, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_SHUTTER_REACHED_BOTTOM_END, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, reserved, zone, subZone, 0, 0);
+}
 
 /**
  * Shutter reached middle end.
@@ -1080,7 +1245,10 @@ extern BOOL vscp_information_sendShutterReachedBottomEndEvent(uint8_t reserved,
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendShutterReachedMiddleEndEvent(uint8_t reserved, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendShutterReachedMiddleEndEvent(uint8_t reserved, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_SHUTTER_REACHED_MIDDLE_END, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, reserved, zone, subZone, 0, 0);
+}
 
 /**
  * Shutter reached preset end.
@@ -1093,7 +1261,10 @@ extern BOOL vscp_information_sendShutterReachedMiddleEndEvent(uint8_t reserved,
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendShutterReachedPresetEndEvent(uint8_t reserved, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendShutterReachedPresetEndEvent(uint8_t reserved, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_SHUTTER_REACHED_PRESET_END, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, reserved, zone, subZone, 0, 0);
+}
 
 /**
  * Shutter reached preset left.
@@ -1106,7 +1277,10 @@ extern BOOL vscp_information_sendShutterReachedPresetEndEvent(uint8_t reserved,
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendShutterReachedPresetLeftEvent(uint8_t reserved, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendShutterReachedPresetLeftEvent(uint8_t reserved, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_SHUTTER_REACHED_PRESET_LEFT, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, reserved, zone, subZone, 0, 0);
+}
 
 /**
  * Shutter reached preset right.
@@ -1119,7 +1293,10 @@ extern BOOL vscp_information_sendShutterReachedPresetLeftEvent(uint8_t reserved,
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendShutterReachedPresetRightEvent(uint8_t reserved, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendShutterReachedPresetRightEvent(uint8_t reserved, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_SHUTTER_REACHED_PRESET_RIGHT, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, reserved, zone, subZone, 0, 0);
+}
 
 /**
  * Long click detected.
@@ -1132,7 +1309,10 @@ extern BOOL vscp_information_sendShutterReachedPresetRightEvent(uint8_t reserved
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendLongClickEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendLongClickEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_LONG_CLICK, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Single click detected.
@@ -1145,7 +1325,10 @@ extern BOOL vscp_information_sendLongClickEvent(uint8_t index, uint8_t zone, uin
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendSingleClickEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendSingleClickEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_SINGLE_CLICK, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Double click detected.
@@ -1158,7 +1341,10 @@ extern BOOL vscp_information_sendSingleClickEvent(uint8_t index, uint8_t zone, u
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendDoubleClickEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendDoubleClickEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_DOUBLE_CLICK, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Send date event.
@@ -1219,7 +1405,10 @@ extern BOOL vscp_information_sendWeekdayEvent(uint8_t index, uint8_t zone, uint8
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendLockEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendLockEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_LOCK, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * A device got unlocked.
@@ -1232,7 +1421,10 @@ extern BOOL vscp_information_sendLockEvent(uint8_t index, uint8_t zone, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendUnlockEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendUnlockEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_UNLOCK, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * A device generated a date/time event. Time is UTC.
@@ -1264,7 +1456,10 @@ extern BOOL vscp_information_sendDateTime(uint8_t index, uint8_t zone, uint8_t s
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendRisingEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendRisingEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_RISING, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * A falling (edge) is detected.
@@ -1277,7 +1472,10 @@ extern BOOL vscp_information_sendRisingEvent(uint8_t index, uint8_t zone, uint8_
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendFallingEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendFallingEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_FALLING, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Something has been updated.
@@ -1290,7 +1488,10 @@ extern BOOL vscp_information_sendFallingEvent(uint8_t index, uint8_t zone, uint8
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_information_sendUpdatedEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_information_sendUpdatedEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_UPDATED, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 #endif /* __VSCP_INFORMATION_H__ */
 
@@ -35,7 +35,7 @@
 @section desc Description
 @see vscp_log.h
 
-This file is automatically generated. Don't change it manually.
+This file was generated once and is maintained by hand now.
 
 *******************************************************************************/
 
@@ -80,25 +80,6 @@ This file is automatically generated. Don't change it manually.
     GLOBAL FUNCTIONS
 *******************************************************************************/
 
-/**
- * General log event.
- *
- * @return Status
- * @retval FALSE Failed to send the event
- * @retval TRUE  Event successful sent
- *
- */
-extern BOOL vscp_log_sendUndefinedEvent(void)
-{
-    vscp_TxMessage txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_LOG, VSCP_TYPE_LOG_UNDEFINED, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataNum = 0;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
 /**
  * Message for Log. Several frames have to be sent for a event that take up more the
  * five bytes which is the maximum for each frame. In this case the zero based index
@@ -118,69 +99,6 @@ extern BOOL vscp_log_sendLogEvent(uint8_t id, uint8_t level, uint8_t const * con
     return vscp_logger_sendLogEvent(id, level, msg, size);
 }
 
-/**
- * Start logging.
- *
- * @param[in] id ID for log (stream).
- * @return Status
- * @retval FALSE Failed to send the event
- * @retval TRUE  Event successful sent
- *
- */
-extern BOOL vscp_log_sendLogStartEvent(uint8_t id)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_LOG, VSCP_TYPE_LOG_LOG_START, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataNum = 1;
-    txMsg.data[0] = id;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Stop logging.
- *
- * @param[in] id ID for log (stream).
- * @return Status
- * @retval FALSE Failed to send the event
- * @retval TRUE  Event successful sent
- *
- */
-extern BOOL vscp_log_sendLogStopEvent(uint8_t id)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_LOG, VSCP_TYPE_LOG_LOG_STOP, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataNum = 1;
-    txMsg.data[0] = id;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
-/**
- * Set level for logging.
- *
- * @param[in] level Log level
- * @return Status
- * @retval FALSE Failed to send the event
- * @retval TRUE  Event successful sent
- *
- */
-extern BOOL vscp_log_sendLogLevelEvent(uint8_t level)
-{
-    vscp_TxMessage  txMsg;
-
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_LOG, VSCP_TYPE_LOG_LOG_LEVEL, VSCP_PRIORITY_3_NORMAL);
-
-    txMsg.dataNum = 1;
-    txMsg.data[0] = level;
-
-    return vscp_core_sendEvent(&txMsg);
-}
-
 /*******************************************************************************
     LOCAL FUNCTIONS
 *******************************************************************************/
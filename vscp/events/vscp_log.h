@@ -35,7 +35,7 @@
 @section desc Description
 Logging functionality.
 
-This file is automatically generated. Don't change it manually.
+This file was generated once and is maintained by hand now.
 
 *******************************************************************************/
 /** @defgroup vscp_log Log events abstraction
@@ -52,6 +52,9 @@ This file is automatically generated. Don't change it manually.
 *******************************************************************************/
 #include <stdint.h>
 #include "vscp_types.h"
+#include "vscp_class_l1.h"
+#include "vscp_type_log.h"
+#include "vscp_event_encoder.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -85,7 +88,10 @@ This file is automatically generated. Don't change it manually.
  * @retval TRUE  Event successful sent
  *
  */
-extern BOOL vscp_log_sendUndefinedEvent(void);
+static inline BOOL vscp_log_sendUndefinedEvent(void)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_LOG, VSCP_TYPE_LOG_UNDEFINED, VSCP_EVENT_ENCODER_LAYOUT_NONE, 0, 0, 0, 0, 0);
+}
 
 /**
  * Message for Log. Several frames have to be sent for a event that take up more the
@@ -112,7 +118,10 @@ extern BOOL vscp_log_sendLogEvent(uint8_t id, uint8_t level, uint8_t const * con
  * @retval TRUE  Event successful sent
  *
  */
-extern BOOL vscp_log_sendLogStartEvent(uint8_t id);
+static inline BOOL vscp_log_sendLogStartEvent(uint8_t id)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_LOG, VSCP_TYPE_LOG_LOG_START, VSCP_EVENT_ENCODER_LAYOUT_BYTES_1, id, 0, 0, 0, 0);
+}
 
 /**
  * Stop logging.
@@ -123,7 +132,10 @@ extern BOOL vscp_log_sendLogStartEvent(uint8_t id);
  * @retval TRUE  Event successful sent
  *
  */
-extern BOOL vscp_log_sendLogStopEvent(uint8_t id);
+static inline BOOL vscp_log_sendLogStopEvent(uint8_t id)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_LOG, VSCP_TYPE_LOG_LOG_STOP, VSCP_EVENT_ENCODER_LAYOUT_BYTES_1, id, 0, 0, 0, 0);
+}
 
 /**
  * Set level for logging.
@@ -134,7 +146,10 @@ extern BOOL vscp_log_sendLogStopEvent(uint8_t id);
  * @retval TRUE  Event successful sent
  *
  */
-extern BOOL vscp_log_sendLogLevelEvent(uint8_t level);
+static inline BOOL vscp_log_sendLogLevelEvent(uint8_t level)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_LOG, VSCP_TYPE_LOG_LOG_LEVEL, VSCP_EVENT_ENCODER_LAYOUT_BYTES_1, level, 0, 0, 0, 0);
+}
 
 #endif /* __VSCP_LOG_H__ */
 
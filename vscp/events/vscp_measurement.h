@@ -35,7 +35,7 @@
 @section desc Description
 Measurement information.
 
-This file is automatically generated. Don't change it manually.
+This file was generated once and is maintained by hand now.
 
 @section svn Subversion
 $Rev:  $
@@ -50,6 +50,9 @@ $Date:  $
 *******************************************************************************/
 #include <stdint.h>
 #include "vscp_types.h"
+#include "vscp_class_l1.h"
+#include "vscp_type_measurement.h"
+#include "vscp_event_encoder.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -83,7 +86,10 @@ $Date:  $
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendUndefinedEvent(void);
+static inline BOOL vscp_measurement_sendUndefinedEvent(void)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_UNDEFINED, VSCP_EVENT_ENCODER_LAYOUT_NONE, 0, 0, 0, 0, 0);
+}
 
 /**
  * This is a discrete value typical for a count. There is no unit for this measurement just a discrete
@@ -98,7 +104,10 @@ extern BOOL vscp_measurement_sendUndefinedEvent(void);
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendCountEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendCountEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_COUNT, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Meter.
@@ -114,7 +123,10 @@ extern BOOL vscp_measurement_sendCountEvent(uint8_t index, uint8_t unit, int32_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendLengthDistanceEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendLengthDistanceEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_LENGTH_DISTANCE, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Kilogram.
@@ -130,7 +142,10 @@ extern BOOL vscp_measurement_sendLengthDistanceEvent(uint8_t index, uint8_t unit
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendMassEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendMassEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_MASS, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Seconds.
@@ -147,7 +162,10 @@ extern BOOL vscp_measurement_sendMassEvent(uint8_t index, uint8_t unit, int32_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendTimeEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendTimeEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_TIME, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Ampere.
@@ -163,7 +181,10 @@ extern BOOL vscp_measurement_sendTimeEvent(uint8_t index, uint8_t unit, int32_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendElectricCurrentEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendElectricCurrentEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_ELECTRIC_CURRENT, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Kelvin.
@@ -181,7 +202,10 @@ extern BOOL vscp_measurement_sendElectricCurrentEvent(uint8_t index, uint8_t uni
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendTemperatureEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendTemperatureEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_TEMPERATURE, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Mole.
@@ -197,7 +221,10 @@ extern BOOL vscp_measurement_sendTemperatureEvent(uint8_t index, uint8_t unit, i
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendAmountOfSubstanceEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendAmountOfSubstanceEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_AMOUNT_OF_SUBSTANCE, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Candela.
@@ -213,7 +240,10 @@ extern BOOL vscp_measurement_sendAmountOfSubstanceEvent(uint8_t index, uint8_t u
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendLuminousIntensityEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendLuminousIntensityEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_LUMINOUS_INTENSITY, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Hertz.
@@ -229,7 +259,10 @@ extern BOOL vscp_measurement_sendLuminousIntensityEvent(uint8_t index, uint8_t u
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendFrequencyEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendFrequencyEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_FREQUENCY, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Becquerel.
@@ -245,7 +278,10 @@ extern BOOL vscp_measurement_sendFrequencyEvent(uint8_t index, uint8_t unit, int
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendRadioactivityAndOtherRandomEventsEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendRadioactivityAndOtherRandomEventsEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_RADIOACTIVITY_AND_OTHER_RANDOM_EVENTS, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Newton.
@@ -261,7 +297,10 @@ extern BOOL vscp_measurement_sendRadioactivityAndOtherRandomEventsEvent(uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendForceEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendForceEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_FORCE, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Pascal.
@@ -279,7 +318,10 @@ extern BOOL vscp_measurement_sendForceEvent(uint8_t index, uint8_t unit, int32_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendPressureEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendPressureEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_PRESSURE, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Joule.
@@ -295,7 +337,10 @@ extern BOOL vscp_measurement_sendPressureEvent(uint8_t index, uint8_t unit, int3
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendEnergyEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendEnergyEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_ENERGY, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Watt.
@@ -311,7 +356,10 @@ extern BOOL vscp_measurement_sendEnergyEvent(uint8_t index, uint8_t unit, int32_
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendPowerEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendPowerEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_POWER, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Coulomb.
@@ -327,7 +375,10 @@ extern BOOL vscp_measurement_sendPowerEvent(uint8_t index, uint8_t unit, int32_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendElectricalChargeEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendElectricalChargeEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_ELECTRICAL_CHARGE, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Volt.
@@ -343,7 +394,10 @@ extern BOOL vscp_measurement_sendElectricalChargeEvent(uint8_t index, uint8_t un
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendElectricalPotentialEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendElectricalPotentialEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_ELECTRICAL_POTENTIAL, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Farad.
@@ -359,7 +413,10 @@ extern BOOL vscp_measurement_sendElectricalPotentialEvent(uint8_t index, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendElectricalCapacitanceEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendElectricalCapacitanceEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_ELECTRICAL_CAPACITANCE, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Ohm.
@@ -375,7 +432,10 @@ extern BOOL vscp_measurement_sendElectricalCapacitanceEvent(uint8_t index, uint8
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendElectricalResistanceEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendElectricalResistanceEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_ELECTRICAL_RESISTANCE, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Siemens.
@@ -391,7 +451,10 @@ extern BOOL vscp_measurement_sendElectricalResistanceEvent(uint8_t index, uint8_
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendElectricalConductanceEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendElectricalConductanceEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_ELECTRICAL_CONDUCTANCE, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Ampere meters.
@@ -407,7 +470,10 @@ extern BOOL vscp_measurement_sendElectricalConductanceEvent(uint8_t index, uint8
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendMagneticFieldStrengthEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendMagneticFieldStrengthEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_MAGNETIC_FIELD_STRENGTH, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Weber.
@@ -423,7 +489,10 @@ extern BOOL vscp_measurement_sendMagneticFieldStrengthEvent(uint8_t index, uint8
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendMagneticFluxEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendMagneticFluxEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_MAGNETIC_FLUX, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Tesla.
@@ -440,7 +509,10 @@ extern BOOL vscp_measurement_sendMagneticFluxEvent(uint8_t index, uint8_t unit,
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendMagneticFluxDensityEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendMagneticFluxDensityEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_MAGNETIC_FLUX_DENSITY, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Henry.
@@ -456,7 +528,10 @@ extern BOOL vscp_measurement_sendMagneticFluxDensityEvent(uint8_t index, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendInductanceEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendInductanceEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_INDUCTANCE, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Lumen (lm= cd * sr)
@@ -472,7 +547,10 @@ extern BOOL vscp_measurement_sendInductanceEvent(uint8_t index, uint8_t unit, in
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendLuminousFluxEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendLuminousFluxEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_LUMINOUS_FLUX, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Lux ( lx = lm / m² )
@@ -489,7 +567,10 @@ extern BOOL vscp_measurement_sendLuminousFluxEvent(uint8_t index, uint8_t unit,
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendIlluminanceEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendIlluminanceEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_ILLUMINANCE, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Gray. Opt unit: Sievert.
@@ -505,7 +586,10 @@ extern BOOL vscp_measurement_sendIlluminanceEvent(uint8_t index, uint8_t unit, i
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendRadiationDoseEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendRadiationDoseEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_RADIATION_DOSE, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Katal.
@@ -521,7 +605,10 @@ extern BOOL vscp_measurement_sendRadiationDoseEvent(uint8_t index, uint8_t unit,
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendCatalyticActivityEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendCatalyticActivityEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_CATALYTIC_ACTIVITY, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: cubic meter
@@ -539,7 +626,10 @@ extern BOOL vscp_measurement_sendCatalyticActivityEvent(uint8_t index, uint8_t u
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendVolumeEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendVolumeEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_VOLUME, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Bel.
@@ -557,7 +647,10 @@ extern BOOL vscp_measurement_sendVolumeEvent(uint8_t index, uint8_t unit, int32_
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendSoundIntensityEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendSoundIntensityEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_SOUND_INTENSITY, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Radian (Plane angles). Opt Unit: Degree (1) Opt Unit: Arcminute (2) Opt Unit:
@@ -574,7 +667,10 @@ extern BOOL vscp_measurement_sendSoundIntensityEvent(uint8_t index, uint8_t unit
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendAngleEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendAngleEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_ANGLE, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Longitude.
@@ -592,7 +688,10 @@ extern BOOL vscp_measurement_sendAngleEvent(uint8_t index, uint8_t unit, int32_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendPositionEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendPositionEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_POSITION, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Meters per second.
@@ -608,7 +707,10 @@ extern BOOL vscp_measurement_sendPositionEvent(uint8_t index, uint8_t unit, int3
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendSpeedEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendSpeedEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_SPEED, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Meters per second/second.
@@ -624,7 +726,10 @@ extern BOOL vscp_measurement_sendSpeedEvent(uint8_t index, uint8_t unit, int32_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendAccelerationEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendAccelerationEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_ACCELERATION, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: N/m.
@@ -640,7 +745,10 @@ extern BOOL vscp_measurement_sendAccelerationEvent(uint8_t index, uint8_t unit,
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendTensionEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendTensionEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_TENSION, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Relative percentage 0-100%.
@@ -656,7 +764,10 @@ extern BOOL vscp_measurement_sendTensionEvent(uint8_t index, uint8_t unit, int32
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendDampMoistEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendDampMoistEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_DAMP_MOIST, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Cubic meters/second. Opt Unit: Liter/Second.
@@ -672,7 +783,10 @@ extern BOOL vscp_measurement_sendDampMoistEvent(uint8_t index, uint8_t unit, int
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendFlowEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendFlowEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_FLOW, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Thermal ohm K/W.
@@ -688,7 +802,10 @@ extern BOOL vscp_measurement_sendFlowEvent(uint8_t index, uint8_t unit, int32_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendThermalResistanceEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendThermalResistanceEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_THERMAL_RESISTANCE, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Dioptre (dpt) m-1.
@@ -704,7 +821,10 @@ extern BOOL vscp_measurement_sendThermalResistanceEvent(uint8_t index, uint8_t u
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendRefractivePowerEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendRefractivePowerEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_REFRACTIVE_POWER, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Poiseuille (Pl) Pa . s.
@@ -720,7 +840,10 @@ extern BOOL vscp_measurement_sendRefractivePowerEvent(uint8_t index, uint8_t uni
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendDynamicViscosityEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendDynamicViscosityEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_DYNAMIC_VISCOSITY, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Rayal Pa . s/m.
@@ -736,7 +859,10 @@ extern BOOL vscp_measurement_sendDynamicViscosityEvent(uint8_t index, uint8_t un
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendSoundImpedanceEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendSoundImpedanceEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_SOUND_IMPEDANCE, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Acoustic ohm Pa . s/ m³.
@@ -752,7 +878,10 @@ extern BOOL vscp_measurement_sendSoundImpedanceEvent(uint8_t index, uint8_t unit
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendSoundResistanceEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendSoundResistanceEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_SOUND_RESISTANCE, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Darag F-1.
@@ -768,7 +897,10 @@ extern BOOL vscp_measurement_sendSoundResistanceEvent(uint8_t index, uint8_t uni
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendElectricElastanceEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendElectricElastanceEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_ELECTRIC_ELASTANCE, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Talbot ( tb = lm * s)
@@ -784,7 +916,10 @@ extern BOOL vscp_measurement_sendElectricElastanceEvent(uint8_t index, uint8_t u
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendLuminousEnergyEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendLuminousEnergyEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_LUMINOUS_ENERGY, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Nit (nt = cd / m²)
@@ -800,7 +935,10 @@ extern BOOL vscp_measurement_sendLuminousEnergyEvent(uint8_t index, uint8_t unit
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendLuminanceEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendLuminanceEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_LUMINANCE, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Molal mol/kg.
@@ -816,7 +954,10 @@ extern BOOL vscp_measurement_sendLuminanceEvent(uint8_t index, uint8_t unit, int
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendChemicalConcentrationEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendChemicalConcentrationEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_CHEMICAL_CONCENTRATION, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Sievert J/Kg.
@@ -832,7 +973,10 @@ extern BOOL vscp_measurement_sendChemicalConcentrationEvent(uint8_t index, uint8
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendDoseEquivalentEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendDoseEquivalentEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_DOSE_EQUIVALENT, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Kelvin.
@@ -850,7 +994,10 @@ extern BOOL vscp_measurement_sendDoseEquivalentEvent(uint8_t index, uint8_t unit
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendDewPointEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendDewPointEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_DEW_POINT, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Relative value.
@@ -867,7 +1014,10 @@ extern BOOL vscp_measurement_sendDewPointEvent(uint8_t index, uint8_t unit, int3
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendRelativeLevelEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendRelativeLevelEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_RELATIVE_LEVEL, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: Meter.
@@ -885,7 +1035,10 @@ extern BOOL vscp_measurement_sendRelativeLevelEvent(uint8_t index, uint8_t unit,
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendAltitude(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendAltitude(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_ALTITUDE, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: square meter (m²)
@@ -901,7 +1054,10 @@ extern BOOL vscp_measurement_sendAltitude(uint8_t index, uint8_t unit, int32_t d
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendAreaEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendAreaEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_AREA, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: watt per steradian ( W / sr )
@@ -917,7 +1073,10 @@ extern BOOL vscp_measurement_sendAreaEvent(uint8_t index, uint8_t unit, int32_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendRadiantIntensityEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendRadiantIntensityEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_RADIANT_INTENSITY, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Default unit: att per steradian per square metre ( W / (sr * m²) )
@@ -931,7 +1090,10 @@ extern BOOL vscp_measurement_sendRadiantIntensityEvent(uint8_t index, uint8_t un
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendRadianceEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendRadianceEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_RADIANCE, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Power emitted from or striking onto a surface or area.
@@ -947,7 +1109,10 @@ extern BOOL vscp_measurement_sendRadianceEvent(uint8_t index, uint8_t unit, int3
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendIrradianceExitanceRadiosityEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendIrradianceExitanceRadiosityEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_IRRADIANCE_EXITANCE_RADIOSITY, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Radiance of a surface per unit frequency or wavelength.
@@ -966,7 +1131,10 @@ extern BOOL vscp_measurement_sendIrradianceExitanceRadiosityEvent(uint8_t index,
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendSpectralRadianceEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendSpectralRadianceEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_SPECTRAL_RADIANCE, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Irradiance of a surface per unit frequency or wavelength.
@@ -984,7 +1152,10 @@ extern BOOL vscp_measurement_sendSpectralRadianceEvent(uint8_t index, uint8_t un
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendSpectralIrradianceEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendSpectralIrradianceEvent(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_SPECTRAL_IRRADIANCE, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * This is a measurement of sound pressure (acoustic pressure). 
@@ -1000,7 +1171,10 @@ extern BOOL vscp_measurement_sendSpectralIrradianceEvent(uint8_t index, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendSoundPressure(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendSoundPressure(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_SOUND_PRESSURE, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Sound energy density or sound density is the sound energy per unit volume.
@@ -1016,7 +1190,10 @@ extern BOOL vscp_measurement_sendSoundPressure(uint8_t index, uint8_t unit, int3
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendSoundEnergyDensity(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendSoundEnergyDensity(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_SOUND_DENSITY, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 /**
  * Sound level expressed in decibel. This event is supplied for convenience.
@@ -1032,6 +1209,9 @@ extern BOOL vscp_measurement_sendSoundEnergyDensity(uint8_t index, uint8_t unit,
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurement_sendSoundLevel(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static inline BOOL vscp_measurement_sendSoundLevel(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_SOUND_LEVEL, VSCP_EVENT_ENCODER_LAYOUT_NORMALIZED, index, unit, 0, data, exp);
+}
 
 #endif /* __VSCP_MEASUREMENT_H__ */
@@ -35,7 +35,7 @@
 @section desc Description
 Measurements with zone information.
 
-This file is automatically generated. Don't change it manually.
+This file was generated once and is maintained by hand now.
 
 @section svn Subversion
 $Rev:  $
@@ -50,6 +50,9 @@ $Date:  $
 *******************************************************************************/
 #include <stdint.h>
 #include "vscp_types.h"
+#include "vscp_class_l1.h"
+#include "vscp_type_measurezone.h"
+#include "vscp_event_encoder.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -83,7 +86,10 @@ $Date:  $
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendUndefinedEvent(void);
+static inline BOOL vscp_measurezone_sendUndefinedEvent(void)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_UNDEFINED, VSCP_EVENT_ENCODER_LAYOUT_NONE, 0, 0, 0, 0, 0);
+}
 
 /**
  * This is a discrete value typical for a count. There is no unit for this measurement just a discrete
@@ -99,7 +105,10 @@ extern BOOL vscp_measurezone_sendUndefinedEvent(void);
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendCountEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendCountEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_COUNT, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Meter.
@@ -116,7 +125,10 @@ extern BOOL vscp_measurezone_sendCountEvent(uint8_t index, uint8_t zone, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendLengthDistanceEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendLengthDistanceEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_LENGTH_DISTANCE, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Kilogram.
@@ -133,7 +145,10 @@ extern BOOL vscp_measurezone_sendLengthDistanceEvent(uint8_t index, uint8_t zone
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendMassEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendMassEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_MASS, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Seconds.
@@ -151,7 +166,10 @@ extern BOOL vscp_measurezone_sendMassEvent(uint8_t index, uint8_t zone, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendTimeEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendTimeEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_TIME, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Ampere.
@@ -168,7 +186,10 @@ extern BOOL vscp_measurezone_sendTimeEvent(uint8_t index, uint8_t zone, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendElectricCurrentEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendElectricCurrentEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_ELECTRIC_CURRENT, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Kelvin.
@@ -187,7 +208,10 @@ extern BOOL vscp_measurezone_sendElectricCurrentEvent(uint8_t index, uint8_t zon
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendTemperatureEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendTemperatureEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_TEMPERATURE, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Mole.
@@ -204,7 +228,10 @@ extern BOOL vscp_measurezone_sendTemperatureEvent(uint8_t index, uint8_t zone, u
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendAmountOfSubstanceEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendAmountOfSubstanceEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_AMOUNT_OF_SUBSTANCE, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Candela.
@@ -221,7 +248,10 @@ extern BOOL vscp_measurezone_sendAmountOfSubstanceEvent(uint8_t index, uint8_t z
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendLuminousIntensityEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendLuminousIntensityEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_LUMINOUS_INTENSITY, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Hertz.
@@ -238,7 +268,10 @@ extern BOOL vscp_measurezone_sendLuminousIntensityEvent(uint8_t index, uint8_t z
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendFrequencyEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendFrequencyEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_FREQUENCY, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Becquerel.
@@ -255,7 +288,10 @@ extern BOOL vscp_measurezone_sendFrequencyEvent(uint8_t index, uint8_t zone, uin
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendRadioactivityAndOtherRandomEventsEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendRadioactivityAndOtherRandomEventsEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_RADIOACTIVITY_AND_OTHER_RANDOM_EVENTS, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Newton.
@@ -272,7 +308,10 @@ extern BOOL vscp_measurezone_sendRadioactivityAndOtherRandomEventsEvent(uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendForceEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendForceEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_FORCE, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Pascal.
@@ -291,7 +330,10 @@ extern BOOL vscp_measurezone_sendForceEvent(uint8_t index, uint8_t zone, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendPressureEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendPressureEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_PRESSURE, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Joule.
@@ -308,7 +350,10 @@ extern BOOL vscp_measurezone_sendPressureEvent(uint8_t index, uint8_t zone, uint
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendEnergyEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendEnergyEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_ENERGY, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Watt.
@@ -325,7 +370,10 @@ extern BOOL vscp_measurezone_sendEnergyEvent(uint8_t index, uint8_t zone, uint8_
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendPowerEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendPowerEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_POWER, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Coulomb.
@@ -342,7 +390,10 @@ extern BOOL vscp_measurezone_sendPowerEvent(uint8_t index, uint8_t zone, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendElectricalChargeEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendElectricalChargeEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_ELECTRICAL_CHARGE, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Volt.
@@ -359,7 +410,10 @@ extern BOOL vscp_measurezone_sendElectricalChargeEvent(uint8_t index, uint8_t zo
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendElectricalPotentialEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendElectricalPotentialEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_ELECTRICAL_POTENTIAL, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Farad.
@@ -376,7 +430,10 @@ extern BOOL vscp_measurezone_sendElectricalPotentialEvent(uint8_t index, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendElectricalCapacitanceEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendElectricalCapacitanceEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_ELECTRICAL_CAPACITANCE, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Ohm.
@@ -393,7 +450,10 @@ extern BOOL vscp_measurezone_sendElectricalCapacitanceEvent(uint8_t index, uint8
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendElectricalResistanceEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendElectricalResistanceEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_ELECTRICAL_RESISTANCE, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Siemens.
@@ -410,7 +470,10 @@ extern BOOL vscp_measurezone_sendElectricalResistanceEvent(uint8_t index, uint8_
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendElectricalConductanceEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendElectricalConductanceEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_ELECTRICAL_CONDUCTANCE, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Ampere meters.
@@ -427,7 +490,10 @@ extern BOOL vscp_measurezone_sendElectricalConductanceEvent(uint8_t index, uint8
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendMagneticFieldStrengthEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendMagneticFieldStrengthEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_MAGNETIC_FIELD_STRENGTH, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Weber.
@@ -444,7 +510,10 @@ extern BOOL vscp_measurezone_sendMagneticFieldStrengthEvent(uint8_t index, uint8
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendMagneticFluxEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendMagneticFluxEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_MAGNETIC_FLUX, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Tesla.
@@ -462,7 +531,10 @@ extern BOOL vscp_measurezone_sendMagneticFluxEvent(uint8_t index, uint8_t zone,
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendMagneticFluxDensityEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendMagneticFluxDensityEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_MAGNETIC_FLUX_DENSITY, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Henry.
@@ -479,7 +551,10 @@ extern BOOL vscp_measurezone_sendMagneticFluxDensityEvent(uint8_t index, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendInductanceEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendInductanceEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_INDUCTANCE, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Lumen (lm= cd * sr)
@@ -496,7 +571,10 @@ extern BOOL vscp_measurezone_sendInductanceEvent(uint8_t index, uint8_t zone, ui
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendLuminousFluxEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendLuminousFluxEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_LUMINOUS_FLUX, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Lux ( lx = lm / m² )
@@ -514,7 +592,10 @@ extern BOOL vscp_measurezone_sendLuminousFluxEvent(uint8_t index, uint8_t zone,
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendIlluminanceEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendIlluminanceEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_ILLUMINANCE, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Gray. Opt unit: Sievert.
@@ -531,7 +612,10 @@ extern BOOL vscp_measurezone_sendIlluminanceEvent(uint8_t index, uint8_t zone, u
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendRadiationDoseEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendRadiationDoseEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_RADIATION_DOSE, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Katal.
@@ -548,7 +632,10 @@ extern BOOL vscp_measurezone_sendRadiationDoseEvent(uint8_t index, uint8_t zone,
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendCatalyticActivityEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendCatalyticActivityEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_CATALYTIC_ACTIVITY, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: cubic meter
@@ -567,7 +654,10 @@ extern BOOL vscp_measurezone_sendCatalyticActivityEvent(uint8_t index, uint8_t z
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendVolumeEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendVolumeEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_VOLUME, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Bel.
@@ -586,7 +676,10 @@ extern BOOL vscp_measurezone_sendVolumeEvent(uint8_t index, uint8_t zone, uint8_
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendSoundIntensityEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendSoundIntensityEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_SOUND_INTENSITY, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Radian (Plane angles). Opt Unit: Degree (1) Opt Unit: Arcminute (2) Opt Unit:
@@ -604,7 +697,10 @@ extern BOOL vscp_measurezone_sendSoundIntensityEvent(uint8_t index, uint8_t zone
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendAngleEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendAngleEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_ANGLE, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Longitude.
@@ -623,7 +719,10 @@ extern BOOL vscp_measurezone_sendAngleEvent(uint8_t index, uint8_t zone, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendPositionEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendPositionEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_POSITION, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Meters per second.
@@ -640,7 +739,10 @@ extern BOOL vscp_measurezone_sendPositionEvent(uint8_t index, uint8_t zone, uint
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendSpeedEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendSpeedEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_SPEED, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Meters per second/second.
@@ -657,7 +759,10 @@ extern BOOL vscp_measurezone_sendSpeedEvent(uint8_t index, uint8_t zone, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendAccelerationEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendAccelerationEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_ACCELERATION, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: N/m.
@@ -674,7 +779,10 @@ extern BOOL vscp_measurezone_sendAccelerationEvent(uint8_t index, uint8_t zone,
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendTensionEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendTensionEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_TENSION, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Relative percentage 0-100%.
@@ -691,7 +799,10 @@ extern BOOL vscp_measurezone_sendTensionEvent(uint8_t index, uint8_t zone, uint8
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendDampMoistEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendDampMoistEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_DAMP_MOIST, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Cubic meters/second. Opt Unit: Liter/Second.
@@ -708,7 +819,10 @@ extern BOOL vscp_measurezone_sendDampMoistEvent(uint8_t index, uint8_t zone, uin
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendFlowEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendFlowEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_FLOW, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Thermal ohm K/W.
@@ -725,7 +839,10 @@ extern BOOL vscp_measurezone_sendFlowEvent(uint8_t index, uint8_t zone, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendThermalResistanceEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendThermalResistanceEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_THERMAL_RESISTANCE, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Dioptre (dpt) m-1.
@@ -742,7 +859,10 @@ extern BOOL vscp_measurezone_sendThermalResistanceEvent(uint8_t index, uint8_t z
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendRefractivePowerEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendRefractivePowerEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_REFRACTIVE_POWER, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Poiseuille (Pl) Pa . s.
@@ -759,7 +879,10 @@ extern BOOL vscp_measurezone_sendRefractivePowerEvent(uint8_t index, uint8_t zon
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendDynamicViscosityEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendDynamicViscosityEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_DYNAMIC_VISCOSITY, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Rayal Pa . s/m.
@@ -776,7 +899,10 @@ extern BOOL vscp_measurezone_sendDynamicViscosityEvent(uint8_t index, uint8_t zo
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendSoundImpedanceEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendSoundImpedanceEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_SOUND_IMPEDANCE, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Acoustic ohm Pa . s/ m³.
@@ -793,7 +919,10 @@ extern BOOL vscp_measurezone_sendSoundImpedanceEvent(uint8_t index, uint8_t zone
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendSoundResistanceEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendSoundResistanceEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_SOUND_RESISTANCE, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Darag F-1.
@@ -810,7 +939,10 @@ extern BOOL vscp_measurezone_sendSoundResistanceEvent(uint8_t index, uint8_t zon
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendElectricElastanceEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendElectricElastanceEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_ELECTRIC_ELASTANCE, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Talbot ( tb = lm * s)
@@ -827,7 +959,10 @@ extern BOOL vscp_measurezone_sendElectricElastanceEvent(uint8_t index, uint8_t z
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendLuminousEnergyEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendLuminousEnergyEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_LUMINOUS_ENERGY, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Nit (nt = cd / m²)
@@ -844,7 +979,10 @@ extern BOOL vscp_measurezone_sendLuminousEnergyEvent(uint8_t index, uint8_t zone
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendLuminanceEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendLuminanceEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_LUMINANCE, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Molal mol/kg.
@@ -861,7 +999,10 @@ extern BOOL vscp_measurezone_sendLuminanceEvent(uint8_t index, uint8_t zone, uin
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendChemicalConcentrationEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendChemicalConcentrationEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_CHEMICAL_CONCENTRATION, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Sievert J/Kg.
@@ -878,7 +1019,10 @@ extern BOOL vscp_measurezone_sendChemicalConcentrationEvent(uint8_t index, uint8
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendDoseEquivalentEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendDoseEquivalentEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_DOSE_EQUIVALENT, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Kelvin.
@@ -897,7 +1041,10 @@ extern BOOL vscp_measurezone_sendDoseEquivalentEvent(uint8_t index, uint8_t zone
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendDewPointEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendDewPointEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_DEW_POINT, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Relative value.
@@ -915,7 +1062,10 @@ extern BOOL vscp_measurezone_sendDewPointEvent(uint8_t index, uint8_t zone, uint
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendRelativeLevelEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendRelativeLevelEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_RELATIVE_LEVEL, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: Meter.
@@ -934,7 +1084,10 @@ extern BOOL vscp_measurezone_sendRelativeLevelEvent(uint8_t index, uint8_t zone,
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendAltitude(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendAltitude(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_ALTITUDE, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: square meter (m²)
@@ -951,7 +1104,10 @@ extern BOOL vscp_measurezone_sendAltitude(uint8_t index, uint8_t zone, uint8_t s
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendAreaEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendAreaEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_AREA, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: watt per steradian ( W / sr )
@@ -968,7 +1124,10 @@ extern BOOL vscp_measurezone_sendAreaEvent(uint8_t index, uint8_t zone, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendRadiantIntensityEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendRadiantIntensityEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_RADIANT_INTENSITY, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: att per steradian per square metre ( W / (sr * m²) )
@@ -983,7 +1142,10 @@ extern BOOL vscp_measurezone_sendRadiantIntensityEvent(uint8_t index, uint8_t zo
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendRadianceEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendRadianceEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_RADIANCE, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: watt per square metre ( W / m² )
@@ -1000,7 +1162,10 @@ extern BOOL vscp_measurezone_sendRadianceEvent(uint8_t index, uint8_t zone, uint
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendIrradianceExitanceRadiosityEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendIrradianceExitanceRadiosityEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_IRRADIANCE_EXITANCE_RADIOSITY, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: watt per steradian per square metre per nm (W·sr-1·m-2·nm-1)
@@ -1018,7 +1183,10 @@ extern BOOL vscp_measurezone_sendIrradianceExitanceRadiosityEvent(uint8_t index,
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendSpectralRadianceEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendSpectralRadianceEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_SPECTRAL_RADIANCE, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 /**
  * Default unit: watt per square metre per nm (W·m-2·nm-1)
@@ -1035,6 +1203,9 @@ extern BOOL vscp_measurezone_sendSpectralRadianceEvent(uint8_t index, uint8_t zo
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_measurezone_sendSpectralIrradianceEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp);
+static inline BOOL vscp_measurezone_sendSpectralIrradianceEvent(uint8_t index, uint8_t zone, uint8_t subZone, int32_t data, int8_t exp)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_MEASUREZONE, VSCP_TYPE_MEASUREZONE_SPECTRAL_IRRADIANCE, VSCP_EVENT_ENCODER_LAYOUT_ZONE_NORMALIZED, index, zone, subZone, data, exp);
+}
 
 #endif /* __VSCP_MEASUREZONE_H__ */
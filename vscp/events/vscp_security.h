@@ -35,7 +35,7 @@
 @section desc Description
 Security related events for alarms and similar devices.
 
-This file is automatically generated. Don't change it manually.
+This file was generated once and is maintained by hand now.
 
 *******************************************************************************/
 /** @defgroup vscp_security Security events abstraction
@@ -52,6 +52,9 @@ This file is automatically generated. Don't change it manually.
 *******************************************************************************/
 #include <stdint.h>
 #include "vscp_types.h"
+#include "vscp_class_l1.h"
+#include "vscp_type_security.h"
+#include "vscp_event_encoder.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -85,7 +88,10 @@ This file is automatically generated. Don't change it manually.
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_security_sendUndefinedEvent(void);
+static inline BOOL vscp_security_sendUndefinedEvent(void)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_SECURITY, VSCP_TYPE_SECURITY_UNDEFINED, VSCP_EVENT_ENCODER_LAYOUT_NONE, 0, 0, 0, 0, 0);
+}
 
 /**
  * A motion has been detected.
@@ -98,7 +104,10 @@ extern BOOL vscp_security_sendUndefinedEvent(void);
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_security_sendMotionDetectEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_security_sendMotionDetectEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_SECURITY, VSCP_TYPE_SECURITY_MOTION_DETECT, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * A glass break event has been detected.
@@ -111,7 +120,10 @@ extern BOOL vscp_security_sendMotionDetectEvent(uint8_t userData, uint8_t zone,
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_security_sendGlassBreakEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_security_sendGlassBreakEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_SECURITY, VSCP_TYPE_SECURITY_GLASS_BREAK, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * A beam break event has been detected.
@@ -124,7 +136,10 @@ extern BOOL vscp_security_sendGlassBreakEvent(uint8_t userData, uint8_t zone, ui
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_security_sendBeamBreakEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_security_sendBeamBreakEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_SECURITY, VSCP_TYPE_SECURITY_BEAM_BREAK, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * A sensor tamper has been detected.
@@ -137,7 +152,10 @@ extern BOOL vscp_security_sendBeamBreakEvent(uint8_t userData, uint8_t zone, uin
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_security_sendSensorTamperEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_security_sendSensorTamperEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_SECURITY, VSCP_TYPE_SECURITY_SENSOR_TAMPER, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * A shock sensor event has been detected.
@@ -150,7 +168,10 @@ extern BOOL vscp_security_sendSensorTamperEvent(uint8_t userData, uint8_t zone,
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_security_sendShockSensorEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_security_sendShockSensorEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_SECURITY, VSCP_TYPE_SECURITY_SHOCK_SENSOR, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * A smoke sensor event has been detected.
@@ -163,7 +184,10 @@ extern BOOL vscp_security_sendShockSensorEvent(uint8_t userData, uint8_t zone, u
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_security_sendSmokeSensorEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_security_sendSmokeSensorEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_SECURITY, VSCP_TYPE_SECURITY_SMOKE_SENSOR, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * A heat sensor event has been detected.
@@ -176,7 +200,10 @@ extern BOOL vscp_security_sendSmokeSensorEvent(uint8_t userData, uint8_t zone, u
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_security_sendHeatSensorEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_security_sendHeatSensorEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_SECURITY, VSCP_TYPE_SECURITY_HEAT_SENSOR, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * A panic switch event has been detected.
@@ -189,7 +216,10 @@ extern BOOL vscp_security_sendHeatSensorEvent(uint8_t userData, uint8_t zone, ui
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_security_sendPanicSwitchEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_security_sendPanicSwitchEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_SECURITY, VSCP_TYPE_SECURITY_PANIC_SWITCH, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * Indicates a door sensor reports that a door is open.
@@ -202,7 +232,10 @@ extern BOOL vscp_security_sendPanicSwitchEvent(uint8_t userData, uint8_t zone, u
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_security_sendDoorContactEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_security_sendDoorContactEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_SECURITY, VSCP_TYPE_SECURITY_DOOR_CONTACT, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * Indicates a window sensor reports that a window is open.
@@ -215,7 +248,10 @@ extern BOOL vscp_security_sendDoorContactEvent(uint8_t userData, uint8_t zone, u
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_security_sendWindowContactEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_security_sendWindowContactEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_SECURITY, VSCP_TYPE_SECURITY_WINDOW_CONTACT, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * CO sensor has detected CO at non secure level
@@ -228,7 +264,10 @@ extern BOOL vscp_security_sendWindowContactEvent(uint8_t userData, uint8_t zone,
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_security_sendCoSensorEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_security_sendCoSensorEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_SECURITY, VSCP_TYPE_SECURITY_CO_SENSOR, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * A frost sensor condition is detected
@@ -241,7 +280,10 @@ extern BOOL vscp_security_sendCoSensorEvent(uint8_t userData, uint8_t zone, uint
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_security_sendFrostDetectedEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_security_sendFrostDetectedEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_SECURITY, VSCP_TYPE_SECURITY_FROST_DETECTED, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * Flame is detected.
@@ -254,7 +296,10 @@ extern BOOL vscp_security_sendFrostDetectedEvent(uint8_t userData, uint8_t zone,
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_security_sendFlameDetectedEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_security_sendFlameDetectedEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_SECURITY, VSCP_TYPE_SECURITY_FLAME_DETECTED, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * Low oxygen level detected.
@@ -267,7 +312,10 @@ extern BOOL vscp_security_sendFlameDetectedEvent(uint8_t userData, uint8_t zone,
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_security_sendOxygenLowEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_security_sendOxygenLowEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_SECURITY, VSCP_TYPE_SECURITY_OXYGEN_LOW, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * Weight-detector triggered.
@@ -280,7 +328,10 @@ extern BOOL vscp_security_sendOxygenLowEvent(uint8_t userData, uint8_t zone, uin
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_security_sendWeightDetectedEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_security_sendWeightDetectedEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_SECURITY, VSCP_TYPE_SECURITY_WEIGHT_DETECTED, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * Water has been detected.
@@ -293,7 +344,10 @@ extern BOOL vscp_security_sendWeightDetectedEvent(uint8_t userData, uint8_t zone
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_security_sendWaterDetectedEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_security_sendWaterDetectedEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_SECURITY, VSCP_TYPE_SECURITY_WATER_DETECTED, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * Condensation (humidity) detected.
@@ -306,7 +360,10 @@ extern BOOL vscp_security_sendWaterDetectedEvent(uint8_t userData, uint8_t zone,
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_security_sendCondensationDetectedEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_security_sendCondensationDetectedEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_SECURITY, VSCP_TYPE_SECURITY_CONDENSATION_DETECTED, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * Noise (sound) has been detected.
@@ -319,7 +376,10 @@ extern BOOL vscp_security_sendCondensationDetectedEvent(uint8_t userData, uint8_
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_security_sendNoiseDetectedEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_security_sendNoiseDetectedEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_SECURITY, VSCP_TYPE_SECURITY_NOISE_DETECTED, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * Harmful sound levels detected.
@@ -332,7 +392,10 @@ extern BOOL vscp_security_sendNoiseDetectedEvent(uint8_t userData, uint8_t zone,
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_security_sendHarmfulSoundLevelsDetectedEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_security_sendHarmfulSoundLevelsDetectedEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_SECURITY, VSCP_TYPE_SECURITY_HARMFUL_SOUND_LEVELS_DETECTED, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 /**
  * Tamper detected.
@@ -345,7 +408,10 @@ extern BOOL vscp_security_sendHarmfulSoundLevelsDetectedEvent(uint8_t userData,
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_security_sendTamperDetectedEvent(uint8_t userData, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_security_sendTamperDetectedEvent(uint8_t userData, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_SECURITY, VSCP_TYPE_SECURITY_TAMPER_DETECTED, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, userData, zone, subZone, 0, 0);
+}
 
 #endif /* __VSCP_SECURITY_H__ */
 
@@ -35,7 +35,7 @@
 @section desc Description
 Weather reporting. Used to report current weather conditions.
 
-This file is automatically generated. Don't change it manually.
+This file was generated once and is maintained by hand now.
 
 *******************************************************************************/
 /** @defgroup vscp_weather Weather events abstraction
@@ -52,6 +52,9 @@ This file is automatically generated. Don't change it manually.
 *******************************************************************************/
 #include <stdint.h>
 #include "vscp_types.h"
+#include "vscp_class_l1.h"
+#include "vscp_type_weather.h"
+#include "vscp_event_encoder.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -85,7 +88,10 @@ This file is automatically generated. Don't change it manually.
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendUndefinedEvent(void);
+static inline BOOL vscp_weather_sendUndefinedEvent(void)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_UNDEFINED, VSCP_EVENT_ENCODER_LAYOUT_NONE, 0, 0, 0, 0, 0);
+}
 
 /**
  * The winter season as started.
@@ -98,7 +104,10 @@ extern BOOL vscp_weather_sendUndefinedEvent(void);
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendSeasonWinterEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendSeasonWinterEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_SEASON_WINTER, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * The spring season has started.
@@ -111,7 +120,10 @@ extern BOOL vscp_weather_sendSeasonWinterEvent(uint8_t index, uint8_t zone, uint
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendSeasonSpringEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendSeasonSpringEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_SEASON_SPRING, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * The summer season has started.
@@ -124,7 +136,10 @@ extern BOOL vscp_weather_sendSeasonSpringEvent(uint8_t index, uint8_t zone, uint
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendSeasonSummerEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendSeasonSummerEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_SEASON_SUMMER, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * The autumn season has started.
@@ -137,7 +152,10 @@ extern BOOL vscp_weather_sendSeasonSummerEvent(uint8_t index, uint8_t zone, uint
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendAutumnSummerEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendAutumnSummerEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_AUTUMN_SUMMER, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * No wind
@@ -150,7 +168,10 @@ extern BOOL vscp_weather_sendAutumnSummerEvent(uint8_t index, uint8_t zone, uint
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendWinNoneEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendWinNoneEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_WIN_NONE, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Low wind speed conditions.
@@ -163,7 +184,10 @@ extern BOOL vscp_weather_sendWinNoneEvent(uint8_t index, uint8_t zone, uint8_t s
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendLowWindEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendLowWindEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_LOW_WIND, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Medium wind speed conditions.
@@ -176,7 +200,10 @@ extern BOOL vscp_weather_sendLowWindEvent(uint8_t index, uint8_t zone, uint8_t s
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendMediumWindEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendMediumWindEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_MEDIUM_WIND, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * High wind speed conditions.
@@ -189,7 +216,10 @@ extern BOOL vscp_weather_sendMediumWindEvent(uint8_t index, uint8_t zone, uint8_
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendHighWindEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendHighWindEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_HIGH_WIND, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Very high wind speed conditions.
@@ -202,7 +232,10 @@ extern BOOL vscp_weather_sendHighWindEvent(uint8_t index, uint8_t zone, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendVeryHighWindEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendVeryHighWindEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_VERY_HIGH_WIND, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Fogg.
@@ -215,7 +248,10 @@ extern BOOL vscp_weather_sendVeryHighWindEvent(uint8_t index, uint8_t zone, uint
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendAirFoggyEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendAirFoggyEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_AIR_FOGGY, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Freezing.
@@ -228,7 +264,10 @@ extern BOOL vscp_weather_sendAirFoggyEvent(uint8_t index, uint8_t zone, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendAirFreezingEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendAirFreezingEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_AIR_FREEZING, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Cold
@@ -241,7 +280,10 @@ extern BOOL vscp_weather_sendAirFreezingEvent(uint8_t index, uint8_t zone, uint8
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendColdEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendColdEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_COLD, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Very cold
@@ -254,7 +296,10 @@ extern BOOL vscp_weather_sendColdEvent(uint8_t index, uint8_t zone, uint8_t subZ
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendVeryColdEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendVeryColdEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_VERY_COLD, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Air normal
@@ -267,7 +312,10 @@ extern BOOL vscp_weather_sendVeryColdEvent(uint8_t index, uint8_t zone, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendAirNormalEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendAirNormalEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_AIR_NORMAL, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Air hot
@@ -280,7 +328,10 @@ extern BOOL vscp_weather_sendAirNormalEvent(uint8_t index, uint8_t zone, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendAirHotEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendAirHotEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_AIR_HOT, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Air very hot
@@ -293,7 +344,10 @@ extern BOOL vscp_weather_sendAirHotEvent(uint8_t index, uint8_t zone, uint8_t su
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendAirVeryHotEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendAirVeryHotEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_AIR_VERY_HOT, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Pollution low
@@ -306,7 +360,10 @@ extern BOOL vscp_weather_sendAirVeryHotEvent(uint8_t index, uint8_t zone, uint8_
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendPollutionLowEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendPollutionLowEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_POLLUTION_LOW, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Pollution medium
@@ -319,7 +376,10 @@ extern BOOL vscp_weather_sendPollutionLowEvent(uint8_t index, uint8_t zone, uint
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendPollutionMediumEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendPollutionMediumEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_POLLUTION_MEDIUM, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Pollution high
@@ -332,7 +392,10 @@ extern BOOL vscp_weather_sendPollutionMediumEvent(uint8_t index, uint8_t zone, u
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendPollutionHighEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendPollutionHighEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_POLLUTION_HIGH, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Air humid
@@ -345,7 +408,10 @@ extern BOOL vscp_weather_sendPollutionHighEvent(uint8_t index, uint8_t zone, uin
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendAirHumidEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendAirHumidEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_AIR_HUMID, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Air dry
@@ -358,7 +424,10 @@ extern BOOL vscp_weather_sendAirHumidEvent(uint8_t index, uint8_t zone, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendAirDryEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendAirDryEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_AIR_DRY, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * soil humid
@@ -371,7 +440,10 @@ extern BOOL vscp_weather_sendAirDryEvent(uint8_t index, uint8_t zone, uint8_t su
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendSoilHumidEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendSoilHumidEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_SOIL_HUMID, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * soil dry
@@ -384,7 +456,10 @@ extern BOOL vscp_weather_sendSoilHumidEvent(uint8_t index, uint8_t zone, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendSoilDryEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendSoilDryEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_SOIL_DRY, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Rain none
@@ -397,7 +472,10 @@ extern BOOL vscp_weather_sendSoilDryEvent(uint8_t index, uint8_t zone, uint8_t s
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendRainNoneEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendRainNoneEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_RAIN_NONE, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Rain light
@@ -410,7 +488,10 @@ extern BOOL vscp_weather_sendRainNoneEvent(uint8_t index, uint8_t zone, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendRainLightEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendRainLightEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_RAIN_LIGHT, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Rain heavy
@@ -423,7 +504,10 @@ extern BOOL vscp_weather_sendRainLightEvent(uint8_t index, uint8_t zone, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendRainHeavyEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendRainHeavyEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_RAIN_HEAVY, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Rain very heavy
@@ -436,7 +520,10 @@ extern BOOL vscp_weather_sendRainHeavyEvent(uint8_t index, uint8_t zone, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendRainVeryHeavyEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendRainVeryHeavyEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_RAIN_VERY_HEAVY, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Sun none
@@ -449,7 +536,10 @@ extern BOOL vscp_weather_sendRainVeryHeavyEvent(uint8_t index, uint8_t zone, uin
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendSunNoneEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendSunNoneEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_SUN_NONE, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Sun light
@@ -462,7 +552,10 @@ extern BOOL vscp_weather_sendSunNoneEvent(uint8_t index, uint8_t zone, uint8_t s
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendSunLightEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendSunLightEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_SUN_LIGHT, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Sun heavy
@@ -475,7 +568,10 @@ extern BOOL vscp_weather_sendSunLightEvent(uint8_t index, uint8_t zone, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendSunHeavyEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendSunHeavyEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_SUN_HEAVY, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Snow none.
@@ -488,7 +584,10 @@ extern BOOL vscp_weather_sendSunHeavyEvent(uint8_t index, uint8_t zone, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendSnowNoneEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendSnowNoneEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_SNOW_NONE, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Snow light.
@@ -501,7 +600,10 @@ extern BOOL vscp_weather_sendSnowNoneEvent(uint8_t index, uint8_t zone, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendSnowLightEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendSnowLightEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_SNOW_LIGHT, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Snow heavy.
@@ -514,7 +616,10 @@ extern BOOL vscp_weather_sendSnowLightEvent(uint8_t index, uint8_t zone, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendSnowHeavyEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendSnowHeavyEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_SNOW_HEAVY, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Dew point.
@@ -527,7 +632,10 @@ extern BOOL vscp_weather_sendSnowHeavyEvent(uint8_t index, uint8_t zone, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendDewPointEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendDewPointEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_DEW_POINT, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Storm.
@@ -540,7 +648,10 @@ extern BOOL vscp_weather_sendDewPointEvent(uint8_t index, uint8_t zone, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendStormEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendStormEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_STORM, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Flood.
@@ -553,7 +664,10 @@ extern BOOL vscp_weather_sendStormEvent(uint8_t index, uint8_t zone, uint8_t sub
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendFloodEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendFloodEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_FLOOD, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Earthquake
@@ -566,7 +680,10 @@ extern BOOL vscp_weather_sendFloodEvent(uint8_t index, uint8_t zone, uint8_t sub
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendEarthquakeEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendEarthquakeEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_EARTHQUAKE, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Nuclera disaster
@@ -579,7 +696,10 @@ extern BOOL vscp_weather_sendEarthquakeEvent(uint8_t index, uint8_t zone, uint8_
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendNuclearDisasterEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendNuclearDisasterEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_NUCLEAR_DISASTER, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Fire.
@@ -592,7 +712,10 @@ extern BOOL vscp_weather_sendNuclearDisasterEvent(uint8_t index, uint8_t zone, u
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendFireEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendFireEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_FIRE, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Lightning.
@@ -605,7 +728,10 @@ extern BOOL vscp_weather_sendFireEvent(uint8_t index, uint8_t zone, uint8_t subZ
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendLightningEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendLightningEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_LIGHTNING, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Radiation low.
@@ -618,7 +744,10 @@ extern BOOL vscp_weather_sendLightningEvent(uint8_t index, uint8_t zone, uint8_t
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendUvRadiationLowEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendUvRadiationLowEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_UV_RADIATION_LOW, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Radiation medium.
@@ -631,7 +760,10 @@ extern BOOL vscp_weather_sendUvRadiationLowEvent(uint8_t index, uint8_t zone, ui
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendUvRadiationMediumEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendUvRadiationMediumEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_UV_RADIATION_MEDIUM, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Radiation normal.
@@ -644,7 +776,10 @@ extern BOOL vscp_weather_sendUvRadiationMediumEvent(uint8_t index, uint8_t zone,
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendUvRadiationNormalEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendUvRadiationNormalEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_UV_RADIATION_NORMAL, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Radiation high.
@@ -657,7 +792,10 @@ extern BOOL vscp_weather_sendUvRadiationNormalEvent(uint8_t index, uint8_t zone,
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendUvRadiationHighEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendUvRadiationHighEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_UV_RADIATION_HIGH, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Radiation very high.
@@ -670,7 +808,10 @@ extern BOOL vscp_weather_sendUvRadiationHighEvent(uint8_t index, uint8_t zone, u
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendUvRadiationVeryHighEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendUvRadiationVeryHighEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_UV_RADIATION_VERY_HIGH, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Warning level 1. This is the lowest varning level.
@@ -683,7 +824,10 @@ extern BOOL vscp_weather_sendUvRadiationVeryHighEvent(uint8_t index, uint8_t zon
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendWarningLevel1Event(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendWarningLevel1Event(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_WARNING_LEVEL_1, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Warninglevel 2.
@@ -696,7 +840,10 @@ extern BOOL vscp_weather_sendWarningLevel1Event(uint8_t index, uint8_t zone, uin
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendWarningLevel2Event(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendWarningLevel2Event(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_WARNING_LEVEL_2, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Warninglevel 3.
@@ -709,7 +856,10 @@ extern BOOL vscp_weather_sendWarningLevel2Event(uint8_t index, uint8_t zone, uin
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendWarningLevel3Event(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendWarningLevel3Event(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_WARNING_LEVEL_3, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Warning level 4.
@@ -722,7 +872,10 @@ extern BOOL vscp_weather_sendWarningLevel3Event(uint8_t index, uint8_t zone, uin
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendWarningLevel4Event(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendWarningLevel4Event(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_WARNING_LEVEL_4, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * Warning level 5. This is the highest warning level.
@@ -735,7 +888,10 @@ extern BOOL vscp_weather_sendWarningLevel4Event(uint8_t index, uint8_t zone, uin
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendWarningLevel5Event(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendWarningLevel5Event(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_WARNING_LEVEL_5, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * The final warning level not seen by humans.
@@ -748,7 +904,10 @@ extern BOOL vscp_weather_sendWarningLevel5Event(uint8_t index, uint8_t zone, uin
  * @retval TRUE  Event successul sent
  *
  */
-extern BOOL vscp_weather_sendArmageddonEvent(uint8_t index, uint8_t zone, uint8_t subZone);
+static inline BOOL vscp_weather_sendArmageddonEvent(uint8_t index, uint8_t zone, uint8_t subZone)
+{
+    return vscp_event_encoder_send(VSCP_CLASS_L1_WEATHER, VSCP_TYPE_WEATHER_ARMAGEDDON, VSCP_EVENT_ENCODER_LAYOUT_BYTES_3, index, zone, subZone, 0, 0);
+}
 
 /**
  * UV Index is an international scale for UV intensity which can have the range of 1-15 where 1 is
@@ -100,6 +100,32 @@ extern "C"
 
 #define VSCP_CONFIG_ENABLE_CUSTOM_HEARTBEAT     VSCP_CONFIG_BASE_DISABLED
 
+#define VSCP_CONFIG_ENABLE_NICKNAME_MAP         VSCP_CONFIG_BASE_ENABLED
+
+#define VSCP_CONFIG_ENABLE_EVENT_INTEREST       VSCP_CONFIG_BASE_ENABLED
+
+#define VSCP_CONFIG_ENABLE_EVENT_INTEREST_RESPONSE  VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_REG_MAP              VSCP_CONFIG_BASE_ENABLED
+
+#define VSCP_CONFIG_ENABLE_WHO_IS_THERE_CACHE   VSCP_CONFIG_BASE_ENABLED
+
+#define VSCP_CONFIG_ENABLE_WHO_IS_THERE_STAGGER VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_ADAPTIVE_HEARTBEAT   VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_HEARTBEAT_NODE_SUPPRESS     VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_PUBLISHER            VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_TP_ADAPTER_WRITE_MESSAGES    VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_CAN_ADAPTER          VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_CAN_FILTER           VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_ENABLE_LOGGER_QUEUE         VSCP_CONFIG_BASE_DISABLED
+
 */
 
 /*******************************************************************************
@@ -116,7 +142,11 @@ extern "C"
 
 #define VSCP_CONFIG_MULTI_MSG_TIMEOUT           ((uint16_t)1000)
 
-#define VSCP_CONFIG_HEARTBEAT_NODE_PERIOD       ((uint16_t)30000)
+#define VSCP_CONFIG_HEARTBEAT_NODE_PERIOD       30000
+
+#define VSCP_CONFIG_EXT_PAGE_READ_FRAMES        ((uint8_t)4)
+
+#define VSCP_CONFIG_EVENT_INTEREST_FRAMES       ((uint8_t)4)
 
 #define VSCP_CONFIG_DM_PAGE                     1
 
@@ -130,6 +160,36 @@ extern "C"
 
 #define VSCP_CONFIG_LOOPBACK_STORAGE_NUM        4
 
+#define VSCP_CONFIG_REG_MAP_SIZE                8
+
+#define VSCP_CONFIG_WHO_IS_THERE_STAGGER_SLOT   ((uint16_t)2)
+
+#define VSCP_CONFIG_HEARTBEAT_NODE_JITTER       ((uint16_t)3000)
+
+#define VSCP_CONFIG_HEARTBEAT_NODE_LOAD_WINDOW  500
+
+#define VSCP_CONFIG_HEARTBEAT_NODE_LOAD_LIMIT   ((uint8_t)50)
+
+#define VSCP_CONFIG_HEARTBEAT_NODE_BACKOFF_MAX  ((uint8_t)10)
+
+#define VSCP_CONFIG_PUBLISHER_NUM               4
+
+#define VSCP_CONFIG_PUBLISHER_TICK              ((uint16_t)100)
+
+#define VSCP_CONFIG_CAN_ADAPTER_RX_NUM          32
+
+#define VSCP_CONFIG_CAN_ADAPTER_TX_NUM          8
+
+#define VSCP_CONFIG_CAN_FILTER_NUM              8
+
+#define VSCP_CONFIG_LOGGER_QUEUE_NUM            4
+
+#define VSCP_CONFIG_LOGGER_MSG_SIZE             5
+
+#define VSCP_CONFIG_LOGGER_RATE_LIMIT           ((uint8_t)2)
+
+#define VSCP_CONFIG_LOGGER_REPEATED_ID          ((uint8_t)0xFF)
+
 */
 
 /*******************************************************************************
@@ -127,6 +127,53 @@ extern BOOL vscp_tp_adapter_writeMessage(vscp_TxMessage const * const msg)
     return status;
 }
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_TP_ADAPTER_WRITE_MESSAGES )
+
+/**
+ * This function writes several messages to the transport layer at once. The
+ * messages shall be written in order, until the first one is not accepted.
+ *
+ * @param[in]   msgs    Message array
+ * @param[in]   num     Number of messages
+ * @return  Number of accepted messages
+ */
+extern uint8_t vscp_tp_adapter_writeMessages(vscp_TxMessage const * const msgs, uint8_t num)
+{
+    uint8_t accepted    = 0;
+
+    if (NULL != msgs)
+    {
+        /* Implement your code here ... */
+
+    }
+
+    return accepted;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_TP_ADAPTER_WRITE_MESSAGES ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CAN_FILTER )
+
+/**
+ * This function sets the CAN acceptance filters. A frame shall be received,
+ * if it passes at least one of them. The filters replace the previous ones.
+ *
+ * @param[in]   filters Filter array
+ * @param[in]   num     Number of filters, up to VSCP_CONFIG_CAN_FILTER_NUM
+ */
+extern void vscp_tp_adapter_setFilters(vscp_can_filter_Filter const * const filters, uint8_t num)
+{
+    if (NULL != filters)
+    {
+        /* Implement your code here ... */
+
+    }
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CAN_FILTER ) */
+
 /*******************************************************************************
     LOCAL FUNCTIONS
 *******************************************************************************/
@@ -43,6 +43,7 @@ This module contains the main entry point.
 #include <stdint.h>
 #include "CUnit.h"
 #include "Basic.h"
+#include "vscp_config.h"
 #include "vscp_test.h"
 
 /*******************************************************************************
@@ -101,6 +102,7 @@ int main(int argc, char* argv[])
         (void)CU_add_test(pSuite, "Send probe ack with same nickname", vscp_test_sendProbeAckInActiveState);
         (void)CU_add_test(pSuite, "Segment master removed", vscp_test_noSegmentMaster);
         (void)CU_add_test(pSuite, "Bad segment master", vscp_test_badSegmentMaster);
+        (void)CU_add_test(pSuite, "Skip occupied nickname ids", vscp_test_skipOccupiedNickname);
 
         pSuite  = CU_add_suite("Force error state", vscp_test_init, NULL);
         (void)CU_add_test(pSuite, "Limit number of available timers", vscp_test_init07);
@@ -182,21 +184,56 @@ int main(int argc, char* argv[])
         pSuite  = CU_add_suite("Extended page read/write", vscp_test_initActive, NULL);
         (void)CU_add_test(pSuite, "Start up", vscp_test_active01);
         (void)CU_add_test(pSuite, "Extended page read", vscp_test_active31);
+        (void)CU_add_test(pSuite, "Extended page read with several responses", vscp_test_active31_1);
         (void)CU_add_test(pSuite, "Extended page write", vscp_test_active32);
 
         pSuite  = CU_add_suite("Node heartbeat", vscp_test_initActive, NULL);
         (void)CU_add_test(pSuite, "Start up", vscp_test_active01);
         (void)CU_add_test(pSuite, "Node heartbeat", vscp_test_active33);
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ADAPTIVE_HEARTBEAT )
+        (void)CU_add_test(pSuite, "Adaptive node heartbeat jitter", vscp_test_heartbeat01);
+        (void)CU_add_test(pSuite, "Adaptive node heartbeat back-off", vscp_test_heartbeat02);
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ADAPTIVE_HEARTBEAT ) */
+        (void)CU_add_test(pSuite, "Saturating transport counters", vscp_test_heartbeat03);
 
         pSuite  = CU_add_suite("Transparent sending of events", NULL, NULL);
         (void)CU_add_test(pSuite, "Prepare tx message and send event", vscp_test_active34);
+        (void)CU_add_test(pSuite, "Send events by the generic event encoder", vscp_test_active36);
+        (void)CU_add_test(pSuite, "Send several events at once", vscp_test_active37);
 
         pSuite  = CU_add_suite("Application gets events from the core", NULL, NULL);
         (void)CU_add_test(pSuite, "Receive transparent events", vscp_test_active35);
 
+        pSuite  = CU_add_suite("Measurement publisher", vscp_test_initActive, NULL);
+        (void)CU_add_test(pSuite, "Start up", vscp_test_active01);
+        (void)CU_add_test(pSuite, "Deadband, minimum and maximum interval", vscp_test_publisher01);
+
         pSuite  = CU_add_suite("Decision matrix next generation", vscp_test_initDMNG, NULL);
         (void)CU_add_test(pSuite, "Send class information, type button event with parameter \"all released\".", vscp_test_dmNG01);
         (void)CU_add_test(pSuite, "Send class information, type button event with parameter \"pressed\".", vscp_test_dmNG02);
+        (void)CU_add_test(pSuite, "Get event interest.", vscp_test_dmNG03);
+        (void)CU_add_test(pSuite, "Get event interest over several process cycles.", vscp_test_dmNG04);
+
+        pSuite  = CU_add_suite("Data coding", NULL, NULL);
+        (void)CU_add_test(pSuite, "Normalized integer", vscp_test_dataCoding01);
+        (void)CU_add_test(pSuite, "Floating point and string", vscp_test_dataCoding02);
+
+        pSuite  = CU_add_suite("CAN codec", NULL, NULL);
+        (void)CU_add_test(pSuite, "Identifier", vscp_test_canCodec01);
+        (void)CU_add_test(pSuite, "Data words", vscp_test_canCodec02);
+
+        pSuite  = CU_add_suite("CAN transport layer adapter", NULL, NULL);
+        (void)CU_add_test(pSuite, "Frame ring", vscp_test_canRing01);
+        (void)CU_add_test(pSuite, "Receive frames", vscp_test_canAdapter01);
+        (void)CU_add_test(pSuite, "Transmit frames", vscp_test_canAdapter02);
+
+        pSuite  = CU_add_suite("CAN acceptance filter", NULL, NULL);
+        (void)CU_add_test(pSuite, "Planner", vscp_test_canFilter01);
+        (void)CU_add_test(pSuite, "Event interest", vscp_test_canFilter02);
+
+        pSuite  = CU_add_suite("Logger queue", vscp_test_initActive, NULL);
+        (void)CU_add_test(pSuite, "Start up", vscp_test_active01);
+        (void)CU_add_test(pSuite, "Coalescing, rate limit and drop counter", vscp_test_logger01);
 
         CU_basic_set_mode(CU_BRM_VERBOSE);
         
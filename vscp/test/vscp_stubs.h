@@ -52,6 +52,8 @@ VSCP.
 #include <stdint.h>
 #include "vscp_types.h"
 #include "vscp_dm.h"
+#include "vscp_can_ring.h"
+#include "vscp_can_filter.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -91,6 +93,8 @@ extern void vscp_test_appRegInit(void);
 extern void vscp_test_tpAdatperInit(void);
 extern BOOL vscp_test_tpAdatperReadMessage(vscp_RxMessage * const msg);
 extern BOOL vscp_test_tpAdatperWriteMessage(vscp_TxMessage const * const msg);
+extern uint8_t vscp_test_tpAdatperWriteMessages(vscp_TxMessage const * const msgs, uint8_t num);
+extern void vscp_test_tpAdatperSetFilters(vscp_can_filter_Filter const * const filters, uint8_t num);
 
 extern void vscp_test_portableInit(void);
 extern void vscp_test_portableRestoreFactoryDefaultSettings(void);
@@ -109,10 +113,15 @@ extern uint8_t  vscp_test_portableGetMdfUrl(uint8_t index);
 extern void vscp_test_portableProvideEvent(vscp_RxMessage const * const msg);
 extern void vscp_test_portableUpdateTimeSinceEpoch(uint32_t timestamp);
 extern void vscp_test_portableSetLampState(VSCP_LAMP_STATE state);
+extern void vscp_test_portableAddEventInterest(void);
 
 extern void vscp_test_actionInit(void);
 extern void vscp_test_actionExecute(uint8_t action, uint8_t par, vscp_RxMessage const * const msg);
 
+extern void vscp_test_canHalWriteFrame(vscp_can_ring_Frame const * const frame);
+extern void vscp_test_canHalDisableIrq(void);
+extern void vscp_test_canHalEnableIrq(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -43,8 +43,10 @@
 #include "vscp_test.h"
 #include <stdint.h>
 #include <string.h>
+#include <stdlib.h>
 #include "CUnit.h"
 #include "vscp_core.h"
+#include "vscp_transport.h"
 #include "vscp_ps.h"
 #include "vscp_class_l1.h"
 #include "vscp_type_protocol.h"
@@ -52,7 +54,19 @@
 #include "vscp_stubs.h"
 #include "vscp_dev_data.h"
 #include "vscp_dm_ng.h"
+#include "vscp_interest.h"
 #include "vscp_timer.h"
+#include "vscp_data_coding.h"
+#include "vscp_publisher.h"
+#include "vscp_can_codec.h"
+#include "vscp_can_ring.h"
+#include "vscp_can_filter.h"
+#include "vscp_can_adapter.h"
+#include "vscp_measurement.h"
+#include "vscp_measurezone.h"
+#include "vscp_information.h"
+#include "vscp_logger.h"
+#include "vscp_type_log.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -68,9 +82,21 @@
 /** Number of tx message buffers */
 #define VSCP_TEST_TX_MSG_NUM                    10
 
+/** Number of CAN frames, the fake CAN hardware abstraction can record */
+#define VSCP_TEST_CAN_TX_FRAME_NUM              16
+
+/** Max. number of CAN acceptance filters in the planner test */
+#define VSCP_TEST_CAN_FILTER_NUM_MAX            8
+
+/** Max. number of class/type interests in the planner test */
+#define VSCP_TEST_CAN_INTEREST_NUM_MAX          12
+
 /** Node nickname id for tests */
 #define VSCP_TEST_NICKNAME                      (0x5A)
 
+/** Nickname id, which is not used by any other node in the nickname map test */
+#define VSCP_TEST_FREE_NICKNAME                 (0x42)
+
 /** Remote node nickname id for tests */
 #define VSCP_TEST_NICKNAME_REMOTE               (0x12)
 
@@ -152,6 +178,7 @@ typedef enum
     VSCP_TEST_CALL_COUNTER_TP_ADAPTER_INIT,
     VSCP_TEST_CALL_COUNTER_TP_ADAPTER_READ_MESSAGE,
     VSCP_TEST_CALL_COUNTER_TP_ADAPTER_WRITE_MESSAGE,
+    VSCP_TEST_CALL_COUNTER_TP_ADAPTER_WRITE_MESSAGES,
 
     VSCP_TEST_CALL_COUNTER_PORTABLE_INIT,
     VSCP_TEST_CALL_COUNTER_PORTABLE_CREATE_TIMER,
@@ -181,6 +208,7 @@ typedef enum
     VSCP_TEST_TIMER_2,
     VSCP_TEST_TIMER_3,
     VSCP_TEST_TIMER_4,
+    VSCP_TEST_TIMER_5,
 
     VSCP_TEST_TIMER_SIZE
 
@@ -221,6 +249,11 @@ static uint8_t  vscp_test_getControlFlags(uint8_t value);
 static uint8_t  vscp_test_getNicknameId(uint8_t value);
 static uint8_t  vscp_test_getZero(uint8_t value);
 
+static BOOL     vscp_test_publisherSend(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+static void     vscp_test_processCycles(uint16_t cycles);
+static uint32_t vscp_test_waitForHeartbeat(uint32_t max, uint16_t loadPeriod);
+static void vscp_test_checkCanFilterPlan(vscp_can_filter_Plan const * const plan, uint16_t const interests[][4], uint8_t num, uint32_t * const missing, uint32_t * const extra);
+
 /*******************************************************************************
     LOCAL VARIABLES
 *******************************************************************************/
@@ -334,6 +367,45 @@ static BOOL                 vscp_test_noMoreTimers      = FALSE;
 
 static uint32_t             vscp_test_timeSinceEpoch    = 0;
 
+/** Number of measurement events, which are sent by the publisher. */
+static uint8_t              vscp_test_publisherSendCnt  = 0;
+
+/** Last data, which is sent by the publisher. */
+static int32_t              vscp_test_publisherData     = 0;
+
+/** Last exponent, which is sent by the publisher. */
+static int8_t               vscp_test_publisherExp      = 0;
+
+/** Simulate a full transmit buffer for the publisher. */
+static BOOL                 vscp_test_publisherTxFull   = FALSE;
+
+/** Max. number of messages, the transport layer adapter accepts at once. */
+static uint8_t              vscp_test_txAcceptNum       = VSCP_TEST_TX_MSG_NUM;
+
+/** Simulate a busy transport layer adapter, which doesn't accept a single message. */
+static BOOL                 vscp_test_txBusy            = FALSE;
+
+/** Simulate a idle bus, a received message is read only once. */
+static BOOL                 vscp_test_rxIdle            = FALSE;
+
+/** The application is interested in class control, types 0-15. */
+static BOOL                 vscp_test_appInterest       = FALSE;
+
+/** CAN frames, written by the CAN transport layer adapter to the fake CAN hardware abstraction */
+static vscp_can_ring_Frame  vscp_test_canTxFrame[VSCP_TEST_CAN_TX_FRAME_NUM];
+
+/** Number of written CAN frames */
+static uint8_t              vscp_test_canTxFrameCnt     = 0;
+
+/** CAN interrupt is disabled or not */
+static BOOL                 vscp_test_canIrqDisabled    = FALSE;
+
+/** CAN acceptance filters, set by the core via the transport layer adapter */
+static vscp_can_filter_Filter   vscp_test_canFilter[VSCP_CONFIG_CAN_FILTER_NUM];
+
+/** Number of set CAN acceptance filters */
+static uint8_t              vscp_test_canFilterNum      = 0;
+
 /*******************************************************************************
     GLOBAL VARIABLES
 *******************************************************************************/
@@ -372,6 +444,9 @@ extern int  vscp_test_init(void)
     /* Reset decision matrix extension */
     memset(vscp_test_extStorage, 0, VSCP_PS_SIZE_DM_EXTENSION);
 
+    /* Decision matrix changed directly in the persistent memory */
+    vscp_interest_invalidate();
+
     /* Reset action triggered VSCP event */
     memset(&vscp_test_actionTriggeredMsg, 0, sizeof(vscp_test_actionTriggeredMsg));
 
@@ -668,28 +743,41 @@ extern void vscp_test_sendProbeAckInActiveState(void)
  *  - No response (no segment master).
  *
  * Expectation:
- *  - After a specific time, the node starts probing id for id.
+ *  - After a specific time, the node starts probing id for id, beginning
+ *    with a GUID dependent id.
+ *  - Every id is probed only once.
  *  - But because every probe gets an answer, the node surrenders at the end.
  */
 extern void vscp_test_noSegmentMaster(void)
 {
-    uint8_t id  = 1;
+    uint8_t id          = 0;
+    uint8_t probed[256];
+    uint8_t probedNum   = 0;
 
     vscp_test_initTestCase();
 
+    memset(probed, 0, sizeof(probed));
+
     /* Wait for at least 1 event */
     vscp_test_waitForTxMessage(1, VSCP_CONFIG_NODE_SEGMENT_INIT_TIMEOUT + 1);
 
-    while(255 > id)
+    while((VSCP_NICKNAME_NOT_INIT != vscp_test_txMessage[0].data[0]) &&
+          (255 > probedNum))
     {
-        /* Probe event shall be sent with nickname id 1 */
+        id = vscp_test_txMessage[0].data[0];
+
+        /* Probe event shall be sent with a not probed nickname id */
         CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpClass, VSCP_CLASS_L1_PROTOCOL);
         CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_NEW_NODE_ONLINE);
         CU_ASSERT_EQUAL(vscp_test_txMessage[0].oAddr, VSCP_NICKNAME_NOT_INIT);
         CU_ASSERT_EQUAL(vscp_test_txMessage[0].hardCoded, FALSE);
         CU_ASSERT_EQUAL(vscp_test_txMessage[0].priority, VSCP_PRIORITY_7_LOW);
         CU_ASSERT_EQUAL(vscp_test_txMessage[0].dataNum, 1);
-        CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[0], id);
+        CU_ASSERT_NOT_EQUAL(id, VSCP_NICKNAME_SEGMENT_MASTER);
+        CU_ASSERT_EQUAL(probed[id], 0);
+
+        probed[id] = 1;
+        ++probedNum;
 
         /* Send probe acknowledge */
         vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_PROTOCOL;
@@ -699,12 +787,13 @@ extern void vscp_test_noSegmentMaster(void)
         vscp_test_rxMessage.hardCoded   = FALSE;
         vscp_test_rxMessage.dataNum     = 0;
 
-        /* Next id */
-        ++id;
-
         vscp_test_waitForTxMessage(1, 2);
     }
 
+    /* Every nickname id was probed, except the one known as occupied. */
+    CU_ASSERT_EQUAL(probedNum, 253);
+    CU_ASSERT_EQUAL(probed[VSCP_TEST_NICKNAME], 0);
+
     /* Node stops and sends 0xFF as nickname to notify it surrenders */
     CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpClass, VSCP_CLASS_L1_PROTOCOL);
     CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_NEW_NODE_ONLINE);
@@ -712,7 +801,7 @@ extern void vscp_test_noSegmentMaster(void)
     CU_ASSERT_EQUAL(vscp_test_txMessage[0].hardCoded, FALSE);
     CU_ASSERT_EQUAL(vscp_test_txMessage[0].priority, VSCP_PRIORITY_7_LOW);
     CU_ASSERT_EQUAL(vscp_test_txMessage[0].dataNum, 1);
-    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[0], id);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[0], VSCP_NICKNAME_NOT_INIT);
 
     /* Lamp shall be off */
     CU_ASSERT_EQUAL(vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_PORTABLE_SET_LAMP_STATE], 1);
@@ -733,7 +822,7 @@ extern void vscp_test_noSegmentMaster(void)
  */
 extern void vscp_test_badSegmentMaster(void)
 {
-    uint8_t id  = 1;
+    uint8_t id  = 0;
 
     vscp_test_initTestCase();
 
@@ -771,19 +860,22 @@ extern void vscp_test_badSegmentMaster(void)
     /* Wait for at least 1 event */
     vscp_test_waitForTxMessage(1, VSCP_CONFIG_NODE_SEGMENT_INIT_TIMEOUT + 1);
 
-    /* Probe event shall be sent with nickname id 1 */
+    /* Probe event shall be sent with a valid nickname id */
     CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpClass, VSCP_CLASS_L1_PROTOCOL);
     CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_NEW_NODE_ONLINE);
     CU_ASSERT_EQUAL(vscp_test_txMessage[0].oAddr, VSCP_NICKNAME_NOT_INIT);
     CU_ASSERT_EQUAL(vscp_test_txMessage[0].hardCoded, FALSE);
     CU_ASSERT_EQUAL(vscp_test_txMessage[0].priority, VSCP_PRIORITY_7_LOW);
     CU_ASSERT_EQUAL(vscp_test_txMessage[0].dataNum, 1);
-    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[0], id);
+    CU_ASSERT_NOT_EQUAL(vscp_test_txMessage[0].data[0], VSCP_NICKNAME_SEGMENT_MASTER);
+    CU_ASSERT_NOT_EQUAL(vscp_test_txMessage[0].data[0], VSCP_NICKNAME_NOT_INIT);
+
+    id = vscp_test_txMessage[0].data[0];
 
     /* Wait for at least 1 event */
     vscp_test_waitForTxMessage(1, VSCP_CONFIG_NODE_SEGMENT_INIT_TIMEOUT + 1);
 
-    /* Node sends 1 as nickname */
+    /* Node sends the probed nickname id */
     CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpClass, VSCP_CLASS_L1_PROTOCOL);
     CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_NEW_NODE_ONLINE);
     CU_ASSERT_EQUAL(vscp_test_txMessage[0].oAddr, id);
@@ -799,6 +891,83 @@ extern void vscp_test_badSegmentMaster(void)
     return;
 }
 
+/**
+ * Precondition:
+ *  - Nickname discovery finished and nickname is set.
+ *
+ * Action:
+ *  - Send a probe acknowledge with the same nickname.
+ *  - Every nickname id, except one, is used by other nodes, which send events.
+ *
+ * Expectation:
+ *  - Node probes only the unused nickname id and takes it.
+ */
+extern void vscp_test_skipOccupiedNickname(void)
+{
+    uint8_t id  = 0;
+
+    vscp_test_initTestCase();
+
+    /* Send probe acknowledge */
+    vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_PROTOCOL;
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_PROBE_ACK;
+    vscp_test_rxMessage.priority    = VSCP_PRIORITY_7_LOW;
+    vscp_test_rxMessage.oAddr       = vscp_core_readNicknameId();
+    vscp_test_rxMessage.hardCoded   = FALSE;
+    vscp_test_rxMessage.dataNum     = 0;
+
+    /* Wait for at least 1 event */
+    vscp_test_waitForTxMessage(1, 10);
+
+    /* Probe event shall be sent to segment master */
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_NEW_NODE_ONLINE);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[0], VSCP_NICKNAME_SEGMENT_MASTER);
+
+    /* Other nodes send their heartbeat, while the node waits for the segment master. */
+    for(id = 1; id < VSCP_NICKNAME_NOT_INIT; ++id)
+    {
+        if (VSCP_TEST_FREE_NICKNAME != id)
+        {
+            vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_INFORMATION;
+            vscp_test_rxMessage.vscpType    = VSCP_TYPE_INFORMATION_NODE_HEARTBEAT;
+            vscp_test_rxMessage.priority    = VSCP_PRIORITY_7_LOW;
+            vscp_test_rxMessage.oAddr       = id;
+            vscp_test_rxMessage.hardCoded   = FALSE;
+            vscp_test_rxMessage.dataNum     = 3;
+            vscp_test_rxMessage.data[0]     = 0;
+            vscp_test_rxMessage.data[1]     = 0;
+            vscp_test_rxMessage.data[2]     = 0;
+
+            vscp_test_processTimers();
+            vscp_core_process();
+        }
+    }
+
+    /* Wait for at least 1 event */
+    vscp_test_waitForTxMessage(1, VSCP_CONFIG_NODE_SEGMENT_INIT_TIMEOUT + 1);
+
+    /* Only the unused nickname id shall be probed */
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpClass, VSCP_CLASS_L1_PROTOCOL);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_NEW_NODE_ONLINE);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].oAddr, VSCP_NICKNAME_NOT_INIT);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].dataNum, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[0], VSCP_TEST_FREE_NICKNAME);
+
+    /* Wait for at least 1 event */
+    vscp_test_waitForTxMessage(1, VSCP_CONFIG_PROBE_ACK_TIMEOUT + 1);
+
+    /* Node takes the unused nickname id */
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpClass, VSCP_CLASS_L1_PROTOCOL);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_NEW_NODE_ONLINE);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].oAddr, VSCP_TEST_FREE_NICKNAME);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].dataNum, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[0], VSCP_TEST_FREE_NICKNAME);
+
+    CU_ASSERT_EQUAL(vscp_core_readNicknameId(), VSCP_TEST_FREE_NICKNAME);
+
+    return;
+}
+
 /**
  * Precondition:
  *  - VSCP is not called yet.
@@ -2352,6 +2521,9 @@ extern void vscp_test_active28(void)
     /* Reset decision matrix extension */
     memset(vscp_test_extStorage, 0, VSCP_PS_SIZE_DM_EXTENSION);
 
+    /* Decision matrix changed directly in the persistent memory */
+    vscp_interest_invalidate();
+
     vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_PROTOCOL;
     vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_GET_DECISION_MATRIX_INFO;
     vscp_test_rxMessage.priority    = VSCP_PRIORITY_7_LOW;
@@ -2670,6 +2842,9 @@ extern int vscp_test_initDM(void)
     vscp_test_extStorage[index].actionPar   = index;
     ++index;
 
+    /* Decision matrix changed directly in the persistent memory */
+    vscp_interest_invalidate();
+
     return 0;
 }
 
@@ -3059,6 +3234,9 @@ extern int vscp_test_initDMNG(void)
         vscp_test_dmNG[index] = ruleSet[index];
     }
 
+    /* Decision matrix changed directly in the persistent memory */
+    vscp_interest_invalidate();
+
     return 0;
 }
 
@@ -3160,6 +3338,176 @@ extern void vscp_test_dmNG02(void)
     return;
 }
 
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *  - Decision matrix next generation configured
+ *
+ * Action:
+ *  - Check event interest before and after a process cycle without received event.
+ *  - Get event interest.
+ *
+ * Expectation:
+ *  - Every event is of interest, until the event interest is built.
+ *  - Only class information, type button is of interest.
+ *  - Response contains one entry with class information, type button.
+ */
+extern void vscp_test_dmNG03(void)
+{
+    vscp_test_initTestCase();
+
+    /* The rule set was written, but no process cycle without received event
+     * happened yet. The outdated event interest accepts every event.
+     */
+    CU_ASSERT_EQUAL(vscp_interest_isInterested(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_ON), TRUE);
+
+    /* Process core without received event, which builds the event interest. */
+    vscp_test_rxIdle                = TRUE;
+    vscp_test_rxMessage.vscpType    = 0;
+    vscp_test_processTimers();
+    vscp_core_process();
+    vscp_test_rxIdle                = FALSE;
+
+    CU_ASSERT_EQUAL(vscp_interest_isInterested(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_BUTTON), TRUE);
+    CU_ASSERT_EQUAL(vscp_interest_isInterested(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_ON), FALSE);
+    CU_ASSERT_EQUAL(vscp_interest_isInterested(VSCP_CLASS_L1_PROTOCOL, VSCP_TYPE_INFORMATION_BUTTON), FALSE);
+
+    vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_PROTOCOL;
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_GET_EVENT_INTEREST;
+    vscp_test_rxMessage.priority    = VSCP_PRIORITY_7_LOW;
+    vscp_test_rxMessage.oAddr       = VSCP_NICKNAME_SEGMENT_MASTER;
+    vscp_test_rxMessage.hardCoded   = FALSE;
+    vscp_test_rxMessage.dataNum     = 1;
+    vscp_test_rxMessage.data[0]     = VSCP_TEST_NICKNAME;
+
+    vscp_test_waitForTxMessage(1, 10);
+
+    /* Node shall send a single response */
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 1);
+
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpClass, VSCP_CLASS_L1_PROTOCOL);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_GET_EVENT_INTEREST_RESPONSE);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].oAddr, VSCP_TEST_NICKNAME);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].dataNum, 4);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[0], 0);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[1], 0);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[2], VSCP_CLASS_L1_INFORMATION);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[3], VSCP_TYPE_INFORMATION_BUTTON);
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *  - Decision matrix next generation configured
+ *  - Application is interested in class control, types 0-15.
+ *
+ * Action:
+ *  - Get event interest, while the transport layer is busy for one cycle.
+ *
+ * Expectation:
+ *  - Up to VSCP_CONFIG_EVENT_INTEREST_FRAMES responses per process cycle.
+ *  - No response is lost, the index has no gaps.
+ *  - Every class/type of interest is in the responses.
+ *  - The last response has less than two entries.
+ */
+extern void vscp_test_dmNG04(void)
+{
+    uint16_t    classNum    = 0;
+    uint16_t    typeNum     = 0;
+    uint16_t    entryNum    = 0;
+    uint16_t    frameNum    = 0;
+    uint16_t    cycles      = 0;
+    uint8_t     index       = 0;
+    BOOL        isLast      = FALSE;
+
+    vscp_test_initTestCase();
+
+    vscp_test_appInterest = TRUE;
+    vscp_interest_invalidate();
+
+    classNum    = vscp_interest_getClassNum();
+    typeNum     = vscp_interest_getTypeNum();
+
+    CU_ASSERT_EQUAL(classNum, 2);
+    CU_ASSERT_EQUAL(typeNum, 16);
+
+    vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_PROTOCOL;
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_GET_EVENT_INTEREST;
+    vscp_test_rxMessage.priority    = VSCP_PRIORITY_7_LOW;
+    vscp_test_rxMessage.oAddr       = VSCP_NICKNAME_SEGMENT_MASTER;
+    vscp_test_rxMessage.hardCoded   = FALSE;
+    vscp_test_rxMessage.dataNum     = 1;
+    vscp_test_rxMessage.data[0]     = VSCP_TEST_NICKNAME;
+
+    /* Process core */
+    vscp_test_processTimers();
+    vscp_core_process();
+
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, VSCP_CONFIG_EVENT_INTEREST_FRAMES);
+
+    /* Transport layer busy, nothing shall be sent. */
+    vscp_test_txMessageCnt  = 0;
+    vscp_test_txBusy        = TRUE;
+    vscp_test_processCycles(1);
+    vscp_test_txBusy        = FALSE;
+
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 0);
+
+    /* Check the first responses again and continue. */
+    vscp_test_txMessageCnt = VSCP_CONFIG_EVENT_INTEREST_FRAMES;
+
+    while((FALSE == isLast) && (100 > cycles))
+    {
+        for(index = 0; index < vscp_test_txMessageCnt; ++index)
+        {
+            vscp_TxMessage const * const    msg = &vscp_test_txMessage[index];
+
+            CU_ASSERT_EQUAL(msg->vscpType, VSCP_TYPE_PROTOCOL_GET_EVENT_INTEREST_RESPONSE);
+            CU_ASSERT_EQUAL(msg->data[0], (uint8_t)frameNum);
+
+            if (7 == msg->dataNum)
+            {
+                CU_ASSERT_EQUAL(vscp_interest_isInterested(msg->data[5], msg->data[6]), TRUE);
+                ++entryNum;
+            }
+
+            if (4 <= msg->dataNum)
+            {
+                CU_ASSERT_EQUAL(vscp_interest_isInterested(msg->data[2], msg->data[3]), TRUE);
+                ++entryNum;
+            }
+
+            if (7 != msg->dataNum)
+            {
+                CU_ASSERT_EQUAL(index + 1, vscp_test_txMessageCnt);
+                isLast = TRUE;
+            }
+
+            ++frameNum;
+        }
+
+        CU_ASSERT(VSCP_CONFIG_EVENT_INTEREST_FRAMES >= vscp_test_txMessageCnt);
+
+        vscp_test_txMessageCnt = 0;
+        vscp_test_processCycles(1);
+        ++cycles;
+    }
+
+    CU_ASSERT_EQUAL(isLast, TRUE);
+    CU_ASSERT_EQUAL(entryNum, classNum * typeNum);
+    CU_ASSERT_EQUAL(frameNum, (classNum * typeNum) / 2 + 1);
+
+    /* Nothing more shall be sent. */
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 0);
+
+    vscp_test_appInterest = FALSE;
+    vscp_interest_invalidate();
+
+    return;
+}
+
 /**
  * Precondition:
  *  - VSCP is active.
@@ -3206,6 +3554,60 @@ extern void vscp_test_active31(void)
     return;
 }
 
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *
+ * Action:
+ *  - Extended page read of 20 registers.
+ *
+ * Expectation:
+ *  - 4 responses in the first process cycle.
+ *  - Last response in the second process cycle.
+ */
+extern void vscp_test_active31_1(void)
+{
+    uint8_t index   = 0;
+
+    vscp_test_initTestCase();
+
+    vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_PROTOCOL;
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_READ_REGISTER;
+    vscp_test_rxMessage.priority    = VSCP_PRIORITY_7_LOW;
+    vscp_test_rxMessage.oAddr       = VSCP_NICKNAME_SEGMENT_MASTER;
+    vscp_test_rxMessage.hardCoded   = FALSE;
+    vscp_test_rxMessage.dataNum     = 5;
+    vscp_test_rxMessage.data[0]     = VSCP_TEST_NICKNAME;
+    vscp_test_rxMessage.data[1]     = 0;
+    vscp_test_rxMessage.data[2]     = 0;
+    vscp_test_rxMessage.data[3]     = VSCP_REG_VSCP_VERSION_MAJOR;
+    vscp_test_rxMessage.data[4]     = 20;
+
+    /* Process core */
+    vscp_test_processTimers();
+    vscp_core_process();
+
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, VSCP_CONFIG_EXT_PAGE_READ_FRAMES);
+
+    /* Process core */
+    vscp_test_processTimers();
+    vscp_core_process();
+
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 5);
+
+    for(index = 0; index < 5; ++index)
+    {
+        CU_ASSERT_EQUAL(vscp_test_txMessage[index].vscpType, VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_READ_WRITE_RESPONSE);
+        CU_ASSERT_EQUAL(vscp_test_txMessage[index].dataNum, 8);
+        CU_ASSERT_EQUAL(vscp_test_txMessage[index].data[0], index);
+        CU_ASSERT_EQUAL(vscp_test_txMessage[index].data[3], VSCP_REG_VSCP_VERSION_MAJOR + 4 * index);
+    }
+
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[4], VSCP_CORE_VERSION_MAJOR);
+
+    return;
+}
+
 /**
  * Precondition:
  *  - VSCP is active.
@@ -3267,7 +3669,10 @@ extern void vscp_test_active33(void)
 {
     vscp_test_initTestCase();
 
+    /* No bus load, which would postpone the adaptive heartbeat. */
+    vscp_test_rxIdle = TRUE;
     vscp_test_waitForTxMessage(1, VSCP_CONFIG_HEARTBEAT_NODE_PERIOD + 1);
+    vscp_test_rxIdle = FALSE;
 
     /* Node shall send a response */
     CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 1);
@@ -3284,48 +3689,218 @@ extern void vscp_test_active33(void)
     return;
 }
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ADAPTIVE_HEARTBEAT )
+
 /**
  * Precondition:
  *  - VSCP is active.
+ *  - Adaptive node heartbeat enabled.
  *
  * Action:
- *  - Prepare tx message
- *  - Send message
+ *  - Wait for several node heartbeats, while the bus is idle.
  *
  * Expectation:
- *  - Message is sent to the transport layer.
+ *  - Every heartbeat period is shortened by 0 to VSCP_CONFIG_HEARTBEAT_NODE_JITTER.
+ *  - The heartbeat periods differ.
  */
-extern void vscp_test_active34(void)
+extern void vscp_test_heartbeat01(void)
 {
-    vscp_TxMessage  txMessage;
+    uint32_t    cycles      = 0;
+    uint32_t    cyclesMin   = 0xffffffff;
+    uint32_t    cyclesMax   = 0;
+    uint8_t     index       = 0;
 
-    vscp_core_prepareTxMessage(&txMessage, VSCP_CLASS_L1_PROTOCOL, VSCP_TYPE_PROTOCOL_UNDEFINED, VSCP_PRIORITY_3_NORMAL);
+    vscp_test_initTestCase();
 
-    CU_ASSERT_EQUAL(txMessage.vscpClass, VSCP_CLASS_L1_PROTOCOL);
-    CU_ASSERT_EQUAL(txMessage.vscpType, VSCP_TYPE_PROTOCOL_UNDEFINED);
-    CU_ASSERT_EQUAL(txMessage.priority, VSCP_PRIORITY_3_NORMAL);
-    CU_ASSERT_EQUAL(txMessage.oAddr, VSCP_TEST_NICKNAME);
-    CU_ASSERT_EQUAL(txMessage.hardCoded, FALSE);
-    CU_ASSERT_EQUAL(txMessage.dataNum, 0);
+    vscp_test_rxIdle = TRUE;
 
-    txMessage.dataNum = 2;
-    txMessage.data[0]   = 0x12;
-    txMessage.data[1]   = 0x21;
+    /* Synchronize to the heartbeat period. */
+    cycles = vscp_test_waitForHeartbeat(VSCP_CONFIG_HEARTBEAT_NODE_PERIOD + VSCP_CONFIG_HEARTBEAT_NODE_BACKOFF_MAX * VSCP_CONFIG_HEARTBEAT_NODE_LOAD_WINDOW + 1, 0);
+    CU_ASSERT(VSCP_CONFIG_HEARTBEAT_NODE_PERIOD + VSCP_CONFIG_HEARTBEAT_NODE_BACKOFF_MAX * VSCP_CONFIG_HEARTBEAT_NODE_LOAD_WINDOW >= cycles);
 
-    /* Clear transmit message buffers */
-    memset(vscp_test_txMessage, 0, sizeof(vscp_test_txMessage));
-    vscp_test_txMessageCnt = 0;
+    for(index = 0; index < 8; ++index)
+    {
+        cycles = vscp_test_waitForHeartbeat(VSCP_CONFIG_HEARTBEAT_NODE_PERIOD + 1, 0);
 
-    vscp_core_sendEvent(&txMessage);
+        CU_ASSERT(VSCP_CONFIG_HEARTBEAT_NODE_PERIOD >= cycles);
+        CU_ASSERT((VSCP_CONFIG_HEARTBEAT_NODE_PERIOD - VSCP_CONFIG_HEARTBEAT_NODE_JITTER) <= cycles);
 
-    /* Node shall send a response */
-    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 1);
+        if (cyclesMin > cycles)
+        {
+            cyclesMin = cycles;
+        }
 
-    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpClass, VSCP_CLASS_L1_PROTOCOL);
-    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_UNDEFINED);
-    CU_ASSERT_EQUAL(vscp_test_txMessage[0].priority, VSCP_PRIORITY_3_NORMAL);
-    CU_ASSERT_EQUAL(vscp_test_txMessage[0].oAddr, VSCP_TEST_NICKNAME);
-    CU_ASSERT_EQUAL(vscp_test_txMessage[0].hardCoded, FALSE);
+        if (cyclesMax < cycles)
+        {
+            cyclesMax = cycles;
+        }
+    }
+
+    CU_ASSERT(cyclesMin < cyclesMax);
+
+    vscp_test_rxIdle = FALSE;
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *  - Adaptive node heartbeat enabled.
+ *
+ * Action:
+ *  - Wait for the node heartbeat, while the bus is busy.
+ *  - Wait for the node heartbeat, while the bus load is below the limit.
+ *
+ * Expectation:
+ *  - The heartbeat is postponed by VSCP_CONFIG_HEARTBEAT_NODE_BACKOFF_MAX
+ *    measurement windows on a busy bus, but not longer.
+ *  - The heartbeat is not postponed below the bus load limit.
+ */
+extern void vscp_test_heartbeat02(void)
+{
+    uint32_t    cycles  = 0;
+
+    vscp_test_initTestCase();
+
+    vscp_test_rxIdle = TRUE;
+
+    /* Synchronize to the heartbeat period. */
+    (void)vscp_test_waitForHeartbeat(VSCP_CONFIG_HEARTBEAT_NODE_PERIOD + VSCP_CONFIG_HEARTBEAT_NODE_BACKOFF_MAX * VSCP_CONFIG_HEARTBEAT_NODE_LOAD_WINDOW + 1, 0);
+
+    /* Busy bus: an event every process cycle */
+    cycles = vscp_test_waitForHeartbeat(VSCP_CONFIG_HEARTBEAT_NODE_PERIOD + VSCP_CONFIG_HEARTBEAT_NODE_BACKOFF_MAX * VSCP_CONFIG_HEARTBEAT_NODE_LOAD_WINDOW + 1, 1);
+
+    CU_ASSERT(VSCP_CONFIG_HEARTBEAT_NODE_PERIOD + VSCP_CONFIG_HEARTBEAT_NODE_BACKOFF_MAX * VSCP_CONFIG_HEARTBEAT_NODE_LOAD_WINDOW >= cycles);
+    CU_ASSERT((VSCP_CONFIG_HEARTBEAT_NODE_PERIOD - VSCP_CONFIG_HEARTBEAT_NODE_JITTER + VSCP_CONFIG_HEARTBEAT_NODE_BACKOFF_MAX * VSCP_CONFIG_HEARTBEAT_NODE_LOAD_WINDOW) <= cycles);
+
+    /* Bus load below the limit: half of the limit per measurement window */
+    cycles = vscp_test_waitForHeartbeat(VSCP_CONFIG_HEARTBEAT_NODE_PERIOD + 1, (2 * VSCP_CONFIG_HEARTBEAT_NODE_LOAD_WINDOW) / VSCP_CONFIG_HEARTBEAT_NODE_LOAD_LIMIT);
+
+    CU_ASSERT(VSCP_CONFIG_HEARTBEAT_NODE_PERIOD >= cycles);
+    CU_ASSERT((VSCP_CONFIG_HEARTBEAT_NODE_PERIOD - VSCP_CONFIG_HEARTBEAT_NODE_JITTER) <= cycles);
+
+    vscp_test_rxIdle = FALSE;
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ADAPTIVE_HEARTBEAT ) */
+
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *
+ * Action:
+ *  - Receive and send more than 255 messages via the transport layer.
+ *  - Send a message, while the transport layer adapter is busy.
+ *
+ * Expectation:
+ *  - The receive and transmit counters saturate at 255.
+ *  - The counters are cleared by reading them.
+ *  - A message, which isn't accepted, isn't counted.
+ */
+extern void vscp_test_heartbeat03(void)
+{
+    vscp_RxMessage  rxMessage;
+    vscp_TxMessage  txMessage;
+    uint16_t        index       = 0;
+
+    vscp_test_initTestCase();
+
+    memset(&txMessage, 0, sizeof(txMessage));
+    txMessage.vscpClass = VSCP_CLASS_L1_INFORMATION;
+    txMessage.vscpType  = VSCP_TYPE_INFORMATION_ON;
+    txMessage.priority  = VSCP_PRIORITY_3_NORMAL;
+    txMessage.oAddr     = VSCP_TEST_NICKNAME;
+    txMessage.dataNum   = 3;
+
+    /* Clear counters */
+    (void)vscp_transport_getReceivedMessages();
+    (void)vscp_transport_getTransmittedMessages();
+    (void)vscp_transport_getTransmitErrors();
+
+    vscp_test_rxIdle = TRUE;
+
+    /* Nothing received */
+    vscp_test_rxMessage.vscpType = 0;
+    CU_ASSERT_EQUAL(vscp_transport_readMessage(&rxMessage), FALSE);
+    CU_ASSERT_EQUAL(vscp_transport_getReceivedMessages(), 0);
+
+    for(index = 0; index < 300; ++index)
+    {
+        vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_INFORMATION;
+        vscp_test_rxMessage.vscpType    = VSCP_TYPE_INFORMATION_NODE_HEARTBEAT;
+        vscp_test_rxMessage.oAddr       = VSCP_TEST_NICKNAME + 1;
+        vscp_test_rxMessage.dataNum     = 0;
+
+        CU_ASSERT_EQUAL(vscp_transport_readMessage(&rxMessage), TRUE);
+
+        vscp_test_txMessageCnt = 0;
+        CU_ASSERT_EQUAL(vscp_transport_writeMessage(&txMessage), TRUE);
+    }
+
+    CU_ASSERT_EQUAL(vscp_transport_getReceivedMessages(), 255);
+    CU_ASSERT_EQUAL(vscp_transport_getReceivedMessages(), 0);
+    CU_ASSERT_EQUAL(vscp_transport_getTransmittedMessages(), 255);
+    CU_ASSERT_EQUAL(vscp_transport_getTransmittedMessages(), 0);
+
+    /* Transport layer adapter busy */
+    vscp_test_txBusy = TRUE;
+    CU_ASSERT_EQUAL(vscp_transport_writeMessage(&txMessage), FALSE);
+    vscp_test_txBusy = FALSE;
+
+    CU_ASSERT_EQUAL(vscp_transport_getTransmittedMessages(), 0);
+    CU_ASSERT_EQUAL(vscp_transport_getTransmitErrors(), 1);
+
+    vscp_test_rxIdle        = FALSE;
+    vscp_test_txMessageCnt  = 0;
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *
+ * Action:
+ *  - Prepare tx message
+ *  - Send message
+ *
+ * Expectation:
+ *  - Message is sent to the transport layer.
+ */
+extern void vscp_test_active34(void)
+{
+    vscp_TxMessage  txMessage;
+
+    vscp_core_prepareTxMessage(&txMessage, VSCP_CLASS_L1_PROTOCOL, VSCP_TYPE_PROTOCOL_UNDEFINED, VSCP_PRIORITY_3_NORMAL);
+
+    CU_ASSERT_EQUAL(txMessage.vscpClass, VSCP_CLASS_L1_PROTOCOL);
+    CU_ASSERT_EQUAL(txMessage.vscpType, VSCP_TYPE_PROTOCOL_UNDEFINED);
+    CU_ASSERT_EQUAL(txMessage.priority, VSCP_PRIORITY_3_NORMAL);
+    CU_ASSERT_EQUAL(txMessage.oAddr, VSCP_TEST_NICKNAME);
+    CU_ASSERT_EQUAL(txMessage.hardCoded, FALSE);
+    CU_ASSERT_EQUAL(txMessage.dataNum, 0);
+
+    txMessage.dataNum = 2;
+    txMessage.data[0]   = 0x12;
+    txMessage.data[1]   = 0x21;
+
+    /* Clear transmit message buffers */
+    memset(vscp_test_txMessage, 0, sizeof(vscp_test_txMessage));
+    vscp_test_txMessageCnt = 0;
+
+    vscp_core_sendEvent(&txMessage);
+
+    /* Node shall send a response */
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 1);
+
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpClass, VSCP_CLASS_L1_PROTOCOL);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_PROTOCOL_UNDEFINED);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].priority, VSCP_PRIORITY_3_NORMAL);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].oAddr, VSCP_TEST_NICKNAME);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].hardCoded, FALSE);
     CU_ASSERT_EQUAL(vscp_test_txMessage[0].dataNum, 2);
     CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[0], 0x12);
     CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[1], 0x21);
@@ -3335,32 +3910,1091 @@ extern void vscp_test_active34(void)
 
 /**
  * Precondition:
- *  - VSCP is active.
+ *  - VSCP is active.
+ *
+ * Action:
+ *  - Send a measurement, a measurement zone and a information event by the
+ *    generic event encoder.
+ *
+ * Expectation:
+ *  - Events are sent with the class, type and payload layout of their descriptor.
+ */
+extern void vscp_test_active36(void)
+{
+    int32_t data    = 0;
+    int8_t  exp     = 0;
+
+    /* Clear transmit message buffers */
+    memset(vscp_test_txMessage, 0, sizeof(vscp_test_txMessage));
+    vscp_test_txMessageCnt = 0;
+
+    /* Data coding byte and normalized integer */
+    CU_ASSERT_EQUAL(vscp_measurement_sendTemperatureEvent(1, 2, 215, -1), TRUE);
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpClass, VSCP_CLASS_L1_MEASUREMENT);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_MEASUREMENT_TEMPERATURE);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].priority, VSCP_PRIORITY_3_NORMAL);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].dataNum, 4);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[0], vscp_data_coding_getFormatByte(VSCP_DATA_CODING_REPRESENTATION_NORMALIZED_INTEGER, 2, 1));
+    vscp_data_coding_normalizedIntegerToInt32(&vscp_test_txMessage[0].data[1], vscp_test_txMessage[0].dataNum - 1, &data, &exp);
+    CU_ASSERT_EQUAL(data, 215);
+    CU_ASSERT_EQUAL(exp, -1);
+
+    /* Index, zone, sub-zone and normalized integer */
+    CU_ASSERT_EQUAL(vscp_measurezone_sendTemperatureEvent(1, 2, 3, -40, 0), TRUE);
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 2);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[1].vscpClass, VSCP_CLASS_L1_MEASUREZONE);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[1].vscpType, VSCP_TYPE_MEASUREZONE_TEMPERATURE);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[1].dataNum, 5);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[1].data[0], 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[1].data[1], 2);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[1].data[2], 3);
+    vscp_data_coding_normalizedIntegerToInt32(&vscp_test_txMessage[1].data[3], vscp_test_txMessage[1].dataNum - 3, &data, &exp);
+    CU_ASSERT_EQUAL((int8_t)data, -40);
+    CU_ASSERT_EQUAL(exp, 0);
+
+    /* Raw bytes */
+    CU_ASSERT_EQUAL(vscp_information_sendBelowLimitEvent(4, 5), TRUE);
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 3);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[2].vscpClass, VSCP_CLASS_L1_INFORMATION);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[2].vscpType, VSCP_TYPE_INFORMATION_BELOW_LIMIT);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[2].dataNum, 3);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[2].data[0], 0);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[2].data[1], 4);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[2].data[2], 5);
+
+    /* No data */
+    CU_ASSERT_EQUAL(vscp_information_sendUndefinedEvent(), TRUE);
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 4);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[3].vscpType, VSCP_TYPE_INFORMATION_UNDEFINED);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[3].dataNum, 0);
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *
+ * Action:
+ *  - Send several events at once.
+ *  - Transport layer adapter accepts only a part of them.
+ *  - Send several events, with a invalid one in between.
+ *
+ * Expectation:
+ *  - All events are passed to the transport layer adapter in one call.
+ *  - The number of accepted events is reported and one transmit error counted.
+ *  - Only the events in front of the invalid one are sent.
+ */
+extern void vscp_test_active37(void)
+{
+    vscp_TxMessage  txMessages[3];
+    uint8_t         index   = 0;
+
+    for(index = 0; index < VSCP_TEST_ARRAY_NUM(txMessages); ++index)
+    {
+        vscp_core_prepareTxMessage(&txMessages[index], VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_ON, VSCP_PRIORITY_3_NORMAL);
+        txMessages[index].dataNum   = 3;
+        txMessages[index].data[0]   = index;
+        txMessages[index].data[1]   = 0;
+        txMessages[index].data[2]   = 0;
+    }
+
+    /* Clear transmit message buffers */
+    memset(vscp_test_txMessage, 0, sizeof(vscp_test_txMessage));
+    vscp_test_txMessageCnt = 0;
+    vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_TP_ADAPTER_WRITE_MESSAGE] = 0;
+    vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_TP_ADAPTER_WRITE_MESSAGES] = 0;
+    (void)vscp_transport_getTransmitErrors();
+
+    /* All accepted */
+    CU_ASSERT_EQUAL(vscp_core_sendEvents(txMessages, 3), 3);
+    CU_ASSERT_EQUAL(vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_TP_ADAPTER_WRITE_MESSAGES], 1);
+    CU_ASSERT_EQUAL(vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_TP_ADAPTER_WRITE_MESSAGE], 0);
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 3);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[0], 0);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[2].data[0], 2);
+    CU_ASSERT_EQUAL(vscp_transport_getTransmitErrors(), 0);
+
+    /* Only a part is accepted */
+    vscp_test_txMessageCnt  = 0;
+    vscp_test_txAcceptNum   = 2;
+    CU_ASSERT_EQUAL(vscp_core_sendEvents(txMessages, 3), 2);
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 2);
+    CU_ASSERT_EQUAL(vscp_transport_getTransmitErrors(), 1);
+    vscp_test_txAcceptNum   = VSCP_TEST_TX_MSG_NUM;
+
+    /* Invalid event in between */
+    vscp_test_txMessageCnt      = 0;
+    txMessages[1].dataNum       = VSCP_L1_DATA_SIZE + 1;
+    CU_ASSERT_EQUAL(vscp_core_sendEvents(txMessages, 3), 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 1);
+    CU_ASSERT_EQUAL(vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_TP_ADAPTER_WRITE_MESSAGES], 3);
+
+    /* Nothing to send */
+    CU_ASSERT_EQUAL(vscp_core_sendEvents(NULL, 3), 0);
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *
+ * Action:
+ *  - Send a event to the core, which is not from the protocol class.
+ *
+ * Expectation:
+ *  - Event is provided to the application.
+ */
+extern void vscp_test_active35(void)
+{
+    vscp_test_initTestCase();
+
+    vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_INFORMATION;
+    vscp_test_rxMessage.vscpType    = VSCP_TYPE_INFORMATION_ALIVE;
+    vscp_test_rxMessage.priority    = VSCP_PRIORITY_3_NORMAL;
+    vscp_test_rxMessage.oAddr       = VSCP_TEST_NICKNAME_REMOTE;
+    vscp_test_rxMessage.hardCoded   = FALSE;
+    vscp_test_rxMessage.dataNum     = 0;
+
+    vscp_test_waitForTxMessage(1, 1);
+
+    /* Node shall not send a response */
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 0);
+
+    /* Node shall provide event to the application */
+    CU_ASSERT_EQUAL(vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_PORTABLE_PROVIDE_EVENT], 1);
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *
+ * Action:
+ *  - Register a sensor at the measurement publisher.
+ *  - Update its value inside and outside the deadband.
+ *
+ * Expectation:
+ *  - The first value is sent immediately and normalized.
+ *  - Changes within the deadband are suppressed.
+ *  - Changes beyond the deadband are sent after the minimum interval.
+ *  - The value is sent again after the maximum interval.
+ *  - A failed send is repeated.
+ */
+extern void vscp_test_publisher01(void)
+{
+    static const vscp_publisher_Config  config  =
+    {
+        vscp_test_publisherSend,    /* Send function */
+        1,                          /* Sensor index */
+        0,                          /* Unit */
+        -1,                         /* Exponent */
+        5,                          /* Absolute deadband */
+        0,                          /* Relative deadband */
+        2,                          /* Minimum interval */
+        10                          /* Maximum interval */
+    };
+    static const vscp_publisher_Config  configInvalid   =
+    {
+        vscp_test_publisherSend,    /* Send function */
+        2,                          /* Sensor index */
+        0,                          /* Unit */
+        0,                          /* Exponent */
+        0,                          /* Absolute deadband */
+        VSCP_PUBLISHER_DEADBAND_REL_MAX + 1, /* Relative deadband */
+        1,                          /* Minimum interval */
+        0                           /* Maximum interval */
+    };
+    uint8_t id  = VSCP_PUBLISHER_ID_INVALID;
+
+    vscp_test_initTestCase();
+
+    vscp_test_publisherSendCnt  = 0;
+    vscp_test_publisherTxFull   = FALSE;
+
+    id = vscp_publisher_register(&config);
+    CU_ASSERT_NOT_EQUAL(id, VSCP_PUBLISHER_ID_INVALID);
+
+    /* No value yet */
+    vscp_test_processCycles(3);
+    CU_ASSERT_EQUAL(vscp_test_publisherSendCnt, 0);
+
+    /* First value shall be sent immediately: 200 * 10^-1 => 2 * 10^1 */
+    vscp_publisher_update(id, 200);
+    vscp_test_processCycles(1);
+    CU_ASSERT_EQUAL(vscp_test_publisherSendCnt, 1);
+    CU_ASSERT_EQUAL(vscp_test_publisherData, 2);
+    CU_ASSERT_EQUAL(vscp_test_publisherExp, 1);
+
+    /* Within deadband */
+    vscp_publisher_update(id, 203);
+    vscp_test_processCycles(5);
+    CU_ASSERT_EQUAL(vscp_test_publisherSendCnt, 1);
+
+    /* Beyond deadband */
+    vscp_publisher_update(id, 211);
+    vscp_test_processCycles(1);
+    CU_ASSERT_EQUAL(vscp_test_publisherSendCnt, 2);
+    CU_ASSERT_EQUAL(vscp_test_publisherData, 211);
+    CU_ASSERT_EQUAL(vscp_test_publisherExp, -1);
+
+    /* Beyond deadband, but minimum interval not elapsed yet */
+    vscp_publisher_update(id, 300);
+    vscp_test_processCycles(1);
+    CU_ASSERT_EQUAL(vscp_test_publisherSendCnt, 2);
+    vscp_test_processCycles(1);
+    CU_ASSERT_EQUAL(vscp_test_publisherSendCnt, 3);
+    CU_ASSERT_EQUAL(vscp_test_publisherData, 3);
+    CU_ASSERT_EQUAL(vscp_test_publisherExp, 1);
+
+    /* Maximum interval */
+    vscp_test_processCycles(9);
+    CU_ASSERT_EQUAL(vscp_test_publisherSendCnt, 3);
+    vscp_test_processCycles(1);
+    CU_ASSERT_EQUAL(vscp_test_publisherSendCnt, 4);
+
+    /* Failed send shall be repeated. */
+    vscp_test_publisherTxFull = TRUE;
+    vscp_publisher_update(id, 400);
+    vscp_test_processCycles(2);
+    CU_ASSERT_EQUAL(vscp_test_publisherSendCnt, 4);
+    vscp_test_publisherTxFull = FALSE;
+    vscp_test_processCycles(1);
+    CU_ASSERT_EQUAL(vscp_test_publisherSendCnt, 5);
+    CU_ASSERT_EQUAL(vscp_test_publisherData, 4);
+    CU_ASSERT_EQUAL(vscp_test_publisherExp, 1);
+
+    /* Relative deadband above 100% is rejected. */
+    CU_ASSERT_EQUAL(vscp_publisher_register(&configInvalid), VSCP_PUBLISHER_ID_INVALID);
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *  - Logger is enabled with all log levels.
+ *
+ * Action:
+ *  - Log messages with the same id faster than the rate limit.
+ *  - Log messages with more ids than the queue can hold.
+ *
+ * Expectation:
+ *  - Log messages are sent by the core process with the lowest priority.
+ *  - A pending message with the same id is replaced by the latest one.
+ *  - Replaced and suppressed messages are reported in the next second.
+ *  - Messages which don't fit into the queue are dropped and counted.
+ *  - Stopping the logging clears the queue.
+ */
+extern void vscp_test_logger01(void)
+{
+    static const uint8_t    msgA[] = { 'a', 'b', 'c' };
+    static const uint8_t    msgB[] = { 'x', 'y', 'z' };
+
+    vscp_test_initTestCase();
+
+    /* The timers are not processed, so the time since epoch is under control. */
+    vscp_core_setTimeSinceEpoch(1000);
+    vscp_logger_init();
+    vscp_logger_enable(TRUE);
+    vscp_logger_setLogLevel(0xFF);
+
+    /* Logging itself sends nothing. */
+    vscp_logger_log(1, VSCP_LOGGER_LVL_ERROR, msgA, sizeof(msgA));
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 0);
+
+    /* The core process sends the log message with the lowest priority. */
+    vscp_core_process();
+    CU_ASSERT_EQUAL_FATAL(vscp_test_txMessageCnt, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpClass, VSCP_CLASS_L1_LOG);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].vscpType, VSCP_TYPE_LOG_LOG_EVENT);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].priority, VSCP_PRIORITY_7_LOW);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[0], 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[1], VSCP_LOGGER_LVL_ERROR);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[3], 'a');
+
+    /* The pending message is replaced by the latest one. */
+    vscp_test_txMessageCnt = 0;
+    vscp_logger_log(1, VSCP_LOGGER_LVL_ERROR, msgA, sizeof(msgA));
+    vscp_logger_log(1, VSCP_LOGGER_LVL_ERROR, msgA, sizeof(msgA));
+    vscp_logger_log(1, VSCP_LOGGER_LVL_ERROR, msgB, sizeof(msgB));
+    vscp_core_process();
+    vscp_core_process();
+    CU_ASSERT_EQUAL_FATAL(vscp_test_txMessageCnt, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[0], 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[3], 'x');
+
+    /* The rate limit is reached, the message is only counted. */
+    vscp_test_txMessageCnt = 0;
+    vscp_logger_log(1, VSCP_LOGGER_LVL_ERROR, msgA, sizeof(msgA));
+    vscp_core_process();
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 0);
+
+    /* Next second: 2 replaced and 1 suppressed message are reported. */
+    vscp_core_setTimeSinceEpoch(1001);
+    vscp_core_process();
+    CU_ASSERT_EQUAL_FATAL(vscp_test_txMessageCnt, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].priority, VSCP_PRIORITY_7_LOW);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[0], VSCP_CONFIG_LOGGER_REPEATED_ID);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[3], 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[4], 0);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[5], 3);
+
+    /* The queue is full, because the first id stays until the next second. */
+    vscp_test_txMessageCnt = 0;
+    CU_ASSERT_EQUAL(vscp_logger_getDropCnt(), 0);
+    vscp_logger_log(2, VSCP_LOGGER_LVL_INFO, msgA, sizeof(msgA));
+    vscp_logger_log(3, VSCP_LOGGER_LVL_INFO, msgA, sizeof(msgA));
+    CU_ASSERT_EQUAL(vscp_logger_getDropCnt(), 1);
+    vscp_core_process();
+    vscp_core_process();
+    CU_ASSERT_EQUAL_FATAL(vscp_test_txMessageCnt, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[0], 2);
+
+    /* In the next second the queue has space again. */
+    vscp_test_txMessageCnt = 0;
+    vscp_core_setTimeSinceEpoch(1002);
+    vscp_logger_log(3, VSCP_LOGGER_LVL_INFO, msgA, sizeof(msgA));
+    vscp_core_process();
+    CU_ASSERT_EQUAL_FATAL(vscp_test_txMessageCnt, 1);
+    CU_ASSERT_EQUAL(vscp_test_txMessage[0].data[0], 3);
+    CU_ASSERT_EQUAL(vscp_logger_getDropCnt(), 1);
+
+    /* Stopping the logging clears the queue. */
+    vscp_test_txMessageCnt = 0;
+    vscp_logger_log(3, VSCP_LOGGER_LVL_INFO, msgA, sizeof(msgA));
+    vscp_logger_enable(FALSE);
+    vscp_core_process();
+    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 0);
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - None
+ *
+ * Action:
+ *  - Encode values in the shortest normalized integer format.
+ *  - Encode floating point values in the normalized integer format.
+ *
+ * Expectation:
+ *  - Trailing decimal zeros are moved to the exponent.
+ *  - Floating point values are rounded to the given decimals.
+ */
+extern void vscp_test_dataCoding01(void)
+{
+    uint8_t codedData[VSCP_L1_DATA_SIZE];
+    uint8_t size    = 0;
+    int32_t data    = 0;
+    int8_t  exp     = 0;
+
+    /* 3300 * 10^-2 => 33 * 10^0 */
+    size = vscp_data_coding_int32ToBestNormalizedInteger(3300, -2, codedData, sizeof(codedData));
+    CU_ASSERT_EQUAL(size, 2);
+    vscp_data_coding_normalizedIntegerToInt32(codedData, size, &data, &exp);
+    CU_ASSERT_EQUAL(data, 33);
+    CU_ASSERT_EQUAL(exp, 0);
+
+    /* -1200000000 * 10^0 => -12 * 10^8 */
+    size = vscp_data_coding_int32ToBestNormalizedInteger(-1200000000, 0, codedData, sizeof(codedData));
+    CU_ASSERT_EQUAL(size, 2);
+    vscp_data_coding_normalizedIntegerToInt32(codedData, size, &data, &exp);
+    CU_ASSERT_EQUAL((int8_t)data, -12);
+    CU_ASSERT_EQUAL(exp, 8);
+
+    /* No trailing zeros */
+    size = vscp_data_coding_int32ToBestNormalizedInteger(12345, -3, codedData, sizeof(codedData));
+    CU_ASSERT_EQUAL(size, 3);
+    vscp_data_coding_normalizedIntegerToInt32(codedData, size, &data, &exp);
+    CU_ASSERT_EQUAL(data, 12345);
+    CU_ASSERT_EQUAL(exp, -3);
+
+    /* 21.456 with 2 decimals => 2146 * 10^-2 */
+    size = vscp_data_coding_floatToNormalizedInteger(21.456f, 2, codedData, sizeof(codedData));
+    CU_ASSERT_EQUAL(size, 3);
+    vscp_data_coding_normalizedIntegerToInt32(codedData, size, &data, &exp);
+    CU_ASSERT_EQUAL(data, 2146);
+    CU_ASSERT_EQUAL(exp, -2);
+
+    /* -2.5 with 3 decimals => -25 * 10^-1 */
+    size = vscp_data_coding_floatToNormalizedInteger(-2.5f, 3, codedData, sizeof(codedData));
+    CU_ASSERT_EQUAL(size, 2);
+    vscp_data_coding_normalizedIntegerToInt32(codedData, size, &data, &exp);
+    CU_ASSERT_EQUAL((int8_t)data, -25);
+    CU_ASSERT_EQUAL(exp, -1);
+
+    /* Out of range */
+    size = vscp_data_coding_floatToNormalizedInteger(3.0e9f, 0, codedData, sizeof(codedData));
+    CU_ASSERT_EQUAL(size, 0);
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - None
+ *
+ * Action:
+ *  - Encode and decode floating point values.
+ *  - Encode and decode ASCII numerical strings.
+ *
+ * Expectation:
+ *  - Decoded values are equal to the encoded ones.
+ *  - Invalid strings are rejected.
+ */
+extern void vscp_test_dataCoding02(void)
+{
+    uint8_t codedData[VSCP_L1_DATA_SIZE];
+    uint8_t size    = 0;
+    float   value   = 0.0f;
+    int32_t data    = 0;
+    int8_t  exp     = 0;
+
+    /* IEEE-754 single precision, MSB first */
+    size = vscp_data_coding_floatToFloatingPoint(-21.5f, codedData, sizeof(codedData));
+    CU_ASSERT_EQUAL(size, 4);
+    CU_ASSERT_EQUAL(codedData[0], 0xc1);
+    CU_ASSERT_EQUAL(codedData[1], 0xac);
+    CU_ASSERT_EQUAL(codedData[2], 0x00);
+    CU_ASSERT_EQUAL(codedData[3], 0x00);
+    CU_ASSERT_EQUAL(vscp_data_coding_floatingPointToFloat(codedData, size, &value), TRUE);
+    CU_ASSERT_EQUAL(value, -21.5f);
+
+    /* String */
+    size = vscp_data_coding_int32ToString(22, -1, codedData, sizeof(codedData));
+    CU_ASSERT_EQUAL(size, 3);
+    CU_ASSERT_EQUAL(0, memcmp(codedData, "2.2", 3));
+
+    size = vscp_data_coding_int32ToString(-5, -2, codedData, sizeof(codedData));
+    CU_ASSERT_EQUAL(size, 5);
+    CU_ASSERT_EQUAL(0, memcmp(codedData, "-0.05", 5));
+
+    size = vscp_data_coding_int32ToString(33, 1, codedData, sizeof(codedData));
+    CU_ASSERT_EQUAL(size, 3);
+    CU_ASSERT_EQUAL(0, memcmp(codedData, "330", 3));
+
+    /* Doesn't fit */
+    size = vscp_data_coding_int32ToString(-1234567, -2, codedData, sizeof(codedData));
+    CU_ASSERT_EQUAL(size, 0);
+
+    CU_ASSERT_EQUAL(vscp_data_coding_stringToInt32((uint8_t const *)"-0.05", 5, &data, &exp), TRUE);
+    CU_ASSERT_EQUAL(data, -5);
+    CU_ASSERT_EQUAL(exp, -2);
+
+    CU_ASSERT_EQUAL(vscp_data_coding_stringToInt32((uint8_t const *)"1234", 4, &data, &exp), TRUE);
+    CU_ASSERT_EQUAL(data, 1234);
+    CU_ASSERT_EQUAL(exp, 0);
+
+    /* Invalid strings */
+    CU_ASSERT_EQUAL(vscp_data_coding_stringToInt32((uint8_t const *)"1.2.3", 5, &data, &exp), FALSE);
+    CU_ASSERT_EQUAL(vscp_data_coding_stringToInt32((uint8_t const *)"-", 1, &data, &exp), FALSE);
+    CU_ASSERT_EQUAL(vscp_data_coding_stringToInt32((uint8_t const *)"12a", 3, &data, &exp), FALSE);
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - None
+ *
+ * Action:
+ *  - Encode and decode the CAN identifier of all priorities, classes and types.
+ *
+ * Expectation:
+ *  - The identifier has the VSCP level 1 layout.
+ *  - Decoding results in the original message.
+ */
+extern void vscp_test_canCodec01(void)
+{
+    vscp_Message    msg;
+    vscp_Message    decoded;
+    uint32_t        id          = 0;
+    uint32_t        mismatches  = 0;
+    uint8_t         priority    = 0;
+    uint8_t         hardCoded   = 0;
+    uint16_t        vscpClass   = 0;
+    uint16_t        vscpType    = 0;
+
+    memset(&msg, 0, sizeof(msg));
+    memset(&decoded, 0, sizeof(decoded));
+
+    for(priority = 0; priority < 8; ++priority)
+    {
+        for(hardCoded = 0; hardCoded < 2; ++hardCoded)
+        {
+            for(vscpClass = 0; vscpClass < 512; ++vscpClass)
+            {
+                for(vscpType = 0; vscpType < 256; ++vscpType)
+                {
+                    msg.priority    = (VSCP_PRIORITY)priority;
+                    msg.hardCoded   = (BOOL)hardCoded;
+                    msg.vscpClass   = vscpClass;
+                    msg.vscpType    = (uint8_t)vscpType;
+                    msg.oAddr       = (uint8_t)(vscpClass * 7u + vscpType);
+
+                    id = vscp_can_codec_encodeId(&msg);
+
+                    if (id != (((uint32_t)priority << 26) |
+                               ((uint32_t)hardCoded << 25) |
+                               ((uint32_t)vscpClass << 16) |
+                               ((uint32_t)vscpType << 8) |
+                               ((uint32_t)msg.oAddr)))
+                    {
+                        ++mismatches;
+                    }
+
+                    vscp_can_codec_decodeId(id, &decoded);
+
+                    if ((decoded.priority != msg.priority) ||
+                        (decoded.hardCoded != msg.hardCoded) ||
+                        (decoded.vscpClass != msg.vscpClass) ||
+                        (decoded.vscpType != msg.vscpType) ||
+                        (decoded.oAddr != msg.oAddr))
+                    {
+                        ++mismatches;
+                    }
+                }
+            }
+        }
+    }
+
+    CU_ASSERT_EQUAL(mismatches, 0);
+
+    /* Out of range values don't leak into other fields. */
+    msg.priority    = (VSCP_PRIORITY)0xff;
+    msg.hardCoded   = (BOOL)0xff;
+    msg.vscpClass   = 0xffff;
+    msg.vscpType    = 0xff;
+    msg.oAddr       = 0xff;
+    CU_ASSERT_EQUAL(vscp_can_codec_encodeId(&msg), VSCP_CAN_CODEC_ID_MASK);
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - None
+ *
+ * Action:
+ *  - Pack and unpack 0 - 9 data bytes.
+ *
+ * Expectation:
+ *  - The data words are big endian.
+ *  - Bytes beyond the number of data bytes are zero.
+ *  - The number of data bytes is limited to 8.
+ */
+extern void vscp_test_canCodec02(void)
+{
+    vscp_Message    msg;
+    vscp_Message    decoded;
+    uint32_t        word0   = 0;
+    uint32_t        word1   = 0;
+    uint8_t         num     = 0;
+    uint8_t         index   = 0;
+
+    memset(&msg, 0, sizeof(msg));
+    memset(&decoded, 0, sizeof(decoded));
+
+    for(index = 0; index < VSCP_L1_DATA_SIZE; ++index)
+    {
+        msg.data[index] = 0x11 * (index + 1);
+    }
+
+    for(num = 0; num <= (VSCP_L1_DATA_SIZE + 1); ++num)
+    {
+        uint32_t    expWord0    = 0;
+        uint32_t    expWord1    = 0;
+        uint8_t     expNum      = (VSCP_L1_DATA_SIZE < num) ? VSCP_L1_DATA_SIZE : num;
+
+        for(index = 0; index < expNum; ++index)
+        {
+            if (4 > index)
+            {
+                expWord0 |= (uint32_t)msg.data[index] << (24 - index * 8);
+            }
+            else
+            {
+                expWord1 |= (uint32_t)msg.data[index] << (56 - index * 8);
+            }
+        }
+
+        msg.dataNum = num;
+        vscp_can_codec_packData(&msg, &word0, &word1);
+        CU_ASSERT_EQUAL(word0, expWord0);
+        CU_ASSERT_EQUAL(word1, expWord1);
+
+        vscp_can_codec_unpackData(word0, word1, num, &decoded);
+        CU_ASSERT_EQUAL(decoded.dataNum, expNum);
+        CU_ASSERT_EQUAL(0, memcmp(decoded.data, msg.data, expNum));
+    }
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - None
+ *
+ * Action:
+ *  - Initialize rings with invalid number of elements.
+ *  - Write and read frames, many times around the ring.
+ *
+ * Expectation:
+ *  - Only a power of two up to 128 elements is accepted.
+ *  - A full ring rejects frames.
+ *  - Frames are read in the order they were written.
+ */
+extern void vscp_test_canRing01(void)
+{
+    vscp_can_ring_Frame storage[VSCP_CAN_RING_NUM_MAX];
+    vscp_can_ring_Ring  ring;
+    vscp_can_ring_Frame frame;
+    uint16_t            round       = 0;
+    uint16_t            index       = 0;
+    uint32_t            writeCnt    = 0;
+    uint32_t            readCnt     = 0;
+    uint32_t            mismatches  = 0;
+
+    memset(&frame, 0, sizeof(frame));
+
+    CU_ASSERT_EQUAL(vscp_can_ring_init(&ring, storage, 0), FALSE);
+    CU_ASSERT_EQUAL(vscp_can_ring_init(&ring, storage, 3), FALSE);
+    CU_ASSERT_EQUAL(vscp_can_ring_init(&ring, storage, 200), FALSE);
+    CU_ASSERT_EQUAL(vscp_can_ring_init(&ring, NULL, 4), FALSE);
+    CU_ASSERT_EQUAL(vscp_can_ring_init(&ring, storage, VSCP_CAN_RING_NUM_MAX), TRUE);
+
+    /* Fill the largest ring completely. */
+    for(index = 0; index < VSCP_CAN_RING_NUM_MAX; ++index)
+    {
+        frame.id = index;
+        CU_ASSERT_EQUAL(vscp_can_ring_put(&ring, &frame), TRUE);
+    }
+    CU_ASSERT_EQUAL(vscp_can_ring_getNum(&ring), VSCP_CAN_RING_NUM_MAX);
+    CU_ASSERT_EQUAL(vscp_can_ring_put(&ring, &frame), FALSE);
+
+    for(index = 0; index < VSCP_CAN_RING_NUM_MAX; ++index)
+    {
+        CU_ASSERT_EQUAL(vscp_can_ring_get(&ring, &frame), TRUE);
+        CU_ASSERT_EQUAL(frame.id, index);
+    }
+    CU_ASSERT_EQUAL(vscp_can_ring_get(&ring, &frame), FALSE);
+    CU_ASSERT_EQUAL(vscp_can_ring_getNum(&ring), 0);
+
+    /* Small ring, the indices wrap around many times. */
+    CU_ASSERT_EQUAL(vscp_can_ring_init(&ring, storage, 4), TRUE);
+
+    for(round = 0; round < 1000; ++round)
+    {
+        /* Write 1 - 4 frames, read 1 - 4 frames */
+        for(index = 0; index <= (round % 4); ++index)
+        {
+            frame.id        = writeCnt;
+            frame.dataWord0 = ~writeCnt;
+
+            if (FALSE != vscp_can_ring_put(&ring, &frame))
+            {
+                ++writeCnt;
+            }
+        }
+
+        for(index = 0; index <= ((round / 4) % 4); ++index)
+        {
+            if (FALSE != vscp_can_ring_get(&ring, &frame))
+            {
+                if ((frame.id != readCnt) ||
+                    (frame.dataWord0 != ~readCnt))
+                {
+                    ++mismatches;
+                }
+
+                ++readCnt;
+            }
+        }
+
+        if (4 < vscp_can_ring_getNum(&ring))
+        {
+            ++mismatches;
+        }
+    }
+
+    CU_ASSERT_EQUAL(mismatches, 0);
+    CU_ASSERT_EQUAL(writeCnt - readCnt, vscp_can_ring_getNum(&ring));
+    CU_ASSERT(1000 < writeCnt);
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - CAN transport layer adapter is initialized.
  *
  * Action:
- *  - Send a event to the core, which is not from the protocol class.
+ *  - The receive interrupt gets more frames than the receive ring can store.
+ *  - Read all messages.
+ *  - Receive interrupt and main loop alternate for a long time.
  *
  * Expectation:
- *  - Event is provided to the application.
+ *  - The dropped frames are counted.
+ *  - The stored frames are read as messages in order.
+ *  - No frame is lost, as long as the main loop keeps up.
  */
-extern void vscp_test_active35(void)
+extern void vscp_test_canAdapter01(void)
+{
+    vscp_can_ring_Frame frame;
+    vscp_RxMessage      rxMsg;
+    uint16_t            round       = 0;
+    uint8_t             index       = 0;
+    uint16_t            sent        = 0;
+    uint16_t            received    = 0;
+    uint16_t            mismatches  = 0;
+
+    memset(&frame, 0, sizeof(frame));
+    memset(&rxMsg, 0, sizeof(rxMsg));
+
+    vscp_can_adapter_init();
+
+    CU_ASSERT_EQUAL(vscp_can_adapter_readMessage(&rxMsg), FALSE);
+
+    /* One frame more than the receive ring can store */
+    for(index = 0; index <= VSCP_CONFIG_CAN_ADAPTER_RX_NUM; ++index)
+    {
+        frame.id        = (3u << 26) | (VSCP_CLASS_L1_INFORMATION << 16) | (VSCP_TYPE_INFORMATION_ON << 8) | index;
+        frame.length    = 3;
+        frame.dataWord0 = 0x01020300u | index;
+        frame.dataWord1 = 0;
+        vscp_can_adapter_onRxFrame(&frame);
+    }
+
+    CU_ASSERT_EQUAL(vscp_can_adapter_getRxOverflows(), 1);
+    CU_ASSERT_EQUAL(vscp_test_canIrqDisabled, FALSE);
+
+    for(index = 0; index < VSCP_CONFIG_CAN_ADAPTER_RX_NUM; ++index)
+    {
+        CU_ASSERT_EQUAL(vscp_can_adapter_readMessage(&rxMsg), TRUE);
+        CU_ASSERT_EQUAL(rxMsg.priority, VSCP_PRIORITY_3_NORMAL);
+        CU_ASSERT_EQUAL(rxMsg.hardCoded, FALSE);
+        CU_ASSERT_EQUAL(rxMsg.vscpClass, VSCP_CLASS_L1_INFORMATION);
+        CU_ASSERT_EQUAL(rxMsg.vscpType, VSCP_TYPE_INFORMATION_ON);
+        CU_ASSERT_EQUAL(rxMsg.oAddr, index);
+        CU_ASSERT_EQUAL(rxMsg.dataNum, 3);
+        CU_ASSERT_EQUAL(rxMsg.data[0], 0x01);
+        CU_ASSERT_EQUAL(rxMsg.data[1], 0x02);
+        CU_ASSERT_EQUAL(rxMsg.data[2], 0x03);
+    }
+
+    CU_ASSERT_EQUAL(vscp_can_adapter_readMessage(&rxMsg), FALSE);
+
+    /* Bursts up to the ring size, the main loop reads all in between. */
+    for(round = 0; round < 1000; ++round)
+    {
+        for(index = 0; index <= (round % VSCP_CONFIG_CAN_ADAPTER_RX_NUM); ++index)
+        {
+            frame.id        = sent & 0xff;
+            frame.length    = 8;
+            frame.dataWord0 = sent;
+            frame.dataWord1 = ~(uint32_t)sent;
+            vscp_can_adapter_onRxFrame(&frame);
+            ++sent;
+        }
+
+        while(FALSE != vscp_can_adapter_readMessage(&rxMsg))
+        {
+            if ((rxMsg.oAddr != (received & 0xff)) ||
+                (rxMsg.dataNum != 8) ||
+                (rxMsg.data[2] != ((received >> 8) & 0xff)) ||
+                (rxMsg.data[3] != (received & 0xff)) ||
+                (rxMsg.data[7] != ((~received) & 0xff)))
+            {
+                ++mismatches;
+            }
+
+            ++received;
+        }
+    }
+
+    CU_ASSERT_EQUAL(mismatches, 0);
+    CU_ASSERT_EQUAL(sent, received);
+    CU_ASSERT_EQUAL(vscp_can_adapter_getRxOverflows(), 1);
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - CAN transport layer adapter is initialized.
+ *
+ * Action:
+ *  - Write messages, more than the transmit ring can store.
+ *  - Signal transmit complete interrupts.
+ *  - Write several messages at once.
+ *
+ * Expectation:
+ *  - The first frame is sent immediately, the others are queued.
+ *  - A full transmit ring rejects messages, without blocking.
+ *  - Every transmit complete interrupt sends the next queued frame.
+ *  - The CAN interrupt is enabled again after every call.
+ */
+extern void vscp_test_canAdapter02(void)
+{
+    vscp_TxMessage  txMsgs[VSCP_CONFIG_CAN_ADAPTER_TX_NUM + 2];
+    uint8_t         index   = 0;
+
+    memset(txMsgs, 0, sizeof(txMsgs));
+
+    for(index = 0; index < VSCP_TEST_ARRAY_NUM(txMsgs); ++index)
+    {
+        txMsgs[index].priority  = VSCP_PRIORITY_7_LOW;
+        txMsgs[index].vscpClass = VSCP_CLASS_L1_INFORMATION;
+        txMsgs[index].vscpType  = VSCP_TYPE_INFORMATION_OFF;
+        txMsgs[index].oAddr     = VSCP_TEST_NICKNAME;
+        txMsgs[index].dataNum   = 1;
+        txMsgs[index].data[0]   = index;
+    }
+
+    vscp_can_adapter_init();
+    vscp_test_canTxFrameCnt = 0;
+
+    /* Idle, the first frame is written to the CAN controller immediately. */
+    CU_ASSERT_EQUAL(vscp_can_adapter_writeMessage(&txMsgs[0]), TRUE);
+    CU_ASSERT_EQUAL(vscp_test_canTxFrameCnt, 1);
+    CU_ASSERT_EQUAL(vscp_test_canTxFrame[0].id, vscp_can_codec_encodeId(&txMsgs[0]));
+    CU_ASSERT_EQUAL(vscp_test_canTxFrame[0].length, 1);
+    CU_ASSERT_EQUAL(vscp_test_canTxFrame[0].dataWord0, 0x00000000u);
+    CU_ASSERT_EQUAL(vscp_test_canIrqDisabled, FALSE);
+
+    /* Busy, the next ones are queued until the ring is full. */
+    for(index = 1; index <= VSCP_CONFIG_CAN_ADAPTER_TX_NUM; ++index)
+    {
+        CU_ASSERT_EQUAL(vscp_can_adapter_writeMessage(&txMsgs[index]), TRUE);
+    }
+    CU_ASSERT_EQUAL(vscp_can_adapter_writeMessage(&txMsgs[index]), FALSE);
+    CU_ASSERT_EQUAL(vscp_test_canTxFrameCnt, 1);
+
+    /* Invalid message */
+    txMsgs[0].dataNum = VSCP_L1_DATA_SIZE + 1;
+    CU_ASSERT_EQUAL(vscp_can_adapter_writeMessage(&txMsgs[0]), FALSE);
+    txMsgs[0].dataNum = 1;
+
+    /* Every transmit complete interrupt sends the next one. */
+    for(index = 1; index <= VSCP_CONFIG_CAN_ADAPTER_TX_NUM; ++index)
+    {
+        vscp_can_adapter_onTxComplete();
+        CU_ASSERT_EQUAL(vscp_test_canTxFrameCnt, index + 1);
+        CU_ASSERT_EQUAL(vscp_test_canTxFrame[index].dataWord0, (uint32_t)index << 24);
+    }
+
+    /* Nothing left, idle again. */
+    vscp_can_adapter_onTxComplete();
+    CU_ASSERT_EQUAL(vscp_test_canTxFrameCnt, VSCP_CONFIG_CAN_ADAPTER_TX_NUM + 1);
+
+    /* Several at once, the first one is sent and the ring is filled. */
+    vscp_test_canTxFrameCnt = 0;
+    CU_ASSERT_EQUAL(vscp_can_adapter_writeMessages(txMsgs, VSCP_TEST_ARRAY_NUM(txMsgs)), VSCP_CONFIG_CAN_ADAPTER_TX_NUM + 1);
+    CU_ASSERT_EQUAL(vscp_test_canTxFrameCnt, 1);
+    CU_ASSERT_EQUAL(vscp_test_canIrqDisabled, FALSE);
+
+    for(index = 0; index < (VSCP_CONFIG_CAN_ADAPTER_TX_NUM + 1); ++index)
+    {
+        vscp_can_adapter_onTxComplete();
+    }
+    CU_ASSERT_EQUAL(vscp_test_canTxFrameCnt, VSCP_CONFIG_CAN_ADAPTER_TX_NUM + 1);
+
+    for(index = 0; index < vscp_test_canTxFrameCnt; ++index)
+    {
+        CU_ASSERT_EQUAL(vscp_test_canTxFrame[index].dataWord0, (uint32_t)index << 24);
+    }
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - None
+ *
+ * Action:
+ *  - Plan filters without storage.
+ *  - Plan the protocol class and two neighboring types of one class.
+ *  - Plan an interest in everything.
+ *  - Plan random interests with 1 - 8 filters.
+ *
+ * Expectation:
+ *  - Without storage nothing is accepted.
+ *  - Neighboring types and duplicates are merged without loss.
+ *  - Priority, hard coded and originating address bits are not checked.
+ *  - Every interest is accepted and the number of filters is not exceeded.
+ *  - As long as the filters are enough, nothing else is accepted.
+ */
+extern void vscp_test_canFilter01(void)
+{
+    vscp_can_filter_Filter  filters[VSCP_TEST_CAN_FILTER_NUM_MAX];
+    vscp_can_filter_Plan    plan;
+    uint16_t                interests[VSCP_TEST_CAN_INTEREST_NUM_MAX][4];
+    vscp_Message            msg;
+    uint32_t                missing     = 0;
+    uint32_t                extra       = 0;
+    uint8_t                 round       = 0;
+
+    memset(&msg, 0, sizeof(msg));
+
+    /* No storage */
+    vscp_can_filter_init(&plan, NULL, VSCP_TEST_CAN_FILTER_NUM_MAX);
+    vscp_can_filter_add(&plan, VSCP_INTEREST_CLASS_MASK, VSCP_CLASS_L1_PROTOCOL, 0, 0);
+    CU_ASSERT_EQUAL(plan.num, 0);
+    CU_ASSERT_EQUAL(vscp_can_filter_isAccepted(&plan, 0), FALSE);
+
+    /* Protocol class and the types 4 and 5 of class 20 */
+    interests[0][0] = VSCP_INTEREST_CLASS_MASK;
+    interests[0][1] = VSCP_CLASS_L1_PROTOCOL;
+    interests[0][2] = 0;
+    interests[0][3] = 0;
+    interests[1][0] = VSCP_INTEREST_CLASS_MASK;
+    interests[1][1] = 20;
+    interests[1][2] = VSCP_INTEREST_TYPE_MASK;
+    interests[1][3] = 4;
+    interests[2][0] = VSCP_INTEREST_CLASS_MASK;
+    interests[2][1] = 20;
+    interests[2][2] = VSCP_INTEREST_TYPE_MASK;
+    interests[2][3] = 5;
+
+    vscp_can_filter_init(&plan, filters, VSCP_TEST_CAN_FILTER_NUM_MAX);
+    vscp_can_filter_add(&plan, interests[0][0], interests[0][1], (uint8_t)interests[0][2], (uint8_t)interests[0][3]);
+    vscp_can_filter_add(&plan, interests[1][0], interests[1][1], (uint8_t)interests[1][2], (uint8_t)interests[1][3]);
+    vscp_can_filter_add(&plan, interests[2][0], interests[2][1], (uint8_t)interests[2][2], (uint8_t)interests[2][3]);
+    vscp_can_filter_add(&plan, interests[2][0], interests[2][1], (uint8_t)interests[2][2], (uint8_t)interests[2][3]);
+
+    CU_ASSERT_EQUAL(plan.num, 2);
+    vscp_test_checkCanFilterPlan(&plan, interests, 3, &missing, &extra);
+    CU_ASSERT_EQUAL(missing, 0);
+    CU_ASSERT_EQUAL(extra, 0);
+
+    msg.priority    = VSCP_PRIORITY_7_LOW;
+    msg.hardCoded   = TRUE;
+    msg.vscpClass   = 20;
+    msg.vscpType    = 5;
+    msg.oAddr       = 0xff;
+    CU_ASSERT_EQUAL(vscp_can_filter_isAccepted(&plan, vscp_can_codec_encodeId(&msg)), TRUE);
+
+    /* A single filter accepts both, the protocol class and class 20. */
+    vscp_can_filter_init(&plan, filters, 1);
+    vscp_can_filter_add(&plan, interests[0][0], interests[0][1], (uint8_t)interests[0][2], (uint8_t)interests[0][3]);
+    vscp_can_filter_add(&plan, interests[1][0], interests[1][1], (uint8_t)interests[1][2], (uint8_t)interests[1][3]);
+
+    CU_ASSERT_EQUAL(plan.num, 1);
+    vscp_test_checkCanFilterPlan(&plan, interests, 2, &missing, &extra);
+    CU_ASSERT_EQUAL(missing, 0);
+
+    /* Everything */
+    vscp_can_filter_init(&plan, filters, VSCP_TEST_CAN_FILTER_NUM_MAX);
+    vscp_can_filter_add(&plan, interests[1][0], interests[1][1], (uint8_t)interests[1][2], (uint8_t)interests[1][3]);
+    vscp_can_filter_add(&plan, 0, 0, 0, 0);
+
+    CU_ASSERT_EQUAL(plan.num, 1);
+    CU_ASSERT_EQUAL(filters[0].mask, 0);
+
+    /* Random interests, like decision matrix rows */
+    srand(42);
+
+    for(round = 0; round < 40; ++round)
+    {
+        uint8_t max = (uint8_t)(1 + (rand() % VSCP_TEST_CAN_FILTER_NUM_MAX));
+        uint8_t num = (uint8_t)(2 + (rand() % (VSCP_TEST_CAN_INTEREST_NUM_MAX - 1)));
+        uint8_t index   = 0;
+
+        vscp_can_filter_init(&plan, filters, max);
+
+        for(index = 0; index < num; ++index)
+        {
+            if (0 == index)
+            {
+                interests[index][0] = VSCP_INTEREST_CLASS_MASK;
+                interests[index][2] = 0;
+            }
+            else
+            {
+                static const uint16_t   classMasks[] = { 0x01ff, 0x01ff, 0x01f0, 0x0000 };
+                static const uint16_t   typeMasks[]  = { 0x00ff, 0x00ff, 0x00fc, 0x0000 };
+
+                interests[index][0] = classMasks[rand() % VSCP_TEST_ARRAY_NUM(classMasks)];
+                interests[index][2] = typeMasks[rand() % VSCP_TEST_ARRAY_NUM(typeMasks)];
+            }
+
+            interests[index][1] = (uint16_t)(rand() & interests[index][0]);
+            interests[index][3] = (uint16_t)(rand() & interests[index][2]);
+
+            vscp_can_filter_add(&plan, interests[index][0], interests[index][1], (uint8_t)interests[index][2], (uint8_t)interests[index][3]);
+        }
+
+        CU_ASSERT(max >= plan.num);
+        CU_ASSERT(0 < plan.num);
+
+        vscp_test_checkCanFilterPlan(&plan, interests, num, &missing, &extra);
+        CU_ASSERT_EQUAL(missing, 0);
+
+        if (max >= num)
+        {
+            CU_ASSERT_EQUAL(extra, 0);
+        }
+    }
+
+    return;
+}
+
+/**
+ * Precondition:
+ *  - Decision matrix next generation is interested in class information, type button.
+ *
+ * Action:
+ *  - Check the outdated event interest.
+ *  - Update the outdated event interest.
+ *
+ * Expectation:
+ *  - The check builds the event interest, but doesn't set the CAN acceptance filters.
+ *  - The CAN acceptance filters are set via the transport layer adapter.
+ *  - They accept the protocol class and the decision matrix interest, nothing else.
+ */
+extern void vscp_test_canFilter02(void)
 {
+    vscp_can_filter_Plan    plan;
+    vscp_Message            msg;
+
     vscp_test_initTestCase();
 
-    vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_INFORMATION;
-    vscp_test_rxMessage.vscpType    = VSCP_TYPE_INFORMATION_ALIVE;
-    vscp_test_rxMessage.priority    = VSCP_PRIORITY_3_NORMAL;
-    vscp_test_rxMessage.oAddr       = VSCP_TEST_NICKNAME_REMOTE;
-    vscp_test_rxMessage.hardCoded   = FALSE;
-    vscp_test_rxMessage.dataNum     = 0;
+    memset(&msg, 0, sizeof(msg));
+    vscp_test_canFilterNum = 0;
 
-    vscp_test_waitForTxMessage(1, 1);
+    /* The lazy build in the receive path doesn't set the filters. */
+    vscp_interest_invalidate();
+    (void)vscp_interest_isInterested(VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_BUTTON);
+    CU_ASSERT_EQUAL(vscp_test_canFilterNum, 0);
 
-    /* Node shall not send a response */
-    CU_ASSERT_EQUAL(vscp_test_txMessageCnt, 0);
+    vscp_interest_update();
 
-    /* Node shall provide event to the application */
-    CU_ASSERT_EQUAL(vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_PORTABLE_PROVIDE_EVENT], 1);
+    CU_ASSERT(0 < vscp_test_canFilterNum);
+    CU_ASSERT(VSCP_CONFIG_CAN_FILTER_NUM >= vscp_test_canFilterNum);
+
+    plan.filters    = vscp_test_canFilter;
+    plan.max        = VSCP_CONFIG_CAN_FILTER_NUM;
+    plan.num        = vscp_test_canFilterNum;
+
+    msg.vscpClass   = VSCP_CLASS_L1_PROTOCOL;
+    msg.vscpType    = VSCP_TYPE_PROTOCOL_GET_EVENT_INTEREST;
+    CU_ASSERT_EQUAL(vscp_can_filter_isAccepted(&plan, vscp_can_codec_encodeId(&msg)), TRUE);
+
+    msg.vscpClass   = VSCP_CLASS_L1_INFORMATION;
+    msg.vscpType    = VSCP_TYPE_INFORMATION_BUTTON;
+    CU_ASSERT_EQUAL(vscp_can_filter_isAccepted(&plan, vscp_can_codec_encodeId(&msg)), TRUE);
+
+    msg.vscpType    = VSCP_TYPE_INFORMATION_ON;
+    CU_ASSERT_EQUAL(vscp_can_filter_isAccepted(&plan, vscp_can_codec_encodeId(&msg)), FALSE);
+
+    /* Nothing outdated, nothing to set. */
+    vscp_test_canFilterNum = 0;
+    vscp_interest_update();
+    CU_ASSERT_EQUAL(vscp_test_canFilterNum, 0);
 
     return;
 }
@@ -3409,6 +5043,23 @@ extern void vscp_test_psAccessWrite8(uint16_t addr, uint8_t value)
     return;
 }
 
+extern void vscp_test_tpAdatperSetFilters(vscp_can_filter_Filter const * const filters, uint8_t num)
+{
+    uint8_t index   = 0;
+
+    CU_ASSERT_PTR_NOT_EQUAL_FATAL(filters, NULL);
+    CU_ASSERT_FATAL(VSCP_CONFIG_CAN_FILTER_NUM >= num);
+
+    for(index = 0; index < num; ++index)
+    {
+        vscp_test_canFilter[index] = filters[index];
+    }
+
+    vscp_test_canFilterNum = num;
+
+    return;
+}
+
 extern void vscp_test_appRegInit(void)
 {
     ++vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_APP_REG_INIT];
@@ -3429,6 +5080,13 @@ extern BOOL vscp_test_tpAdatperReadMessage(vscp_RxMessage * const msg)
 
     ++vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_TP_ADAPTER_READ_MESSAGE];
 
+    /* Already read? */
+    if ((FALSE != vscp_test_rxIdle) &&
+        (0 == vscp_test_rxMessage.vscpType))
+    {
+        return FALSE;
+    }
+
     *msg = vscp_test_rxMessage;
 
     /* Make message invalid */
@@ -3442,16 +5100,42 @@ extern BOOL vscp_test_tpAdatperWriteMessage(vscp_TxMessage const * const msg)
     BOOL    status  = TRUE;
 
     CU_ASSERT_PTR_NOT_EQUAL_FATAL(msg, NULL);
-    CU_ASSERT_FATAL(VSCP_TEST_ARRAY_NUM(vscp_test_txMessage) > vscp_test_txMessageCnt);
 
     ++vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_TP_ADAPTER_WRITE_MESSAGE];
 
+    if (FALSE != vscp_test_txBusy)
+    {
+        return FALSE;
+    }
+
+    CU_ASSERT_FATAL(VSCP_TEST_ARRAY_NUM(vscp_test_txMessage) > vscp_test_txMessageCnt);
+
     vscp_test_txMessage[vscp_test_txMessageCnt] = *msg;
     ++vscp_test_txMessageCnt;
 
     return status;
 }
 
+extern uint8_t vscp_test_tpAdatperWriteMessages(vscp_TxMessage const * const msgs, uint8_t num)
+{
+    uint8_t accepted    = 0;
+
+    CU_ASSERT_PTR_NOT_EQUAL_FATAL(msgs, NULL);
+
+    ++vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_TP_ADAPTER_WRITE_MESSAGES];
+
+    while((num > accepted) &&
+          (vscp_test_txAcceptNum > accepted) &&
+          (VSCP_TEST_ARRAY_NUM(vscp_test_txMessage) > vscp_test_txMessageCnt))
+    {
+        vscp_test_txMessage[vscp_test_txMessageCnt] = msgs[accepted];
+        ++vscp_test_txMessageCnt;
+        ++accepted;
+    }
+
+    return accepted;
+}
+
 extern void vscp_test_portableInit(void)
 {
     ++vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_PORTABLE_INIT];
@@ -3682,6 +5366,20 @@ extern void vscp_test_portableUpdateTimeSinceEpoch(uint32_t timestamp)
     return;
 }
 
+extern void vscp_test_portableAddEventInterest(void)
+{
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST )
+
+    if (FALSE != vscp_test_appInterest)
+    {
+        vscp_interest_add(VSCP_INTEREST_CLASS_MASK, VSCP_CLASS_L1_CONTROL, 0xf0, 0x00);
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST ) */
+
+    return;
+}
+
 extern void vscp_test_portableSetLampState(VSCP_LAMP_STATE state)
 {
     ++vscp_test_callCounter[VSCP_TEST_CALL_COUNTER_PORTABLE_SET_LAMP_STATE];
@@ -3708,6 +5406,34 @@ extern void vscp_test_actionExecute(uint8_t action, uint8_t par, vscp_RxMessage
     return;
 }
 
+extern void vscp_test_canHalWriteFrame(vscp_can_ring_Frame const * const frame)
+{
+    CU_ASSERT_PTR_NOT_EQUAL_FATAL(frame, NULL);
+    CU_ASSERT_FATAL(VSCP_TEST_ARRAY_NUM(vscp_test_canTxFrame) > vscp_test_canTxFrameCnt);
+
+    vscp_test_canTxFrame[vscp_test_canTxFrameCnt] = *frame;
+    ++vscp_test_canTxFrameCnt;
+
+    return;
+}
+
+extern void vscp_test_canHalDisableIrq(void)
+{
+    /* Not nested */
+    CU_ASSERT_EQUAL(vscp_test_canIrqDisabled, FALSE);
+    vscp_test_canIrqDisabled = TRUE;
+
+    return;
+}
+
+extern void vscp_test_canHalEnableIrq(void)
+{
+    CU_ASSERT_EQUAL(vscp_test_canIrqDisabled, TRUE);
+    vscp_test_canIrqDisabled = FALSE;
+
+    return;
+}
+
 /*******************************************************************************
     LOCAL FUNCTIONS
 *******************************************************************************/
@@ -3742,6 +5468,70 @@ static void vscp_test_waitForTxMessage(uint8_t min, uint16_t max)
     return;
 }
 
+static void vscp_test_processCycles(uint16_t cycles)
+{
+    while(0 < cycles)
+    {
+        vscp_test_processTimers();
+        vscp_core_process();
+
+        --cycles;
+    }
+
+    return;
+}
+
+/**
+ * This function processes the core until a node heartbeat is sent.
+ *
+ * @param[in]   max         Max. number of process cycles
+ * @param[in]   loadPeriod  Another node sends a event every loadPeriod process cycles (0: idle bus)
+ * @return Number of process cycles
+ */
+static uint32_t vscp_test_waitForHeartbeat(uint32_t max, uint16_t loadPeriod)
+{
+    uint32_t    cycles  = 0;
+    BOOL        isSent  = FALSE;
+
+    while((FALSE == isSent) && (max > cycles))
+    {
+        uint8_t index   = 0;
+
+        if ((0 < loadPeriod) &&
+            (0 == (cycles % loadPeriod)))
+        {
+            vscp_test_rxMessage.vscpClass   = VSCP_CLASS_L1_INFORMATION;
+            vscp_test_rxMessage.vscpType    = VSCP_TYPE_INFORMATION_NODE_HEARTBEAT;
+            vscp_test_rxMessage.priority    = VSCP_PRIORITY_7_LOW;
+            vscp_test_rxMessage.oAddr       = VSCP_TEST_NICKNAME + 1;
+            vscp_test_rxMessage.hardCoded   = FALSE;
+            vscp_test_rxMessage.dataNum     = 3;
+            vscp_test_rxMessage.data[0]     = 0;
+            vscp_test_rxMessage.data[1]     = 0;
+            vscp_test_rxMessage.data[2]     = 0;
+        }
+
+        vscp_test_txMessageCnt = 0;
+
+        vscp_test_processTimers();
+        vscp_core_process();
+        ++cycles;
+
+        for(index = 0; index < vscp_test_txMessageCnt; ++index)
+        {
+            if ((VSCP_CLASS_L1_INFORMATION == vscp_test_txMessage[index].vscpClass) &&
+                (VSCP_TYPE_INFORMATION_NODE_HEARTBEAT == vscp_test_txMessage[index].vscpType))
+            {
+                isSent = TRUE;
+            }
+        }
+    }
+
+    vscp_test_txMessageCnt = 0;
+
+    return cycles;
+}
+
 static void vscp_test_processTimers(void)
 {
     uint8_t index   = 0;
@@ -3843,3 +5633,74 @@ static uint8_t  vscp_test_getZero(uint8_t value)
     return 0;
 }
 
+static BOOL     vscp_test_publisherSend(uint8_t index, uint8_t unit, int32_t data, int8_t exp)
+{
+    if (FALSE != vscp_test_publisherTxFull)
+    {
+        return FALSE;
+    }
+
+    ++vscp_test_publisherSendCnt;
+    vscp_test_publisherData = data;
+    vscp_test_publisherExp  = exp;
+
+    return TRUE;
+}
+
+/**
+ * This function checks a CAN acceptance filter plan for every class/type
+ * combination against the interests, which were added to it.
+ *
+ * @param[in]   plan        Plan
+ * @param[in]   interests   Interests: class mask, class filter, type mask, type filter
+ * @param[in]   num         Number of interests
+ * @param[out]  missing     Number of interesting combinations, which are not accepted
+ * @param[out]  extra       Number of not interesting combinations, which are accepted
+ */
+static void vscp_test_checkCanFilterPlan(vscp_can_filter_Plan const * const plan, uint16_t const interests[][4], uint8_t num, uint32_t * const missing, uint32_t * const extra)
+{
+    vscp_Message    msg;
+    uint16_t        vscpClass   = 0;
+    uint16_t        vscpType    = 0;
+
+    memset(&msg, 0, sizeof(msg));
+
+    *missing    = 0;
+    *extra      = 0;
+
+    for(vscpClass = 0; vscpClass < VSCP_INTEREST_CLASS_NUM; ++vscpClass)
+    {
+        for(vscpType = 0; vscpType < VSCP_INTEREST_TYPE_NUM; ++vscpType)
+        {
+            BOOL    isInterested    = FALSE;
+            uint8_t index           = 0;
+
+            for(index = 0; (index < num) && (FALSE == isInterested); ++index)
+            {
+                if ((interests[index][1] == (vscpClass & interests[index][0])) &&
+                    (interests[index][3] == (vscpType & interests[index][2])))
+                {
+                    isInterested = TRUE;
+                }
+            }
+
+            msg.vscpClass   = vscpClass;
+            msg.vscpType    = (uint8_t)vscpType;
+            msg.oAddr       = (uint8_t)(vscpClass + vscpType);
+
+            if (vscp_can_filter_isAccepted(plan, vscp_can_codec_encodeId(&msg)) != isInterested)
+            {
+                if (FALSE == isInterested)
+                {
+                    ++(*extra);
+                }
+                else
+                {
+                    ++(*missing);
+                }
+            }
+        }
+    }
+
+    return;
+}
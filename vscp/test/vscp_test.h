@@ -165,7 +165,9 @@ extern void vscp_test_sendProbeAckInActiveState(void);
  *  - No response (no segment master).
  *
  * Expectation:
- *  - After a specific time, the node starts probing id for id.
+ *  - After a specific time, the node starts probing id for id, beginning
+ *    with a GUID dependent id.
+ *  - Every id is probed only once.
  *  - But because every probe gets an answer, the node surrenders at the end.
  */
 extern void vscp_test_noSegmentMaster(void);
@@ -182,6 +184,19 @@ extern void vscp_test_noSegmentMaster(void);
  */
 extern void vscp_test_badSegmentMaster(void);
 
+/**
+ * Precondition:
+ *  - Nickname discovery finished and nickname is set.
+ *
+ * Action:
+ *  - Send a probe acknowledge with the same nickname.
+ *  - Every nickname id, except one, is used by other nodes, which send events.
+ *
+ * Expectation:
+ *  - Node probes only the unused nickname id and takes it.
+ */
+extern void vscp_test_skipOccupiedNickname(void);
+
 /**
  * Precondition:
  *  - VSCP is not called yet.
@@ -717,6 +732,39 @@ extern void vscp_test_dmNG01(void);
  */
 extern void vscp_test_dmNG02(void);
 
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *  - Decision matrix next generation configured
+ *
+ * Action:
+ *  - Check event interest before and after a process cycle without received event.
+ *  - Get event interest.
+ *
+ * Expectation:
+ *  - Every event is of interest, until the event interest is built.
+ *  - Only class information, type button is of interest.
+ *  - Response contains one entry with class information, type button.
+ */
+extern void vscp_test_dmNG03(void);
+
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *  - Decision matrix next generation configured
+ *  - Application is interested in class control, types 0-15.
+ *
+ * Action:
+ *  - Get event interest, while the transport layer is busy for one cycle.
+ *
+ * Expectation:
+ *  - Up to VSCP_CONFIG_EVENT_INTEREST_FRAMES responses per process cycle.
+ *  - No response is lost, the index has no gaps.
+ *  - Every class/type of interest is in the responses.
+ *  - The last response has less than two entries.
+ */
+extern void vscp_test_dmNG04(void);
+
 /**
  * Precondition:
  *  - VSCP is active.
@@ -730,6 +778,19 @@ extern void vscp_test_dmNG02(void);
  */
 extern void vscp_test_active31(void);
 
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *
+ * Action:
+ *  - Extended page read of 20 registers.
+ *
+ * Expectation:
+ *  - 4 responses in the first process cycle.
+ *  - Last response in the second process cycle.
+ */
+extern void vscp_test_active31_1(void);
+
 /**
  * Precondition:
  *  - VSCP is active.
@@ -756,6 +817,51 @@ extern void vscp_test_active32(void);
  */
 extern void vscp_test_active33(void);
 
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *  - Adaptive node heartbeat enabled.
+ *
+ * Action:
+ *  - Wait for several node heartbeats, while the bus is idle.
+ *
+ * Expectation:
+ *  - Every heartbeat period is shortened by 0 to VSCP_CONFIG_HEARTBEAT_NODE_JITTER.
+ *  - The heartbeat periods differ.
+ */
+extern void vscp_test_heartbeat01(void);
+
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *  - Adaptive node heartbeat enabled.
+ *
+ * Action:
+ *  - Wait for the node heartbeat, while the bus is busy.
+ *  - Wait for the node heartbeat, while the bus load is below the limit.
+ *
+ * Expectation:
+ *  - The heartbeat is postponed by VSCP_CONFIG_HEARTBEAT_NODE_BACKOFF_MAX
+ *    measurement windows on a busy bus, but not longer.
+ *  - The heartbeat is not postponed below the bus load limit.
+ */
+extern void vscp_test_heartbeat02(void);
+
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *
+ * Action:
+ *  - Receive and send more than 255 messages via the transport layer.
+ *  - Send a message, while the transport layer adapter is busy.
+ *
+ * Expectation:
+ *  - The receive and transmit counters saturate at 255.
+ *  - The counters are cleared by reading them.
+ *  - A message, which isn't accepted, isn't counted.
+ */
+extern void vscp_test_heartbeat03(void);
+
 /**
  * Precondition:
  *  - VSCP is active.
@@ -781,6 +887,208 @@ extern void vscp_test_active34(void);
  */
 extern void vscp_test_active35(void);
 
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *
+ * Action:
+ *  - Send a measurement, a measurement zone and a information event by the
+ *    generic event encoder.
+ *
+ * Expectation:
+ *  - Events are sent with the class, type and payload layout of their descriptor.
+ */
+extern void vscp_test_active36(void);
+
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *
+ * Action:
+ *  - Send several events at once.
+ *  - Transport layer adapter accepts only a part of them.
+ *  - Send several events, with a invalid one in between.
+ *
+ * Expectation:
+ *  - All events are passed to the transport layer adapter in one call.
+ *  - The number of accepted events is reported and one transmit error counted.
+ *  - Only the events in front of the invalid one are sent.
+ */
+extern void vscp_test_active37(void);
+
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *
+ * Action:
+ *  - Register a sensor at the measurement publisher.
+ *  - Update its value inside and outside the deadband.
+ *
+ * Expectation:
+ *  - The first value is sent immediately and normalized.
+ *  - Changes within the deadband are suppressed.
+ *  - Changes beyond the deadband are sent after the minimum interval.
+ *  - The value is sent again after the maximum interval.
+ *  - A failed send is repeated.
+ *  - A relative deadband above 100% is rejected.
+ */
+extern void vscp_test_publisher01(void);
+
+/**
+ * Precondition:
+ *  - None
+ *
+ * Action:
+ *  - Encode values in the shortest normalized integer format.
+ *  - Encode floating point values in the normalized integer format.
+ *
+ * Expectation:
+ *  - Trailing decimal zeros are moved to the exponent.
+ *  - Floating point values are rounded to the given decimals.
+ */
+extern void vscp_test_dataCoding01(void);
+
+/**
+ * Precondition:
+ *  - None
+ *
+ * Action:
+ *  - Encode and decode floating point values.
+ *  - Encode and decode ASCII numerical strings.
+ *
+ * Expectation:
+ *  - Decoded values are equal to the encoded ones.
+ *  - Invalid strings are rejected.
+ */
+extern void vscp_test_dataCoding02(void);
+
+/**
+ * Precondition:
+ *  - None
+ *
+ * Action:
+ *  - Encode and decode the CAN identifier of all priorities, classes and types.
+ *
+ * Expectation:
+ *  - The identifier has the VSCP level 1 layout.
+ *  - Decoding results in the original message.
+ */
+extern void vscp_test_canCodec01(void);
+
+/**
+ * Precondition:
+ *  - None
+ *
+ * Action:
+ *  - Pack and unpack 0 - 9 data bytes.
+ *
+ * Expectation:
+ *  - The data words are big endian.
+ *  - Bytes beyond the number of data bytes are zero.
+ *  - The number of data bytes is limited to 8.
+ */
+extern void vscp_test_canCodec02(void);
+
+/**
+ * Precondition:
+ *  - None
+ *
+ * Action:
+ *  - Initialize rings with invalid number of elements.
+ *  - Write and read frames, many times around the ring.
+ *
+ * Expectation:
+ *  - Only a power of two up to 128 elements is accepted.
+ *  - A full ring rejects frames.
+ *  - Frames are read in the order they were written.
+ */
+extern void vscp_test_canRing01(void);
+
+/**
+ * Precondition:
+ *  - CAN transport layer adapter is initialized.
+ *
+ * Action:
+ *  - The receive interrupt gets more frames than the receive ring can store.
+ *  - Read all messages.
+ *  - Receive interrupt and main loop alternate for a long time.
+ *
+ * Expectation:
+ *  - The dropped frames are counted.
+ *  - The stored frames are read as messages in order.
+ *  - No frame is lost, as long as the main loop keeps up.
+ */
+extern void vscp_test_canAdapter01(void);
+
+/**
+ * Precondition:
+ *  - CAN transport layer adapter is initialized.
+ *
+ * Action:
+ *  - Write messages, more than the transmit ring can store.
+ *  - Signal transmit complete interrupts.
+ *  - Write several messages at once.
+ *
+ * Expectation:
+ *  - The first frame is sent immediately, the others are queued.
+ *  - A full transmit ring rejects messages, without blocking.
+ *  - Every transmit complete interrupt sends the next queued frame.
+ *  - The CAN interrupt is enabled again after every call.
+ */
+extern void vscp_test_canAdapter02(void);
+
+/**
+ * Precondition:
+ *  - None
+ *
+ * Action:
+ *  - Plan filters without storage.
+ *  - Plan the protocol class and two neighboring types of one class.
+ *  - Plan an interest in everything.
+ *  - Plan random interests with 1 - 8 filters.
+ *
+ * Expectation:
+ *  - Without storage nothing is accepted.
+ *  - Neighboring types and duplicates are merged without loss.
+ *  - Priority, hard coded and originating address bits are not checked.
+ *  - Every interest is accepted and the number of filters is not exceeded.
+ *  - As long as the filters are enough, nothing else is accepted.
+ */
+extern void vscp_test_canFilter01(void);
+
+/**
+ * Precondition:
+ *  - Decision matrix next generation is interested in class information, type button.
+ *
+ * Action:
+ *  - Check the outdated event interest.
+ *  - Update the outdated event interest.
+ *
+ * Expectation:
+ *  - The check builds the event interest, but doesn't set the CAN acceptance filters.
+ *  - The CAN acceptance filters are set via the transport layer adapter.
+ *  - They accept the protocol class and the decision matrix interest, nothing else.
+ */
+extern void vscp_test_canFilter02(void);
+
+/**
+ * Precondition:
+ *  - VSCP is active.
+ *  - Logger is enabled with all log levels.
+ *
+ * Action:
+ *  - Log messages with the same id faster than the rate limit.
+ *  - Log messages with more ids than the queue can hold.
+ *
+ * Expectation:
+ *  - Log messages are sent by the core process with the lowest priority.
+ *  - A pending message with the same id is replaced by the latest one.
+ *  - Replaced and suppressed messages are reported in the next second.
+ *  - Messages which don't fit into the queue are dropped and counted.
+ *  - Stopping the logging clears the queue.
+ */
+extern void vscp_test_logger01(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,313 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2019, Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP CAN transport layer adapter
+@file   vscp_can_adapter.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see vscp_can_adapter.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "vscp_can_adapter.h"
+#include "vscp_can_codec.h"
+#include "vscp_can_hal.h"
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CAN_ADAPTER )
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+static BOOL vscp_can_adapter_putTxMessage(vscp_TxMessage const * const msg);
+static void vscp_can_adapter_startTx(void);
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/** Receive ring storage */
+static vscp_can_ring_Frame  vscp_can_adapter_rxStorage[VSCP_CONFIG_CAN_ADAPTER_RX_NUM];
+
+/** Transmit ring storage */
+static vscp_can_ring_Frame  vscp_can_adapter_txStorage[VSCP_CONFIG_CAN_ADAPTER_TX_NUM];
+
+/** Receive ring, producer is the receive interrupt. */
+static vscp_can_ring_Ring   vscp_can_adapter_rxRing;
+
+/** Transmit ring, consumer is the transmit complete interrupt. */
+static vscp_can_ring_Ring   vscp_can_adapter_txRing;
+
+/** A frame is in transmission or not. */
+static volatile BOOL        vscp_can_adapter_txBusy         = FALSE;
+
+/** Number of dropped received frames */
+static volatile uint16_t    vscp_can_adapter_rxOverflows    = 0;
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function initializes the CAN transport layer adapter. Call it before
+ * the CAN interrupt is enabled.
+ */
+extern void vscp_can_adapter_init(void)
+{
+    (void)vscp_can_ring_init(&vscp_can_adapter_rxRing, vscp_can_adapter_rxStorage, VSCP_CONFIG_CAN_ADAPTER_RX_NUM);
+    (void)vscp_can_ring_init(&vscp_can_adapter_txRing, vscp_can_adapter_txStorage, VSCP_CONFIG_CAN_ADAPTER_TX_NUM);
+
+    vscp_can_adapter_txBusy         = FALSE;
+    vscp_can_adapter_rxOverflows    = 0;
+
+    return;
+}
+
+/**
+ * This function reads a message from the receive ring.
+ *
+ * @param[out]  msg Message storage
+ * @return  Message received or not
+ * @retval  FALSE   No message received
+ * @retval  TRUE    Message received
+ */
+extern BOOL vscp_can_adapter_readMessage(vscp_RxMessage * const msg)
+{
+    BOOL                status  = FALSE;
+    vscp_can_ring_Frame frame;
+
+    if (NULL != msg)
+    {
+        if (FALSE != vscp_can_ring_get(&vscp_can_adapter_rxRing, &frame))
+        {
+            vscp_can_codec_decodeId(frame.id, msg);
+            vscp_can_codec_unpackData(frame.dataWord0, frame.dataWord1, frame.length, msg);
+
+            status = TRUE;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * This function writes a message to the transmit ring and starts the
+ * transmission, if the CAN controller is idle.
+ *
+ * @param[in]   msg Message storage
+ * @return  Message sent or not
+ * @retval  FALSE   Transmit ring is full
+ * @retval  TRUE    Message will be sent
+ */
+extern BOOL vscp_can_adapter_writeMessage(vscp_TxMessage const * const msg)
+{
+    BOOL    status  = vscp_can_adapter_putTxMessage(msg);
+
+    if (FALSE != status)
+    {
+        vscp_can_adapter_startTx();
+    }
+
+    return status;
+}
+
+/**
+ * This function writes several messages to the transmit ring and starts the
+ * transmission, if the CAN controller is idle. The messages are written in
+ * order, until the transmit ring is full.
+ *
+ * @param[in]   msgs    Message array
+ * @param[in]   num     Number of messages
+ * @return  Number of accepted messages
+ */
+extern uint8_t vscp_can_adapter_writeMessages(vscp_TxMessage const * const msgs, uint8_t num)
+{
+    uint8_t written = 0;
+
+    if (NULL != msgs)
+    {
+        while((num > written) &&
+              (FALSE != vscp_can_adapter_putTxMessage(&msgs[written])))
+        {
+            ++written;
+
+            /* Start the transmission with the first message, which frees its
+             * place in the transmit ring. The following ones are sent by the
+             * transmit complete interrupt.
+             */
+            if (1 == written)
+            {
+                vscp_can_adapter_startTx();
+            }
+        }
+    }
+
+    return written;
+}
+
+/**
+ * This function returns the number of received frames, which were dropped,
+ * because the receive ring was full. The counter saturates.
+ *
+ * @return Number of dropped frames
+ */
+extern uint16_t vscp_can_adapter_getRxOverflows(void)
+{
+    uint16_t    overflows   = 0;
+
+    /* Not atomic on 8-bit targets */
+    vscp_can_hal_disableIrq();
+    overflows = vscp_can_adapter_rxOverflows;
+    vscp_can_hal_enableIrq();
+
+    return overflows;
+}
+
+/**
+ * This function shall be called by the CAN receive interrupt for every
+ * received frame.
+ *
+ * @param[in]   frame   Received frame
+ */
+extern void vscp_can_adapter_onRxFrame(vscp_can_ring_Frame const * const frame)
+{
+    if (NULL != frame)
+    {
+        if ((FALSE == vscp_can_ring_put(&vscp_can_adapter_rxRing, frame)) &&
+            (UINT16_MAX > vscp_can_adapter_rxOverflows))
+        {
+            ++vscp_can_adapter_rxOverflows;
+        }
+    }
+
+    return;
+}
+
+/**
+ * This function shall be called by the CAN transmit complete interrupt. It
+ * starts the transmission of the next frame.
+ */
+extern void vscp_can_adapter_onTxComplete(void)
+{
+    vscp_can_ring_Frame frame;
+
+    if (FALSE != vscp_can_ring_get(&vscp_can_adapter_txRing, &frame))
+    {
+        vscp_can_hal_writeFrame(&frame);
+    }
+    else
+    {
+        vscp_can_adapter_txBusy = FALSE;
+    }
+
+    return;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function encodes a message and writes it to the transmit ring.
+ *
+ * @param[in]   msg Message storage
+ * @return  Status
+ * @retval  FALSE   Invalid message or transmit ring is full
+ * @retval  TRUE    Successful
+ */
+static BOOL vscp_can_adapter_putTxMessage(vscp_TxMessage const * const msg)
+{
+    BOOL    status  = FALSE;
+
+    if ((NULL != msg) &&                        /* Message shall exists */
+        (VSCP_L1_DATA_SIZE >= msg->dataNum))    /* Number of data bytes is limited */
+    {
+        vscp_can_ring_Frame frame;
+
+        frame.id        = vscp_can_codec_encodeId(msg);
+        frame.length    = msg->dataNum;
+        vscp_can_codec_packData(msg, &frame.dataWord0, &frame.dataWord1);
+
+        status = vscp_can_ring_put(&vscp_can_adapter_txRing, &frame);
+    }
+
+    return status;
+}
+
+/**
+ * This function starts the transmission of the next frame, if no frame is in
+ * transmission. Otherwise the transmit complete interrupt will do it.
+ */
+static void vscp_can_adapter_startTx(void)
+{
+    vscp_can_ring_Frame frame;
+
+    /* The transmit complete interrupt is the consumer of the transmit ring
+     * too, therefore the CAN interrupt is disabled here.
+     */
+    vscp_can_hal_disableIrq();
+
+    if ((FALSE == vscp_can_adapter_txBusy) &&
+        (FALSE != vscp_can_ring_get(&vscp_can_adapter_txRing, &frame)))
+    {
+        vscp_can_adapter_txBusy = TRUE;
+        vscp_can_hal_writeFrame(&frame);
+    }
+
+    vscp_can_hal_enableIrq();
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CAN_ADAPTER ) */
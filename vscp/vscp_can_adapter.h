@@ -0,0 +1,171 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2019, Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP CAN transport layer adapter
+@file   vscp_can_adapter.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module contains the platform independent part of a interrupt driven CAN
+transport layer adapter. The platform dependent part is behind the CAN
+hardware abstraction (vscp_can_hal.h).
+
+*******************************************************************************/
+/** @defgroup vscp_can_adapter VSCP CAN transport layer adapter
+ * Received frames are written by the CAN receive interrupt to the receive
+ * ring and read by vscp_can_adapter_readMessage() in the main loop. Messages
+ * to send are written to the transmit ring and the transmit complete
+ * interrupt starts the next transmission. Neither reading nor writing blocks.
+ *
+ * If the receive ring is full, the frame is dropped and counted, see
+ * vscp_can_adapter_getRxOverflows().
+ *
+ * Supported compile switches:
+ * - VSCP_CONFIG_ENABLE_CAN_ADAPTER
+ *
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __VSCP_CAN_ADAPTER_H__
+#define __VSCP_CAN_ADAPTER_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include "vscp_config.h"
+#include "vscp_types.h"
+#include "vscp_can_ring.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CAN_ADAPTER )
+
+/**
+ * This function initializes the CAN transport layer adapter. Call it before
+ * the CAN interrupt is enabled.
+ */
+extern void vscp_can_adapter_init(void);
+
+/**
+ * This function reads a message from the receive ring.
+ *
+ * @param[out]  msg Message storage
+ * @return  Message received or not
+ * @retval  FALSE   No message received
+ * @retval  TRUE    Message received
+ */
+extern BOOL vscp_can_adapter_readMessage(vscp_RxMessage * const msg);
+
+/**
+ * This function writes a message to the transmit ring and starts the
+ * transmission, if the CAN controller is idle.
+ *
+ * @param[in]   msg Message storage
+ * @return  Message sent or not
+ * @retval  FALSE   Transmit ring is full
+ * @retval  TRUE    Message will be sent
+ */
+extern BOOL vscp_can_adapter_writeMessage(vscp_TxMessage const * const msg);
+
+/**
+ * This function writes several messages to the transmit ring and starts the
+ * transmission, if the CAN controller is idle. The messages are written in
+ * order, until the transmit ring is full.
+ *
+ * @param[in]   msgs    Message array
+ * @param[in]   num     Number of messages
+ * @return  Number of accepted messages
+ */
+extern uint8_t vscp_can_adapter_writeMessages(vscp_TxMessage const * const msgs, uint8_t num);
+
+/**
+ * This function returns the number of received frames, which were dropped,
+ * because the receive ring was full. The counter saturates.
+ *
+ * @return Number of dropped frames
+ */
+extern uint16_t vscp_can_adapter_getRxOverflows(void);
+
+/**
+ * This function shall be called by the CAN receive interrupt for every
+ * received frame.
+ *
+ * @param[in]   frame   Received frame
+ */
+extern void vscp_can_adapter_onRxFrame(vscp_can_ring_Frame const * const frame);
+
+/**
+ * This function shall be called by the CAN transmit complete interrupt. It
+ * starts the transmission of the next frame.
+ */
+extern void vscp_can_adapter_onTxComplete(void);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CAN_ADAPTER ) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __VSCP_CAN_ADAPTER_H__ */
+
+/** @} */
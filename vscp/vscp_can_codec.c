@@ -0,0 +1,254 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2019, Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP CAN codec
+@file   vscp_can_codec.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see vscp_can_codec.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "vscp_can_codec.h"
+#include <string.h>
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Number of data bytes in one data word */
+#define VSCP_CAN_CODEC_WORD_SIZE    (4u)
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/** Converts a 32-bit word between the native and the big endian order. If the
+ * compiler provides it, a word is loaded and stored with a single access.
+ */
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && (__ORDER_LITTLE_ENDIAN__ == __BYTE_ORDER__)
+#define VSCP_CAN_CODEC_TO_BE32(__value) __builtin_bswap32(__value)
+#elif defined(__GNUC__) && defined(__BYTE_ORDER__) && (__ORDER_BIG_ENDIAN__ == __BYTE_ORDER__)
+#define VSCP_CAN_CODEC_TO_BE32(__value) (__value)
+#endif
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+static inline uint32_t vscp_can_codec_loadBe32(uint8_t const * const data);
+static inline void vscp_can_codec_storeBe32(uint32_t value, uint8_t * const data);
+static inline uint32_t vscp_can_codec_getMask(uint8_t num);
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function builds the 29-bit CAN identifier of a message.
+ *
+ * @param[in]   msg Message
+ * @return  29-bit CAN identifier
+ */
+extern uint32_t vscp_can_codec_encodeId(vscp_Message const * const msg)
+{
+    if (NULL == msg)
+    {
+        return 0;
+    }
+
+    return (((uint32_t)msg->priority & 0x07) << 26) |
+           (((uint32_t)msg->hardCoded & 0x01) << 25) |
+           (((uint32_t)msg->vscpClass & 0x01ff) << 16) |
+           ((uint32_t)msg->vscpType << 8) |
+           ((uint32_t)msg->oAddr);
+}
+
+/**
+ * This function takes the priority, hard coded flag, class, type and
+ * originating address of a message from a 29-bit CAN identifier.
+ *
+ * @param[in]   id  29-bit CAN identifier
+ * @param[out]  msg Message
+ */
+extern void vscp_can_codec_decodeId(uint32_t id, vscp_Message * const msg)
+{
+    if (NULL != msg)
+    {
+        msg->vscpClass  = (uint16_t)((id >> 16) & 0x01ff);
+        msg->vscpType   = (uint8_t)((id >> 8) & 0x00ff);
+        msg->oAddr      = (uint8_t)((id >> 0) & 0x00ff);
+        msg->hardCoded  = (BOOL)((id >> 25) & 0x0001);
+        msg->priority   = (VSCP_PRIORITY)((id >> 26) & 0x0007);
+    }
+
+    return;
+}
+
+/**
+ * This function packs the message data in two big endian words. Bytes beyond
+ * the number of data bytes are zero.
+ *
+ * @param[in]   msg     Message
+ * @param[out]  word0   Data byte 0 - 3
+ * @param[out]  word1   Data byte 4 - 7
+ */
+extern void vscp_can_codec_packData(vscp_Message const * const msg, uint32_t * const word0, uint32_t * const word1)
+{
+    if ((NULL != msg) &&
+        (NULL != word0) &&
+        (NULL != word1))
+    {
+        /* The selects below are usually compiled to conditional instructions. */
+        uint8_t num     = (VSCP_L1_DATA_SIZE < msg->dataNum) ? VSCP_L1_DATA_SIZE : msg->dataNum;
+        uint8_t num0    = (VSCP_CAN_CODEC_WORD_SIZE < num) ? VSCP_CAN_CODEC_WORD_SIZE : num;
+        uint8_t num1    = num - num0;
+
+        /* Always all data bytes are loaded, the unused ones are masked out. */
+        *word0 = vscp_can_codec_loadBe32(&msg->data[0]) & vscp_can_codec_getMask(num0);
+        *word1 = vscp_can_codec_loadBe32(&msg->data[VSCP_CAN_CODEC_WORD_SIZE]) & vscp_can_codec_getMask(num1);
+    }
+
+    return;
+}
+
+/**
+ * This function unpacks the message data from two big endian words.
+ *
+ * @param[in]   word0   Data byte 0 - 3
+ * @param[in]   word1   Data byte 4 - 7
+ * @param[in]   length  Number of data bytes, limited to VSCP_L1_DATA_SIZE
+ * @param[out]  msg     Message
+ */
+extern void vscp_can_codec_unpackData(uint32_t word0, uint32_t word1, uint8_t length, vscp_Message * const msg)
+{
+    if (NULL != msg)
+    {
+        /* Always all data bytes are stored, the message has space for them. */
+        vscp_can_codec_storeBe32(word0, &msg->data[0]);
+        vscp_can_codec_storeBe32(word1, &msg->data[VSCP_CAN_CODEC_WORD_SIZE]);
+
+        msg->dataNum = (VSCP_L1_DATA_SIZE < length) ? VSCP_L1_DATA_SIZE : length;
+    }
+
+    return;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function loads a 32-bit word in big endian order.
+ *
+ * @param[in]   data    Four data bytes
+ * @return  Word
+ */
+static inline uint32_t vscp_can_codec_loadBe32(uint8_t const * const data)
+{
+#if defined(VSCP_CAN_CODEC_TO_BE32)
+
+    uint32_t    value   = 0;
+
+    /* The data bytes may be unaligned, memcpy() is compiled to a single load. */
+    memcpy(&value, data, sizeof(value));
+
+    return VSCP_CAN_CODEC_TO_BE32(value);
+
+#else   /* defined(VSCP_CAN_CODEC_TO_BE32) */
+
+    return ((uint32_t)data[0] << 24) |
+           ((uint32_t)data[1] << 16) |
+           ((uint32_t)data[2] << 8) |
+           ((uint32_t)data[3] << 0);
+
+#endif  /* defined(VSCP_CAN_CODEC_TO_BE32) */
+}
+
+/**
+ * This function stores a 32-bit word in big endian order.
+ *
+ * @param[in]   value   Word
+ * @param[out]  data    Four data bytes
+ */
+static inline void vscp_can_codec_storeBe32(uint32_t value, uint8_t * const data)
+{
+#if defined(VSCP_CAN_CODEC_TO_BE32)
+
+    value = VSCP_CAN_CODEC_TO_BE32(value);
+
+    /* The data bytes may be unaligned, memcpy() is compiled to a single store. */
+    memcpy(data, &value, sizeof(value));
+
+#else   /* defined(VSCP_CAN_CODEC_TO_BE32) */
+
+    data[0] = (uint8_t)((value >> 24) & 0xff);
+    data[1] = (uint8_t)((value >> 16) & 0xff);
+    data[2] = (uint8_t)((value >> 8) & 0xff);
+    data[3] = (uint8_t)((value >> 0) & 0xff);
+
+#endif  /* defined(VSCP_CAN_CODEC_TO_BE32) */
+
+    return;
+}
+
+/**
+ * This function returns the mask of the first num bytes of a big endian word.
+ *
+ * @param[in]   num Number of bytes (0 - 4)
+ * @return  Mask
+ */
+static inline uint32_t vscp_can_codec_getMask(uint8_t num)
+{
+    /* Shifting a 32-bit value by 32 is undefined, therefore the shift is
+     * split in two halves.
+     */
+    return ~((UINT32_MAX >> (num * 4u)) >> (num * 4u));
+}
@@ -0,0 +1,146 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2019, Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP CAN codec
+@file   vscp_can_codec.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module maps a VSCP level 1 message to a CAN frame with 29-bit identifier
+and back. It is shared by all CAN transport layer adapters.
+
+Identifier:
+- Bit 28-26: Priority
+- Bit 25   : Hard coded node
+- Bit 24-16: VSCP class
+- Bit 15-8 : VSCP type
+- Bit 7-0  : Originating address (nickname)
+
+The payload is packed in two 32-bit words in big endian order, which is the
+data word layout of many CAN controllers, e.g. the FlexCAN. The first data
+byte is the MSB of the first word. Packing and unpacking doesn't loop over
+the data bytes, it takes the same time for 0 - 8 bytes.
+
+*******************************************************************************/
+/** @defgroup vscp_can_codec VSCP CAN codec
+ * Maps VSCP level 1 messages to CAN frames and back.
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __VSCP_CAN_CODEC_H__
+#define __VSCP_CAN_CODEC_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include "vscp_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Mask of a 29-bit CAN identifier */
+#define VSCP_CAN_CODEC_ID_MASK  ((uint32_t)0x1fffffff)
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function builds the 29-bit CAN identifier of a message.
+ *
+ * @param[in]   msg Message
+ * @return  29-bit CAN identifier
+ */
+extern uint32_t vscp_can_codec_encodeId(vscp_Message const * const msg);
+
+/**
+ * This function takes the priority, hard coded flag, class, type and
+ * originating address of a message from a 29-bit CAN identifier.
+ *
+ * @param[in]   id  29-bit CAN identifier
+ * @param[out]  msg Message
+ */
+extern void vscp_can_codec_decodeId(uint32_t id, vscp_Message * const msg);
+
+/**
+ * This function packs the message data in two big endian words. Bytes beyond
+ * the number of data bytes are zero.
+ *
+ * @param[in]   msg     Message
+ * @param[out]  word0   Data byte 0 - 3
+ * @param[out]  word1   Data byte 4 - 7
+ */
+extern void vscp_can_codec_packData(vscp_Message const * const msg, uint32_t * const word0, uint32_t * const word1);
+
+/**
+ * This function unpacks the message data from two big endian words.
+ *
+ * @param[in]   word0   Data byte 0 - 3
+ * @param[in]   word1   Data byte 4 - 7
+ * @param[in]   length  Number of data bytes, limited to VSCP_L1_DATA_SIZE
+ * @param[out]  msg     Message
+ */
+extern void vscp_can_codec_unpackData(uint32_t word0, uint32_t word1, uint8_t length, vscp_Message * const msg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __VSCP_CAN_CODEC_H__ */
+
+/** @} */
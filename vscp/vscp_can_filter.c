@@ -0,0 +1,439 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2019, Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP CAN acceptance filter planner
+@file   vscp_can_filter.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see vscp_can_filter.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "vscp_can_filter.h"
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Bit position of the VSCP class in the CAN identifier */
+#define VSCP_CAN_FILTER_CLASS_SHIFT     (16u)
+
+/** Bit position of the VSCP type in the CAN identifier */
+#define VSCP_CAN_FILTER_TYPE_SHIFT      (8u)
+
+/** Class and type bits of the CAN identifier, the only ones which are checked. */
+#define VSCP_CAN_FILTER_CHECK_MASK      ((uint32_t)0x01ffff00)
+
+/** Number of class and type bits */
+#define VSCP_CAN_FILTER_CHECK_BITS      (17u)
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+static BOOL vscp_can_filter_isCovered(vscp_can_filter_Filter const * const outer, vscp_can_filter_Filter const * const inner);
+static vscp_can_filter_Filter vscp_can_filter_merge(vscp_can_filter_Filter const * const first, vscp_can_filter_Filter const * const second);
+static uint32_t vscp_can_filter_getWidth(uint32_t mask);
+static uint32_t vscp_can_filter_getMergeCost(vscp_can_filter_Filter const * const first, vscp_can_filter_Filter const * const second);
+static void vscp_can_filter_remove(vscp_can_filter_Plan * const plan, uint8_t index);
+static void vscp_can_filter_removeCovered(vscp_can_filter_Plan * const plan, vscp_can_filter_Filter const * const filter, uint8_t skip);
+static void vscp_can_filter_mergeLossless(vscp_can_filter_Plan * const plan);
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function initializes an empty plan, which accepts nothing.
+ *
+ * @param[out]  plan    Plan
+ * @param[in]   filters Filter storage
+ * @param[in]   max     Number of available filters
+ */
+extern void vscp_can_filter_init(vscp_can_filter_Plan * const plan, vscp_can_filter_Filter * const filters, uint8_t max)
+{
+    if (NULL == plan)
+    {
+        return;
+    }
+
+    plan->filters   = filters;
+    plan->max       = (NULL == filters) ? 0 : max;
+    plan->num       = 0;
+
+    return;
+}
+
+/**
+ * This function adds the classes and types, which pass the given masks and
+ * filters, to the plan. A class or type passes, if its masked value is equal
+ * to the filter. A mask of 0 means, that every class or type passes. This
+ * corresponds to the decision matrix row class/type filter.
+ *
+ * @param[in]   plan        Plan
+ * @param[in]   classMask   Class mask
+ * @param[in]   classFilter Class filter
+ * @param[in]   typeMask    Type mask
+ * @param[in]   typeFilter  Type filter
+ */
+extern void vscp_can_filter_add(vscp_can_filter_Plan * const plan, uint16_t classMask, uint16_t classFilter, uint8_t typeMask, uint8_t typeFilter)
+{
+    uint32_t    id      = (((uint32_t)classFilter & 0x01ff) << VSCP_CAN_FILTER_CLASS_SHIFT) |
+                          ((uint32_t)typeFilter << VSCP_CAN_FILTER_TYPE_SHIFT);
+    uint32_t    mask    = (((uint32_t)classMask & 0x01ff) << VSCP_CAN_FILTER_CLASS_SHIFT) |
+                          ((uint32_t)typeMask << VSCP_CAN_FILTER_TYPE_SHIFT);
+
+    vscp_can_filter_addFilter(plan, id, mask);
+
+    return;
+}
+
+/**
+ * This function adds a CAN identifier/mask pair to the plan.
+ *
+ * @param[in]   plan    Plan
+ * @param[in]   id      29-bit CAN identifier
+ * @param[in]   mask    Mask, a set bit is checked
+ */
+extern void vscp_can_filter_addFilter(vscp_can_filter_Plan * const plan, uint32_t id, uint32_t mask)
+{
+    vscp_can_filter_Filter  pending;
+
+    if ((NULL == plan) ||
+        (0 == plan->max))
+    {
+        return;
+    }
+
+    pending.mask    = mask & VSCP_CAN_FILTER_CHECK_MASK;
+    pending.id      = id & pending.mask;
+
+    for(;;)
+    {
+        uint8_t     index       = 0;
+        uint8_t     first       = 0;
+        uint8_t     second      = 0;
+        uint32_t    bestCost    = 0;
+        BOOL        isFound     = FALSE;
+
+        /* Nothing to do, if the filter is already covered. */
+        for(index = 0; index < plan->num; ++index)
+        {
+            if (TRUE == vscp_can_filter_isCovered(&plan->filters[index], &pending))
+            {
+                return;
+            }
+        }
+
+        vscp_can_filter_removeCovered(plan, &pending, plan->max);
+
+        if (plan->max > plan->num)
+        {
+            plan->filters[plan->num] = pending;
+            ++plan->num;
+
+            vscp_can_filter_mergeLossless(plan);
+            break;
+        }
+
+        /* All filters are used, merge the pair with the least additional
+         * accepted identifiers. The index plan->num stands for the pending one.
+         */
+        for(index = 0; index < plan->num; ++index)
+        {
+            uint8_t index2  = 0;
+
+            for(index2 = index + 1; index2 <= plan->num; ++index2)
+            {
+                vscp_can_filter_Filter const *  filter2 = (plan->num == index2) ? &pending : &plan->filters[index2];
+                uint32_t                        cost    = vscp_can_filter_getMergeCost(&plan->filters[index], filter2);
+
+                if ((FALSE == isFound) ||
+                    (bestCost > cost))
+                {
+                    bestCost    = cost;
+                    first       = index;
+                    second      = index2;
+                    isFound     = TRUE;
+                }
+            }
+        }
+
+        if (plan->num == second)
+        {
+            /* The merged one is added in the next loop. */
+            pending = vscp_can_filter_merge(&plan->filters[first], &pending);
+            vscp_can_filter_remove(plan, first);
+        }
+        else
+        {
+            /* The pending one is added in the next loop into the free filter. */
+            plan->filters[first] = vscp_can_filter_merge(&plan->filters[first], &plan->filters[second]);
+            vscp_can_filter_remove(plan, second);
+            vscp_can_filter_removeCovered(plan, &plan->filters[first], first);
+        }
+    }
+
+    return;
+}
+
+/**
+ * This function checks whether a CAN identifier passes the plan.
+ *
+ * @param[in]   plan    Plan
+ * @param[in]   id      29-bit CAN identifier
+ * @return  Accepted or not
+ * @retval  FALSE   Not accepted
+ * @retval  TRUE    Accepted
+ */
+extern BOOL vscp_can_filter_isAccepted(vscp_can_filter_Plan const * const plan, uint32_t id)
+{
+    uint8_t index   = 0;
+
+    if (NULL == plan)
+    {
+        return FALSE;
+    }
+
+    for(index = 0; index < plan->num; ++index)
+    {
+        if (plan->filters[index].id == (id & plan->filters[index].mask))
+        {
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function checks whether every identifier, which passes the inner
+ * filter, passes the outer filter too.
+ *
+ * @param[in]   outer   Outer filter
+ * @param[in]   inner   Inner filter
+ * @return  Covered or not
+ * @retval  FALSE   Not covered
+ * @retval  TRUE    Covered
+ */
+static BOOL vscp_can_filter_isCovered(vscp_can_filter_Filter const * const outer, vscp_can_filter_Filter const * const inner)
+{
+    /* The outer filter must not check more bits than the inner one and the
+     * bits it checks must be equal.
+     */
+    if ((outer->mask == (outer->mask & inner->mask)) &&
+        (outer->id == (inner->id & outer->mask)))
+    {
+        return TRUE;
+    }
+
+    return FALSE;
+}
+
+/**
+ * This function merges two filters to the narrowest filter, which accepts
+ * both of them.
+ *
+ * @param[in]   first   First filter
+ * @param[in]   second  Second filter
+ * @return  Merged filter
+ */
+static vscp_can_filter_Filter vscp_can_filter_merge(vscp_can_filter_Filter const * const first, vscp_can_filter_Filter const * const second)
+{
+    vscp_can_filter_Filter  merged;
+
+    /* Only bits, which both check and which are equal, remain checked. */
+    merged.mask = first->mask & second->mask & ~(first->id ^ second->id);
+    merged.id   = first->id & merged.mask;
+
+    return merged;
+}
+
+/**
+ * This function returns the number of class/type combinations, which pass
+ * a filter with the given mask.
+ *
+ * @param[in]   mask    Mask
+ * @return  Number of class/type combinations
+ */
+static uint32_t vscp_can_filter_getWidth(uint32_t mask)
+{
+    uint8_t     bits    = 0;
+
+    mask &= VSCP_CAN_FILTER_CHECK_MASK;
+
+    while(0 != mask)
+    {
+        mask &= mask - 1;
+        ++bits;
+    }
+
+    return (uint32_t)1 << (VSCP_CAN_FILTER_CHECK_BITS - bits);
+}
+
+/**
+ * This function returns the number of class/type combinations, which the
+ * merged filter accepts additional to the two filters.
+ *
+ * @param[in]   first   First filter
+ * @param[in]   second  Second filter
+ * @return  Number of additional class/type combinations
+ */
+static uint32_t vscp_can_filter_getMergeCost(vscp_can_filter_Filter const * const first, vscp_can_filter_Filter const * const second)
+{
+    vscp_can_filter_Filter  merged  = vscp_can_filter_merge(first, second);
+    uint32_t                both    = vscp_can_filter_getWidth(first->mask) + vscp_can_filter_getWidth(second->mask);
+
+    /* Overlapping filters? */
+    if (0 == ((first->id ^ second->id) & first->mask & second->mask))
+    {
+        both -= vscp_can_filter_getWidth(first->mask | second->mask);
+    }
+
+    return vscp_can_filter_getWidth(merged.mask) - both;
+}
+
+/**
+ * This function removes a filter from the plan.
+ *
+ * @param[in]   plan    Plan
+ * @param[in]   index   Filter index
+ */
+static void vscp_can_filter_remove(vscp_can_filter_Plan * const plan, uint8_t index)
+{
+    --plan->num;
+
+    /* Keep it compact, the last filter moves into the gap. */
+    plan->filters[index] = plan->filters[plan->num];
+
+    return;
+}
+
+/**
+ * This function removes all filters from the plan, which the given filter
+ * covers.
+ *
+ * @param[in]   plan    Plan
+ * @param[in]   filter  Filter
+ * @param[in]   skip    Index of the filter itself, which is not removed
+ */
+static void vscp_can_filter_removeCovered(vscp_can_filter_Plan * const plan, vscp_can_filter_Filter const * const filter, uint8_t skip)
+{
+    vscp_can_filter_Filter  outer   = *filter;
+    uint8_t                 index   = plan->num;
+
+    /* Backwards, because the last filter moves into the gap. */
+    while(0 < index)
+    {
+        --index;
+
+        if ((skip != index) &&
+            (TRUE == vscp_can_filter_isCovered(&outer, &plan->filters[index])))
+        {
+            /* The filter itself moves into the gap, if it is the last one. */
+            if ((plan->num - 1) == skip)
+            {
+                skip = index;
+            }
+
+            vscp_can_filter_remove(plan, index);
+        }
+    }
+
+    return;
+}
+
+/**
+ * This function merges filters, as long as the merged filter accepts
+ * exactly the same, e.g. two filters for the types 4 and 5 result in a single
+ * filter which doesn't check the type bit 0.
+ *
+ * @param[in]   plan    Plan
+ */
+static void vscp_can_filter_mergeLossless(vscp_can_filter_Plan * const plan)
+{
+    uint8_t index   = 0;
+    uint8_t index2  = 0;
+
+    while(index < plan->num)
+    {
+        for(index2 = index + 1; index2 < plan->num; ++index2)
+        {
+            if (0 == vscp_can_filter_getMergeCost(&plan->filters[index], &plan->filters[index2]))
+            {
+                break;
+            }
+        }
+
+        if (plan->num > index2)
+        {
+            plan->filters[index] = vscp_can_filter_merge(&plan->filters[index], &plan->filters[index2]);
+            vscp_can_filter_remove(plan, index2);
+            vscp_can_filter_removeCovered(plan, &plan->filters[index], index);
+
+            /* The merged filter may merge again with a previous one. */
+            index = 0;
+        }
+        else
+        {
+            ++index;
+        }
+    }
+
+    return;
+}
@@ -0,0 +1,172 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2019, Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP CAN acceptance filter planner
+@file   vscp_can_filter.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module computes the CAN acceptance filters, which a CAN controller needs
+to receive only the frames the node is interested in. Every filter is an
+identifier/mask pair for the 29-bit CAN identifier: A frame is accepted, if
+its identifier masked with the mask is equal to the filter identifier.
+
+The class/type interests are added one by one. If there are more interests
+than hardware filters, the planner merges the two filters, whose merged
+filter accepts the least additional identifiers. Therefore the result always
+fits into the available hardware filters and is a superset of the interests.
+In the worst case it's a single filter, which accepts everything.
+
+The planner doesn't access any hardware or global data, it works only on the
+plan and its filter storage, which the caller provides.
+
+*******************************************************************************/
+/** @defgroup vscp_can_filter VSCP CAN acceptance filter planner
+ * Maps class/type interests to a limited number of CAN identifier/mask pairs.
+ *
+ * The priority, hard coded and originating address bits are never checked.
+ * The mapping to the controller:
+ * - AT90CAN: One message object per filter, see can_set_filter().
+ * - FlexCAN: One rx FIFO filter element with its individual mask per filter.
+ * - MCP2515: It has only two masks, which are shared by the filters. Plan with
+ *   two filters and program each of them in a mask and its filters.
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __VSCP_CAN_FILTER_H__
+#define __VSCP_CAN_FILTER_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include "vscp_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/** This type defines a CAN acceptance filter. */
+typedef struct
+{
+    uint32_t    id;     /**< 29-bit CAN identifier, only the masked bits are set */
+    uint32_t    mask;   /**< Mask, a set bit is checked */
+
+} vscp_can_filter_Filter;
+
+/** This type defines a filter plan. */
+typedef struct
+{
+    vscp_can_filter_Filter* filters;    /**< Filter storage */
+    uint8_t                 max;        /**< Number of available filters */
+    uint8_t                 num;        /**< Number of used filters */
+
+} vscp_can_filter_Plan;
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function initializes an empty plan, which accepts nothing.
+ *
+ * @param[out]  plan    Plan
+ * @param[in]   filters Filter storage
+ * @param[in]   max     Number of available filters
+ */
+extern void vscp_can_filter_init(vscp_can_filter_Plan * const plan, vscp_can_filter_Filter * const filters, uint8_t max);
+
+/**
+ * This function adds the classes and types, which pass the given masks and
+ * filters, to the plan. A class or type passes, if its masked value is equal
+ * to the filter. A mask of 0 means, that every class or type passes. This
+ * corresponds to the decision matrix row class/type filter.
+ *
+ * @param[in]   plan        Plan
+ * @param[in]   classMask   Class mask
+ * @param[in]   classFilter Class filter
+ * @param[in]   typeMask    Type mask
+ * @param[in]   typeFilter  Type filter
+ */
+extern void vscp_can_filter_add(vscp_can_filter_Plan * const plan, uint16_t classMask, uint16_t classFilter, uint8_t typeMask, uint8_t typeFilter);
+
+/**
+ * This function adds a CAN identifier/mask pair to the plan.
+ *
+ * @param[in]   plan    Plan
+ * @param[in]   id      29-bit CAN identifier
+ * @param[in]   mask    Mask, a set bit is checked
+ */
+extern void vscp_can_filter_addFilter(vscp_can_filter_Plan * const plan, uint32_t id, uint32_t mask);
+
+/**
+ * This function checks whether a CAN identifier passes the plan.
+ *
+ * @param[in]   plan    Plan
+ * @param[in]   id      29-bit CAN identifier
+ * @return  Accepted or not
+ * @retval  FALSE   Not accepted
+ * @retval  TRUE    Accepted
+ */
+extern BOOL vscp_can_filter_isAccepted(vscp_can_filter_Plan const * const plan, uint32_t id);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __VSCP_CAN_FILTER_H__ */
+
+/** @} */
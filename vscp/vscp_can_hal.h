@@ -0,0 +1,117 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2019, Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP CAN hardware abstraction
+@file   vscp_can_hal.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module contains the interface to the CAN controller, which is used by
+the CAN transport layer adapter (vscp_can_adapter.h). Implement it for your
+platform, e.g. in the transport layer adapter of your application.
+
+*******************************************************************************/
+/** @defgroup vscp_can_hal VSCP CAN hardware abstraction
+ * The CAN driver calls vscp_can_adapter_onRxFrame() for every received frame
+ * and vscp_can_adapter_onTxComplete() after a frame was sent, both in its
+ * interrupt service routine. The interface below is called by the CAN
+ * transport layer adapter.
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __VSCP_CAN_HAL_H__
+#define __VSCP_CAN_HAL_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include "vscp_can_ring.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function writes a frame to the transmit message buffer and starts the
+ * transmission. It is only called, if no other frame is pending, either from
+ * vscp_can_adapter_onTxComplete() or with disabled CAN interrupt.
+ *
+ * @param[in]   frame   Frame
+ */
+extern void vscp_can_hal_writeFrame(vscp_can_ring_Frame const * const frame);
+
+/**
+ * This function disables the CAN interrupt.
+ */
+extern void vscp_can_hal_disableIrq(void);
+
+/**
+ * This function enables the CAN interrupt.
+ */
+extern void vscp_can_hal_enableIrq(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __VSCP_CAN_HAL_H__ */
+
+/** @} */
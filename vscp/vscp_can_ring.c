@@ -0,0 +1,209 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2019, Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP CAN frame ring
+@file   vscp_can_ring.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see vscp_can_ring.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "vscp_can_ring.h"
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/** Compiler barrier, which avoids that the frame access is moved across the
+ * index update.
+ */
+#if defined(__GNUC__)
+#define VSCP_CAN_RING_BARRIER() __asm__ __volatile__("" ::: "memory")
+#else
+#define VSCP_CAN_RING_BARRIER()
+#endif
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function initializes a ring. It must not be called while producer or
+ * consumer access it.
+ *
+ * @param[in,out]   ring    Ring context
+ * @param[in]       storage Storage of all elements
+ * @param[in]       num     Number of elements, power of two up to VSCP_CAN_RING_NUM_MAX
+ * @return Status
+ * @retval FALSE    Invalid parameter
+ * @retval TRUE     Successful
+ */
+extern BOOL vscp_can_ring_init(vscp_can_ring_Ring * const ring, vscp_can_ring_Frame * const storage, uint8_t num)
+{
+    BOOL    status  = FALSE;
+
+    if ((NULL != ring) &&
+        (NULL != storage) &&
+        (0 < num) &&
+        (VSCP_CAN_RING_NUM_MAX >= num) &&
+        (0 == (num & (num - 1))))   /* Power of two */
+    {
+        ring->storage       = storage;
+        ring->mask          = num - 1;
+        ring->writeIndex    = 0;
+        ring->readIndex     = 0;
+
+        status = TRUE;
+    }
+
+    return status;
+}
+
+/**
+ * This function writes a frame to the ring. Only the producer shall call it.
+ *
+ * @param[in,out]   ring    Ring context
+ * @param[in]       frame   Frame
+ * @return Status
+ * @retval FALSE    Ring is full
+ * @retval TRUE     Frame written
+ */
+extern BOOL vscp_can_ring_put(vscp_can_ring_Ring * const ring, vscp_can_ring_Frame const * const frame)
+{
+    BOOL    status  = FALSE;
+
+    if ((NULL != ring) &&
+        (NULL != frame))
+    {
+        uint8_t writeIndex  = ring->writeIndex;
+
+        /* Ring not full? */
+        if (ring->mask >= (uint8_t)(writeIndex - ring->readIndex))
+        {
+            ring->storage[writeIndex & ring->mask] = *frame;
+
+            /* The frame must be complete, before the consumer sees it. */
+            VSCP_CAN_RING_BARRIER();
+            ring->writeIndex = writeIndex + 1;
+
+            status = TRUE;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * This function reads a frame from the ring. Only the consumer shall call it.
+ *
+ * @param[in,out]   ring    Ring context
+ * @param[out]      frame   Frame
+ * @return Status
+ * @retval FALSE    Ring is empty
+ * @retval TRUE     Frame read
+ */
+extern BOOL vscp_can_ring_get(vscp_can_ring_Ring * const ring, vscp_can_ring_Frame * const frame)
+{
+    BOOL    status  = FALSE;
+
+    if ((NULL != ring) &&
+        (NULL != frame))
+    {
+        uint8_t readIndex   = ring->readIndex;
+
+        /* Ring not empty? */
+        if (readIndex != ring->writeIndex)
+        {
+            VSCP_CAN_RING_BARRIER();
+            *frame = ring->storage[readIndex & ring->mask];
+
+            /* The frame must be copied, before the producer overwrites it. */
+            VSCP_CAN_RING_BARRIER();
+            ring->readIndex = readIndex + 1;
+
+            status = TRUE;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * This function returns the number of frames in the ring. Called by the
+ * producer, the real number may be lower. Called by the consumer, the real
+ * number may be higher.
+ *
+ * @param[in]   ring    Ring context
+ * @return Number of frames
+ */
+extern uint8_t vscp_can_ring_getNum(vscp_can_ring_Ring const * const ring)
+{
+    uint8_t num = 0;
+
+    if (NULL != ring)
+    {
+        num = (uint8_t)(ring->writeIndex - ring->readIndex);
+    }
+
+    return num;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
@@ -0,0 +1,175 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2019, Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP CAN frame ring
+@file   vscp_can_ring.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module provides a lock-free single producer, single consumer ring of CAN
+frames. It is used to pass CAN frames between a interrupt service routine and
+the main loop.
+
+*******************************************************************************/
+/** @defgroup vscp_can_ring VSCP CAN frame ring
+ * A ring has exactly one producer, which calls vscp_can_ring_put(), and one
+ * consumer, which calls vscp_can_ring_get(). Producer and consumer may run in
+ * different contexts, e.g. a interrupt service routine and the main loop,
+ * without any lock.
+ *
+ * The producer owns the write index and the consumer owns the read index.
+ * Both are free running 8-bit counters, which are read and written
+ * atomically on every supported target. The number of elements must be a
+ * power of two, up to 128.
+ *
+ * The ring is designed for single core targets, where a compiler barrier
+ * is sufficient to order the frame access and the index update.
+ *
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __VSCP_CAN_RING_H__
+#define __VSCP_CAN_RING_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include "vscp_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Max. number of elements in a ring */
+#define VSCP_CAN_RING_NUM_MAX   (128u)
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/** This type defines a CAN frame with 29-bit identifier. */
+typedef struct
+{
+    uint32_t    id;         /**< 29-bit CAN identifier */
+    uint32_t    dataWord0;  /**< Data byte 0 - 3, big endian */
+    uint32_t    dataWord1;  /**< Data byte 4 - 7, big endian */
+    uint8_t     length;     /**< Number of data bytes */
+
+} vscp_can_ring_Frame;
+
+/** This type defines a CAN frame ring context. */
+typedef struct
+{
+    vscp_can_ring_Frame *storage;       /**< Storage of elements */
+    uint8_t             mask;           /**< Number of elements - 1 */
+    volatile uint8_t    writeIndex;     /**< Write index, written only by the producer */
+    volatile uint8_t    readIndex;      /**< Read index, written only by the consumer */
+
+} vscp_can_ring_Ring;
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function initializes a ring. It must not be called while producer or
+ * consumer access it.
+ *
+ * @param[in,out]   ring    Ring context
+ * @param[in]       storage Storage of all elements
+ * @param[in]       num     Number of elements, power of two up to VSCP_CAN_RING_NUM_MAX
+ * @return Status
+ * @retval FALSE    Invalid parameter
+ * @retval TRUE     Successful
+ */
+extern BOOL vscp_can_ring_init(vscp_can_ring_Ring * const ring, vscp_can_ring_Frame * const storage, uint8_t num);
+
+/**
+ * This function writes a frame to the ring. Only the producer shall call it.
+ *
+ * @param[in,out]   ring    Ring context
+ * @param[in]       frame   Frame
+ * @return Status
+ * @retval FALSE    Ring is full
+ * @retval TRUE     Frame written
+ */
+extern BOOL vscp_can_ring_put(vscp_can_ring_Ring * const ring, vscp_can_ring_Frame const * const frame);
+
+/**
+ * This function reads a frame from the ring. Only the consumer shall call it.
+ *
+ * @param[in,out]   ring    Ring context
+ * @param[out]      frame   Frame
+ * @return Status
+ * @retval FALSE    Ring is empty
+ * @retval TRUE     Frame read
+ */
+extern BOOL vscp_can_ring_get(vscp_can_ring_Ring * const ring, vscp_can_ring_Frame * const frame);
+
+/**
+ * This function returns the number of frames in the ring. Called by the
+ * producer, the real number may be lower. Called by the consumer, the real
+ * number may be higher.
+ *
+ * @param[in]   ring    Ring context
+ * @return Number of frames
+ */
+extern uint8_t vscp_can_ring_getNum(vscp_can_ring_Ring const * const ring);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __VSCP_CAN_RING_H__ */
+
+/** @} */
@@ -235,6 +235,196 @@ extern "C"
 
 #endif  /* Undefined VSCP_CONFIG_ENABLE_CUSTOM_HEARTBEAT */
 
+#ifndef VSCP_CONFIG_ENABLE_NICKNAME_MAP
+
+/**
+ * Enable the nickname occupancy map. The core marks the nickname id of every
+ * received event as occupied. The nickname discovery skips occupied nickname
+ * ids and starts at a GUID dependent nickname id, instead of probing
+ * sequential from nickname id 1. Costs 32 byte RAM.
+ */
+#define VSCP_CONFIG_ENABLE_NICKNAME_MAP         VSCP_CONFIG_BASE_ENABLED
+
+#endif  /* Undefined VSCP_CONFIG_ENABLE_NICKNAME_MAP */
+
+#ifndef VSCP_CONFIG_ENABLE_EVENT_INTEREST
+
+/**
+ * Enable the event interest. The classes and types, which the decision matrix
+ * rows (standard and next generation) are interested in, are kept as bitmap.
+ * Received events, which can't match any row, skip the decision matrix
+ * evaluation. Costs 97 byte RAM.
+ */
+#define VSCP_CONFIG_ENABLE_EVENT_INTEREST       VSCP_CONFIG_BASE_ENABLED
+
+#endif  /* Undefined VSCP_CONFIG_ENABLE_EVENT_INTEREST */
+
+#ifndef VSCP_CONFIG_ENABLE_EVENT_INTEREST_RESPONSE
+
+/**
+ * Enable the response to CLASS1.PROTOCOL, Type=40 "Get event interest".
+ * Because the application gets every received event, it must add its own
+ * interests via vscp_portable_addEventInterest().
+ */
+#define VSCP_CONFIG_ENABLE_EVENT_INTEREST_RESPONSE  VSCP_CONFIG_BASE_DISABLED
+
+#endif  /* Undefined VSCP_CONFIG_ENABLE_EVENT_INTEREST_RESPONSE */
+
+#if VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_DM ) && VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION )
+
+#undef VSCP_CONFIG_ENABLE_EVENT_INTEREST
+
+/** Without any decision matrix, there is no need for the event interest. */
+#define VSCP_CONFIG_ENABLE_EVENT_INTEREST       VSCP_CONFIG_BASE_DISABLED
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_DM ) && VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST_RESPONSE )
+#if VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST )
+#error The event interest response requires the event interest.
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST ) */
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST_RESPONSE ) */
+
+#ifndef VSCP_CONFIG_ENABLE_REG_MAP
+
+/**
+ * Enable the register map. It contains the register ranges of the VSCP
+ * registers and the decision matrix (standard and next generation), which is
+ * built once during initialization. Register accesses look up the range
+ * instead of checking every register module, and multi register reads resolve
+ * a range only once. Costs 5 byte RAM per range, see VSCP_CONFIG_REG_MAP_SIZE.
+ */
+#define VSCP_CONFIG_ENABLE_REG_MAP              VSCP_CONFIG_BASE_ENABLED
+
+#endif  /* Undefined VSCP_CONFIG_ENABLE_REG_MAP */
+
+#ifndef VSCP_CONFIG_ENABLE_WHO_IS_THERE_CACHE
+
+/**
+ * Enable the who is there response cache. The GUID and the MDF URL are read
+ * once and kept in RAM, instead of reading them again from the device data
+ * for every who is there request. Costs 48 byte RAM.
+ * Call vscp_core_invalidateWhoIsThere(), if the GUID or the MDF URL is
+ * changed by the application.
+ */
+#define VSCP_CONFIG_ENABLE_WHO_IS_THERE_CACHE   VSCP_CONFIG_BASE_ENABLED
+
+#endif  /* Undefined VSCP_CONFIG_ENABLE_WHO_IS_THERE_CACHE */
+
+#ifndef VSCP_CONFIG_ENABLE_WHO_IS_THERE_STAGGER
+
+/**
+ * Enable staggering of the who is there response. A who is there request to
+ * all nodes is answered after a delay, derived from the nickname id, see
+ * VSCP_CONFIG_WHO_IS_THERE_STAGGER_SLOT. This spreads the responses of all
+ * nodes over time. A request to this node only is answered immediately.
+ * Note, this needs one more timer.
+ */
+#define VSCP_CONFIG_ENABLE_WHO_IS_THERE_STAGGER VSCP_CONFIG_BASE_DISABLED
+
+#endif  /* Undefined VSCP_CONFIG_ENABLE_WHO_IS_THERE_STAGGER */
+
+#ifndef VSCP_CONFIG_ENABLE_ADAPTIVE_HEARTBEAT
+
+/**
+ * Enable the adaptive node heartbeat. The heartbeat period is shortened by a
+ * GUID seeded random jitter, see VSCP_CONFIG_HEARTBEAT_NODE_JITTER, so nodes
+ * which were powered up together don't send their heartbeat at the same time.
+ * Before sending, the bus load is measured and the heartbeat is postponed
+ * while the bus is busy, see VSCP_CONFIG_HEARTBEAT_NODE_LOAD_LIMIT.
+ */
+#define VSCP_CONFIG_ENABLE_ADAPTIVE_HEARTBEAT   VSCP_CONFIG_BASE_DISABLED
+
+#endif  /* Undefined VSCP_CONFIG_ENABLE_ADAPTIVE_HEARTBEAT */
+
+#ifndef VSCP_CONFIG_HEARTBEAT_NODE_SUPPRESS
+
+/**
+ * Suppress the adaptive node heartbeat, if the node sent any other event
+ * during the heartbeat period. Never two heartbeats in a row are suppressed.
+ */
+#define VSCP_CONFIG_HEARTBEAT_NODE_SUPPRESS     VSCP_CONFIG_BASE_DISABLED
+
+#endif  /* Undefined VSCP_CONFIG_HEARTBEAT_NODE_SUPPRESS */
+
+#ifndef VSCP_CONFIG_ENABLE_PUBLISHER
+
+/**
+ * Enable the measurement publisher. It sends measurement events of registered
+ * sensors only, if the value changed more than the deadband or the maximum
+ * interval elapsed. Note, this needs one more timer.
+ */
+#define VSCP_CONFIG_ENABLE_PUBLISHER            VSCP_CONFIG_BASE_DISABLED
+
+#endif  /* Undefined VSCP_CONFIG_ENABLE_PUBLISHER */
+
+#ifndef VSCP_CONFIG_ENABLE_TP_ADAPTER_WRITE_MESSAGES
+
+/**
+ * Enable this, if the transport layer adapter provides
+ * vscp_tp_adapter_writeMessages() to write several messages at once. If
+ * disabled, vscp_core_sendEvents() writes the messages one by one.
+ */
+#define VSCP_CONFIG_ENABLE_TP_ADAPTER_WRITE_MESSAGES    VSCP_CONFIG_BASE_DISABLED
+
+#endif  /* Undefined VSCP_CONFIG_ENABLE_TP_ADAPTER_WRITE_MESSAGES */
+
+#ifndef VSCP_CONFIG_ENABLE_CAN_ADAPTER
+
+/**
+ * Enable the interrupt driven CAN transport layer adapter (vscp_can_adapter.h).
+ * The platform provides the CAN hardware abstraction (vscp_can_hal.h).
+ */
+#define VSCP_CONFIG_ENABLE_CAN_ADAPTER          VSCP_CONFIG_BASE_DISABLED
+
+#endif  /* Undefined VSCP_CONFIG_ENABLE_CAN_ADAPTER */
+
+#ifndef VSCP_CONFIG_ENABLE_CAN_FILTER
+
+/**
+ * Enable the CAN acceptance filters (vscp_can_filter.h). They are planned from
+ * the event interest and the protocol class, every time it was built, and
+ * passed to vscp_tp_adapter_setFilters(). The CAN controller rejects the
+ * frames, which the node is not interested in, instead of the software.
+ * Note, the application gets only the events it added as interest and the
+ * nickname map learns only from accepted frames.
+ */
+#define VSCP_CONFIG_ENABLE_CAN_FILTER           VSCP_CONFIG_BASE_DISABLED
+
+#endif  /* Undefined VSCP_CONFIG_ENABLE_CAN_FILTER */
+
+#ifndef VSCP_CONFIG_ENABLE_LOGGER_QUEUE
+
+/**
+ * Enable the log message queue. Log messages are queued instead of sent
+ * immediately and the core sends them with the lowest priority, one per
+ * process cycle in active state, after the received message is handled.
+ * Messages with the same id are coalesced and limited per second, the
+ * suppressed ones are reported with the VSCP_CONFIG_LOGGER_REPEATED_ID
+ * message.
+ */
+#define VSCP_CONFIG_ENABLE_LOGGER_QUEUE         VSCP_CONFIG_BASE_DISABLED
+
+#endif  /* Undefined VSCP_CONFIG_ENABLE_LOGGER_QUEUE */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ADAPTIVE_HEARTBEAT )
+#if VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_HEARTBEAT_NODE )
+#error The adaptive heartbeat requires the node heartbeat.
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_HEARTBEAT_NODE ) */
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ADAPTIVE_HEARTBEAT ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CAN_FILTER )
+#if VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST_RESPONSE )
+#error The CAN acceptance filters require the event interest response, which contains the application interests.
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST_RESPONSE ) */
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CAN_FILTER ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_QUEUE )
+#if VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_LOGGER )
+#error The log message queue requires the logger.
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_LOGGER ) */
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_QUEUE ) */
+
 /*******************************************************************************
     CONSTANTS
 *******************************************************************************/
@@ -265,10 +455,30 @@ extern "C"
 #ifndef VSCP_CONFIG_HEARTBEAT_NODE_PERIOD
 
 /** Node heartbeat period in ms (recommended 30s - 60s). */
-#define VSCP_CONFIG_HEARTBEAT_NODE_PERIOD       ((uint16_t)30000)
+#define VSCP_CONFIG_HEARTBEAT_NODE_PERIOD       30000
 
 #endif  /* Undefined VSCP_CONFIG_HEARTBEAT_NODE_PERIOD */
 
+#ifndef VSCP_CONFIG_EXT_PAGE_READ_FRAMES
+
+/** Maximum number of extended page read responses, which are sent in one
+ * process cycle. The remaining responses are sent in the following process
+ * cycles, which avoids that other events are starved by a long read.
+ */
+#define VSCP_CONFIG_EXT_PAGE_READ_FRAMES        ((uint8_t)4)
+
+#endif  /* Undefined VSCP_CONFIG_EXT_PAGE_READ_FRAMES */
+
+#ifndef VSCP_CONFIG_EVENT_INTEREST_FRAMES
+
+/** Maximum number of get event interest responses, which are sent in one
+ * process cycle. The remaining responses are sent in the following process
+ * cycles.
+ */
+#define VSCP_CONFIG_EVENT_INTEREST_FRAMES       ((uint8_t)4)
+
+#endif  /* Undefined VSCP_CONFIG_EVENT_INTEREST_FRAMES */
+
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM )
 
 #if VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_DM_PAGED_FEATURE )
@@ -323,6 +533,186 @@ extern "C"
 
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_REG_MAP )
+
+#ifndef VSCP_CONFIG_REG_MAP_SIZE
+
+/** Maximum number of register ranges in the register map. Every page of the
+ * decision matrix needs one range. If the ranges don't fit, every register
+ * access checks the register modules again.
+ */
+#define VSCP_CONFIG_REG_MAP_SIZE                8
+
+#endif  /* Undefined VSCP_CONFIG_REG_MAP_SIZE */
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_REG_MAP ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_WHO_IS_THERE_STAGGER )
+
+#ifndef VSCP_CONFIG_WHO_IS_THERE_STAGGER_SLOT
+
+/** Who is there response delay per nickname id in ms. The response is delayed
+ * by the nickname id multiplied with this value.
+ */
+#define VSCP_CONFIG_WHO_IS_THERE_STAGGER_SLOT   ((uint16_t)2)
+
+#endif  /* Undefined VSCP_CONFIG_WHO_IS_THERE_STAGGER_SLOT */
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_WHO_IS_THERE_STAGGER ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ADAPTIVE_HEARTBEAT )
+
+#ifndef VSCP_CONFIG_HEARTBEAT_NODE_JITTER
+
+/** Maximum node heartbeat jitter in ms. Every heartbeat period is shortened
+ * by a random value between 0 and this value.
+ */
+#define VSCP_CONFIG_HEARTBEAT_NODE_JITTER       ((uint16_t)3000)
+
+#endif  /* Undefined VSCP_CONFIG_HEARTBEAT_NODE_JITTER */
+
+#ifndef VSCP_CONFIG_HEARTBEAT_NODE_LOAD_WINDOW
+
+/** Bus load measurement window in ms, right before the node heartbeat is sent.
+ * It is part of the heartbeat period.
+ */
+#define VSCP_CONFIG_HEARTBEAT_NODE_LOAD_WINDOW  500
+
+#endif  /* Undefined VSCP_CONFIG_HEARTBEAT_NODE_LOAD_WINDOW */
+
+#ifndef VSCP_CONFIG_HEARTBEAT_NODE_LOAD_LIMIT
+
+/** Number of received and transmitted events in one measurement window, which
+ * is considered as busy bus. The node heartbeat is postponed by one
+ * measurement window then.
+ */
+#define VSCP_CONFIG_HEARTBEAT_NODE_LOAD_LIMIT   ((uint8_t)50)
+
+#endif  /* Undefined VSCP_CONFIG_HEARTBEAT_NODE_LOAD_LIMIT */
+
+#ifndef VSCP_CONFIG_HEARTBEAT_NODE_BACKOFF_MAX
+
+/** Maximum number of measurement windows, the node heartbeat is postponed.
+ * Afterwards the heartbeat is sent, independent of the bus load.
+ */
+#define VSCP_CONFIG_HEARTBEAT_NODE_BACKOFF_MAX  ((uint8_t)10)
+
+#endif  /* Undefined VSCP_CONFIG_HEARTBEAT_NODE_BACKOFF_MAX */
+
+#if (VSCP_CONFIG_HEARTBEAT_NODE_PERIOD <= VSCP_CONFIG_HEARTBEAT_NODE_LOAD_WINDOW)
+#error The bus load measurement window must be shorter than the node heartbeat period.
+#endif
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ADAPTIVE_HEARTBEAT ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_PUBLISHER )
+
+#ifndef VSCP_CONFIG_PUBLISHER_NUM
+
+/** Maximum number of sensors, which can be registered at the measurement publisher. */
+#define VSCP_CONFIG_PUBLISHER_NUM               4
+
+#endif  /* Undefined VSCP_CONFIG_PUBLISHER_NUM */
+
+#ifndef VSCP_CONFIG_PUBLISHER_TICK
+
+/** Measurement publisher tick period in ms. All intervals are given in ticks. */
+#define VSCP_CONFIG_PUBLISHER_TICK              ((uint16_t)100)
+
+#endif  /* Undefined VSCP_CONFIG_PUBLISHER_TICK */
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_PUBLISHER ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CAN_ADAPTER )
+
+#ifndef VSCP_CONFIG_CAN_ADAPTER_RX_NUM
+
+/** Number of frames in the CAN receive ring, power of two up to 128. It shall
+ * buffer all frames, which are received during the longest process cycle.
+ */
+#define VSCP_CONFIG_CAN_ADAPTER_RX_NUM          32
+
+#endif  /* Undefined VSCP_CONFIG_CAN_ADAPTER_RX_NUM */
+
+#ifndef VSCP_CONFIG_CAN_ADAPTER_TX_NUM
+
+/** Number of frames in the CAN transmit ring, power of two up to 128. */
+#define VSCP_CONFIG_CAN_ADAPTER_TX_NUM          8
+
+#endif  /* Undefined VSCP_CONFIG_CAN_ADAPTER_TX_NUM */
+
+#if (0 != (VSCP_CONFIG_CAN_ADAPTER_RX_NUM & (VSCP_CONFIG_CAN_ADAPTER_RX_NUM - 1))) || (128 < VSCP_CONFIG_CAN_ADAPTER_RX_NUM)
+#error The number of frames in the CAN receive ring must be a power of two up to 128.
+#endif
+
+#if (0 != (VSCP_CONFIG_CAN_ADAPTER_TX_NUM & (VSCP_CONFIG_CAN_ADAPTER_TX_NUM - 1))) || (128 < VSCP_CONFIG_CAN_ADAPTER_TX_NUM)
+#error The number of frames in the CAN transmit ring must be a power of two up to 128.
+#endif
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CAN_ADAPTER ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CAN_FILTER )
+
+#ifndef VSCP_CONFIG_CAN_FILTER_NUM
+
+/** Number of CAN acceptance filters, which the CAN controller provides. */
+#define VSCP_CONFIG_CAN_FILTER_NUM              8
+
+#endif  /* Undefined VSCP_CONFIG_CAN_FILTER_NUM */
+
+#if (0 == VSCP_CONFIG_CAN_FILTER_NUM) || (255 < VSCP_CONFIG_CAN_FILTER_NUM)
+#error The number of CAN acceptance filters must be in the range of 1 to 255.
+#endif
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CAN_FILTER ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_QUEUE )
+
+#ifndef VSCP_CONFIG_LOGGER_QUEUE_NUM
+
+/** Number of log messages with different ids, which can be queued. */
+#define VSCP_CONFIG_LOGGER_QUEUE_NUM            4
+
+#endif  /* Undefined VSCP_CONFIG_LOGGER_QUEUE_NUM */
+
+#ifndef VSCP_CONFIG_LOGGER_MSG_SIZE
+
+/** Max. size of a queued log message in bytes, longer messages are cut.
+ * 5 bytes fit into a single CLASS1.Log event.
+ */
+#define VSCP_CONFIG_LOGGER_MSG_SIZE             5
+
+#endif  /* Undefined VSCP_CONFIG_LOGGER_MSG_SIZE */
+
+#ifndef VSCP_CONFIG_LOGGER_RATE_LIMIT
+
+/** Max. number of sent log messages per id and second. Further messages with
+ * this id are only counted.
+ */
+#define VSCP_CONFIG_LOGGER_RATE_LIMIT           ((uint8_t)2)
+
+#endif  /* Undefined VSCP_CONFIG_LOGGER_RATE_LIMIT */
+
+#ifndef VSCP_CONFIG_LOGGER_REPEATED_ID
+
+/** Log message id, which reports the number of coalesced or suppressed
+ * messages of another id. The message contains the id (byte 0) and the
+ * number (byte 1-2, MSB first).
+ */
+#define VSCP_CONFIG_LOGGER_REPEATED_ID          ((uint8_t)0xFF)
+
+#endif  /* Undefined VSCP_CONFIG_LOGGER_REPEATED_ID */
+
+#if (0 == VSCP_CONFIG_LOGGER_QUEUE_NUM) || (255 < VSCP_CONFIG_LOGGER_QUEUE_NUM)
+#error The number of queued log messages must be in the range of 1 to 255.
+#endif
+
+#if (3 > VSCP_CONFIG_LOGGER_MSG_SIZE) || (255 < VSCP_CONFIG_LOGGER_MSG_SIZE)
+#error The size of a queued log message must be in the range of 3 to 255.
+#endif
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_QUEUE ) */
+
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOOPBACK )
 
 #ifndef VSCP_CONFIG_LOOPBACK_STORAGE_NUM
@@ -53,9 +53,11 @@
 #include "vscp_app_reg.h"
 #include "vscp_dm.h"
 #include "vscp_dm_ng.h"
+#include "vscp_interest.h"
 #include "vscp_util.h"
 #include "vscp_action.h"
 #include "vscp_logger.h"
+#include "vscp_publisher.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -80,6 +82,25 @@
 /** Timer threshold of 1s in ms */
 #define VSCP_CORE_TIMER_THRESHOLD_1S    ((uint16_t)1000)
 
+/** First nickname id, which is probed by the nickname discovery. */
+#define VSCP_CORE_NICKNAME_PROBE_FIRST  ((uint8_t)1)
+
+/** Last nickname id, which is probed by the nickname discovery. */
+#define VSCP_CORE_NICKNAME_PROBE_LAST   ((uint8_t)254)
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP )
+
+/** Size of the nickname occupancy map in byte, one bit per nickname id. */
+#define VSCP_CORE_NICKNAME_MAP_SIZE     (256 / 8)
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP ) */
+
+/** Number of who is there response data bytes (GUID and MDF URL). */
+#define VSCP_CORE_WHO_IS_THERE_DATA_SIZE    (VSCP_GUID_SIZE + 32)
+
+/** Number of who is there response frames. The first data byte of every frame is the row index. */
+#define VSCP_CORE_WHO_IS_THERE_FRAMES       ((VSCP_CORE_WHO_IS_THERE_DATA_SIZE + VSCP_L1_DATA_SIZE - 2) / (VSCP_L1_DATA_SIZE - 1))
+
 /*******************************************************************************
     MACROS
 *******************************************************************************/
@@ -124,11 +145,66 @@ typedef struct
 
 } ExtPageRead;
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST_RESPONSE )
+
+/**
+ * This type is used to store all necessary information, used to continue the
+ * get event interest responses in the next process cycle.
+ */
+typedef struct
+{
+    uint16_t    vscpClass;  /**< Class of the next entry */
+    uint16_t    vscpType;   /**< Type of the next entry */
+    uint8_t     index;      /**< Index of the next response */
+    BOOL        allTypes;   /**< One entry per class covers all types */
+    BOOL        isPending;  /**< Responses pending */
+
+} EventInterestRead;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST_RESPONSE ) */
+
+/** Owner of a register range */
+typedef enum
+{
+    VSCP_CORE_REG_OWNER_APP = 0,    /**< Application specific registers */
+    VSCP_CORE_REG_OWNER_VSCP,       /**< VSCP specific registers */
+    VSCP_CORE_REG_OWNER_DM,         /**< Decision matrix */
+    VSCP_CORE_REG_OWNER_DM_NG       /**< Decision matrix next generation */
+
+} VSCP_CORE_REG_OWNER;
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_REG_MAP )
+
+/**
+ * This type describes a range of registers in a page with the same owner.
+ */
+typedef struct
+{
+    uint16_t    page;   /**< Page */
+    uint8_t     start;  /**< First register address */
+    uint8_t     end;    /**< Last register address */
+    uint8_t     owner;  /**< Owner (VSCP_CORE_REG_OWNER) */
+
+} RegRange;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_REG_MAP ) */
+
 /*******************************************************************************
     PROTOTYPES
 *******************************************************************************/
 
 static void vscp_core_writeNicknameId(uint8_t nickname);
+static uint8_t vscp_core_getFirstProbeNickname(void);
+static uint8_t vscp_core_getNextProbeNickname(uint8_t nickname);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP )
+
+static void vscp_core_clearNicknameMap(void);
+static void vscp_core_updateNicknameMap(void);
+static BOOL vscp_core_isNicknameOccupied(uint8_t nickname);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP ) */
+
 static BOOL vscp_core_checkPersistentMemory(void);
 static void vscp_core_stateStartup(void);
 static void vscp_core_changeToStateInit(BOOL probeSegmentMaster);
@@ -145,6 +221,16 @@ static void vscp_core_changeToStateError(void);
 static void vscp_core_stateError(void);
 static void vscp_core_handleProtocolClassType(void);
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_HEARTBEAT_NODE )
+static void vscp_core_sendNodeHeartbeat(void);
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_HEARTBEAT_NODE ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ADAPTIVE_HEARTBEAT )
+static void vscp_core_seedHeartbeatJitter(void);
+static void vscp_core_startHeartbeatPeriod(void);
+static void vscp_core_processAdaptiveHeartbeat(void);
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ADAPTIVE_HEARTBEAT ) */
+
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_HEARTBEAT_SUPPORT_SEGMENT )
 static void vscp_core_handleProtocolHeartbeat(void);
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_HEARTBEAT_SUPPORT_SEGMENT ) */
@@ -155,8 +241,20 @@ static void vscp_core_handleProtocolSetNicknameId(void);
 static void vscp_core_handleProtocolDropNicknameId(void);
 static void vscp_core_handleProtocolReadRegister(void);
 static void vscp_core_sendRegisterReadWriteRsp(uint8_t addr, uint8_t value);
+static VSCP_CORE_REG_OWNER vscp_core_getRegOwner(uint16_t page, uint8_t addr);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_REG_MAP )
+static void vscp_core_buildRegMap(void);
+static BOOL vscp_core_addRegMapPage(uint16_t page);
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_REG_MAP ) */
+
+static VSCP_CORE_REG_OWNER vscp_core_findRegRange(uint16_t page, uint8_t addr, uint8_t * const end);
 static uint8_t vscp_core_readRegister(uint16_t page, uint8_t addr);
+static void vscp_core_readRegisters(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num);
+static uint8_t vscp_core_readRegisterOf(VSCP_CORE_REG_OWNER owner, uint16_t page, uint8_t addr);
+static uint8_t vscp_core_readRegisterVscp(uint8_t addr);
 static uint8_t vscp_core_writeRegister(uint16_t page, uint8_t addr, uint8_t value, /*@null@*/ BOOL* failed);
+static uint8_t vscp_core_writeRegisterVscp(uint8_t addr, uint8_t value, BOOL * const failed);
 static void vscp_core_handleProtocolWriteRegister(void);
 static void vscp_core_handleProtocolEnterBootLoaderMode(void);
 static void vscp_core_handleProtocolGuidDropNickname(void);
@@ -165,10 +263,23 @@ static void vscp_core_handleProtocolPageWrite(void);
 static void vscp_core_handleProtocolIncrementRegister(void);
 static void vscp_core_handleProtocolDecrementRegister(void);
 static void vscp_core_handleProtocolWhoIsThere(void);
+static void vscp_core_sendWhoIsThereResponse(void);
+static uint8_t vscp_core_getWhoIsThereData(uint8_t index);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_WHO_IS_THERE_CACHE )
+static void vscp_core_buildWhoIsThereCache(void);
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_WHO_IS_THERE_CACHE ) */
+
 static void vscp_core_handleProtocolGetDecisionMatrixInfo(void);
 static void vscp_core_handleProtocolExtendedPageReadRegister(void);
 static void vscp_core_extendedPageReadRegister(ExtPageRead * const data);
 static void vscp_core_handleProtocolExtendedPageWriteRegister(void);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST_RESPONSE )
+static void vscp_core_handleProtocolGetEventInterest(void);
+static void vscp_core_eventInterestResponse(EventInterestRead * const data);
+static BOOL vscp_core_findEventInterest(uint16_t * const vscpClass, uint16_t * const vscpType, BOOL allTypes);
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST_RESPONSE ) */
 static uint8_t vscp_core_getStartUpControl(void);
 static uint8_t vscp_core_getRegAppWriteProtect(void);
 
@@ -209,6 +320,16 @@ static uint8_t          vscp_core_secCnt            = 0;
 /** Nickname id used during nickname discovery process */
 static uint8_t          vscp_core_nickname_probe    = VSCP_NICKNAME_NOT_INIT;
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP )
+
+/** Nickname id, where the nickname discovery started. */
+static uint8_t          vscp_core_nicknameProbeStart    = VSCP_CORE_NICKNAME_PROBE_FIRST;
+
+/** Nickname occupancy map, one bit per nickname id. A set bit means occupied. */
+static uint8_t          vscp_core_nicknameMap[VSCP_CORE_NICKNAME_MAP_SIZE];
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP ) */
+
 /** Time since epoch 00:00:00 UTC, January 1, 1970 (unix timestamp) in s */
 static uint32_t         vscp_core_timeSinceEpoch    = 0;
 
@@ -222,6 +343,25 @@ static BOOL             vscp_core_isHeartbeatEnabled    = TRUE;
 
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_HEARTBEAT_NODE ) */
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ADAPTIVE_HEARTBEAT )
+
+/** Pseudo random state for the node heartbeat jitter, never 0. */
+static uint16_t         vscp_core_heartbeatRandom       = 1;
+
+/** Bus load is measured right before the node heartbeat or not. */
+static BOOL             vscp_core_heartbeatMeasuring    = FALSE;
+
+/** Number of measurement windows, the node heartbeat was postponed. */
+static uint8_t          vscp_core_heartbeatBackoffCnt   = 0;
+
+/** Node sent any event during the current heartbeat period or not. */
+static BOOL             vscp_core_heartbeatTxSeen       = FALSE;
+
+/** Last node heartbeat was suppressed or not. */
+static BOOL             vscp_core_heartbeatSuppressed   = FALSE;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ADAPTIVE_HEARTBEAT ) */
+
 /** Register: alarm status */
 static uint8_t          vscp_core_regAlarmStatus    = 0;
 
@@ -237,6 +377,49 @@ static BOOL             vscp_core_resetRequested    = FALSE;
  */
 static ExtPageRead      vscp_core_extPageReadData   = { 0, 0, 0, 0 };
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST_RESPONSE )
+
+/**
+ * Get event interest data, which is used to continue the responses in the
+ * next process cycle.
+ */
+static EventInterestRead    vscp_core_eventInterestData = { 0, 0, 0, FALSE, FALSE };
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST_RESPONSE ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_REG_MAP )
+
+/** Register map, sorted by page and register address. */
+static RegRange         vscp_core_regMap[VSCP_CONFIG_REG_MAP_SIZE];
+
+/** Number of ranges in the register map */
+static uint8_t          vscp_core_regMapNum         = 0;
+
+/** Register map contains all ranges or not. */
+static BOOL             vscp_core_regMapComplete    = FALSE;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_REG_MAP ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_WHO_IS_THERE_CACHE )
+
+/** Who is there response data: GUID (MSB first) followed by the MDF URL. */
+static uint8_t          vscp_core_whoIsThereData[VSCP_CORE_WHO_IS_THERE_DATA_SIZE];
+
+/** Who is there response data is valid or not. */
+static BOOL             vscp_core_whoIsThereValid   = FALSE;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_WHO_IS_THERE_CACHE ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_WHO_IS_THERE_STAGGER )
+
+/** Timer id, which is used to delay the who is there response. */
+static uint8_t          vscp_core_timerIdWhoIsThere = VSCP_TIMER_ID_INVALID;
+
+/** Delayed who is there response is pending or not. */
+static BOOL             vscp_core_whoIsTherePending = FALSE;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_WHO_IS_THERE_STAGGER ) */
+
 /*******************************************************************************
     GLOBAL VARIABLES
 *******************************************************************************/
@@ -287,6 +470,20 @@ extern VSCP_CORE_RET vscp_core_init(void)
 
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST )
+
+    /* Initialize event interest */
+    vscp_interest_init();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_REG_MAP )
+
+    /* Build the register map, after all register modules are initialized. */
+    vscp_core_buildRegMap();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_REG_MAP ) */
+
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) || VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION )
 
     /* Initialize action module */
@@ -316,6 +513,13 @@ extern VSCP_CORE_RET vscp_core_init(void)
     vscp_core_rxMessage.hardCoded   = FALSE;
     vscp_core_rxMessageValid        = FALSE;
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP )
+
+    /* Nothing is known about the other nodes yet. */
+    vscp_core_clearNicknameMap();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP ) */
+
     /* Show the user that the node starts up. */
     vscp_portable_setLampState(VSCP_LAMP_STATE_BLINK_SLOW);
 
@@ -368,6 +572,31 @@ extern VSCP_CORE_RET vscp_core_init(void)
 
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_HEARTBEAT_NODE ) */
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_WHO_IS_THERE_STAGGER )
+
+    /* Create a timer for the delayed who is there response */
+    vscp_core_timerIdWhoIsThere = vscp_timer_create();
+    if (VSCP_TIMER_ID_INVALID == vscp_core_timerIdWhoIsThere)
+    {
+        /* No timer available. */
+        ret = VSCP_CORE_RET_ERROR;
+    }
+
+    vscp_core_whoIsTherePending = FALSE;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_WHO_IS_THERE_STAGGER ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_PUBLISHER )
+
+    /* Initialize measurement publisher */
+    if (FALSE == vscp_publisher_init())
+    {
+        /* No timer available. */
+        ret = VSCP_CORE_RET_ERROR;
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_PUBLISHER ) */
+
     /* Verify persistent memory by checking the node control flags,
        especially the start up control. Because the start up control bits can
        be only 01b or 10b.
@@ -378,6 +607,13 @@ extern VSCP_CORE_RET vscp_core_init(void)
         vscp_core_restoreFactoryDefaultSettings();
     }
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_WHO_IS_THERE_CACHE )
+
+    /* Prepare the who is there response, after the device data is valid. */
+    vscp_core_buildWhoIsThereCache();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_WHO_IS_THERE_CACHE ) */
+
     /* Any error happened? */
     if (VSCP_CORE_RET_OK != ret)
     {
@@ -407,6 +643,10 @@ extern void vscp_core_restoreFactoryDefaultSettings(void)
     vscp_core_extPageReadData.count = 0;
     vscp_core_extPageReadData.seq   = 0;
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST_RESPONSE )
+    vscp_core_eventInterestData.isPending = FALSE;
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST_RESPONSE ) */
+
     /* Clear nickname id */
     vscp_core_writeNicknameId(VSCP_NICKNAME_NOT_INIT);
 
@@ -450,6 +690,9 @@ extern void vscp_core_restoreFactoryDefaultSettings(void)
     /* Restore application factory default settings */
     vscp_portable_restoreFactoryDefaultSettings();
 
+    /* GUID and MDF URL may be changed. */
+    vscp_core_invalidateWhoIsThere();
+
     return;
 }
 
@@ -465,6 +708,31 @@ extern void vscp_core_process(void)
      */
     vscp_core_rxMessageValid = vscp_transport_readMessage(&vscp_core_rxMessage);
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST )
+
+    /* Build the event interest and plan the CAN acceptance filters again after
+     * a decision matrix change, but not during a burst of received events,
+     * e.g. register writes.
+     */
+    if (FALSE == vscp_core_rxMessageValid)
+    {
+        vscp_interest_update();
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP )
+
+    /* Learn from every received message, independent of the current state,
+     * which nickname ids are in use.
+     */
+    if (TRUE == vscp_core_rxMessageValid)
+    {
+        vscp_core_updateNicknameMap();
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP ) */
+
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER )
 
     /* Handle early as possible any kind of log control messages. */
@@ -528,6 +796,18 @@ extern void vscp_core_process(void)
         break;
     }
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_QUEUE )
+
+    /* Queued log messages have the lowest priority, therefore they are sent
+     * after the received message is handled, one per process cycle.
+     */
+    if (STATE_ACTIVE == vscp_core_state)
+    {
+        vscp_logger_process();
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_QUEUE ) */
+
     /* Invalidate received message */
     vscp_core_rxMessageValid = FALSE;
 
@@ -615,6 +895,23 @@ extern void vscp_core_setTimeSinceEpoch(uint32_t timestamp)
     return;
 }
 
+/**
+ * This function invalidates the prepared who is there response. Call it
+ * every time the GUID or the MDF URL is changed, e.g. written directly to the
+ * persistent memory. The response is prepared again with the next who is
+ * there request.
+ */
+extern void vscp_core_invalidateWhoIsThere(void)
+{
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_WHO_IS_THERE_CACHE )
+
+    vscp_core_whoIsThereValid = FALSE;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_WHO_IS_THERE_CACHE ) */
+
+    return;
+}
+
 /**
  * Prepares a transmit message, before it is used.
  *
@@ -661,6 +958,20 @@ extern BOOL vscp_core_sendEvent(vscp_TxMessage const * const txMessage)
     return vscp_transport_writeMessage(txMessage);
 }
 
+/**
+ * Send several events to the communication bus at once. The events are sent
+ * in order, until the first one is not accepted. If the transport layer
+ * adapter supports it, all events are passed to it in one call.
+ *
+ * @param[in]   txMessages  The events which will be sent.
+ * @param[in]   num         Number of events
+ * @return Number of accepted events
+ */
+extern uint8_t vscp_core_sendEvents(vscp_TxMessage const * const txMessages, uint8_t num)
+{
+    return vscp_transport_writeMessages(txMessages, num);
+}
+
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_HEARTBEAT_NODE )
 
 /**
@@ -802,7 +1113,7 @@ static inline void  vscp_core_changeToStateInit(BOOL probeSegmentMaster)
         if (FALSE == probeSegmentMaster)
         {
             vscp_core_initState = INIT_STATE_PROBE;
-            vscp_core_nickname_probe = 1;
+            vscp_core_nickname_probe = vscp_core_getFirstProbeNickname();
         }
         else
         {
@@ -867,8 +1178,8 @@ static inline void  vscp_core_stateInit(void)
             /* Start nickname id discovery process */
             vscp_core_initState = INIT_STATE_PROBE;
 
-            /* Probe shall start with nickname id 1. */
-            vscp_core_nickname_probe = 1;
+            /* Determine the first nickname id, which shall be probed. */
+            vscp_core_nickname_probe = vscp_core_getFirstProbeNickname();
         }
         /* Valid message received */
         else if (TRUE == vscp_core_rxMessageValid)
@@ -900,7 +1211,7 @@ static inline void  vscp_core_stateInit(void)
     case INIT_STATE_PROBE:
 
         /* If no nickname assignment occurs the node checks the other possible
-         * nicknames (1-254) in turn.
+         * nicknames (1-254) in turn. Known occupied nickname ids are skipped.
          */
         txMessage.vscpClass = VSCP_CLASS_L1_PROTOCOL;
         txMessage.vscpType  = VSCP_TYPE_PROTOCOL_NEW_NODE_ONLINE;
@@ -921,6 +1232,15 @@ static inline void  vscp_core_stateInit(void)
             /* Stop timer */
             vscp_timer_stop(vscp_core_timerId);
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP )
+
+            /* The occupancy information may be outdated, which shall not
+             * prevent a later requested nickname discovery.
+             */
+            vscp_core_clearNicknameMap();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP ) */
+
             /* Go offline, because segment is full. */
             vscp_core_changeToStateIdle();
         }
@@ -964,7 +1284,7 @@ static inline void  vscp_core_stateInit(void)
                          * See VSCP specification, chapter Level I Events,
                          * CLASS1.PROTOCOL, Type=2 (0x02) New node on line / Probe
                          */
-                        ++vscp_core_nickname_probe;
+                        vscp_core_nickname_probe = vscp_core_getNextProbeNickname(vscp_core_nickname_probe);
 
                         vscp_core_initState = INIT_STATE_PROBE;
                     }
@@ -989,6 +1309,156 @@ static inline void  vscp_core_stateInit(void)
     return;
 }
 
+/**
+ * This function determines the first nickname id, which shall be probed by
+ * the nickname discovery.
+ *
+ * If the nickname occupancy map is enabled, the discovery starts at a nickname
+ * id derived from the GUID. This spreads the nodes over the nickname id range
+ * after a power cycle of the whole segment, instead that all of them compete
+ * for nickname id 1.
+ *
+ * @return Nickname id or VSCP_NICKNAME_NOT_INIT if all are occupied
+ */
+static uint8_t vscp_core_getFirstProbeNickname(void)
+{
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP )
+
+    uint8_t index   = 0;
+    uint8_t hash    = 0;
+
+    for(index = 0; index < VSCP_GUID_SIZE; ++index)
+    {
+        hash = (uint8_t)(hash * 31u + vscp_dev_data_getGUID(index));
+    }
+
+    vscp_core_nicknameProbeStart = (uint8_t)(VSCP_CORE_NICKNAME_PROBE_FIRST + (hash % VSCP_CORE_NICKNAME_PROBE_LAST));
+
+    if (FALSE == vscp_core_isNicknameOccupied(vscp_core_nicknameProbeStart))
+    {
+        return vscp_core_nicknameProbeStart;
+    }
+
+    return vscp_core_getNextProbeNickname(vscp_core_nicknameProbeStart);
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP ) */
+
+    return VSCP_CORE_NICKNAME_PROBE_FIRST;
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP ) */
+}
+
+/**
+ * This function determines the next nickname id, which shall be probed by
+ * the nickname discovery.
+ *
+ * @param[in] nickname  Last probed nickname id
+ *
+ * @return Nickname id or VSCP_NICKNAME_NOT_INIT if all are probed
+ */
+static uint8_t vscp_core_getNextProbeNickname(uint8_t nickname)
+{
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP )
+
+    /* Walk cyclic through the nickname ids and skip the occupied ones. */
+    do
+    {
+        if (VSCP_CORE_NICKNAME_PROBE_LAST <= nickname)
+        {
+            nickname = VSCP_CORE_NICKNAME_PROBE_FIRST;
+        }
+        else
+        {
+            ++nickname;
+        }
+
+        /* All nickname ids probed? */
+        if (vscp_core_nicknameProbeStart == nickname)
+        {
+            return VSCP_NICKNAME_NOT_INIT;
+        }
+    }
+    while(TRUE == vscp_core_isNicknameOccupied(nickname));
+
+    return nickname;
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP ) */
+
+    /* After the last one, it overflows to VSCP_NICKNAME_NOT_INIT. */
+    return (uint8_t)(nickname + 1);
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP ) */
+}
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP )
+
+/**
+ * This function clears the nickname occupancy map.
+ */
+static void vscp_core_clearNicknameMap(void)
+{
+    uint8_t index   = 0;
+
+    for(index = 0; index < VSCP_CORE_NICKNAME_MAP_SIZE; ++index)
+    {
+        vscp_core_nicknameMap[index] = 0;
+    }
+
+    return;
+}
+
+/**
+ * This function updates the nickname occupancy map with the received message.
+ * The originating nickname id is occupied, except it is the own one.
+ * A dropped or changed nickname id of another node is released.
+ */
+static void vscp_core_updateNicknameMap(void)
+{
+    uint8_t nickname    = vscp_core_rxMessage.oAddr;
+
+    if ((VSCP_NICKNAME_SEGMENT_MASTER != nickname) &&
+        (VSCP_NICKNAME_NOT_INIT != nickname) &&
+        (vscp_core_nickname != nickname))
+    {
+        vscp_core_nicknameMap[nickname / 8] |= (uint8_t)(1 << (nickname % 8));
+    }
+
+    if ((VSCP_CLASS_L1_PROTOCOL == vscp_core_rxMessage.vscpClass) &&
+        (1 <= vscp_core_rxMessage.dataNum))
+    {
+        if ((VSCP_TYPE_PROTOCOL_DROP_NICKNAME_ID == vscp_core_rxMessage.vscpType) ||
+            (VSCP_TYPE_PROTOCOL_SET_NICKNAME_ID == vscp_core_rxMessage.vscpType))
+        {
+            nickname = vscp_core_rxMessage.data[0];
+
+            vscp_core_nicknameMap[nickname / 8] &= (uint8_t)~(1 << (nickname % 8));
+        }
+    }
+
+    return;
+}
+
+/**
+ * This function returns whether a nickname id is known as occupied.
+ *
+ * @param[in] nickname  Nickname id
+ *
+ * @return If occupied, it will return TRUE otherwise FALSE.
+ */
+static BOOL vscp_core_isNicknameOccupied(uint8_t nickname)
+{
+    BOOL    isOccupied  = FALSE;
+
+    if (0 != (vscp_core_nicknameMap[nickname / 8] & (1 << (nickname % 8))))
+    {
+        isOccupied = TRUE;
+    }
+
+    return isOccupied;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_NICKNAME_MAP ) */
+
 /**
  * Change to pre-active state.
  */
@@ -1083,8 +1553,18 @@ static inline void  vscp_core_changeToStateActive(void)
 
         if (FALSE != vscp_core_isHeartbeatEnabled)
         {
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ADAPTIVE_HEARTBEAT )
+
+            /* Start heartbeat period with jitter */
+            vscp_core_seedHeartbeatJitter();
+            vscp_core_startHeartbeatPeriod();
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_ADAPTIVE_HEARTBEAT ) */
+
             /* Start timer for node heartbeat */
             vscp_timer_start(vscp_core_heartbeatTimerId, VSCP_CONFIG_HEARTBEAT_NODE_PERIOD);
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_ADAPTIVE_HEARTBEAT ) */
         }
 
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_HEARTBEAT_NODE ) */
@@ -1150,53 +1630,223 @@ static inline void  vscp_core_stateActive(void)
     if ((FALSE != vscp_core_isHeartbeatEnabled) &&
         (FALSE == vscp_timer_getStatus(vscp_core_heartbeatTimerId)))
     {
-#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CUSTOM_HEARTBEAT )
-        (void)vscp_portable_sendNodeHeartbeatEvent();
-#else
-        (void)vscp_information_sendNodeHeartbeatEvent(0, vscp_dev_data_getNodeZone(), vscp_dev_data_getNodeSubZone());
-#endif
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ADAPTIVE_HEARTBEAT )
+
+        vscp_core_processAdaptiveHeartbeat();
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_ADAPTIVE_HEARTBEAT ) */
+
+        vscp_core_sendNodeHeartbeat();
 
         /* Restart timer */
         vscp_timer_start(vscp_core_heartbeatTimerId, VSCP_CONFIG_HEARTBEAT_NODE_PERIOD);
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_ADAPTIVE_HEARTBEAT ) */
     }
 
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_HEARTBEAT_NODE ) */
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_PUBLISHER )
+
+    /* Send the measurement events, which are due. */
+    vscp_publisher_process();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_PUBLISHER ) */
+
     /* Continue a extended page read? */
     if (0 < vscp_core_extPageReadData.count)
     {
         vscp_core_extendedPageReadRegister(&vscp_core_extPageReadData);
     }
 
-    return;
-}
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST_RESPONSE )
 
-/**
- * Change to idle state.
- */
-static inline void  vscp_core_changeToStateIdle(void)
-{
-    if (STATE_IDLE != vscp_core_state)
+    /* Continue the get event interest responses? */
+    if (FALSE != vscp_core_eventInterestData.isPending)
     {
-        /* Disable lamp and show the user that the node is offline. */
-        vscp_portable_setLampState(VSCP_LAMP_STATE_OFF);
-
-        vscp_core_state = STATE_IDLE;
-
-#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_IDLE_CALLOUT )
+        vscp_core_eventInterestResponse(&vscp_core_eventInterestData);
+    }
 
-        /* Notify the application. */
-        vscp_portable_idleStateEntered();
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST_RESPONSE ) */
 
-#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_IDLE_CALLOUT ) */
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_WHO_IS_THERE_STAGGER )
 
+    /* Send a delayed who is there response? */
+    if ((FALSE != vscp_core_whoIsTherePending) &&
+        (FALSE == vscp_timer_getStatus(vscp_core_timerIdWhoIsThere)))
+    {
+        vscp_core_whoIsTherePending = FALSE;
+        vscp_core_sendWhoIsThereResponse();
     }
 
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_WHO_IS_THERE_STAGGER ) */
+
     return;
 }
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_HEARTBEAT_NODE )
+
 /**
- * Handles the idle state.
+ * Sends the node heartbeat.
+ */
+static void vscp_core_sendNodeHeartbeat(void)
+{
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CUSTOM_HEARTBEAT )
+    (void)vscp_portable_sendNodeHeartbeatEvent();
+#else
+    (void)vscp_information_sendNodeHeartbeatEvent(0, vscp_dev_data_getNodeZone(), vscp_dev_data_getNodeSubZone());
+#endif
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_HEARTBEAT_NODE ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ADAPTIVE_HEARTBEAT )
+
+/**
+ * Seeds the pseudo random jitter of the node heartbeat with the GUID and the
+ * nickname id. Nodes which are powered up together get different heartbeat
+ * periods this way.
+ */
+static void vscp_core_seedHeartbeatJitter(void)
+{
+    uint8_t     index   = 0;
+    uint16_t    seed    = vscp_core_nickname;
+
+    for(index = 0; index < VSCP_GUID_SIZE; ++index)
+    {
+        seed = (uint16_t)(seed * 31u + vscp_dev_data_getGUID(index));
+    }
+
+    /* The xorshift generator never leaves 0. */
+    if (0 == seed)
+    {
+        seed = 1;
+    }
+
+    vscp_core_heartbeatRandom = seed;
+
+    return;
+}
+
+/**
+ * Starts a new node heartbeat period. The period is shortened by a pseudo
+ * random jitter and ends with the bus load measurement window.
+ */
+static void vscp_core_startHeartbeatPeriod(void)
+{
+    uint16_t    jitter  = 0;
+    uint16_t    period  = VSCP_CONFIG_HEARTBEAT_NODE_PERIOD - VSCP_CONFIG_HEARTBEAT_NODE_LOAD_WINDOW;
+
+    /* xorshift16 */
+    vscp_core_heartbeatRandom ^= (uint16_t)(vscp_core_heartbeatRandom << 7);
+    vscp_core_heartbeatRandom ^= (uint16_t)(vscp_core_heartbeatRandom >> 9);
+    vscp_core_heartbeatRandom ^= (uint16_t)(vscp_core_heartbeatRandom << 8);
+
+    jitter = vscp_core_heartbeatRandom % (VSCP_CONFIG_HEARTBEAT_NODE_JITTER + 1u);
+
+    if (period > jitter)
+    {
+        period -= jitter;
+    }
+
+    /* Forget the events of the last period. */
+    (void)vscp_transport_getReceivedMessages();
+    (void)vscp_transport_getTransmittedMessages();
+
+    vscp_core_heartbeatMeasuring    = FALSE;
+    vscp_core_heartbeatBackoffCnt   = 0;
+    vscp_core_heartbeatTxSeen       = FALSE;
+
+    vscp_timer_start(vscp_core_heartbeatTimerId, period);
+
+    return;
+}
+
+/**
+ * Handles the node heartbeat timer. After the heartbeat period, the bus load
+ * is measured for one window. If the bus is busy, the heartbeat is postponed
+ * by another window, but not more than VSCP_CONFIG_HEARTBEAT_NODE_BACKOFF_MAX
+ * times.
+ */
+static void vscp_core_processAdaptiveHeartbeat(void)
+{
+    uint8_t rxNum   = vscp_transport_getReceivedMessages();
+    uint8_t txNum   = vscp_transport_getTransmittedMessages();
+
+    if (0 < txNum)
+    {
+        vscp_core_heartbeatTxSeen = TRUE;
+    }
+
+    /* Heartbeat period elapsed? */
+    if (FALSE == vscp_core_heartbeatMeasuring)
+    {
+        /* Measure the bus load right before the heartbeat. */
+        vscp_core_heartbeatMeasuring = TRUE;
+        vscp_timer_start(vscp_core_heartbeatTimerId, VSCP_CONFIG_HEARTBEAT_NODE_LOAD_WINDOW);
+    }
+    /* Bus busy? */
+    else if ((VSCP_CONFIG_HEARTBEAT_NODE_LOAD_LIMIT <= ((uint16_t)rxNum + txNum)) &&
+             (VSCP_CONFIG_HEARTBEAT_NODE_BACKOFF_MAX > vscp_core_heartbeatBackoffCnt))
+    {
+        /* Postpone heartbeat */
+        ++vscp_core_heartbeatBackoffCnt;
+        vscp_timer_start(vscp_core_heartbeatTimerId, VSCP_CONFIG_HEARTBEAT_NODE_LOAD_WINDOW);
+    }
+    else
+    {
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_HEARTBEAT_NODE_SUPPRESS )
+
+        /* The node sent events, which show already that it is alive. */
+        if ((FALSE != vscp_core_heartbeatTxSeen) &&
+            (FALSE == vscp_core_heartbeatSuppressed))
+        {
+            vscp_core_heartbeatSuppressed = TRUE;
+        }
+        else
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_HEARTBEAT_NODE_SUPPRESS ) */
+        {
+            vscp_core_sendNodeHeartbeat();
+            vscp_core_heartbeatSuppressed = FALSE;
+        }
+
+        vscp_core_startHeartbeatPeriod();
+    }
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_ADAPTIVE_HEARTBEAT ) */
+
+/**
+ * Change to idle state.
+ */
+static inline void  vscp_core_changeToStateIdle(void)
+{
+    if (STATE_IDLE != vscp_core_state)
+    {
+        /* Disable lamp and show the user that the node is offline. */
+        vscp_portable_setLampState(VSCP_LAMP_STATE_OFF);
+
+        vscp_core_state = STATE_IDLE;
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_IDLE_CALLOUT )
+
+        /* Notify the application. */
+        vscp_portable_idleStateEntered();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_IDLE_CALLOUT ) */
+
+    }
+
+    return;
+}
+
+/**
+ * Handles the idle state.
  */
 static inline void  vscp_core_stateIdle(void)
 {
@@ -1502,7 +2152,13 @@ static inline void  vscp_core_handleProtocolClassType(void)
 
     /* VSCP specification, chapter Get event interest. */
     case VSCP_TYPE_PROTOCOL_GET_EVENT_INTEREST:
-        /* Optional and not supported yet. */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST_RESPONSE )
+
+        vscp_core_handleProtocolGetEventInterest();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST_RESPONSE ) */
+
         break;
 
     /* VSCP specification, chapter Get event interest response. */
@@ -1793,246 +2449,343 @@ static void vscp_core_sendRegisterReadWriteRsp(uint8_t addr, uint8_t value)
 }
 
 /**
- * Read register and return its value.
+ * Get the owner of a register, by checking every register module.
  *
  * @param[in]   page    Page
  * @param[in]   addr    Register address
- * @return  Register value
+ * @return  Owner
  */
-static uint8_t  vscp_core_readRegister(uint16_t page, uint8_t addr)
+static VSCP_CORE_REG_OWNER vscp_core_getRegOwner(uint16_t page, uint8_t addr)
 {
-    uint8_t ret = 0;
+    VSCP_CORE_REG_OWNER owner   = VSCP_CORE_REG_OWNER_APP;
 
     /* Page 0 includes the VSCP specific registers. */
     if ((0 == page) &&
         (VSCP_REGISTER_VSCP_START_ADDR <= addr) &&
         (VSCP_REGISTER_VSCP_END_ADDR >= addr))
     {
-        switch(addr)
-        {
-            case VSCP_REG_ALARM_STATUS:
-                ret = vscp_core_regAlarmStatus;
-
-                /* Reset alarm */
-                vscp_core_regAlarmStatus = 0;
-                break;
-
-            case VSCP_REG_VSCP_VERSION_MAJOR:
-                ret = VSCP_CORE_VERSION_MAJOR;
-                break;
+        owner = VSCP_CORE_REG_OWNER_VSCP;
+    }
 
-            case VSCP_REG_VSCP_VERSION_MINOR:
-                ret = VSCP_CORE_VERSION_MINOR;
-                break;
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM )
+    /* Is the addressed register part of the decision matrix? */
+    else if (FALSE != vscp_dm_isDecisionMatrix(page, addr))
+    {
+        owner = VSCP_CORE_REG_OWNER_DM;
+    }
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) */
 
-            case VSCP_REG_NODE_CONTROL_FLAGS:
-                ret = vscp_ps_readNodeControlFlags();
-                break;
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION )
+    /* Is the addressed register part of the decision matrix NG? */
+    else if (FALSE != vscp_dm_ng_isDecisionMatrix(page, addr))
+    {
+        owner = VSCP_CORE_REG_OWNER_DM_NG;
+    }
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
 
-            case VSCP_REG_USER_ID_0:
-                /*@fallthrough@*/
-            case VSCP_REG_USER_ID_1:
-                /*@fallthrough@*/
-            case VSCP_REG_USER_ID_2:
-                /*@fallthrough@*/
-            case VSCP_REG_USER_ID_3:
-                /*@fallthrough@*/
-            case VSCP_REG_USER_ID_4:
-                ret = vscp_ps_readUserId(addr - VSCP_REG_USER_ID_0);
-                break;
+    return owner;
+}
 
-            case VSCP_REG_MANUFACTURER_DEV_ID_0:
-                /*@fallthrough@*/
-            case VSCP_REG_MANUFACTURER_DEV_ID_1:
-                /*@fallthrough@*/
-            case VSCP_REG_MANUFACTURER_DEV_ID_2:
-                /*@fallthrough@*/
-            case VSCP_REG_MANUFACTURER_DEV_ID_3:
-                ret = vscp_dev_data_getManufacturerDevId(addr - VSCP_REG_MANUFACTURER_DEV_ID_0);
-                break;
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_REG_MAP )
 
-            case VSCP_REG_MANUFACTURER_SUB_DEV_ID_0:
-                /*@fallthrough@*/
-            case VSCP_REG_MANUFACTURER_SUB_DEV_ID_1:
-                /*@fallthrough@*/
-            case VSCP_REG_MANUFACTURER_SUB_DEV_ID_2:
-                /*@fallthrough@*/
-            case VSCP_REG_MANUFACTURER_SUB_DEV_ID_3:
-                ret = vscp_dev_data_getManufacturerSubDevId(addr - VSCP_REG_MANUFACTURER_SUB_DEV_ID_0);
-                break;
+/**
+ * Build the register map with the ranges of the VSCP registers and the
+ * decision matrix. Every register, which is not part of a range, is a
+ * application specific register.
+ */
+static void vscp_core_buildRegMap(void)
+{
+    uint8_t index   = 0;
 
-            case VSCP_REG_NICKNAME_ID:
-                ret = vscp_core_nickname;
-                break;
+    vscp_core_regMapNum         = 0;
+    vscp_core_regMapComplete    = TRUE;
 
-            case VSCP_REG_PAGE_SELECT_MSB:
-                ret = VSCP_UTIL_WORD_MSB(vscp_core_regPageSelect);
-                break;
+    /* VSCP specific registers */
+    (void)vscp_core_addRegMapPage(0);
 
-            case VSCP_REG_PAGE_SELECT_LSB:
-                ret = VSCP_UTIL_WORD_LSB(vscp_core_regPageSelect);
-                break;
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM )
 
-            case VSCP_REG_FIRMWARE_VERSION_MAJOR:
-                ret = vscp_dev_data_getFirmwareVersionMajor();
-                break;
+    /* Decision matrix, which may span several pages */
+    {
+        uint16_t    page    = vscp_dm_getPage();
 
-            case VSCP_REG_FIRMWARE_VERSION_MINOR:
-                ret = vscp_dev_data_getFirmwareVersionMinor();
-                break;
+        while((0 != page) && (FALSE != vscp_core_addRegMapPage(page)))
+        {
+            ++page;
+        }
+    }
 
-            case VSCP_REG_FIRMWARE_VERSION_SUB_MINOR:
-                ret = vscp_dev_data_getFirmwareVersionSubMinor();
-                break;
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) */
 
-            case VSCP_REG_BOOT_LOADER_ALGORITHM:
-#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BOOT_LOADER_SUPPORTED )
-                ret = vscp_portable_getBootLoaderAlgorithm();
-#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_BOOT_LOADER_SUPPORTED ) */
-                ret = 0xFF;
-#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_BOOT_LOADER_SUPPORTED ) */
-                break;
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION )
 
-            case VSCP_REG_BUFFER_SIZE:
-                ret = VSCP_L1_DATA_SIZE;
-                break;
+    /* Decision matrix next generation, which may span several pages */
+    {
+        uint16_t    page    = VSCP_CONFIG_DM_NG_PAGE;
 
-            case VSCP_REG_PAGES_USED:
-                ret = vscp_app_reg_getPagesUsed();
-                break;
+        while((0 != page) && (FALSE != vscp_core_addRegMapPage(page)))
+        {
+            ++page;
+        }
+    }
 
-            case VSCP_REG_STD_DEV_FAMILY_CODE_3:
-                /*@fallthrough@*/
-            case VSCP_REG_STD_DEV_FAMILY_CODE_2:
-                /*@fallthrough@*/
-            case VSCP_REG_STD_DEV_FAMILY_CODE_1:
-                /*@fallthrough@*/
-            case VSCP_REG_STD_DEV_FAMILY_CODE_0:
-                ret = vscp_dev_data_getStdDevFamilyCode(3 - (addr - VSCP_REG_STD_DEV_FAMILY_CODE_3));
-                break;
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
 
-            case VSCP_REG_STD_DEV_TYPE_3:
-                /*@fallthrough@*/
-            case VSCP_REG_STD_DEV_TYPE_2:
-                /*@fallthrough@*/
-            case VSCP_REG_STD_DEV_TYPE_1:
-                /*@fallthrough@*/
-            case VSCP_REG_STD_DEV_TYPE_0:
-                ret = vscp_dev_data_getStdDevType(3 - (addr - VSCP_REG_STD_DEV_TYPE_3));
-                break;
+    /* Sort the ranges by page. The ranges of one page are already sorted. */
+    for(index = 1; index < vscp_core_regMapNum; ++index)
+    {
+        RegRange    range   = vscp_core_regMap[index];
+        uint8_t     pos     = index;
 
-            case VSCP_REG_RESTORE_STD_CFG:
-                /* Write only */
-                break;
+        while((0 < pos) && (vscp_core_regMap[pos - 1].page > range.page))
+        {
+            vscp_core_regMap[pos] = vscp_core_regMap[pos - 1];
+            --pos;
+        }
 
-            case VSCP_REG_GUID_15:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_14:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_13:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_12:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_11:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_10:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_9:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_8:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_7:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_6:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_5:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_4:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_3:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_2:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_1:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_0:
-                ret = vscp_dev_data_getGUID(15 - (addr - VSCP_REG_GUID_15));
-                break;
+        vscp_core_regMap[pos] = range;
+    }
 
-            default:
+    return;
+}
 
-                if ((VSCP_REG_MDF_URL_BEGIN <= addr) &&
-                    (VSCP_REG_MDF_URL_END >= addr))
-                {
-                    ret = vscp_dev_data_getMdfUrl(addr - VSCP_REG_MDF_URL_BEGIN);
-                }
+/**
+ * Add all ranges of a page, which are not application specific registers, to
+ * the register map. A page, which is already in the map, is skipped.
+ *
+ * @param[in]   page    Page
+ * @return  Page contains any range or not
+ * @retval  FALSE   No range in the page
+ * @retval  TRUE    At least one range in the page
+ */
+static BOOL vscp_core_addRegMapPage(uint16_t page)
+{
+    uint8_t     index       = 0;
+    uint16_t    addr        = 0;
+    RegRange *  range       = NULL;
+    uint8_t     rangeNum    = vscp_core_regMapNum;
 
-                break;
+    /* Page already added? */
+    for(index = 0; index < vscp_core_regMapNum; ++index)
+    {
+        if (page == vscp_core_regMap[index].page)
+        {
+            return TRUE;
         }
     }
-    
-#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM )
-    /* Is the addressed register part of the decision matrix? */
-    else if (FALSE != vscp_dm_isDecisionMatrix(page, addr))
+
+    for(addr = 0; addr <= 0xff; ++addr)
     {
-        ret = vscp_dm_readRegister(page, addr);
+        VSCP_CORE_REG_OWNER owner   = vscp_core_getRegOwner(page, (uint8_t)addr);
+
+        if (VSCP_CORE_REG_OWNER_APP == owner)
+        {
+            range = NULL;
+        }
+        /* Continue the current range? */
+        else if ((NULL != range) &&
+                 (owner == range->owner))
+        {
+            range->end = (uint8_t)addr;
+        }
+        /* Register map full? */
+        else if (VSCP_CONFIG_REG_MAP_SIZE <= vscp_core_regMapNum)
+        {
+            vscp_core_regMapComplete = FALSE;
+            break;
+        }
+        else
+        {
+            range = &vscp_core_regMap[vscp_core_regMapNum];
+            ++vscp_core_regMapNum;
+
+            range->page     = page;
+            range->start    = (uint8_t)addr;
+            range->end      = (uint8_t)addr;
+            range->owner    = owner;
+        }
     }
-#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) */
 
-#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION )
-    /* Is the addressed register part of the decision matrix NG? */
-    else if (FALSE != vscp_dm_ng_isDecisionMatrix(page, addr))
+    return (rangeNum < vscp_core_regMapNum) ? TRUE : FALSE;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_REG_MAP ) */
+
+/**
+ * Find the owner of a register and the last register address, which has the
+ * same owner.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Register address
+ * @param[out]  end     Last register address with the same owner
+ * @return  Owner
+ */
+static VSCP_CORE_REG_OWNER vscp_core_findRegRange(uint16_t page, uint8_t addr, uint8_t * const end)
+{
+    VSCP_CORE_REG_OWNER owner   = VSCP_CORE_REG_OWNER_APP;
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_REG_MAP )
+
+    if (FALSE != vscp_core_regMapComplete)
     {
-        ret = vscp_dm_ng_readRegister(page, addr);
-    }
-#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
+        uint8_t index   = 0;
+
+        /* Application specific registers up to the end of the page, if not
+         * limited by the next range.
+         */
+        *end = 0xff;
 
+        for(index = 0; index < vscp_core_regMapNum; ++index)
+        {
+            RegRange const * const  range   = &vscp_core_regMap[index];
+
+            if (page < range->page)
+            {
+                break;
+            }
+            else if (page > range->page)
+            {
+                continue;
+            }
+            else if (addr < range->start)
+            {
+                *end = range->start - 1;
+                break;
+            }
+            else if (addr <= range->end)
+            {
+                *end    = range->end;
+                owner   = range->owner;
+                break;
+            }
+        }
+    }
     else
-    /* Application specific register */
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_REG_MAP ) */
+
     {
-        ret = vscp_app_reg_readRegister(page, addr);
+        *end    = addr;
+        owner   = vscp_core_getRegOwner(page, addr);
     }
 
-    return ret;
+    return owner;
 }
 
 /**
- * Write to register.
+ * Read register and return its value.
  *
  * @param[in]   page    Page
  * @param[in]   addr    Register address
- * @param[in]   value   Value to write
- * @param[out]  failed  Write error is set to TRUE
  * @return  Register value
  */
-static uint8_t  vscp_core_writeRegister(uint16_t page, uint8_t addr, uint8_t value, /*@null@*/ BOOL* failed)
+static uint8_t  vscp_core_readRegister(uint16_t page, uint8_t addr)
 {
-    uint8_t ret     = 0;
-    BOOL    error   = TRUE;
+    uint8_t             end     = 0;
+    VSCP_CORE_REG_OWNER owner   = vscp_core_findRegRange(page, addr, &end);
 
-    /* Page 0 includes the VSCP specific registers. */
-    if ((0 == page) &&
-        (VSCP_REGISTER_VSCP_START_ADDR <= addr) &&
-        (VSCP_REGISTER_VSCP_END_ADDR >= addr))
+    return vscp_core_readRegisterOf(owner, page, addr);
+}
+
+/**
+ * Read several registers in a row. The owner is resolved only once per range.
+ * The registers must not exceed the page.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Address of the first register
+ * @param[out]  buffer  Buffer for the register values
+ * @param[in]   num     Number of registers to read
+ */
+static void vscp_core_readRegisters(uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t num)
+{
+    uint8_t     index   = 0;
+    uint16_t    regAddr = addr;
+
+    while(index < num)
     {
-        switch(addr)
-        {
-        case VSCP_REG_ALARM_STATUS:
-            /* Read only */
-            break;
+        uint8_t             end     = 0;
+        VSCP_CORE_REG_OWNER owner   = vscp_core_findRegRange(page, (uint8_t)regAddr, &end);
 
-        case VSCP_REG_VSCP_VERSION_MAJOR:
-            /* Read only */
+        do
+        {
+            buffer[index] = vscp_core_readRegisterOf(owner, page, (uint8_t)regAddr);
+            ++index;
+            ++regAddr;
+        }
+        while((index < num) && (end >= regAddr));
+    }
+
+    return;
+}
+
+/**
+ * Read register of the given owner and return its value.
+ *
+ * @param[in]   owner   Owner of the register
+ * @param[in]   page    Page
+ * @param[in]   addr    Register address
+ * @return  Register value
+ */
+static uint8_t  vscp_core_readRegisterOf(VSCP_CORE_REG_OWNER owner, uint16_t page, uint8_t addr)
+{
+    uint8_t ret = 0;
+
+    switch(owner)
+    {
+    case VSCP_CORE_REG_OWNER_VSCP:
+        ret = vscp_core_readRegisterVscp(addr);
+        break;
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM )
+    case VSCP_CORE_REG_OWNER_DM:
+        ret = vscp_dm_readRegister(page, addr);
+        break;
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION )
+    case VSCP_CORE_REG_OWNER_DM_NG:
+        ret = vscp_dm_ng_readRegister(page, addr);
+        break;
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
+
+    default:
+        /* Application specific register */
+        ret = vscp_app_reg_readRegister(page, addr);
+        break;
+    }
+
+    return ret;
+}
+
+/**
+ * Read a VSCP specific register (page 0) and return its value.
+ *
+ * @param[in]   addr    Register address
+ * @return  Register value
+ */
+static uint8_t  vscp_core_readRegisterVscp(uint8_t addr)
+{
+    uint8_t ret = 0;
+
+    switch(addr)
+    {
+        case VSCP_REG_ALARM_STATUS:
+            ret = vscp_core_regAlarmStatus;
+
+            /* Reset alarm */
+            vscp_core_regAlarmStatus = 0;
+            break;
+
+        case VSCP_REG_VSCP_VERSION_MAJOR:
+            ret = VSCP_CORE_VERSION_MAJOR;
             break;
 
         case VSCP_REG_VSCP_VERSION_MINOR:
-            /* Read only */
+            ret = VSCP_CORE_VERSION_MINOR;
             break;
 
         case VSCP_REG_NODE_CONTROL_FLAGS:
-            vscp_ps_writeNodeControlFlags(value);
             ret = vscp_ps_readNodeControlFlags();
-            error = FALSE;
             break;
 
         case VSCP_REG_USER_ID_0:
@@ -2044,9 +2797,7 @@ static uint8_t  vscp_core_writeRegister(uint16_t page, uint8_t addr, uint8_t val
         case VSCP_REG_USER_ID_3:
             /*@fallthrough@*/
         case VSCP_REG_USER_ID_4:
-            vscp_ps_writeUserId(addr - VSCP_REG_USER_ID_0, value);
             ret = vscp_ps_readUserId(addr - VSCP_REG_USER_ID_0);
-            error = FALSE;
             break;
 
         case VSCP_REG_MANUFACTURER_DEV_ID_0:
@@ -2056,7 +2807,7 @@ static uint8_t  vscp_core_writeRegister(uint16_t page, uint8_t addr, uint8_t val
         case VSCP_REG_MANUFACTURER_DEV_ID_2:
             /*@fallthrough@*/
         case VSCP_REG_MANUFACTURER_DEV_ID_3:
-            /* Read only */
+            ret = vscp_dev_data_getManufacturerDevId(addr - VSCP_REG_MANUFACTURER_DEV_ID_0);
             break;
 
         case VSCP_REG_MANUFACTURER_SUB_DEV_ID_0:
@@ -2066,49 +2817,47 @@ static uint8_t  vscp_core_writeRegister(uint16_t page, uint8_t addr, uint8_t val
         case VSCP_REG_MANUFACTURER_SUB_DEV_ID_2:
             /*@fallthrough@*/
         case VSCP_REG_MANUFACTURER_SUB_DEV_ID_3:
-            /* Read only */
+            ret = vscp_dev_data_getManufacturerSubDevId(addr - VSCP_REG_MANUFACTURER_SUB_DEV_ID_0);
             break;
 
         case VSCP_REG_NICKNAME_ID:
-            /* Read only */
+            ret = vscp_core_nickname;
             break;
 
         case VSCP_REG_PAGE_SELECT_MSB:
-            vscp_core_regPageSelect &= 0x00FF;
-            vscp_core_regPageSelect |= ((uint16_t)value) << 8;
             ret = VSCP_UTIL_WORD_MSB(vscp_core_regPageSelect);
-            error = FALSE;
             break;
 
         case VSCP_REG_PAGE_SELECT_LSB:
-            vscp_core_regPageSelect &= 0xFF00;
-            vscp_core_regPageSelect |= ((uint16_t)value) << 0;
             ret = VSCP_UTIL_WORD_LSB(vscp_core_regPageSelect);
-            error = FALSE;
             break;
 
         case VSCP_REG_FIRMWARE_VERSION_MAJOR:
-            /* Read only */
+            ret = vscp_dev_data_getFirmwareVersionMajor();
             break;
 
         case VSCP_REG_FIRMWARE_VERSION_MINOR:
-            /* Read only */
+            ret = vscp_dev_data_getFirmwareVersionMinor();
             break;
 
         case VSCP_REG_FIRMWARE_VERSION_SUB_MINOR:
-            /* Read only */
+            ret = vscp_dev_data_getFirmwareVersionSubMinor();
             break;
 
         case VSCP_REG_BOOT_LOADER_ALGORITHM:
-            /* Read only */
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BOOT_LOADER_SUPPORTED )
+            ret = vscp_portable_getBootLoaderAlgorithm();
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_BOOT_LOADER_SUPPORTED ) */
+            ret = 0xFF;
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_BOOT_LOADER_SUPPORTED ) */
             break;
 
         case VSCP_REG_BUFFER_SIZE:
-            /* Read only */
+            ret = VSCP_L1_DATA_SIZE;
             break;
 
         case VSCP_REG_PAGES_USED:
-            /* Read only */
+            ret = vscp_app_reg_getPagesUsed();
             break;
 
         case VSCP_REG_STD_DEV_FAMILY_CODE_3:
@@ -2118,7 +2867,7 @@ static uint8_t  vscp_core_writeRegister(uint16_t page, uint8_t addr, uint8_t val
         case VSCP_REG_STD_DEV_FAMILY_CODE_1:
             /*@fallthrough@*/
         case VSCP_REG_STD_DEV_FAMILY_CODE_0:
-            /* Read only */
+            ret = vscp_dev_data_getStdDevFamilyCode(3 - (addr - VSCP_REG_STD_DEV_FAMILY_CODE_3));
             break;
 
         case VSCP_REG_STD_DEV_TYPE_3:
@@ -2128,28 +2877,11 @@ static uint8_t  vscp_core_writeRegister(uint16_t page, uint8_t addr, uint8_t val
         case VSCP_REG_STD_DEV_TYPE_1:
             /*@fallthrough@*/
         case VSCP_REG_STD_DEV_TYPE_0:
-            /* Read only */
+            ret = vscp_dev_data_getStdDevType(3 - (addr - VSCP_REG_STD_DEV_TYPE_3));
             break;
 
         case VSCP_REG_RESTORE_STD_CFG:
-
-            /* 0x55 has to be written first, multi-frame timer is disabled. */
-            if ((0x55 == value) &&
-                (FALSE == vscp_timer_getStatus(vscp_core_timerIdReg162)))
-            {
-                vscp_timer_start(vscp_core_timerIdReg162, VSCP_CONFIG_MULTI_MSG_TIMEOUT);
-            }
-            /* 0xAA has to be written after 0x55 and within a specific time. */
-            else if ((0xAA == value) &&
-                     (TRUE == vscp_timer_getStatus(vscp_core_timerIdReg162)))
-            {
-                vscp_timer_stop(vscp_core_timerIdReg162);
-
-                /* Restore default settings */
-                vscp_core_restoreFactoryDefaultSettings();
-            }
-
-            error = FALSE;
+            /* Write only */
             break;
 
         case VSCP_REG_GUID_15:
@@ -2183,7 +2915,7 @@ static uint8_t  vscp_core_writeRegister(uint16_t page, uint8_t addr, uint8_t val
         case VSCP_REG_GUID_1:
             /*@fallthrough@*/
         case VSCP_REG_GUID_0:
-            /* Read only */
+            ret = vscp_dev_data_getGUID(15 - (addr - VSCP_REG_GUID_15));
             break;
 
         default:
@@ -2191,38 +2923,57 @@ static uint8_t  vscp_core_writeRegister(uint16_t page, uint8_t addr, uint8_t val
             if ((VSCP_REG_MDF_URL_BEGIN <= addr) &&
                 (VSCP_REG_MDF_URL_END >= addr))
             {
-                /* Read only */
-                ;
+                ret = vscp_dev_data_getMdfUrl(addr - VSCP_REG_MDF_URL_BEGIN);
             }
 
             break;
-        }
+    }
+
+    return ret;
+}
+
+/**
+ * Write to register.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Register address
+ * @param[in]   value   Value to write
+ * @param[out]  failed  Write error is set to TRUE
+ * @return  Register value
+ */
+static uint8_t  vscp_core_writeRegister(uint16_t page, uint8_t addr, uint8_t value, /*@null@*/ BOOL* failed)
+{
+    uint8_t             ret     = 0;
+    BOOL                error   = TRUE;
+    uint8_t             end     = 0;
+    VSCP_CORE_REG_OWNER owner   = vscp_core_findRegRange(page, addr, &end);
+
+    /* Page 0 includes the VSCP specific registers. */
+    if (VSCP_CORE_REG_OWNER_VSCP == owner)
+    {
+        ret = vscp_core_writeRegisterVscp(addr, value, &error);
     }
     /* Write protection disabled? */
     else if (0 != vscp_core_getRegAppWriteProtect())
     {
-    
-#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM )
-        /* Is the addressed register part of the decision matrix? */
-        if (FALSE != vscp_dm_isDecisionMatrix(page, addr))
+        switch(owner)
         {
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM )
+        case VSCP_CORE_REG_OWNER_DM:
             ret = vscp_dm_writeRegister(page, addr, value);
-        }
-        else
+            break;
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) */
 
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION )
-        /* Is the addressed register part of the decision matrix NG? */
-        if (FALSE != vscp_dm_ng_isDecisionMatrix(page, addr))
-        {
+        case VSCP_CORE_REG_OWNER_DM_NG:
             ret = vscp_dm_ng_writeRegister(page, addr, value);
-        }
-        else
+            break;
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
 
-        /* Application specific registers */
-        {
+        default:
+            /* Application specific registers */
             ret = vscp_app_reg_writeRegister(page, addr, value);
+            break;
         }
 
         error = FALSE;
@@ -2236,6 +2987,207 @@ static uint8_t  vscp_core_writeRegister(uint16_t page, uint8_t addr, uint8_t val
     return ret;
 }
 
+/**
+ * Write to a VSCP specific register (page 0).
+ *
+ * @param[in]   addr    Register address
+ * @param[in]   value   Value to write
+ * @param[out]  failed  Write error is set to TRUE
+ * @return  Register value
+ */
+static uint8_t  vscp_core_writeRegisterVscp(uint8_t addr, uint8_t value, BOOL * const failed)
+{
+    uint8_t ret     = 0;
+    BOOL    error   = TRUE;
+
+    switch(addr)
+    {
+    case VSCP_REG_ALARM_STATUS:
+        /* Read only */
+        break;
+
+    case VSCP_REG_VSCP_VERSION_MAJOR:
+        /* Read only */
+        break;
+
+    case VSCP_REG_VSCP_VERSION_MINOR:
+        /* Read only */
+        break;
+
+    case VSCP_REG_NODE_CONTROL_FLAGS:
+        vscp_ps_writeNodeControlFlags(value);
+        ret = vscp_ps_readNodeControlFlags();
+        error = FALSE;
+        break;
+
+    case VSCP_REG_USER_ID_0:
+        /*@fallthrough@*/
+    case VSCP_REG_USER_ID_1:
+        /*@fallthrough@*/
+    case VSCP_REG_USER_ID_2:
+        /*@fallthrough@*/
+    case VSCP_REG_USER_ID_3:
+        /*@fallthrough@*/
+    case VSCP_REG_USER_ID_4:
+        vscp_ps_writeUserId(addr - VSCP_REG_USER_ID_0, value);
+        ret = vscp_ps_readUserId(addr - VSCP_REG_USER_ID_0);
+        error = FALSE;
+        break;
+
+    case VSCP_REG_MANUFACTURER_DEV_ID_0:
+        /*@fallthrough@*/
+    case VSCP_REG_MANUFACTURER_DEV_ID_1:
+        /*@fallthrough@*/
+    case VSCP_REG_MANUFACTURER_DEV_ID_2:
+        /*@fallthrough@*/
+    case VSCP_REG_MANUFACTURER_DEV_ID_3:
+        /* Read only */
+        break;
+
+    case VSCP_REG_MANUFACTURER_SUB_DEV_ID_0:
+        /*@fallthrough@*/
+    case VSCP_REG_MANUFACTURER_SUB_DEV_ID_1:
+        /*@fallthrough@*/
+    case VSCP_REG_MANUFACTURER_SUB_DEV_ID_2:
+        /*@fallthrough@*/
+    case VSCP_REG_MANUFACTURER_SUB_DEV_ID_3:
+        /* Read only */
+        break;
+
+    case VSCP_REG_NICKNAME_ID:
+        /* Read only */
+        break;
+
+    case VSCP_REG_PAGE_SELECT_MSB:
+        vscp_core_regPageSelect &= 0x00FF;
+        vscp_core_regPageSelect |= ((uint16_t)value) << 8;
+        ret = VSCP_UTIL_WORD_MSB(vscp_core_regPageSelect);
+        error = FALSE;
+        break;
+
+    case VSCP_REG_PAGE_SELECT_LSB:
+        vscp_core_regPageSelect &= 0xFF00;
+        vscp_core_regPageSelect |= ((uint16_t)value) << 0;
+        ret = VSCP_UTIL_WORD_LSB(vscp_core_regPageSelect);
+        error = FALSE;
+        break;
+
+    case VSCP_REG_FIRMWARE_VERSION_MAJOR:
+        /* Read only */
+        break;
+
+    case VSCP_REG_FIRMWARE_VERSION_MINOR:
+        /* Read only */
+        break;
+
+    case VSCP_REG_FIRMWARE_VERSION_SUB_MINOR:
+        /* Read only */
+        break;
+
+    case VSCP_REG_BOOT_LOADER_ALGORITHM:
+        /* Read only */
+        break;
+
+    case VSCP_REG_BUFFER_SIZE:
+        /* Read only */
+        break;
+
+    case VSCP_REG_PAGES_USED:
+        /* Read only */
+        break;
+
+    case VSCP_REG_STD_DEV_FAMILY_CODE_3:
+        /*@fallthrough@*/
+    case VSCP_REG_STD_DEV_FAMILY_CODE_2:
+        /*@fallthrough@*/
+    case VSCP_REG_STD_DEV_FAMILY_CODE_1:
+        /*@fallthrough@*/
+    case VSCP_REG_STD_DEV_FAMILY_CODE_0:
+        /* Read only */
+        break;
+
+    case VSCP_REG_STD_DEV_TYPE_3:
+        /*@fallthrough@*/
+    case VSCP_REG_STD_DEV_TYPE_2:
+        /*@fallthrough@*/
+    case VSCP_REG_STD_DEV_TYPE_1:
+        /*@fallthrough@*/
+    case VSCP_REG_STD_DEV_TYPE_0:
+        /* Read only */
+        break;
+
+    case VSCP_REG_RESTORE_STD_CFG:
+
+        /* 0x55 has to be written first, multi-frame timer is disabled. */
+        if ((0x55 == value) &&
+            (FALSE == vscp_timer_getStatus(vscp_core_timerIdReg162)))
+        {
+            vscp_timer_start(vscp_core_timerIdReg162, VSCP_CONFIG_MULTI_MSG_TIMEOUT);
+        }
+        /* 0xAA has to be written after 0x55 and within a specific time. */
+        else if ((0xAA == value) &&
+                 (TRUE == vscp_timer_getStatus(vscp_core_timerIdReg162)))
+        {
+            vscp_timer_stop(vscp_core_timerIdReg162);
+
+            /* Restore default settings */
+            vscp_core_restoreFactoryDefaultSettings();
+        }
+
+        error = FALSE;
+        break;
+
+    case VSCP_REG_GUID_15:
+        /*@fallthrough@*/
+    case VSCP_REG_GUID_14:
+        /*@fallthrough@*/
+    case VSCP_REG_GUID_13:
+        /*@fallthrough@*/
+    case VSCP_REG_GUID_12:
+        /*@fallthrough@*/
+    case VSCP_REG_GUID_11:
+        /*@fallthrough@*/
+    case VSCP_REG_GUID_10:
+        /*@fallthrough@*/
+    case VSCP_REG_GUID_9:
+        /*@fallthrough@*/
+    case VSCP_REG_GUID_8:
+        /*@fallthrough@*/
+    case VSCP_REG_GUID_7:
+        /*@fallthrough@*/
+    case VSCP_REG_GUID_6:
+        /*@fallthrough@*/
+    case VSCP_REG_GUID_5:
+        /*@fallthrough@*/
+    case VSCP_REG_GUID_4:
+        /*@fallthrough@*/
+    case VSCP_REG_GUID_3:
+        /*@fallthrough@*/
+    case VSCP_REG_GUID_2:
+        /*@fallthrough@*/
+    case VSCP_REG_GUID_1:
+        /*@fallthrough@*/
+    case VSCP_REG_GUID_0:
+        /* Read only */
+        break;
+
+    default:
+
+        if ((VSCP_REG_MDF_URL_BEGIN <= addr) &&
+            (VSCP_REG_MDF_URL_END >= addr))
+        {
+            /* Read only */
+            ;
+        }
+
+        break;
+    }
+
+    *failed = error;
+
+    return ret;
+}
+
 /**
  * Handles a protocol class write register event.
  */
@@ -2440,7 +3392,6 @@ static inline void  vscp_core_handleProtocolPageRead(void)
             uint8_t         addr        = vscp_core_rxMessage.data[1];
             uint8_t         index       = 0;
             uint8_t         num         = vscp_core_rxMessage.data[2];
-            uint8_t         dataIndex   = 0;
 
             /* If the number of bytes to read overflows the page, it will be
              * limited to the page end.
@@ -2456,33 +3407,28 @@ static inline void  vscp_core_handleProtocolPageRead(void)
             txMessage.priority  = VSCP_PRIORITY_3_NORMAL;
             txMessage.oAddr     = vscp_core_nickname;
             txMessage.hardCoded = VSCP_CORE_HARD_CODED;
-            txMessage.dataNum   = VSCP_L1_DATA_SIZE;
 
             /* Sequence number */
-            txMessage.data[dataIndex] = 0;
-            ++dataIndex;
+            txMessage.data[0] = 0;
 
-            for(index = 0; index < num; ++index)
+            while(index < num)
             {
-                txMessage.data[dataIndex] = vscp_core_readRegister(vscp_core_regPageSelect, addr + index);
-                ++dataIndex;
+                uint8_t readNum = VSCP_L1_DATA_SIZE - 1;
 
-                if (VSCP_L1_DATA_SIZE <= dataIndex)
+                if ((num - index) < readNum)
                 {
-                    (void)vscp_transport_writeMessage(&txMessage);
-
-                    /* Increase sequence number and reset data index */
-                    dataIndex = 0;
-                    ++(txMessage.data[dataIndex]);
-                    ++dataIndex;
+                    readNum = num - index;
                 }
-            }
 
-            if (1 < dataIndex)
-            {
-                txMessage.dataNum = dataIndex;
+                vscp_core_readRegisters(vscp_core_regPageSelect, addr + index, &txMessage.data[1], readNum);
+                index += readNum;
+
+                txMessage.dataNum = 1 + readNum;
 
                 (void)vscp_transport_writeMessage(&txMessage);
+
+                /* Increase sequence number */
+                ++(txMessage.data[0]);
             }
         }
     }
@@ -2617,79 +3563,138 @@ static inline void  vscp_core_handleProtocolWhoIsThere(void)
     if (1 == vscp_core_rxMessage.dataNum)
     {
         /* This node? */
-        if ((vscp_core_nickname == vscp_core_rxMessage.data[0]) ||
-            (VSCP_NICKNAME_NOT_INIT == vscp_core_rxMessage.data[0]))
+        if (vscp_core_nickname == vscp_core_rxMessage.data[0])
         {
-            vscp_TxMessage  txMessage;
-            int8_t          sIndex      = 0;
-            uint8_t         uIndex      = 0;
-            uint8_t         dataIndex   = 0;
-            uint8_t         rowIndex    = 0;
+            vscp_core_sendWhoIsThereResponse();
+        }
+        /* All nodes? */
+        else if (VSCP_NICKNAME_NOT_INIT == vscp_core_rxMessage.data[0])
+        {
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_WHO_IS_THERE_STAGGER )
 
-            txMessage.vscpClass = VSCP_CLASS_L1_PROTOCOL;
-            txMessage.vscpType  = VSCP_TYPE_PROTOCOL_WHO_IS_THERE_RESPONSE;
-            txMessage.priority  = VSCP_PRIORITY_3_NORMAL;
-            txMessage.oAddr     = vscp_core_nickname;
-            txMessage.hardCoded = VSCP_CORE_HARD_CODED;
-            txMessage.dataNum   = 8;
+            /* All nodes will respond, therefore delay the response depended
+             * on the nickname id to avoid that all nodes send at once.
+             * A already pending response is not delayed again.
+             */
+            if (FALSE == vscp_core_whoIsTherePending)
+            {
+                vscp_core_whoIsTherePending = TRUE;
+                vscp_timer_start(vscp_core_timerIdWhoIsThere, (uint16_t)vscp_core_nickname * VSCP_CONFIG_WHO_IS_THERE_STAGGER_SLOT);
+            }
 
-            /* Row index */
-            txMessage.data[dataIndex] = rowIndex;
-            ++dataIndex;
-            ++rowIndex;
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_WHO_IS_THERE_STAGGER ) */
 
-            /* GUID */
-            for(sIndex = 15; sIndex >= 0; --sIndex)
-            {
-                txMessage.data[dataIndex] = vscp_dev_data_getGUID((uint8_t)sIndex);
-                ++dataIndex;
+            vscp_core_sendWhoIsThereResponse();
 
-                if (VSCP_L1_DATA_SIZE <= dataIndex)
-                {
-                    (void)vscp_transport_writeMessage(&txMessage);
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_WHO_IS_THERE_STAGGER ) */
+        }
+    }
 
-                    dataIndex = 0;
+    return;
+}
 
-                    /* Row index */
-                    txMessage.data[dataIndex] = rowIndex;
-                    ++dataIndex;
-                    ++rowIndex;
-                }
-            }
+/**
+ * Sends the who is there response. It consists of several frames with the
+ * row index in the first data byte, followed by the GUID (MSB first) and the
+ * MDF URL. The last frame is filled up with zeros.
+ */
+static void vscp_core_sendWhoIsThereResponse(void)
+{
+    vscp_TxMessage  txMessage;
+    uint8_t         rowIndex    = 0;
+    uint8_t         dataIndex   = 0;
+    uint8_t         index       = 0;
 
-            /* MDF */
-            for(uIndex = 0; uIndex < 32; ++uIndex)
-            {
-                txMessage.data[dataIndex] = vscp_dev_data_getMdfUrl(uIndex);
-                ++dataIndex;
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_WHO_IS_THERE_CACHE )
 
-                if (VSCP_L1_DATA_SIZE <= dataIndex)
-                {
-                    (void)vscp_transport_writeMessage(&txMessage);
+    if (FALSE == vscp_core_whoIsThereValid)
+    {
+        vscp_core_buildWhoIsThereCache();
+    }
 
-                    dataIndex = 0;
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_WHO_IS_THERE_CACHE ) */
 
-                    /* Row index */
-                    txMessage.data[dataIndex] = rowIndex;
-                    ++dataIndex;
-                    ++rowIndex;
-                }
-            }
+    txMessage.vscpClass = VSCP_CLASS_L1_PROTOCOL;
+    txMessage.vscpType  = VSCP_TYPE_PROTOCOL_WHO_IS_THERE_RESPONSE;
+    txMessage.priority  = VSCP_PRIORITY_3_NORMAL;
+    txMessage.oAddr     = vscp_core_nickname;
+    txMessage.hardCoded = VSCP_CORE_HARD_CODED;
+    txMessage.dataNum   = VSCP_L1_DATA_SIZE;
+
+    for(rowIndex = 0; rowIndex < VSCP_CORE_WHO_IS_THERE_FRAMES; ++rowIndex)
+    {
+        /* Row index */
+        txMessage.data[0] = rowIndex;
 
-            /* Fill up */
-            while(VSCP_L1_DATA_SIZE > dataIndex)
+        for(dataIndex = 1; dataIndex < VSCP_L1_DATA_SIZE; ++dataIndex)
+        {
+            if (VSCP_CORE_WHO_IS_THERE_DATA_SIZE > index)
+            {
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_WHO_IS_THERE_CACHE )
+                txMessage.data[dataIndex] = vscp_core_whoIsThereData[index];
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_WHO_IS_THERE_CACHE ) */
+                txMessage.data[dataIndex] = vscp_core_getWhoIsThereData(index);
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_WHO_IS_THERE_CACHE ) */
+                ++index;
+            }
+            else
             {
+                /* Fill up */
                 txMessage.data[dataIndex] = 0;
-                ++dataIndex;
             }
-
-            (void)vscp_transport_writeMessage(&txMessage);
         }
+
+        (void)vscp_transport_writeMessage(&txMessage);
+    }
+
+    return;
+}
+
+/**
+ * Get a single byte of the who is there response data, read from the device
+ * data. The GUID is provided MSB first, followed by the MDF URL.
+ *
+ * @param[in]   index   Index in the response data
+ * @return  Response data byte
+ */
+static uint8_t vscp_core_getWhoIsThereData(uint8_t index)
+{
+    uint8_t value   = 0;
+
+    if (VSCP_GUID_SIZE > index)
+    {
+        value = vscp_dev_data_getGUID(VSCP_GUID_SIZE - index - 1);
+    }
+    else if (VSCP_CORE_WHO_IS_THERE_DATA_SIZE > index)
+    {
+        value = vscp_dev_data_getMdfUrl(index - VSCP_GUID_SIZE);
+    }
+
+    return value;
+}
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_WHO_IS_THERE_CACHE )
+
+/**
+ * Reads the GUID and the MDF URL once from the device data and keeps them for
+ * the who is there response.
+ */
+static void vscp_core_buildWhoIsThereCache(void)
+{
+    uint8_t index   = 0;
+
+    for(index = 0; index < VSCP_CORE_WHO_IS_THERE_DATA_SIZE; ++index)
+    {
+        vscp_core_whoIsThereData[index] = vscp_core_getWhoIsThereData(index);
     }
 
+    vscp_core_whoIsThereValid = TRUE;
+
     return;
 }
 
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_WHO_IS_THERE_CACHE ) */
+
 /**
  * Handles a protocol class get decision matrix info event.
  */
@@ -2764,12 +3769,12 @@ static inline void  vscp_core_handleProtocolExtendedPageReadRegister(void)
                 vscp_core_extPageReadData.count = 1;
             }
 
-            /* Only one response will be sent now.
-             * If more responses are necessary, they will be sent in the following
+            /* The responses are sent at the end of the active state, up to
+             * VSCP_CONFIG_EXT_PAGE_READ_FRAMES per process cycle. If more
+             * responses are necessary, they will be sent in the following
              * process cycles. This avoids that the framework blocks the application
              * too long. And makes the node more responsive.
              */
-            vscp_core_extendedPageReadRegister(&vscp_core_extPageReadData);
         }
     }
 
@@ -2777,19 +3782,27 @@ static inline void  vscp_core_handleProtocolExtendedPageReadRegister(void)
 }
 
 /**
- * This function handles a extended page read register.
+ * This function handles a extended page read register. It sends responses as
+ * long as the transport layer accepts them, but not more than
+ * VSCP_CONFIG_EXT_PAGE_READ_FRAMES. If a response can't be sent, it will be
+ * sent again in the next process cycle.
  *
  * @param[in] data  Extended page read register data
  */
 static void vscp_core_extendedPageReadRegister(ExtPageRead * const data)
 {
-    if ((NULL != data) &&
-        (0 < data->count))
+    uint8_t frames  = 0;
+
+    if (NULL == data)
+    {
+        return;
+    }
+
+    while((0 < data->count) && (VSCP_CONFIG_EXT_PAGE_READ_FRAMES > frames))
     {
         vscp_TxMessage  txMessage;
-        uint8_t         index       = 0;
+        uint8_t         num         = VSCP_L1_DATA_SIZE - 4;
         uint8_t         addr        = data->addr;
-        uint16_t        count       = data->count;
         BOOL            nextPage    = FALSE;
 
         /* Prepare tx message */
@@ -2807,49 +3820,49 @@ static void vscp_core_extendedPageReadRegister(ExtPageRead * const data)
         txMessage.data[2] = (data->page >> 0) & 0xff;
         txMessage.data[3] = addr;
 
-        /* Read registers */
-        index = 4;
-        do
+        /* Limit the number of registers to the remaining ones */
+        if (data->count < num)
         {
-            txMessage.data[index] = vscp_core_readRegister(data->page, addr);
-            ++index;
-            --count;
+            num = (uint8_t)data->count;
+        }
 
-            /* If the read takes place on the next page, a new event shall be used,
-             * because the event parameter contains the page, where all read
-             * registers are located.
-             */
-            if (0xff > addr)
-            {
-                ++addr;
-            }
-            else
-            {
-                nextPage = TRUE;
-            }
+        /* If the read takes place on the next page, a new event shall be used,
+         * because the event parameter contains the page, where all read
+         * registers are located.
+         */
+        if ((0x100 - addr) <= num)
+        {
+            num         = (uint8_t)(0x100 - addr);
+            nextPage    = TRUE;
         }
-        while((VSCP_L1_DATA_SIZE > index) && (0 < count) && (FALSE == nextPage));
+
+        /* Read registers */
+        vscp_core_readRegisters(data->page, addr, &txMessage.data[4], num);
 
         /* Set event data size */
-        txMessage.dataNum = index;
+        txMessage.dataNum = 4 + num;
 
-        if (TRUE == vscp_transport_writeMessage(&txMessage))
+        /* Transport layer busy? Try again in the next process cycle. */
+        if (FALSE == vscp_transport_writeMessage(&txMessage))
         {
-            /* Continue on the next page? */
-            if (TRUE == nextPage)
-            {
-                ++data->page;
-                data->addr = 0;
-            }
-            /* Continue on the same page */
-            else
-            {
-                data->addr = addr;
-            }
+            break;
+        }
 
-            data->count = count;
-            ++data->seq;
+        /* Continue on the next page? */
+        if (TRUE == nextPage)
+        {
+            ++data->page;
+            data->addr = 0;
+        }
+        /* Continue on the same page */
+        else
+        {
+            data->addr = addr + num;
         }
+
+        data->count -= num;
+        ++data->seq;
+        ++frames;
     }
 
     return;
@@ -2914,6 +3927,177 @@ static inline void  vscp_core_handleProtocolExtendedPageWriteRegister(void)
     return;
 }
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST_RESPONSE )
+
+/**
+ * Handles a protocol class get event interest event.
+ *
+ * Every response contains the index in byte 0, followed by up to two entries
+ * of 3 bytes: class bit 8 (bit 7 set means all types), class bit 0-7 and type.
+ * A response with less than two entries is the last one.
+ * If the node is interested in all events or if the interest doesn't fit into
+ * 256 responses, no response will be sent.
+ */
+static inline void  vscp_core_handleProtocolGetEventInterest(void)
+{
+    /* Check number of parameters. */
+    if (1 == vscp_core_rxMessage.dataNum)
+    {
+        /* This node? */
+        if (vscp_core_nickname == vscp_core_rxMessage.data[0])
+        {
+            uint16_t    classNum    = vscp_interest_getClassNum();
+            uint16_t    typeNum     = vscp_interest_getTypeNum();
+            uint32_t    entryNum    = classNum;
+
+            if (VSCP_INTEREST_TYPE_NUM != typeNum)
+            {
+                entryNum *= typeNum;
+            }
+
+            if (((VSCP_INTEREST_CLASS_NUM != classNum) || (VSCP_INTEREST_TYPE_NUM != typeNum)) &&
+                ((2u * 256u) > entryNum))
+            {
+                vscp_core_eventInterestData.vscpClass   = 0;
+                vscp_core_eventInterestData.vscpType    = 0;
+                vscp_core_eventInterestData.index       = 0;
+                vscp_core_eventInterestData.allTypes    = (VSCP_INTEREST_TYPE_NUM == typeNum) ? TRUE : FALSE;
+                vscp_core_eventInterestData.isPending   = TRUE;
+
+                /* The responses are sent at the end of the active state, up to
+                 * VSCP_CONFIG_EVENT_INTEREST_FRAMES per process cycle. If more
+                 * responses are necessary or the transport layer is busy, they
+                 * will be sent in the following process cycles.
+                 */
+            }
+        }
+    }
+
+    return;
+}
+
+/**
+ * This function sends get event interest responses as long as the transport
+ * layer accepts them, but not more than VSCP_CONFIG_EVENT_INTEREST_FRAMES.
+ * If a response can't be sent, it will be sent again in the next process
+ * cycle.
+ *
+ * @param[in] data  Get event interest data
+ */
+static void vscp_core_eventInterestResponse(EventInterestRead * const data)
+{
+    uint8_t frames  = 0;
+
+    if (NULL == data)
+    {
+        return;
+    }
+
+    while((FALSE != data->isPending) && (VSCP_CONFIG_EVENT_INTEREST_FRAMES > frames))
+    {
+        vscp_TxMessage  txMessage;
+        uint16_t        vscpClass   = data->vscpClass;
+        uint16_t        vscpType    = data->vscpType;
+        uint8_t         entries     = 0;
+
+        txMessage.vscpClass = VSCP_CLASS_L1_PROTOCOL;
+        txMessage.vscpType  = VSCP_TYPE_PROTOCOL_GET_EVENT_INTEREST_RESPONSE;
+        txMessage.priority  = VSCP_PRIORITY_3_NORMAL;
+        txMessage.oAddr     = vscp_core_nickname;
+        txMessage.hardCoded = VSCP_CORE_HARD_CODED;
+        txMessage.dataNum   = 1;
+        txMessage.data[0]   = data->index;
+
+        /* Up to two entries per response */
+        while((2 > entries) &&
+              (FALSE != vscp_core_findEventInterest(&vscpClass, &vscpType, data->allTypes)))
+        {
+            if (FALSE != data->allTypes)
+            {
+                txMessage.data[txMessage.dataNum + 0] = 0x80 | (uint8_t)((vscpClass >> 8) & 0x01);
+                txMessage.data[txMessage.dataNum + 1] = (uint8_t)(vscpClass & 0xff);
+                txMessage.data[txMessage.dataNum + 2] = 0;
+
+                /* One entry covers all types. */
+                ++vscpClass;
+                vscpType = 0;
+            }
+            else
+            {
+                txMessage.data[txMessage.dataNum + 0] = (uint8_t)((vscpClass >> 8) & 0x01);
+                txMessage.data[txMessage.dataNum + 1] = (uint8_t)(vscpClass & 0xff);
+                txMessage.data[txMessage.dataNum + 2] = (uint8_t)vscpType;
+
+                ++vscpType;
+            }
+
+            txMessage.dataNum += 3;
+            ++entries;
+        }
+
+        /* Transport layer busy? Try again in the next process cycle. */
+        if (FALSE == vscp_transport_writeMessage(&txMessage))
+        {
+            break;
+        }
+
+        /* The last response has less than two entries. */
+        if (2 > entries)
+        {
+            data->isPending = FALSE;
+        }
+
+        data->vscpClass = vscpClass;
+        data->vscpType  = vscpType;
+        ++data->index;
+        ++frames;
+    }
+
+    return;
+}
+
+/**
+ * This function searches the next class/type of interest, starting at the
+ * given class/type.
+ *
+ * @param[in,out]   vscpClass   Class, where the search starts
+ * @param[in,out]   vscpType    Type, where the search starts
+ * @param[in]       allTypes    One entry per class covers all types
+ * @return  Found or not
+ * @retval  FALSE   No further interest
+ * @retval  TRUE    Class/type of interest found
+ */
+static BOOL vscp_core_findEventInterest(uint16_t * const vscpClass, uint16_t * const vscpType, BOOL allTypes)
+{
+    while(VSCP_INTEREST_CLASS_NUM > *vscpClass)
+    {
+        if (FALSE != vscp_interest_isClass(*vscpClass))
+        {
+            if (FALSE != allTypes)
+            {
+                return TRUE;
+            }
+
+            while(VSCP_INTEREST_TYPE_NUM > *vscpType)
+            {
+                if (FALSE != vscp_interest_isType((uint8_t)*vscpType))
+                {
+                    return TRUE;
+                }
+
+                ++(*vscpType);
+            }
+        }
+
+        ++(*vscpClass);
+        *vscpType = 0;
+    }
+
+    return FALSE;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST_RESPONSE ) */
+
 /**
  * Get start up control information.
  *
@@ -199,6 +199,14 @@ extern uint32_t vscp_core_getTimeSinceEpoch(void);
  */
 extern void vscp_core_setTimeSinceEpoch(uint32_t timestamp);
 
+/**
+ * This function invalidates the prepared who is there response. Call it
+ * every time the GUID or the MDF URL is changed, e.g. written directly to the
+ * persistent memory. The response is prepared again with the next who is
+ * there request.
+ */
+extern void vscp_core_invalidateWhoIsThere(void);
+
 /**
  * Prepares a transmit message, before it is used.
  *
@@ -229,6 +237,17 @@ extern void vscp_core_prepareTxMessage(vscp_TxMessage * const txMessage, uint16_
  */
 extern BOOL vscp_core_sendEvent(vscp_TxMessage const * const txMessage);
 
+/**
+ * Send several events to the communication bus at once. The events are sent
+ * in order, until the first one is not accepted. If the transport layer
+ * adapter supports it, all events are passed to it in one call.
+ *
+ * @param[in]   txMessages  The events which will be sent.
+ * @param[in]   num         Number of events
+ * @return Number of accepted events
+ */
+extern uint8_t vscp_core_sendEvents(vscp_TxMessage const * const txMessages, uint8_t num);
+
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_HEARTBEAT_NODE )
 
 /**
@@ -50,6 +50,15 @@
     CONSTANTS
 *******************************************************************************/
 
+/** Maximum number of decimals, supported by the floating point conversion. */
+#define VSCP_DATA_CODING_FLOAT_DECIMALS_MAX ((uint8_t)7)
+
+/** Maximum number of decimal digits of a 32 bit value. */
+#define VSCP_DATA_CODING_DIGITS_MAX         ((uint8_t)10)
+
+/** Maximum exponent magnitude of the normalized integer format. */
+#define VSCP_DATA_CODING_EXP_MAX            ((int8_t)127)
+
 /*******************************************************************************
     MACROS
 *******************************************************************************/
@@ -68,6 +77,26 @@ static inline uint8_t vscp_data_coding_getNormalizerByte(uint8_t sign, uint8_t m
     LOCAL VARIABLES
 *******************************************************************************/
 
+/** Powers of ten of all decimal digits of a 32 bit value, highest first. */
+static const uint32_t   vscp_data_coding_pow10[VSCP_DATA_CODING_DIGITS_MAX] =
+{
+    1000000000u, 100000000u, 10000000u, 1000000u, 100000u, 10000u, 1000u, 100u, 10u, 1u
+};
+
+/** Floating point powers of ten, used to scale a value by the number of decimals. */
+static const float      vscp_data_coding_pow10Float[VSCP_DATA_CODING_FLOAT_DECIMALS_MAX + 1] =
+{
+    1.0f, 10.0f, 100.0f, 1000.0f, 10000.0f, 100000.0f, 1000000.0f, 10000000.0f
+};
+
+/** Divisors to strip trailing decimal zeros, with the corresponding exponent.
+ * Up to 15 trailing zeros are stripped with 4 steps, like a binary search.
+ */
+static const uint32_t   vscp_data_coding_zeroDivisor[]  = { 100000000u, 10000u, 100u, 10u };
+
+/** Exponent of the divisors in vscp_data_coding_zeroDivisor. */
+static const int8_t     vscp_data_coding_zeroExp[]      = { 8, 4, 2, 1 };
+
 /*******************************************************************************
     GLOBAL VARIABLES
 *******************************************************************************/
@@ -308,6 +337,398 @@ extern void vscp_data_coding_normalizedIntegerToInt32(uint8_t const * const code
     return;
 }
 
+/**
+ * This function returns the data in the shortest normalized integer format,
+ * which represents the value exactly. Trailing decimal zeros of the data are
+ * moved to the exponent.
+ * Note, there is not format byte at the head of the coded data.
+ *
+ * Examples:
+ * -  data = 3300, exp = -2  => data =  33, exp = 0
+ * -  data = 120000, exp = 0 => data =  12, exp = 4
+ *
+ * @param[in]       data            The data value
+ * @param[in]       exp             The data exponent
+ * @param[in,out]   codedData       The coded data array
+ * @param[in]       codedDataSize   The size of the coded data array
+ * @return Used coded data size
+ */
+extern uint8_t vscp_data_coding_int32ToBestNormalizedInteger(int32_t data, int8_t exp, uint8_t * const codedData, uint8_t codedDataSize)
+{
+    vscp_data_coding_normalize(&data, &exp);
+
+    return vscp_data_coding_int32ToNormalizedInteger(data, exp, codedData, codedDataSize);
+}
+
+/**
+ * This function moves trailing decimal zeros of the data to the exponent.
+ * The value itself keeps unchanged, but the data needs less bytes in the
+ * normalized integer format. A data of 0 gets the exponent 0.
+ *
+ * Example:
+ * -  data = 3300, exp = -2  => data =  33, exp = 0
+ *
+ * @param[in,out]   data    The data value
+ * @param[in,out]   exp     The data exponent
+ */
+extern void vscp_data_coding_normalize(int32_t * const data, int8_t * const exp)
+{
+    uint8_t index   = 0;
+
+    if ((NULL == data) ||
+        (NULL == exp))
+    {
+        return;
+    }
+
+    if (0 == *data)
+    {
+        *exp = 0;
+        return;
+    }
+
+    for(index = 0; index < (sizeof(vscp_data_coding_zeroDivisor) / sizeof(vscp_data_coding_zeroDivisor[0])); ++index)
+    {
+        if ((0 == (*data % (int32_t)vscp_data_coding_zeroDivisor[index])) &&
+            ((VSCP_DATA_CODING_EXP_MAX - vscp_data_coding_zeroExp[index]) >= *exp))
+        {
+            *data /= (int32_t)vscp_data_coding_zeroDivisor[index];
+            *exp  += vscp_data_coding_zeroExp[index];
+        }
+    }
+
+    return;
+}
+
+/**
+ * This function returns a floating point value in the shortest normalized
+ * integer format. The value is rounded to the given number of decimals.
+ * Note, there is not format byte at the head of the coded data.
+ *
+ * @param[in]       value           The value
+ * @param[in]       decimals        Number of decimals [0; 7]
+ * @param[in,out]   codedData       The coded data array
+ * @param[in]       codedDataSize   The size of the coded data array
+ * @return Used coded data size (0 if the value doesn't fit into 32 bit)
+ */
+extern uint8_t vscp_data_coding_floatToNormalizedInteger(float value, uint8_t decimals, uint8_t * const codedData, uint8_t codedDataSize)
+{
+    int32_t data    = 0;
+
+    if (VSCP_DATA_CODING_FLOAT_DECIMALS_MAX < decimals)
+    {
+        decimals = VSCP_DATA_CODING_FLOAT_DECIMALS_MAX;
+    }
+
+    value *= vscp_data_coding_pow10Float[decimals];
+
+    /* Round half away from zero */
+    if (0.0f > value)
+    {
+        value -= 0.5f;
+    }
+    else
+    {
+        value += 0.5f;
+    }
+
+    /* Out of range or not a number? */
+    if (!((-2147483648.0f <= value) && (2147483520.0f >= value)))
+    {
+        return 0;
+    }
+
+    data = (int32_t)value;
+
+    return vscp_data_coding_int32ToBestNormalizedInteger(data, -(int8_t)decimals, codedData, codedDataSize);
+}
+
+/**
+ * This function returns a floating point value in the IEEE-754 single
+ * precision format, MSB first.
+ * Note, there is not format byte at the head of the coded data.
+ *
+ * @param[in]       value           The value
+ * @param[in,out]   codedData       The coded data array
+ * @param[in]       codedDataSize   The size of the coded data array
+ * @return Used coded data size
+ */
+extern uint8_t vscp_data_coding_floatToFloatingPoint(float value, uint8_t * const codedData, uint8_t codedDataSize)
+{
+    union
+    {
+        float       value;
+        uint32_t    raw;
+
+    } convert;
+
+    if ((NULL == codedData) ||
+        (4 > codedDataSize))
+    {
+        return 0;
+    }
+
+    convert.value = value;
+
+    codedData[0] = (uint8_t)((convert.raw >> 24) & 0xff);
+    codedData[1] = (uint8_t)((convert.raw >> 16) & 0xff);
+    codedData[2] = (uint8_t)((convert.raw >>  8) & 0xff);
+    codedData[3] = (uint8_t)((convert.raw >>  0) & 0xff);
+
+    return 4;
+}
+
+/**
+ * This function returns the IEEE-754 single precision format as floating
+ * point value.
+ * Note, there is shall not be a format byte at the head of the coded data.
+ *
+ * @param[in]   codedData       The coded data array
+ * @param[in]   codedDataSize   The size of the coded data array
+ * @param[out]  value           The value
+ * @return Valid coded data or not
+ * @retval FALSE    Invalid coded data
+ * @retval TRUE     Valid coded data
+ */
+extern BOOL vscp_data_coding_floatingPointToFloat(uint8_t const * const codedData, uint8_t codedDataSize, float * const value)
+{
+    union
+    {
+        float       value;
+        uint32_t    raw;
+
+    } convert;
+
+    if ((NULL == codedData) ||
+        (NULL == value) ||
+        (4 != codedDataSize))
+    {
+        return FALSE;
+    }
+
+    convert.raw  = ((uint32_t)codedData[0]) << 24;
+    convert.raw |= ((uint32_t)codedData[1]) << 16;
+    convert.raw |= ((uint32_t)codedData[2]) <<  8;
+    convert.raw |= ((uint32_t)codedData[3]) <<  0;
+
+    *value = convert.value;
+
+    return TRUE;
+}
+
+/**
+ * This function returns the data as ASCII numerical string, without string
+ * termination.
+ * Note, there is not format byte at the head of the coded data.
+ *
+ * Examples:
+ * -  data =  22, exp = -1 => "2.2"
+ * -  data = -5,  exp = -2 => "-0.05"
+ * -  data =  33, exp =  1 => "330"
+ *
+ * @param[in]       data            The data value
+ * @param[in]       exp             The data exponent
+ * @param[in,out]   codedData       The coded data array
+ * @param[in]       codedDataSize   The size of the coded data array
+ * @return Used coded data size (0 if the string doesn't fit)
+ */
+extern uint8_t vscp_data_coding_int32ToString(int32_t data, int8_t exp, uint8_t * const codedData, uint8_t codedDataSize)
+{
+    uint8_t     digits[VSCP_DATA_CODING_DIGITS_MAX];
+    uint8_t     digitsNum       = 0;
+    uint32_t    magnitude       = (0 > data) ? (0u - (uint32_t)data) : (uint32_t)data;
+    uint8_t     index           = 0;
+    uint8_t     decimals        = (0 > exp) ? (uint8_t)(-exp) : 0;
+    uint8_t     zeros           = (0 < exp) ? (uint8_t)exp : 0;
+    uint8_t     intDigits       = 0;
+    uint16_t    neededSize      = 0;
+    uint8_t     codedDataIndex  = 0;
+
+    if (NULL == codedData)
+    {
+        return 0;
+    }
+
+    /* Determine the digits by subtracting the powers of ten, which avoids
+     * a division per digit.
+     */
+    for(index = 0; index < VSCP_DATA_CODING_DIGITS_MAX; ++index)
+    {
+        uint8_t digit   = 0;
+
+        while(vscp_data_coding_pow10[index] <= magnitude)
+        {
+            magnitude -= vscp_data_coding_pow10[index];
+            ++digit;
+        }
+
+        /* Skip leading zeros, but keep at least one digit. */
+        if ((0 < digitsNum) ||
+            (0 < digit) ||
+            ((VSCP_DATA_CODING_DIGITS_MAX - 1) == index))
+        {
+            digits[digitsNum] = digit;
+            ++digitsNum;
+        }
+    }
+
+    /* Digits before the decimal point, at least a single 0 */
+    intDigits = (digitsNum > decimals) ? (digitsNum - decimals) : 1;
+
+    /* Calculate needed coded data size */
+    neededSize = (0 > data) ? 1 : 0;
+    neededSize += intDigits + zeros;
+
+    if (0 < decimals)
+    {
+        neededSize += 1 + decimals;
+    }
+
+    /* Check given coded data size */
+    if (codedDataSize < neededSize)
+    {
+        /* Abort */
+        return 0;
+    }
+
+    if (0 > data)
+    {
+        codedData[codedDataIndex] = '-';
+        ++codedDataIndex;
+    }
+
+    /* Integer part */
+    if (digitsNum > decimals)
+    {
+        for(index = 0; index < intDigits; ++index)
+        {
+            codedData[codedDataIndex] = '0' + digits[index];
+            ++codedDataIndex;
+        }
+    }
+    else
+    {
+        codedData[codedDataIndex] = '0';
+        ++codedDataIndex;
+    }
+
+    /* Positive exponent */
+    for(index = 0; index < zeros; ++index)
+    {
+        codedData[codedDataIndex] = '0';
+        ++codedDataIndex;
+    }
+
+    /* Fraction */
+    if (0 < decimals)
+    {
+        codedData[codedDataIndex] = '.';
+        ++codedDataIndex;
+
+        for(index = digitsNum; index < decimals; ++index)
+        {
+            codedData[codedDataIndex] = '0';
+            ++codedDataIndex;
+        }
+
+        for(index = (digitsNum > decimals) ? intDigits : 0; index < digitsNum; ++index)
+        {
+            codedData[codedDataIndex] = '0' + digits[index];
+            ++codedDataIndex;
+        }
+    }
+
+    return codedDataIndex;
+}
+
+/**
+ * This function returns the ASCII numerical string in integer form.
+ * Note, there is shall not be a format byte at the head of the coded data.
+ *
+ * @param[in]   codedData       The coded data array
+ * @param[in]   codedDataSize   The size of the coded data array
+ * @param[out]  data            The data value
+ * @param[out]  exp             The data exponent
+ * @return Valid coded data or not
+ * @retval FALSE    Invalid coded data
+ * @retval TRUE     Valid coded data
+ */
+extern BOOL vscp_data_coding_stringToInt32(uint8_t const * const codedData, uint8_t codedDataSize, int32_t* const data, int8_t* const exp)
+{
+    uint8_t     codedDataIndex  = 0;
+    BOOL        isNegative      = FALSE;
+    BOOL        isFraction      = FALSE;
+    BOOL        hasDigit        = FALSE;
+    uint32_t    magnitude       = 0;
+    int8_t      decimals        = 0;
+
+    if ((NULL == codedData) ||
+        (NULL == data) ||
+        (NULL == exp))
+    {
+        return FALSE;
+    }
+
+    *data = 0;
+    *exp  = 0;
+
+    /* Sign */
+    if ((0 < codedDataSize) &&
+        (('-' == codedData[0]) || ('+' == codedData[0])))
+    {
+        isNegative = ('-' == codedData[0]) ? TRUE : FALSE;
+        ++codedDataIndex;
+    }
+
+    for(; codedDataIndex < codedDataSize; ++codedDataIndex)
+    {
+        uint8_t character = codedData[codedDataIndex];
+
+        if (('.' == character) &&
+            (FALSE == isFraction))
+        {
+            isFraction = TRUE;
+        }
+        else if (('0' <= character) && ('9' >= character))
+        {
+            /* The next digit would exceed the 32 bit range. */
+            if ((0x80000000u / 10u) < magnitude)
+            {
+                return FALSE;
+            }
+
+            /* magnitude * 10 by shift and add */
+            magnitude = (magnitude << 3) + (magnitude << 1) + (uint32_t)(character - '0');
+            hasDigit  = TRUE;
+
+            if (FALSE != isFraction)
+            {
+                ++decimals;
+            }
+        }
+        else
+        {
+            return FALSE;
+        }
+    }
+
+    if (FALSE == hasDigit)
+    {
+        return FALSE;
+    }
+
+    if (((FALSE == isNegative) && (0x7fffffffu < magnitude)) ||
+        ((FALSE != isNegative) && (0x80000000u < magnitude)))
+    {
+        return FALSE;
+    }
+
+    *data = (FALSE != isNegative) ? (int32_t)(0u - magnitude) : (int32_t)magnitude;
+    *exp  = -decimals;
+
+    return TRUE;
+}
+
 /*******************************************************************************
     LOCAL FUNCTIONS
 *******************************************************************************/
@@ -145,6 +145,108 @@ extern uint8_t vscp_data_coding_int32ToNormalizedInteger(int32_t data, int8_t ex
  */
 extern void vscp_data_coding_normalizedIntegerToInt32(uint8_t const * const codedData, uint8_t codedDataSize, int32_t* const data, int8_t* const exp);
 
+/**
+ * This function returns the data in the shortest normalized integer format,
+ * which represents the value exactly. Trailing decimal zeros of the data are
+ * moved to the exponent.
+ * Note, there is not format byte at the head of the coded data.
+ *
+ * Examples:
+ * -  data = 3300, exp = -2  => data =  33, exp = 0
+ * -  data = 120000, exp = 0 => data =  12, exp = 4
+ *
+ * @param[in]       data            The data value
+ * @param[in]       exp             The data exponent
+ * @param[in,out]   codedData       The coded data array
+ * @param[in]       codedDataSize   The size of the coded data array
+ * @return Used coded data size
+ */
+extern uint8_t vscp_data_coding_int32ToBestNormalizedInteger(int32_t data, int8_t exp, uint8_t * const codedData, uint8_t codedDataSize);
+
+/**
+ * This function moves trailing decimal zeros of the data to the exponent.
+ * The value itself keeps unchanged, but the data needs less bytes in the
+ * normalized integer format. A data of 0 gets the exponent 0.
+ *
+ * Example:
+ * -  data = 3300, exp = -2  => data =  33, exp = 0
+ *
+ * @param[in,out]   data    The data value
+ * @param[in,out]   exp     The data exponent
+ */
+extern void vscp_data_coding_normalize(int32_t * const data, int8_t * const exp);
+
+/**
+ * This function returns a floating point value in the shortest normalized
+ * integer format. The value is rounded to the given number of decimals.
+ * Note, there is not format byte at the head of the coded data.
+ *
+ * @param[in]       value           The value
+ * @param[in]       decimals        Number of decimals [0; 7]
+ * @param[in,out]   codedData       The coded data array
+ * @param[in]       codedDataSize   The size of the coded data array
+ * @return Used coded data size (0 if the value doesn't fit into 32 bit)
+ */
+extern uint8_t vscp_data_coding_floatToNormalizedInteger(float value, uint8_t decimals, uint8_t * const codedData, uint8_t codedDataSize);
+
+/**
+ * This function returns a floating point value in the IEEE-754 single
+ * precision format, MSB first.
+ * Note, there is not format byte at the head of the coded data.
+ *
+ * @param[in]       value           The value
+ * @param[in,out]   codedData       The coded data array
+ * @param[in]       codedDataSize   The size of the coded data array
+ * @return Used coded data size
+ */
+extern uint8_t vscp_data_coding_floatToFloatingPoint(float value, uint8_t * const codedData, uint8_t codedDataSize);
+
+/**
+ * This function returns the IEEE-754 single precision format as floating
+ * point value.
+ * Note, there is shall not be a format byte at the head of the coded data.
+ *
+ * @param[in]   codedData       The coded data array
+ * @param[in]   codedDataSize   The size of the coded data array
+ * @param[out]  value           The value
+ * @return Valid coded data or not
+ * @retval FALSE    Invalid coded data
+ * @retval TRUE     Valid coded data
+ */
+extern BOOL vscp_data_coding_floatingPointToFloat(uint8_t const * const codedData, uint8_t codedDataSize, float * const value);
+
+/**
+ * This function returns the data as ASCII numerical string, without string
+ * termination.
+ * Note, there is not format byte at the head of the coded data.
+ *
+ * Examples:
+ * -  data =  22, exp = -1 => "2.2"
+ * -  data = -5,  exp = -2 => "-0.05"
+ * -  data =  33, exp =  1 => "330"
+ *
+ * @param[in]       data            The data value
+ * @param[in]       exp             The data exponent
+ * @param[in,out]   codedData       The coded data array
+ * @param[in]       codedDataSize   The size of the coded data array
+ * @return Used coded data size (0 if the string doesn't fit)
+ */
+extern uint8_t vscp_data_coding_int32ToString(int32_t data, int8_t exp, uint8_t * const codedData, uint8_t codedDataSize);
+
+/**
+ * This function returns the ASCII numerical string in integer form.
+ * Note, there is shall not be a format byte at the head of the coded data.
+ *
+ * @param[in]   codedData       The coded data array
+ * @param[in]   codedDataSize   The size of the coded data array
+ * @param[out]  data            The data value
+ * @param[out]  exp             The data exponent
+ * @return Valid coded data or not
+ * @retval FALSE    Invalid coded data
+ * @retval TRUE     Valid coded data
+ */
+extern BOOL vscp_data_coding_stringToInt32(uint8_t const * const codedData, uint8_t codedDataSize, int32_t* const data, int8_t* const exp);
+
 #ifdef __cplusplus
 }
 #endif
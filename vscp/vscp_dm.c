@@ -45,6 +45,7 @@
 #include "vscp_util.h"
 #include "vscp_dev_data.h"
 #include "vscp_ps.h"
+#include "vscp_interest.h"
 
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM )
 
@@ -219,6 +220,13 @@ extern void vscp_dm_restoreFactoryDefaultSettings(void)
 
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION ) */
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST )
+
+    /* The decision matrix changed, which may change the event interest too. */
+    vscp_interest_invalidate();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST ) */
+
     return;
 }
 
@@ -305,15 +313,33 @@ extern uint8_t  vscp_dm_readRegister(uint16_t page, uint8_t addr)
  */
 extern uint8_t  vscp_dm_writeRegister(uint16_t page, uint8_t addr, uint8_t value)
 {
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST )
+
+    uint8_t oldValue    = vscp_dm_readRegister(page, addr);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST ) */
+
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_PAGED_FEATURE )
 
-    return vscp_dm_writeRegisterPagedFeature(page, addr, value);
+    value = vscp_dm_writeRegisterPagedFeature(page, addr, value);
 
 #else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_DM_PAGED_FEATURE ) */
 
-    return vscp_dm_writeRegisterStd(page, addr, value);
+    value = vscp_dm_writeRegisterStd(page, addr, value);
 
 #endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_DM_PAGED_FEATURE ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST )
+
+    /* A changed decision matrix may change the event interest too. */
+    if (oldValue != value)
+    {
+        vscp_interest_invalidate();
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST ) */
+
+    return value;
 }
 
 /**
@@ -331,6 +357,16 @@ extern void vscp_dm_executeActions(vscp_RxMessage const * const msg)
         return;
     }
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST )
+
+    /* No row can match, if the event is not of interest. */
+    if (FALSE == vscp_interest_isInterested(msg->vscpClass, msg->vscpType))
+    {
+        return;
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST ) */
+
     /* Walk through all decision matrix rows and execute the triggered ones. */
     for(index = 0; index < VSCP_CONFIG_DM_ROWS; ++index)
     {
@@ -575,6 +611,55 @@ extern void vscp_dm_executeActions(vscp_RxMessage const * const msg)
     return;
 }
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST )
+
+/**
+ * This function adds the classes and types of all enabled decision matrix
+ * rows to the event interest.
+ */
+extern void vscp_dm_addEventInterest(void)
+{
+    uint8_t index   = 0;
+
+    for(index = 0; index < VSCP_CONFIG_DM_ROWS; ++index)
+    {
+        uint16_t            classMask   = 0;
+        uint16_t            classFilter = 0;
+        vscp_dm_MatrixRow   row         = { 0, 0, 0, 0, 0, 0, 0, 0 };
+
+        vscp_dm_readDecisionMatrix(&row, index);
+
+        /* Decision matrix row disabled or no action? */
+        if ((0 == (row.flags & VSCP_DM_FLAG_ENABLE)) ||
+            (VSCP_DM_ACTION_NO_OPERATION == row.action))
+        {
+            /* Next row */
+            continue;
+        }
+
+        /* Build class mask and filter */
+        classMask   = row.classMask;
+
+        if (0 != (row.flags & VSCP_DM_FLAG_CLASS_MASK_BIT8))
+        {
+            classMask |= (uint16_t)0x0100;
+        }
+
+        classFilter = row.classFilter;
+
+        if (0 != (row.flags & VSCP_DM_FLAG_CLASS_FILTER_BIT8))
+        {
+            classFilter |= (uint16_t)0x0100;
+        }
+
+        vscp_interest_add(classMask, classFilter, row.typeMask, row.typeFilter);
+    }
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST ) */
+
 /*******************************************************************************
     LOCAL FUNCTIONS
 *******************************************************************************/
@@ -260,6 +260,16 @@ extern uint8_t  vscp_dm_writeRegister(uint16_t page, uint8_t addr, uint8_t value
  */
 extern void vscp_dm_executeActions(vscp_RxMessage const * const msg);
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST )
+
+/**
+ * This function adds the classes and types of all enabled decision matrix
+ * rows to the event interest.
+ */
+extern void vscp_dm_addEventInterest(void);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST ) */
+
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) */
 
 #ifdef __cplusplus
@@ -44,6 +44,7 @@
 #include "vscp_util.h"
 #include "vscp_action.h"
 #include "vscp_ps.h"
+#include "vscp_interest.h"
 #include <stdint.h>
 
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION )
@@ -148,6 +149,12 @@ static BOOL vscp_dm_ng_compare(VSCP_DM_NG_BASIC_OP basicOp, uint16_t eventParVal
 static VSCP_DM_NG_RET   vscp_dm_ng_getFirstRule(uint8_t * const rule, uint8_t maxSize);
 extern VSCP_DM_NG_RET   vscp_dm_ng_getNextRule(uint8_t * const rule, uint8_t maxSize);
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST )
+
+static void vscp_dm_ng_addConditionInterest(uint8_t const * const rulePart, uint8_t size);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST ) */
+
 /*******************************************************************************
     LOCAL VARIABLES
 *******************************************************************************/
@@ -208,6 +215,13 @@ extern void vscp_dm_ng_restoreFactoryDefaultSettings(void)
         vscp_ps_writeDMNextGeneration(index, 0);
     }
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST )
+
+    /* The rule set changed, which may change the event interest too. */
+    vscp_interest_invalidate();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST ) */
+
     return;
 }
 
@@ -288,12 +302,34 @@ extern uint8_t  vscp_dm_ng_writeRegister(uint16_t page, uint8_t addr, uint8_t va
     
     if (VSCP_DM_NG_START_PAGE <= page)
     {
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST )
+
+        uint8_t oldValue    = 0;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST ) */
+
         index = (page - VSCP_DM_NG_START_PAGE) * 256 + addr;
-        
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST )
+
+        oldValue = vscp_ps_readDMNextGeneration(index);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST ) */
+
         vscp_ps_writeDMNextGeneration(index, value);
-        
+
         /* Read value back */
         value = vscp_ps_readDMNextGeneration(index);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST )
+
+        /* A changed rule set may change the event interest too. */
+        if (oldValue != value)
+        {
+            vscp_interest_invalidate();
+        }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST ) */
     }
     
     return value;
@@ -314,6 +350,16 @@ extern void vscp_dm_ng_executeActions(vscp_RxMessage const * const rxMsg)
         return;
     }
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST )
+
+    /* No rule can match, if the event is not of interest. */
+    if (FALSE == vscp_interest_isInterested(rxMsg->vscpClass, rxMsg->vscpType))
+    {
+        return;
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST ) */
+
     /* Get the first rule */
     if (VSCP_DM_NG_RET_OK != vscp_dm_ng_getFirstRule(rule, VSCP_DM_NG_RULE_MAX_SIZE))
     {
@@ -374,6 +420,39 @@ extern void vscp_dm_ng_executeActions(vscp_RxMessage const * const rxMsg)
     return;
 }
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST )
+
+/**
+ * This function adds the classes and types of all rules with an action to
+ * the event interest.
+ */
+extern void vscp_dm_ng_addEventInterest(void)
+{
+    uint8_t rule[VSCP_DM_NG_RULE_MAX_SIZE];
+
+    /* Get the first rule */
+    if (VSCP_DM_NG_RET_OK != vscp_dm_ng_getFirstRule(rule, VSCP_DM_NG_RULE_MAX_SIZE))
+    {
+        return;
+    }
+
+    /* Walk through every rule */
+    do
+    {
+        /* rule: <rule size> <action id> <action parameter> ... */
+        if ((VSCP_DM_NG_SIZE_MIN <= rule[0]) &&
+            (VSCP_DM_NG_ACTION_NO_OPERATION != rule[1]))
+        {
+            vscp_dm_ng_addConditionInterest(&rule[3], rule[0] - 3);
+        }
+    }
+    while(VSCP_DM_NG_RET_OK == vscp_dm_ng_getNextRule(rule, VSCP_DM_NG_RULE_MAX_SIZE));
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST ) */
+
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DM_NG_DEBUG )
 
 /**
@@ -894,4 +973,108 @@ extern VSCP_DM_NG_RET   vscp_dm_ng_getNextRule(uint8_t * const rule, uint8_t max
     return status;
 }
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST )
+
+/**
+ * This function adds the classes and types, a rule can match, to the event
+ * interest. Only equal conditions on class and type, which are combined via
+ * logic AND, narrow the interest. In any other case the rule is considered
+ * to be interested in every event.
+ *
+ * @param[in]   rulePart    Part of the rule, starting with the first condition.
+ * @param[in]   size        Size of the rule part
+ */
+static void vscp_dm_ng_addConditionInterest(uint8_t const * const rulePart, uint8_t size)
+{
+    uint8_t     index       = 0;
+    uint16_t    classMask   = 0;
+    uint16_t    classFilter = 0;
+    uint8_t     typeMask    = 0;
+    uint8_t     typeFilter  = 0;
+    BOOL        isNarrowed  = TRUE;
+
+    /* ... <condition operator> <event parameter id> <value> ... */
+    while((index + 2) < size)
+    {
+        VSCP_DM_NG_BASIC_OP     basicOp     = rulePart[index] & VSCP_DM_NG_MASK_BASIC_OP;
+        VSCP_DM_NG_LOGIC_OP     logicOp     = rulePart[index] & VSCP_DM_NG_MASK_LOGIC_OP;
+        VSCP_DM_NG_EVENT_PAR_ID eventParId  = rulePart[index + 1];
+        uint16_t                value       = 0;
+
+        index += 2;
+
+        /* A logic OR may match any event. */
+        if (VSCP_DM_NG_LOGIC_OP_OR == logicOp)
+        {
+            isNarrowed = FALSE;
+            break;
+        }
+
+        /* Skip the event parameter index */
+        if (VSCP_DM_NG_EVENT_PAR_ID_DATA == eventParId)
+        {
+            ++index;
+        }
+
+        /* The class value is 16 bit wide. */
+        if (VSCP_DM_NG_EVENT_PAR_ID_CLASS == eventParId)
+        {
+            if (size <= (index + 1))
+            {
+                isNarrowed = FALSE;
+                break;
+            }
+
+            value   = rulePart[index];
+            value <<= 8;
+            value  |= rulePart[index + 1];
+            index  += 2;
+        }
+        else
+        {
+            if (size <= index)
+            {
+                isNarrowed = FALSE;
+                break;
+            }
+
+            value = rulePart[index];
+            ++index;
+        }
+
+        if (VSCP_DM_NG_BASIC_OP_EQUAL == basicOp)
+        {
+            if (VSCP_DM_NG_EVENT_PAR_ID_CLASS == eventParId)
+            {
+                classMask   = VSCP_INTEREST_CLASS_MASK;
+                classFilter = value & VSCP_INTEREST_CLASS_MASK;
+            }
+            else if (VSCP_DM_NG_EVENT_PAR_ID_TYPE == eventParId)
+            {
+                typeMask    = VSCP_INTEREST_TYPE_MASK;
+                typeFilter  = (uint8_t)value;
+            }
+        }
+
+        /* Last condition? */
+        if (VSCP_DM_NG_LOGIC_OP_LAST == logicOp)
+        {
+            break;
+        }
+    }
+
+    if (TRUE == isNarrowed)
+    {
+        vscp_interest_add(classMask, classFilter, typeMask, typeFilter);
+    }
+    else
+    {
+        vscp_interest_add(0, 0, 0, 0);
+    }
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST ) */
+
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
@@ -219,6 +219,16 @@ extern uint8_t  vscp_dm_ng_writeRegister(uint16_t page, uint8_t addr, uint8_t va
  */
 extern void vscp_dm_ng_executeActions(vscp_RxMessage const * const rxMsg);
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST )
+
+/**
+ * This function adds the classes and types of all rules with an action to
+ * the event interest.
+ */
+extern void vscp_dm_ng_addEventInterest(void);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST ) */
+
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DM_NG_DEBUG )
 
 /**
@@ -0,0 +1,432 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2019, Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP event interest
+@file   vscp_interest.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see vscp_interest.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "vscp_interest.h"
+#include "vscp_dm.h"
+#include "vscp_dm_ng.h"
+#include "vscp_portable.h"
+#include "vscp_class_l1.h"
+#include "vscp_can_filter.h"
+#include "vscp_transport.h"
+#include <string.h>
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST )
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/** Check whether a bit in a bitmap is set. */
+#define VSCP_INTEREST_IS_BIT_SET(__bitmap, __index) (0 != ((__bitmap)[(__index) / 8] & (1 << ((__index) % 8))))
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+static void vscp_interest_build(void);
+static void vscp_interest_setBits(uint8_t * const bitmap, uint16_t num, uint16_t mask, uint16_t filter);
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/** Class bitmap, a set bit means interested. */
+static uint8_t  vscp_interest_classes[VSCP_INTEREST_CLASS_NUM / 8];
+
+/** Type bitmap, a set bit means interested. */
+static uint8_t  vscp_interest_types[VSCP_INTEREST_TYPE_NUM / 8];
+
+/** Event interest is outdated and must be built again. */
+static BOOL     vscp_interest_isOutdated    = TRUE;
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CAN_FILTER )
+
+/** CAN acceptance filters */
+static vscp_can_filter_Filter   vscp_interest_canFilters[VSCP_CONFIG_CAN_FILTER_NUM];
+
+/** CAN acceptance filter plan */
+static vscp_can_filter_Plan     vscp_interest_canFilterPlan;
+
+/** CAN acceptance filter plan is built, but not set yet. */
+static BOOL                     vscp_interest_isCanFilterPending    = FALSE;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CAN_FILTER ) */
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function initializes the module.
+ */
+extern void vscp_interest_init(void)
+{
+    vscp_interest_isOutdated = TRUE;
+
+    return;
+}
+
+/**
+ * This function marks the event interest as outdated. It will be built again,
+ * before it is used the next time.
+ *
+ * Call it after the decision matrix was changed directly in the persistent
+ * memory, e.g. by the application. Writes via the decision matrix register
+ * access call it already.
+ */
+extern void vscp_interest_invalidate(void)
+{
+    vscp_interest_isOutdated = TRUE;
+
+    return;
+}
+
+/**
+ * This function builds the event interest, if it is outdated. Only here the
+ * CAN acceptance filters are set, after they were planned again. The core
+ * calls it in every process cycle without received event.
+ */
+extern void vscp_interest_update(void)
+{
+    if (FALSE != vscp_interest_isOutdated)
+    {
+        vscp_interest_build();
+    }
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CAN_FILTER )
+
+    if (FALSE != vscp_interest_isCanFilterPending)
+    {
+        vscp_interest_isCanFilterPending = FALSE;
+
+        vscp_transport_setFilters(vscp_interest_canFilterPlan.filters, vscp_interest_canFilterPlan.num);
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CAN_FILTER ) */
+
+    return;
+}
+
+/**
+ * This function adds the classes and types, which pass the given masks and
+ * filters, to the event interest. A class or type passes, if its masked value
+ * is equal to the filter. A mask of 0 means, that every class or type passes.
+ * It shall only be called while the event interest is built.
+ *
+ * @param[in]   classMask   Class mask
+ * @param[in]   classFilter Class filter
+ * @param[in]   typeMask    Type mask
+ * @param[in]   typeFilter  Type filter
+ */
+extern void vscp_interest_add(uint16_t classMask, uint16_t classFilter, uint8_t typeMask, uint8_t typeFilter)
+{
+    vscp_interest_setBits(vscp_interest_classes, VSCP_INTEREST_CLASS_NUM, classMask, classFilter);
+    vscp_interest_setBits(vscp_interest_types, VSCP_INTEREST_TYPE_NUM, typeMask, typeFilter);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CAN_FILTER )
+
+    /* The filters keep the class/type combination, the bitmaps don't. */
+    vscp_can_filter_add(&vscp_interest_canFilterPlan, classMask, classFilter, typeMask, typeFilter);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CAN_FILTER ) */
+
+    return;
+}
+
+/**
+ * This function checks whether the node is interested in the given event.
+ * It is called in the receive path, therefore an outdated event interest is
+ * not built here. Until it is built, every event is of interest.
+ *
+ * @param[in]   vscpClass   VSCP class
+ * @param[in]   vscpType    VSCP type
+ * @return  Interested or not
+ * @retval  FALSE   Not interested
+ * @retval  TRUE    Interested
+ */
+extern BOOL vscp_interest_isInterested(uint16_t vscpClass, uint8_t vscpType)
+{
+    BOOL    isInterested    = FALSE;
+
+    /* The bitmap contains only level 1 classes. */
+    if ((FALSE != vscp_interest_isOutdated) ||
+        (VSCP_INTEREST_CLASS_NUM <= vscpClass))
+    {
+        isInterested = TRUE;
+    }
+    else if ((VSCP_INTEREST_IS_BIT_SET(vscp_interest_classes, vscpClass)) &&
+             (VSCP_INTEREST_IS_BIT_SET(vscp_interest_types, vscpType)))
+    {
+        isInterested = TRUE;
+    }
+
+    return isInterested;
+}
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST_RESPONSE )
+
+/**
+ * This function checks whether the node is interested in the given class.
+ *
+ * @param[in]   vscpClass   VSCP class
+ * @return  Interested or not
+ * @retval  FALSE   Not interested
+ * @retval  TRUE    Interested
+ */
+extern BOOL vscp_interest_isClass(uint16_t vscpClass)
+{
+    BOOL    isInterested    = FALSE;
+
+    if (FALSE != vscp_interest_isOutdated)
+    {
+        vscp_interest_build();
+    }
+
+    if ((VSCP_INTEREST_CLASS_NUM > vscpClass) &&
+        (VSCP_INTEREST_IS_BIT_SET(vscp_interest_classes, vscpClass)))
+    {
+        isInterested = TRUE;
+    }
+
+    return isInterested;
+}
+
+/**
+ * This function checks whether the node is interested in the given type.
+ *
+ * @param[in]   vscpType    VSCP type
+ * @return  Interested or not
+ * @retval  FALSE   Not interested
+ * @retval  TRUE    Interested
+ */
+extern BOOL vscp_interest_isType(uint8_t vscpType)
+{
+    BOOL    isInterested    = FALSE;
+
+    if (FALSE != vscp_interest_isOutdated)
+    {
+        vscp_interest_build();
+    }
+
+    if (VSCP_INTEREST_IS_BIT_SET(vscp_interest_types, vscpType))
+    {
+        isInterested = TRUE;
+    }
+
+    return isInterested;
+}
+
+/**
+ * This function returns the number of classes, the node is interested in.
+ *
+ * @return  Number of classes
+ */
+extern uint16_t vscp_interest_getClassNum(void)
+{
+    uint16_t    index   = 0;
+    uint16_t    num     = 0;
+
+    for(index = 0; index < VSCP_INTEREST_CLASS_NUM; ++index)
+    {
+        if (FALSE != vscp_interest_isClass(index))
+        {
+            ++num;
+        }
+    }
+
+    return num;
+}
+
+/**
+ * This function returns the number of types, the node is interested in.
+ *
+ * @return  Number of types
+ */
+extern uint16_t vscp_interest_getTypeNum(void)
+{
+    uint16_t    index   = 0;
+    uint16_t    num     = 0;
+
+    for(index = 0; index < VSCP_INTEREST_TYPE_NUM; ++index)
+    {
+        if (FALSE != vscp_interest_isType((uint8_t)index))
+        {
+            ++num;
+        }
+    }
+
+    return num;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST_RESPONSE ) */
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function builds the event interest from the decision matrix rows and
+ * the application interests. The CAN acceptance filters are only planned,
+ * because it may be called in the receive path. They are set by
+ * vscp_interest_update().
+ */
+static void vscp_interest_build(void)
+{
+    uint8_t index   = 0;
+
+    for(index = 0; index < (VSCP_INTEREST_CLASS_NUM / 8); ++index)
+    {
+        vscp_interest_classes[index] = 0;
+    }
+
+    for(index = 0; index < (VSCP_INTEREST_TYPE_NUM / 8); ++index)
+    {
+        vscp_interest_types[index] = 0;
+    }
+
+    /* Clear it before the rows are added, because adding may invalidate it again. */
+    vscp_interest_isOutdated = FALSE;
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CAN_FILTER )
+
+    vscp_can_filter_init(&vscp_interest_canFilterPlan, vscp_interest_canFilters, VSCP_CONFIG_CAN_FILTER_NUM);
+
+    /* The node must receive the whole protocol class, the destination address
+     * is in the data and can't be filtered by the CAN identifier.
+     */
+    vscp_can_filter_add(&vscp_interest_canFilterPlan, VSCP_INTEREST_CLASS_MASK, VSCP_CLASS_L1_PROTOCOL, 0, 0);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CAN_FILTER ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM )
+
+    vscp_dm_addEventInterest();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION )
+
+    vscp_dm_ng_addEventInterest();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST_RESPONSE )
+
+    /* The application gets every received event, therefore it must provide
+     * its own interests for the response.
+     */
+    vscp_portable_addEventInterest();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST_RESPONSE ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CAN_FILTER )
+
+    vscp_interest_isCanFilterPending = TRUE;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CAN_FILTER ) */
+
+    return;
+}
+
+/**
+ * This function sets the bits of all indices in the bitmap, which pass the
+ * mask and filter. Instead of checking every index, only the combinations of
+ * the bits, which are not masked, are enumerated.
+ *
+ * @param[in,out]   bitmap  Bitmap
+ * @param[in]       num     Number of bits in the bitmap, must be a power of two
+ * @param[in]       mask    Mask, 0 means that every index passes
+ * @param[in]       filter  Filter
+ */
+static void vscp_interest_setBits(uint8_t * const bitmap, uint16_t num, uint16_t mask, uint16_t filter)
+{
+    uint16_t    freeBits    = 0;
+    uint16_t    subset      = 0;
+    uint16_t    index       = 0;
+
+    if (0 == mask)
+    {
+        memset(bitmap, 0xff, num / 8);
+        return;
+    }
+
+    /* Mask bits beyond the bitmap have no effect. */
+    mask &= (uint16_t)(num - 1);
+
+    /* A filter bit, which is not masked, never matches. */
+    if (0 != (filter & (uint16_t)~mask))
+    {
+        return;
+    }
+
+    freeBits = (uint16_t)~mask & (uint16_t)(num - 1);
+
+    /* Enumerate all subsets of the free bits, starting with the empty one. */
+    do
+    {
+        index = filter | subset;
+        bitmap[index / 8] |= (uint8_t)(1 << (index % 8));
+
+        subset = (uint16_t)(subset - freeBits) & freeBits;
+    }
+    while(0 != subset);
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST ) */
@@ -0,0 +1,216 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2019, Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP event interest
+@file   vscp_interest.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module keeps the classes and types, which the node is interested in.
+
+*******************************************************************************/
+/** @defgroup vscp_interest VSCP event interest
+ * The event interest contains a class bitmap for all level 1 classes and a
+ * type bitmap. It is derived from the enabled decision matrix rows (standard
+ * and next generation) and the application interests. A received event is of
+ * interest, if its class and its type are in the bitmaps. Because the bitmaps
+ * are independent of each other, the event interest is a superset of the
+ * class/type combinations of the rows.
+ *
+ * The bitmaps are built again, after the decision matrix was changed. This
+ * happens in the next process cycle without received event, therefore a burst
+ * of decision matrix writes causes only a single update. Until then every
+ * received event is of interest.
+ *
+ * With the CAN acceptance filters, the class/type combinations and the
+ * protocol class are planned as filters too, see vscp_can_filter.h. They are
+ * set by vscp_interest_update().
+ *
+ * Supported compile switches:
+ * - VSCP_CONFIG_ENABLE_EVENT_INTEREST
+ * - VSCP_CONFIG_ENABLE_EVENT_INTEREST_RESPONSE
+ * - VSCP_CONFIG_ENABLE_CAN_FILTER
+ *
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __VSCP_INTEREST_H__
+#define __VSCP_INTEREST_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include "vscp_config.h"
+#include "vscp_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Number of level 1 classes */
+#define VSCP_INTEREST_CLASS_NUM     (512)
+
+/** Number of types */
+#define VSCP_INTEREST_TYPE_NUM      (256)
+
+/** Class mask, which considers all class bits of a level 1 class. */
+#define VSCP_INTEREST_CLASS_MASK    ((uint16_t)0x01ff)
+
+/** Type mask, which considers all type bits. */
+#define VSCP_INTEREST_TYPE_MASK     ((uint8_t)0xff)
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST )
+
+/**
+ * This function initializes the module.
+ */
+extern void vscp_interest_init(void);
+
+/**
+ * This function marks the event interest as outdated. It will be built again
+ * by vscp_interest_update().
+ *
+ * Call it after the decision matrix was changed directly in the persistent
+ * memory, e.g. by the application. Writes via the decision matrix register
+ * access call it already.
+ */
+extern void vscp_interest_invalidate(void);
+
+/**
+ * This function builds the event interest, if it is outdated. It is called by
+ * the core, if no event was received in the process cycle. It is the only
+ * place, where the planned CAN acceptance filters are set via the transport
+ * layer, never in the receive path.
+ */
+extern void vscp_interest_update(void);
+
+/**
+ * This function adds the classes and types, which pass the given masks and
+ * filters, to the event interest. A class or type passes, if its masked value
+ * is equal to the filter. A mask of 0 means, that every class or type passes.
+ * It shall only be called while the event interest is built.
+ *
+ * @param[in]   classMask   Class mask
+ * @param[in]   classFilter Class filter
+ * @param[in]   typeMask    Type mask
+ * @param[in]   typeFilter  Type filter
+ */
+extern void vscp_interest_add(uint16_t classMask, uint16_t classFilter, uint8_t typeMask, uint8_t typeFilter);
+
+/**
+ * This function checks whether the node is interested in the given event.
+ * As long as the event interest is outdated, every event is of interest.
+ *
+ * @param[in]   vscpClass   VSCP class
+ * @param[in]   vscpType    VSCP type
+ * @return  Interested or not
+ * @retval  FALSE   Not interested
+ * @retval  TRUE    Interested
+ */
+extern BOOL vscp_interest_isInterested(uint16_t vscpClass, uint8_t vscpType);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST_RESPONSE )
+
+/**
+ * This function checks whether the node is interested in the given class.
+ *
+ * @param[in]   vscpClass   VSCP class
+ * @return  Interested or not
+ * @retval  FALSE   Not interested
+ * @retval  TRUE    Interested
+ */
+extern BOOL vscp_interest_isClass(uint16_t vscpClass);
+
+/**
+ * This function checks whether the node is interested in the given type.
+ *
+ * @param[in]   vscpType    VSCP type
+ * @return  Interested or not
+ * @retval  FALSE   Not interested
+ * @retval  TRUE    Interested
+ */
+extern BOOL vscp_interest_isType(uint8_t vscpType);
+
+/**
+ * This function returns the number of classes, the node is interested in.
+ *
+ * @return  Number of classes
+ */
+extern uint16_t vscp_interest_getClassNum(void);
+
+/**
+ * This function returns the number of types, the node is interested in.
+ *
+ * @return  Number of types
+ */
+extern uint16_t vscp_interest_getTypeNum(void);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST_RESPONSE ) */
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_EVENT_INTEREST ) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __VSCP_INTEREST_H__ */
+
+/** @} */
@@ -46,8 +46,6 @@
 #include "vscp_type_log.h"
 #include "vscp_ps.h"
 
-#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER )
-
 /*******************************************************************************
     COMPILER SWITCHES
 *******************************************************************************/
@@ -64,10 +62,43 @@
     TYPES AND STRUCTURES
 *******************************************************************************/
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_QUEUE )
+
+/** This type defines a log queue entry. An entry holds the last message of a
+ * id and stays in use after sending, until the rate limit period is over.
+ */
+typedef struct
+{
+    BOOL        isUsed;                                 /**< Entry is in use */
+    BOOL        isPending;                              /**< Message waits for sending */
+    uint8_t     order;                                  /**< Queue order, used to send the oldest message first */
+    uint8_t     id;                                     /**< Message id */
+    uint8_t     level;                                  /**< Log level */
+    uint8_t     size;                                   /**< Message size in bytes */
+    uint8_t     msg[VSCP_CONFIG_LOGGER_MSG_SIZE];       /**< Message */
+    uint8_t     sentCnt;                                /**< Number of sent messages in the current second */
+    uint16_t    repeatedCnt;                            /**< Number of coalesced or suppressed messages */
+
+} vscp_logger_QueueEntry;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_QUEUE ) */
+
 /*******************************************************************************
     PROTOTYPES
 *******************************************************************************/
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_QUEUE )
+
+static void vscp_logger_enqueue(uint8_t id, VSCP_LOGGER_LVL level, uint8_t const * const msg, uint8_t size);
+static void vscp_logger_clearQueue(void);
+static void vscp_logger_updatePeriod(void);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_QUEUE ) */
+
+static BOOL vscp_logger_send(uint8_t id, uint8_t level, uint8_t const * const msg, uint8_t size, VSCP_PRIORITY priority);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER )
+
 /*******************************************************************************
     LOCAL VARIABLES
 *******************************************************************************/
@@ -78,6 +109,22 @@ static BOOL     vscp_logger_isEnabled   = FALSE;
 /** Current log level bitfield */
 static uint8_t  vscp_logger_logLevel    = 0;
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_QUEUE )
+
+/** Log queue */
+static vscp_logger_QueueEntry   vscp_logger_queue[VSCP_CONFIG_LOGGER_QUEUE_NUM];
+
+/** Queue order of the next queued message */
+static uint8_t                  vscp_logger_queueOrder  = 0;
+
+/** Second of the current rate limit period */
+static uint32_t                 vscp_logger_second      = 0;
+
+/** Number of dropped log messages, because the queue was full */
+static uint16_t                 vscp_logger_dropCnt     = 0;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_QUEUE ) */
+
 /*******************************************************************************
     GLOBAL VARIABLES
 *******************************************************************************/
@@ -91,7 +138,12 @@ static uint8_t  vscp_logger_logLevel    = 0;
  */
 extern void vscp_logger_init(void)
 {
-    /* Nothing to do */
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_QUEUE )
+
+    vscp_logger_clearQueue();
+    vscp_logger_dropCnt = 0;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_QUEUE ) */
 
     return;
 }
@@ -102,6 +154,17 @@ extern void vscp_logger_init(void)
 extern void vscp_logger_enable(BOOL enableIt)
 {
     vscp_logger_isEnabled = enableIt;
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_QUEUE )
+
+    /* Queued messages shall not be sent after the logging is stopped. */
+    if (FALSE == enableIt)
+    {
+        vscp_logger_clearQueue();
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_QUEUE ) */
+
     return;
 }
 
@@ -141,7 +204,15 @@ extern void vscp_logger_log(uint8_t id, VSCP_LOGGER_LVL level, uint8_t const * c
     {
         if (0 != (vscp_logger_logLevel & (1 << level)))
         {
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_QUEUE )
+
+            vscp_logger_enqueue(id, level, msg, size);
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_LOGGER_QUEUE ) */
+
             (void)vscp_logger_sendLogEvent(id, level, msg, size);
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_LOGGER_QUEUE ) */
         }
     }
 
@@ -199,7 +270,7 @@ extern void vscp_logger_handleEvent(vscp_RxMessage const * const msg)
             {
                 if (vscp_ps_readLogId() == msg->data[0])
                 {
-                    vscp_logger_isEnabled = FALSE;
+                    vscp_logger_enable(FALSE);
                 }
             }
         }
@@ -220,6 +291,86 @@ extern void vscp_logger_handleEvent(vscp_RxMessage const * const msg)
     return;
 }
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_QUEUE )
+
+/**
+ * This function sends the oldest queued log message or if no message is
+ * pending, a report about coalesced or suppressed messages. Only one log
+ * message is sent per call. It will be called by the VSCP core in active
+ * state, after the received message is handled.
+ */
+extern void vscp_logger_process(void)
+{
+    uint8_t                 index   = 0;
+    vscp_logger_QueueEntry* entry   = NULL;
+    uint8_t                 age     = 0;
+
+    vscp_logger_updatePeriod();
+
+    /* Find the oldest pending message, which is allowed to be sent. */
+    for(index = 0; index < VSCP_CONFIG_LOGGER_QUEUE_NUM; ++index)
+    {
+        vscp_logger_QueueEntry* candidate = &vscp_logger_queue[index];
+
+        if ((TRUE == candidate->isUsed) &&
+            (VSCP_CONFIG_LOGGER_RATE_LIMIT > candidate->sentCnt) &&
+            ((TRUE == candidate->isPending) || (0 < candidate->repeatedCnt)))
+        {
+            uint8_t candidateAge = vscp_logger_queueOrder - candidate->order;
+
+            /* Pending messages first, afterwards the reports. */
+            if ((NULL == entry) ||
+                ((TRUE == candidate->isPending) && (FALSE == entry->isPending)) ||
+                ((candidate->isPending == entry->isPending) && (age < candidateAge)))
+            {
+                entry   = candidate;
+                age     = candidateAge;
+            }
+        }
+    }
+
+    if (NULL != entry)
+    {
+        if (TRUE == entry->isPending)
+        {
+            if (TRUE == vscp_logger_send(entry->id, entry->level, entry->msg, entry->size, VSCP_PRIORITY_7_LOW))
+            {
+                entry->isPending = FALSE;
+                ++entry->sentCnt;
+            }
+        }
+        else
+        {
+            uint8_t report[3];
+
+            report[0] = entry->id;
+            report[1] = (uint8_t)(entry->repeatedCnt >> 8);
+            report[2] = (uint8_t)(entry->repeatedCnt >> 0);
+
+            if (TRUE == vscp_logger_send(VSCP_CONFIG_LOGGER_REPEATED_ID, entry->level, report, sizeof(report), VSCP_PRIORITY_7_LOW))
+            {
+                entry->repeatedCnt = 0;
+                ++entry->sentCnt;
+            }
+        }
+    }
+
+    return;
+}
+
+/**
+ * This function returns the number of log messages, which were dropped,
+ * because the queue was full.
+ *
+ * @return Number of dropped log messages
+ */
+extern uint16_t vscp_logger_getDropCnt(void)
+{
+    return vscp_logger_dropCnt;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_QUEUE ) */
+
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER ) */
 
 /**
@@ -237,6 +388,169 @@ extern void vscp_logger_handleEvent(vscp_RxMessage const * const msg)
  *
  */
 extern BOOL vscp_logger_sendLogEvent(uint8_t id, uint8_t level, uint8_t const * const msg, uint8_t size)
+{
+    return vscp_logger_send(id, level, msg, size, VSCP_PRIORITY_3_NORMAL);
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_QUEUE )
+
+/**
+ * This function queues a log message. A pending message with the same id is
+ * replaced and counted as repeated. If the id reached its rate limit, the
+ * message is only counted. If no entry is available, the message is dropped.
+ *
+ * @param[in] id    Message id
+ * @param[in] level Log level
+ * @param[in] msg   Message
+ * @param[in] size  Message size in bytes
+ */
+static void vscp_logger_enqueue(uint8_t id, VSCP_LOGGER_LVL level, uint8_t const * const msg, uint8_t size)
+{
+    uint8_t                 index   = 0;
+    vscp_logger_QueueEntry* entry   = NULL;
+
+    vscp_logger_updatePeriod();
+
+    /* Find the entry of this id or a free one. */
+    for(index = 0; index < VSCP_CONFIG_LOGGER_QUEUE_NUM; ++index)
+    {
+        if (FALSE == vscp_logger_queue[index].isUsed)
+        {
+            if (NULL == entry)
+            {
+                entry = &vscp_logger_queue[index];
+            }
+        }
+        else if (id == vscp_logger_queue[index].id)
+        {
+            entry = &vscp_logger_queue[index];
+            break;
+        }
+    }
+
+    if (NULL == entry)
+    {
+        if (UINT16_MAX > vscp_logger_dropCnt)
+        {
+            ++vscp_logger_dropCnt;
+        }
+
+        return;
+    }
+
+    if (FALSE == entry->isUsed)
+    {
+        entry->isUsed       = TRUE;
+        entry->isPending    = FALSE;
+        entry->id           = id;
+        entry->sentCnt      = 0;
+        entry->repeatedCnt  = 0;
+    }
+
+    /* Coalesce with a pending message or suppress it, if the rate limit is reached. */
+    if ((TRUE == entry->isPending) ||
+        (VSCP_CONFIG_LOGGER_RATE_LIMIT <= entry->sentCnt))
+    {
+        if (UINT16_MAX > entry->repeatedCnt)
+        {
+            ++entry->repeatedCnt;
+        }
+    }
+
+    /* A suppressed message is only counted. */
+    if (VSCP_CONFIG_LOGGER_RATE_LIMIT > entry->sentCnt)
+    {
+        if (FALSE == entry->isPending)
+        {
+            entry->isPending    = TRUE;
+            entry->order        = vscp_logger_queueOrder;
+            ++vscp_logger_queueOrder;
+        }
+
+        if ((NULL == msg) ||
+            (VSCP_CONFIG_LOGGER_MSG_SIZE < size))
+        {
+            size = (NULL == msg) ? 0 : VSCP_CONFIG_LOGGER_MSG_SIZE;
+        }
+
+        /* The latest message is sent. */
+        entry->level    = (uint8_t)level;
+        entry->size     = size;
+
+        for(index = 0; index < size; ++index)
+        {
+            entry->msg[index] = msg[index];
+        }
+    }
+
+    return;
+}
+
+/**
+ * This function removes all queued log messages.
+ */
+static void vscp_logger_clearQueue(void)
+{
+    uint8_t index   = 0;
+
+    for(index = 0; index < VSCP_CONFIG_LOGGER_QUEUE_NUM; ++index)
+    {
+        vscp_logger_queue[index].isUsed         = FALSE;
+        vscp_logger_queue[index].isPending      = FALSE;
+        vscp_logger_queue[index].repeatedCnt    = 0;
+    }
+
+    return;
+}
+
+/**
+ * This function starts a new rate limit period, if the time since epoch
+ * changed. Entries which have nothing more to send are released.
+ */
+static void vscp_logger_updatePeriod(void)
+{
+    uint8_t     index   = 0;
+    uint32_t    second  = vscp_core_getTimeSinceEpoch();
+
+    if (vscp_logger_second != second)
+    {
+        vscp_logger_second = second;
+
+        for(index = 0; index < VSCP_CONFIG_LOGGER_QUEUE_NUM; ++index)
+        {
+            vscp_logger_queue[index].sentCnt = 0;
+
+            if ((FALSE == vscp_logger_queue[index].isPending) &&
+                (0 == vscp_logger_queue[index].repeatedCnt))
+            {
+                vscp_logger_queue[index].isUsed = FALSE;
+            }
+        }
+    }
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_QUEUE ) */
+
+/**
+ * This function sends a log message with the given priority. If the message
+ * doesn't fit into a single log event, several log events are sent.
+ *
+ * @param[in] id        ID for event.
+ * @param[in] level     Log level for message.
+ * @param[in] msg       Message.
+ * @param[in] size      Message size in bytes.
+ * @param[in] priority  Priority of the log events
+ * @return Status
+ * @retval FALSE Failed to send the event
+ * @retval TRUE  Event successful sent
+ */
+static BOOL vscp_logger_send(uint8_t id, uint8_t level, uint8_t const * const msg, uint8_t size, VSCP_PRIORITY priority)
 {
     vscp_TxMessage  txMsg;
     uint8_t         index       = 0;
@@ -244,7 +558,7 @@ extern BOOL vscp_logger_sendLogEvent(uint8_t id, uint8_t level, uint8_t const *
     uint8_t         msgIndex    = 0;
     BOOL            status      = FALSE;
 
-    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_LOG, VSCP_TYPE_LOG_LOG_EVENT, VSCP_PRIORITY_3_NORMAL);
+    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_LOG, VSCP_TYPE_LOG_LOG_EVENT, priority);
 
     txMsg.dataNum = 8;
     txMsg.data[0] = id;
@@ -282,6 +596,3 @@ extern BOOL vscp_logger_sendLogEvent(uint8_t id, uint8_t level, uint8_t const *
     return status;
 }
 
-/*******************************************************************************
-    LOCAL FUNCTIONS
-*******************************************************************************/
@@ -45,8 +45,17 @@ level.
  * Parts of a message means, if the message is defragmented in several VSCP
  * events, it can happen that a event will be lost.
  *
+ * If the log message queue is enabled, the log messages are queued and sent
+ * with the lowest priority by the VSCP core, whenever it has nothing else to
+ * do. A message with the same id as a pending message replaces it and every
+ * id is limited to VSCP_CONFIG_LOGGER_RATE_LIMIT messages per second. The
+ * number of replaced and suppressed messages is reported afterwards with the
+ * id VSCP_CONFIG_LOGGER_REPEATED_ID. If the queue is full, the message is
+ * dropped and counted.
+ *
  * Supported compile switches:
  * - VSCP_CONFIG_ENABLE_LOGGER
+ * - VSCP_CONFIG_ENABLE_LOGGER_QUEUE
  *
  * @{
  */
@@ -258,6 +267,26 @@ extern void vscp_logger_logUInt32(uint8_t id, VSCP_LOGGER_LVL level, uint32_t va
  */
 extern void vscp_logger_handleEvent(vscp_RxMessage const * const msg);
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_QUEUE )
+
+/**
+ * This function sends the oldest queued log message or if no message is
+ * pending, a report about coalesced or suppressed messages. Only one log
+ * message is sent per call. It will be called by the VSCP core in active
+ * state, after the received message is handled.
+ */
+extern void vscp_logger_process(void);
+
+/**
+ * This function returns the number of log messages, which were dropped,
+ * because the queue was full.
+ *
+ * @return Number of dropped log messages
+ */
+extern uint16_t vscp_logger_getDropCnt(void);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER_QUEUE ) */
+
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER ) */
 
 /**
@@ -0,0 +1,343 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2019, Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP measurement publisher
+@file   vscp_publisher.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see vscp_publisher.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "vscp_publisher.h"
+#include "vscp_timer.h"
+#include "vscp_data_coding.h"
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_PUBLISHER )
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/** This type contains the state of a registered sensor. */
+typedef struct
+{
+    vscp_publisher_Config const *   config;     /**< Sensor configuration */
+    int32_t                         value;      /**< Current value */
+    int32_t                         sentValue;  /**< Last sent value */
+    uint16_t                        elapsed;    /**< Ticks since the last sent value */
+    BOOL                            isValid;    /**< Current value is valid or not */
+    BOOL                            isSent;     /**< Any value was sent or not */
+    BOOL                            isChanged;  /**< Current value changed since the last check */
+
+} vscp_publisher_Sensor;
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+static BOOL vscp_publisher_isBeyondDeadband(vscp_publisher_Sensor const * const sensor);
+static BOOL vscp_publisher_send(vscp_publisher_Sensor * const sensor);
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/** All registered sensors */
+static vscp_publisher_Sensor    vscp_publisher_sensors[VSCP_CONFIG_PUBLISHER_NUM];
+
+/** Number of registered sensors */
+static uint8_t                  vscp_publisher_sensorNum    = 0;
+
+/** Timer id, which is used for the publisher tick. */
+static uint8_t                  vscp_publisher_timerId      = VSCP_TIMER_ID_INVALID;
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function initializes the module and removes all registered sensors.
+ *
+ * @return  Initialization successful or not
+ * @retval  FALSE   No timer available
+ * @retval  TRUE    Successful
+ */
+extern BOOL vscp_publisher_init(void)
+{
+    vscp_publisher_sensorNum = 0;
+
+    /* Create a timer for the publisher tick. */
+    vscp_publisher_timerId = vscp_timer_create();
+    if (VSCP_TIMER_ID_INVALID == vscp_publisher_timerId)
+    {
+        return FALSE;
+    }
+
+    vscp_timer_start(vscp_publisher_timerId, VSCP_CONFIG_PUBLISHER_TICK);
+
+    return TRUE;
+}
+
+/**
+ * This function registers a sensor.
+ *
+ * @param[in]   config  Sensor configuration
+ * @return  Publisher id or VSCP_PUBLISHER_ID_INVALID if no space is left or the configuration is invalid
+ */
+extern uint8_t vscp_publisher_register(vscp_publisher_Config const * const config)
+{
+    uint8_t                 id      = VSCP_PUBLISHER_ID_INVALID;
+    vscp_publisher_Sensor*  sensor  = NULL;
+
+    if ((NULL == config) ||
+        (NULL == config->send) ||
+        (VSCP_PUBLISHER_DEADBAND_REL_MAX < config->deadbandRel) ||
+        (VSCP_CONFIG_PUBLISHER_NUM <= vscp_publisher_sensorNum))
+    {
+        return VSCP_PUBLISHER_ID_INVALID;
+    }
+
+    id      = vscp_publisher_sensorNum;
+    sensor  = &vscp_publisher_sensors[id];
+
+    sensor->config      = config;
+    sensor->value       = 0;
+    sensor->sentValue   = 0;
+    sensor->elapsed     = 0;
+    sensor->isValid     = FALSE;
+    sensor->isSent      = FALSE;
+    sensor->isChanged   = FALSE;
+
+    ++vscp_publisher_sensorNum;
+
+    return id;
+}
+
+/**
+ * This function updates the value of a sensor. The measurement event is sent
+ * later in the process cycle, if necessary.
+ *
+ * @param[in]   id      Publisher id
+ * @param[in]   data    The data as signed integer, in units of the configured exponent.
+ */
+extern void vscp_publisher_update(uint8_t id, int32_t data)
+{
+    vscp_publisher_Sensor*  sensor  = NULL;
+
+    if (vscp_publisher_sensorNum <= id)
+    {
+        return;
+    }
+
+    sensor = &vscp_publisher_sensors[id];
+
+    if ((FALSE == sensor->isValid) ||
+        (sensor->value != data))
+    {
+        sensor->value       = data;
+        sensor->isValid     = TRUE;
+        sensor->isChanged   = TRUE;
+    }
+
+    return;
+}
+
+/**
+ * This function sends the measurement events, which are due. It is called by
+ * the core in active state.
+ */
+extern void vscp_publisher_process(void)
+{
+    uint8_t index   = 0;
+    BOOL    isTick  = FALSE;
+
+    if ((VSCP_TIMER_ID_INVALID != vscp_publisher_timerId) &&
+        (FALSE == vscp_timer_getStatus(vscp_publisher_timerId)))
+    {
+        vscp_timer_start(vscp_publisher_timerId, VSCP_CONFIG_PUBLISHER_TICK);
+        isTick = TRUE;
+    }
+
+    for(index = 0; index < vscp_publisher_sensorNum; ++index)
+    {
+        vscp_publisher_Sensor*  sensor  = &vscp_publisher_sensors[index];
+        BOOL                    isDue   = FALSE;
+
+        if ((FALSE != isTick) &&
+            (UINT16_MAX > sensor->elapsed))
+        {
+            ++sensor->elapsed;
+        }
+
+        if (FALSE == sensor->isValid)
+        {
+            continue;
+        }
+
+        /* First value? */
+        if (FALSE == sensor->isSent)
+        {
+            isDue = TRUE;
+        }
+        /* Minimum interval not elapsed yet? */
+        else if (sensor->config->minInterval > sensor->elapsed)
+        {
+            isDue = FALSE;
+        }
+        /* Maximum interval elapsed? */
+        else if ((0 < sensor->config->maxInterval) &&
+                 (sensor->config->maxInterval <= sensor->elapsed))
+        {
+            isDue = TRUE;
+        }
+        /* Value changed more than the deadband? */
+        else if (FALSE != sensor->isChanged)
+        {
+            isDue = vscp_publisher_isBeyondDeadband(sensor);
+
+            /* Check it again with the next update. */
+            sensor->isChanged = FALSE;
+        }
+
+        if (FALSE != isDue)
+        {
+            (void)vscp_publisher_send(sensor);
+        }
+    }
+
+    return;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function checks whether the current value of a sensor differs more
+ * than the deadband from the last sent value.
+ *
+ * @param[in]   sensor  Sensor
+ * @return  Beyond deadband or not
+ * @retval  FALSE   Within deadband
+ * @retval  TRUE    Beyond deadband
+ */
+static BOOL vscp_publisher_isBeyondDeadband(vscp_publisher_Sensor const * const sensor)
+{
+    uint32_t    diff        = 0;
+    uint32_t    magnitude   = 0;
+    uint32_t    deadband    = sensor->config->deadbandAbs;
+
+    /* The unsigned difference can't overflow. */
+    if (sensor->value > sensor->sentValue)
+    {
+        diff = (uint32_t)sensor->value - (uint32_t)sensor->sentValue;
+    }
+    else
+    {
+        diff = (uint32_t)sensor->sentValue - (uint32_t)sensor->value;
+    }
+
+    if (0 < sensor->config->deadbandRel)
+    {
+        uint32_t    relDeadband = 0;
+
+        magnitude = (0 > sensor->sentValue) ? (0u - (uint32_t)sensor->sentValue) : (uint32_t)sensor->sentValue;
+
+        /* Percent of the magnitude, without 32 bit overflow. The relative
+         * deadband is limited to VSCP_PUBLISHER_DEADBAND_REL_MAX during registration.
+         */
+        relDeadband  = (magnitude / 100u) * sensor->config->deadbandRel;
+        relDeadband += ((magnitude % 100u) * sensor->config->deadbandRel) / 100u;
+
+        if (deadband < relDeadband)
+        {
+            deadband = relDeadband;
+        }
+    }
+
+    return (deadband < diff) ? TRUE : FALSE;
+}
+
+/**
+ * This function sends the current value of a sensor.
+ *
+ * @param[in,out]   sensor  Sensor
+ * @return  Sent or not
+ * @retval  FALSE   Failed to send, it will be sent again in the next cycle.
+ * @retval  TRUE    Successful sent
+ */
+static BOOL vscp_publisher_send(vscp_publisher_Sensor * const sensor)
+{
+    int32_t data    = sensor->value;
+    int8_t  exp     = sensor->config->exp;
+    BOOL    status  = FALSE;
+
+    /* Shortest representation on the bus */
+    vscp_data_coding_normalize(&data, &exp);
+
+    status = sensor->config->send(sensor->config->index, sensor->config->unit, data, exp);
+
+    if (FALSE != status)
+    {
+        sensor->sentValue   = sensor->value;
+        sensor->elapsed     = 0;
+        sensor->isSent      = TRUE;
+        sensor->isChanged   = FALSE;
+    }
+    else
+    {
+        /* Try again in the next cycle. */
+        sensor->isChanged   = TRUE;
+    }
+
+    return status;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_PUBLISHER ) */
@@ -0,0 +1,192 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2019, Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP measurement publisher
+@file   vscp_publisher.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module sends measurement events of registered sensors with deadband and
+interval handling.
+
+*******************************************************************************/
+/** @defgroup vscp_publisher VSCP measurement publisher
+ * The application registers every sensor once and afterwards only updates its
+ * value. The publisher decides when a measurement event is sent:
+ * - The first value is sent immediately.
+ * - A value, which differs more than the deadband from the last sent value,
+ *   is sent, but not before the minimum interval elapsed. Several updates in
+ *   between are coalesced, only the latest value is sent.
+ * - After the maximum interval the current value is sent again, even if it
+ *   didn't change.
+ *
+ * The deadband is the larger one of the absolute deadband and the relative
+ * deadband (percent of the last sent value). If both are 0, every change is
+ * sent.
+ *
+ * All intervals are given in ticks of VSCP_CONFIG_PUBLISHER_TICK ms. Only a
+ * single timer is used for all sensors. The events are sent only in active
+ * state, with trailing decimal zeros moved to the exponent.
+ *
+ * Supported compile switches:
+ * - VSCP_CONFIG_ENABLE_PUBLISHER
+ *
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __VSCP_PUBLISHER_H__
+#define __VSCP_PUBLISHER_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include "vscp_config.h"
+#include "vscp_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Invalid publisher id */
+#define VSCP_PUBLISHER_ID_INVALID   (0xFF)
+
+/** Max. relative deadband in percent */
+#define VSCP_PUBLISHER_DEADBAND_REL_MAX (100u)
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_PUBLISHER )
+
+/** Convert a interval in ms to publisher ticks. */
+#define VSCP_PUBLISHER_MS_TO_TICKS(__ms)    ((uint16_t)((__ms) / VSCP_CONFIG_PUBLISHER_TICK))
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_PUBLISHER ) */
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/**
+ * Sends a measurement event, e.g. vscp_measurement_sendTemperatureEvent().
+ *
+ * @param[in] index Index for sensor.
+ * @param[in] unit  The unit of the data.
+ * @param[in] data  The data as signed integer.
+ * @param[in] exp   The exponent of the data (10^exponent).
+ * @return Status
+ * @retval FALSE Failed to send the event
+ * @retval TRUE  Event successul sent
+ */
+typedef BOOL (*vscp_publisher_Send)(uint8_t index, uint8_t unit, int32_t data, int8_t exp);
+
+/**
+ * This type contains the configuration of a sensor. It must be valid as long
+ * as the sensor is registered.
+ */
+typedef struct
+{
+    vscp_publisher_Send send;           /**< Measurement event send function */
+    uint8_t             index;          /**< Sensor index */
+    uint8_t             unit;           /**< Unit of the data */
+    int8_t              exp;            /**< Exponent of all values of this sensor (10^exponent) */
+    uint32_t            deadbandAbs;    /**< Absolute deadband in units of the exponent */
+    uint8_t             deadbandRel;    /**< Relative deadband in percent of the last sent value (0 - VSCP_PUBLISHER_DEADBAND_REL_MAX) */
+    uint16_t            minInterval;    /**< Minimum interval between two events in ticks */
+    uint16_t            maxInterval;    /**< Maximum interval between two events in ticks (0: none) */
+
+} vscp_publisher_Config;
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_PUBLISHER )
+
+/**
+ * This function initializes the module and removes all registered sensors.
+ *
+ * @return  Initialization successful or not
+ * @retval  FALSE   No timer available
+ * @retval  TRUE    Successful
+ */
+extern BOOL vscp_publisher_init(void);
+
+/**
+ * This function registers a sensor.
+ *
+ * @param[in]   config  Sensor configuration
+ * @return  Publisher id or VSCP_PUBLISHER_ID_INVALID if no space is left
+ */
+extern uint8_t vscp_publisher_register(vscp_publisher_Config const * const config);
+
+/**
+ * This function updates the value of a sensor. The measurement event is sent
+ * later in the process cycle, if necessary.
+ *
+ * @param[in]   id      Publisher id
+ * @param[in]   data    The data as signed integer, in units of the configured exponent.
+ */
+extern void vscp_publisher_update(uint8_t id, int32_t data);
+
+/**
+ * This function sends the measurement events, which are due. It is called by
+ * the core in active state.
+ */
+extern void vscp_publisher_process(void);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_PUBLISHER ) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __VSCP_PUBLISHER_H__ */
+
+/** @} */
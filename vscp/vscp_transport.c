@@ -66,6 +66,12 @@
     PROTOTYPES
 *******************************************************************************/
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOOPBACK )
+
+static void vscp_transport_writeLoopBack(vscp_TxMessage const * const msg);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOOPBACK ) */
+
 /*******************************************************************************
     LOCAL VARIABLES
 *******************************************************************************/
@@ -73,6 +79,12 @@
 /** Transmit error counter, counts every message, which couldn't be sent. */
 static uint8_t                  vscp_txErrorCnt = 0;
 
+/** Receive counter, counts every message, which is received from the lower layer. */
+static uint8_t                  vscp_transport_rxCnt    = 0;
+
+/** Transmit counter, counts every message, which is successful sent. */
+static uint8_t                  vscp_transport_txCnt    = 0;
+
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOOPBACK )
 
 /** Cyclic buffer instance for VSCP event loopback. */
@@ -153,6 +165,11 @@ extern BOOL vscp_transport_readMessage(vscp_RxMessage * const msg)
             if (TRUE == received)
             {
                 (void)vscp_util_cyclicBufferWrite(&vscp_transport_loopBackCyclicBuffer, &rxMsg, 1);
+
+                if (255 > vscp_transport_rxCnt)
+                {
+                    ++vscp_transport_rxCnt;
+                }
             }
 
             status = TRUE;
@@ -161,6 +178,12 @@ extern BOOL vscp_transport_readMessage(vscp_RxMessage * const msg)
         /* No message in the loopback, maybe one is received from lower layer. */
         {
             status = vscp_tp_adapter_readMessage(msg);
+
+            if ((TRUE == status) &&
+                (255 > vscp_transport_rxCnt))
+            {
+                ++vscp_transport_rxCnt;
+            }
         }
 
     }
@@ -169,6 +192,12 @@ extern BOOL vscp_transport_readMessage(vscp_RxMessage * const msg)
 
     status = vscp_tp_adapter_readMessage(msg);
 
+    if ((TRUE == status) &&
+        (255 > vscp_transport_rxCnt))
+    {
+        ++vscp_transport_rxCnt;
+    }
+
 #endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_LOOPBACK ) */
 
     return status;
@@ -191,15 +220,7 @@ extern BOOL vscp_transport_writeMessage(vscp_TxMessage const * const msg)
     if ((NULL != msg) &&                        /* Message shall exists */
         (VSCP_L1_DATA_SIZE >= msg->dataNum))    /* Number of data bytes is limited */
     {
-        /* Write all messages to loopback, except:
-         * - CLASS1.PROTOCOL: The core would interpret them.
-         * - CLASS1.LOG     : Make no sense.
-         */
-        if ((VSCP_CLASS_L1_PROTOCOL != msg->vscpClass) &&
-            (VSCP_CLASS_L1_LOG != msg->vscpClass))
-        {
-            (void)vscp_util_cyclicBufferWrite(&vscp_transport_loopBackCyclicBuffer, msg, 1);
-        }
+        vscp_transport_writeLoopBack(msg);
 
         status = vscp_tp_adapter_writeMessage(msg);
     }
@@ -218,10 +239,89 @@ extern BOOL vscp_transport_writeMessage(vscp_TxMessage const * const msg)
             ++vscp_txErrorCnt;
         }
     }
+    else if (255 > vscp_transport_txCnt)
+    {
+        ++vscp_transport_txCnt;
+    }
 
     return status;
 }
 
+/**
+ * This function writes several messages to the transport layer. The messages
+ * are written in order, until the first one is not accepted.
+ *
+ * @param[in]   msgs    Message array
+ * @param[in]   num     Number of messages
+ * @return  Number of accepted messages
+ */
+extern uint8_t  vscp_transport_writeMessages(vscp_TxMessage const * const msgs, uint8_t num)
+{
+    uint8_t accepted    = 0;
+
+    if (NULL == msgs)
+    {
+        return 0;
+    }
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_TP_ADAPTER_WRITE_MESSAGES )
+
+    {
+        uint8_t valid   = 0;
+        uint8_t index   = 0;
+
+        /* Only the messages in front of the first invalid one are written. */
+        while((num > valid) &&
+              (VSCP_L1_DATA_SIZE >= msgs[valid].dataNum))
+        {
+            ++valid;
+        }
+
+        if (0 < valid)
+        {
+            accepted = vscp_tp_adapter_writeMessages(msgs, valid);
+
+            if (valid < accepted)
+            {
+                accepted = valid;
+            }
+        }
+
+        for(index = 0; index < accepted; ++index)
+        {
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOOPBACK )
+            vscp_transport_writeLoopBack(&msgs[index]);
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOOPBACK ) */
+
+            if (255 > vscp_transport_txCnt)
+            {
+                ++vscp_transport_txCnt;
+            }
+        }
+
+        /* The first not accepted message is a transmit error, the rest
+         * was not tried.
+         */
+        if ((num > accepted) &&
+            (255 > vscp_txErrorCnt))
+        {
+            ++vscp_txErrorCnt;
+        }
+    }
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_TP_ADAPTER_WRITE_MESSAGES ) */
+
+    while((num > accepted) &&
+          (FALSE != vscp_transport_writeMessage(&msgs[accepted])))
+    {
+        ++accepted;
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_TP_ADAPTER_WRITE_MESSAGES ) */
+
+    return accepted;
+}
+
 /**
  * This function returns the number of transmit errors.
  * Note, that calling this function clears the transmit error counter.
@@ -237,6 +337,83 @@ extern uint8_t  vscp_transport_getTransmitErrors(void)
     return num;
 }
 
+/**
+ * This function returns the number of messages, received from the lower layer.
+ * The counter saturates at 255.
+ * Note, that calling this function clears the receive counter.
+ *
+ * @return Number of received messages
+ */
+extern uint8_t  vscp_transport_getReceivedMessages(void)
+{
+    uint8_t num = vscp_transport_rxCnt;
+
+    vscp_transport_rxCnt = 0;
+
+    return num;
+}
+
+/**
+ * This function returns the number of messages, which were successful sent.
+ * The counter saturates at 255.
+ * Note, that calling this function clears the transmit counter.
+ *
+ * @return Number of transmitted messages
+ */
+extern uint8_t  vscp_transport_getTransmittedMessages(void)
+{
+    uint8_t num = vscp_transport_txCnt;
+
+    vscp_transport_txCnt = 0;
+
+    return num;
+}
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CAN_FILTER )
+
+/**
+ * This function sets the CAN acceptance filters of the transport layer.
+ *
+ * @param[in]   filters Filter array
+ * @param[in]   num     Number of filters
+ */
+extern void vscp_transport_setFilters(vscp_can_filter_Filter const * const filters, uint8_t num)
+{
+    if ((NULL == filters) ||
+        (0 == num))
+    {
+        return;
+    }
+
+    vscp_tp_adapter_setFilters(filters, num);
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CAN_FILTER ) */
+
 /*******************************************************************************
     LOCAL FUNCTIONS
 *******************************************************************************/
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOOPBACK )
+
+/**
+ * This function writes a message to the loopback, except:
+ * - CLASS1.PROTOCOL: The core would interpret them.
+ * - CLASS1.LOG     : Make no sense.
+ *
+ * @param[in]   msg Message
+ */
+static void vscp_transport_writeLoopBack(vscp_TxMessage const * const msg)
+{
+    if ((VSCP_CLASS_L1_PROTOCOL != msg->vscpClass) &&
+        (VSCP_CLASS_L1_LOG != msg->vscpClass))
+    {
+        (void)vscp_util_cyclicBufferWrite(&vscp_transport_loopBackCyclicBuffer, msg, 1);
+    }
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOOPBACK ) */
@@ -69,6 +69,8 @@ This module handles the transport of the VSCP.
 *******************************************************************************/
 #include <stdint.h>
 #include "vscp_types.h"
+#include "vscp_config.h"
+#include "vscp_can_filter.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -124,6 +126,16 @@ extern BOOL vscp_transport_readMessage(vscp_RxMessage * const msg);
  */
 extern BOOL vscp_transport_writeMessage(vscp_TxMessage const * const msg);
 
+/**
+ * This function writes several messages to the transport layer. The messages
+ * are written in order, until the first one is not accepted.
+ *
+ * @param[in]   msgs    Message array
+ * @param[in]   num     Number of messages
+ * @return  Number of accepted messages
+ */
+extern uint8_t  vscp_transport_writeMessages(vscp_TxMessage const * const msgs, uint8_t num);
+
 /**
  * This function returns the number of transmit errors.
  * Note, that calling this function clears the transmit error counter.
@@ -132,6 +144,36 @@ extern BOOL vscp_transport_writeMessage(vscp_TxMessage const * const msg);
  */
 extern uint8_t  vscp_transport_getTransmitErrors(void);
 
+/**
+ * This function returns the number of messages, received from the lower layer.
+ * The counter saturates at 255.
+ * Note, that calling this function clears the receive counter.
+ *
+ * @return Number of received messages
+ */
+extern uint8_t  vscp_transport_getReceivedMessages(void);
+
+/**
+ * This function returns the number of messages, which were successful sent.
+ * The counter saturates at 255.
+ * Note, that calling this function clears the transmit counter.
+ *
+ * @return Number of transmitted messages
+ */
+extern uint8_t  vscp_transport_getTransmittedMessages(void);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CAN_FILTER )
+
+/**
+ * This function sets the CAN acceptance filters of the transport layer.
+ *
+ * @param[in]   filters Filter array
+ * @param[in]   num     Number of filters
+ */
+extern void vscp_transport_setFilters(vscp_can_filter_Filter const * const filters, uint8_t num);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CAN_FILTER ) */
+
 #ifdef __cplusplus
 }
 #endif